@@ -0,0 +1,49 @@
+#pragma once
+
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <vector>
+
+namespace Benchmark {
+/**
+ * @brief The distributions that integer benchmark data can be generated with.
+ */
+enum class IntegerDistribution {
+	Sorted,
+	FewInversions,
+	Random
+};
+
+/**
+ * @brief Generates integers with the given distribution using a fixed seed so that runs are comparable.
+ * @param size: The number of integers to generate.
+ * @param distribution: The distribution of the integers. FewInversions swaps roughly one pair in every thousand
+ * elements of an otherwise sorted sequence.
+ * @return A vector containing the generated integers.
+ */
+inline std::vector<int> makeIntegers(const std::size_t size, const IntegerDistribution distribution) {
+	std::vector<int> integers(size);
+	std::mt19937 generator {42};
+	
+	if (distribution == IntegerDistribution::Random) {
+		std::uniform_int_distribution<int> valueDistribution {};
+		std::generate(integers.begin(), integers.end(), [&generator, &valueDistribution]() {
+			return valueDistribution(generator);
+		});
+		
+		return integers;
+	}
+	
+	std::iota(integers.begin(), integers.end(), 0);
+	
+	if (distribution == IntegerDistribution::FewInversions && size > 1) {
+		std::uniform_int_distribution<std::size_t> indexDistribution {0, size - 1};
+		for (std::size_t swapCount {0}; swapCount < size / 1000 + 1; ++swapCount) {
+			std::swap(integers[indexDistribution(generator)], integers[indexDistribution(generator)]);
+		}
+	}
+	
+	return integers;
+}
+}
\ No newline at end of file
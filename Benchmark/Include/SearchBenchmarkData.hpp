@@ -0,0 +1,120 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+
+namespace Benchmark {
+/**
+ * @brief The number of queries generated for each search benchmark, which the benchmarks cycle through.
+ */
+inline constexpr std::size_t SEARCH_QUERY_COUNT {1 << 16};
+
+/**
+ * @brief Generates sorted, distinct even integers so that half of all queries miss.
+ * @param size: The number of integers to generate.
+ * @return A vector containing the generated integers in ascending order.
+ */
+inline std::vector<int> makeSortedIntegers(const std::size_t size) {
+	std::vector<int> integers(size);
+	for (std::size_t index {0}; index < size; ++index) {
+		integers[index] = static_cast<int>(2 * index);
+	}
+	
+	return integers;
+}
+
+/**
+ * @brief Generates uniformly random queries over the range of the integers made by makeSortedIntegers.
+ * @param size: The number of sorted integers that will be searched.
+ * @return A vector containing SEARCH_QUERY_COUNT queries.
+ */
+inline std::vector<int> makeSearchQueries(const std::size_t size) {
+	std::vector<int> queries(SEARCH_QUERY_COUNT);
+	std::mt19937 generator {42};
+	std::uniform_int_distribution<int> distribution {0, static_cast<int>(2 * size)};
+	std::generate(queries.begin(), queries.end(), [&generator, &distribution]() {
+		return distribution(generator);
+	});
+	
+	return queries;
+}
+
+/**
+ * @brief The distributions that sorted search keys can be generated with.
+ */
+enum class KeyDistribution {
+	Uniform,
+	Skewed,
+	Clustered
+};
+
+/**
+ * @brief Generates sorted keys with the given distribution using a fixed seed so that runs are comparable.
+ * @param size: The number of keys to generate.
+ * @param distribution: The distribution of the keys. Skewed keys are uniform values raised to the fourth power, so
+ * most keys are crowded near the bottom of the range. Clustered keys are packed tightly around 64 random centers.
+ * @return A vector containing the generated keys in ascending order.
+ */
+inline std::vector<int> makeDistributedSortedIntegers(const std::size_t size, const KeyDistribution distribution) {
+	constexpr auto maximumKey {static_cast<double>(1 << 30)};
+	std::vector<int> integers(size);
+	std::mt19937 generator {42};
+	std::uniform_real_distribution<double> unitDistribution {0.0, 1.0};
+	
+	if (distribution == KeyDistribution::Clustered) {
+		std::vector<double> centers(64);
+		std::generate(centers.begin(), centers.end(), [&generator, &unitDistribution, maximumKey]() {
+			return unitDistribution(generator) * maximumKey;
+		});
+		
+		std::uniform_int_distribution<std::size_t> centerDistribution {0, centers.size() - 1};
+		std::normal_distribution<double> offsetDistribution {0.0, maximumKey / 1e5};
+		std::generate(integers.begin(), integers.end(), [&]() {
+			const auto key {centers[centerDistribution(generator)] + offsetDistribution(generator)};
+			return static_cast<int>(std::clamp(key, 0.0, maximumKey));
+		});
+	} else {
+		const auto exponent {distribution == KeyDistribution::Skewed ? 4.0 : 1.0};
+		std::generate(integers.begin(), integers.end(), [&generator, &unitDistribution, exponent, maximumKey]() {
+			return static_cast<int>(std::pow(unitDistribution(generator), exponent) * maximumKey);
+		});
+	}
+	
+	std::sort(integers.begin(), integers.end());
+	return integers;
+}
+
+/**
+ * @brief Generates queries for the given keys, each of which is a random key or one more than it, so that roughly half
+ * of all queries miss but every query lies where the keys do.
+ * @param keys: The sorted keys that will be searched, which must not be empty.
+ * @return A vector containing SEARCH_QUERY_COUNT queries.
+ */
+inline std::vector<int> makeDistributedSearchQueries(const std::vector<int>& keys) {
+	std::vector<int> queries(SEARCH_QUERY_COUNT);
+	std::mt19937 generator {7};
+	std::uniform_int_distribution<std::size_t> indexDistribution {0, keys.size() - 1};
+	std::bernoulli_distribution missDistribution {0.5};
+	std::generate(queries.begin(), queries.end(), [&]() {
+		return keys[indexDistribution(generator)] + (missDistribution(generator) ? 1 : 0);
+	});
+	
+	return queries;
+}
+
+/**
+ * @brief Picks keys spread across the given keys, so that every lookup hits and consecutive lookups land far apart.
+ * @param keys: The keys that will be searched, which must not be empty.
+ * @return A vector containing SEARCH_QUERY_COUNT lookup keys.
+ */
+inline std::vector<int> makeLookupKeys(const std::vector<int>& keys) {
+	std::vector<int> lookupKeys(SEARCH_QUERY_COUNT);
+	for (std::size_t index {0}; index < SEARCH_QUERY_COUNT; ++index) {
+		lookupKeys[index] = keys[(index * 7919) % keys.size()];
+	}
+	
+	return lookupKeys;
+}
+}
\ No newline at end of file
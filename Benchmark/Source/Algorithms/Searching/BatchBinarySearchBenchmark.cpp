@@ -0,0 +1,57 @@
+#include <benchmark/benchmark.h>
+
+#include <span>
+
+#include "Algorithms/Searching/BinarySearcher.hpp"
+#include "SearchBenchmarkData.hpp"
+
+namespace Core::Algorithms::Searching::Benchmark {
+using ::Benchmark::makeSearchQueries;
+using ::Benchmark::makeSortedIntegers;
+using ::Benchmark::SEARCH_QUERY_COUNT;
+
+/**
+ * @brief The number of targets searched for in each benchmark iteration.
+ */
+constexpr std::size_t BATCH_SIZE {4096};
+
+template<std::size_t GroupSize>
+void batchLowerBound(benchmark::State& state) {
+	auto integers {makeSortedIntegers(static_cast<std::size_t>(state.range(0)))};
+	const auto queries {makeSearchQueries(integers.size())};
+	const auto binarySearcher {BinarySearcher<std::vector<int>> {integers}};
+	std::size_t batchBegin {0};
+	
+	for (auto _ : state) {
+		const std::span<const int> batch {queries.data() + batchBegin, BATCH_SIZE};
+		benchmark::DoNotOptimize(binarySearcher.batchLowerBound<GroupSize>(batch));
+		batchBegin = (batchBegin + BATCH_SIZE) % SEARCH_QUERY_COUNT;
+	}
+	
+	state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(BATCH_SIZE));
+}
+
+void sortedBatchLowerBound(benchmark::State& state) {
+	auto integers {makeSortedIntegers(static_cast<std::size_t>(state.range(0)))};
+	const auto queries {makeSearchQueries(integers.size())};
+	const auto binarySearcher {BinarySearcher<std::vector<int>> {integers}};
+	std::size_t batchBegin {0};
+	
+	for (auto _ : state) {
+		const std::span<const int> batch {queries.data() + batchBegin, BATCH_SIZE};
+		benchmark::DoNotOptimize(binarySearcher.sortedBatchLowerBound(batch));
+		batchBegin = (batchBegin + BATCH_SIZE) % SEARCH_QUERY_COUNT;
+	}
+	
+	state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(BATCH_SIZE));
+}
+
+BENCHMARK_TEMPLATE(batchLowerBound, 1)->RangeMultiplier(16)->Range(1 << 16, 1 << 28);
+BENCHMARK_TEMPLATE(batchLowerBound, 2)->RangeMultiplier(16)->Range(1 << 16, 1 << 28);
+BENCHMARK_TEMPLATE(batchLowerBound, 4)->RangeMultiplier(16)->Range(1 << 16, 1 << 28);
+BENCHMARK_TEMPLATE(batchLowerBound, 8)->RangeMultiplier(16)->Range(1 << 16, 1 << 28);
+BENCHMARK_TEMPLATE(batchLowerBound, 16)->RangeMultiplier(16)->Range(1 << 16, 1 << 28);
+BENCHMARK_TEMPLATE(batchLowerBound, 32)->RangeMultiplier(16)->Range(1 << 16, 1 << 28);
+BENCHMARK_TEMPLATE(batchLowerBound, 64)->RangeMultiplier(16)->Range(1 << 16, 1 << 28);
+BENCHMARK(sortedBatchLowerBound)->RangeMultiplier(16)->Range(1 << 16, 1 << 28);
+}
\ No newline at end of file
@@ -0,0 +1,58 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+
+#include "Algorithms/Searching/BinarySearcher.hpp"
+#include "Algorithms/Searching/BinarySearchPredicate.hpp"
+#include "SearchBenchmarkData.hpp"
+
+namespace Core::Algorithms::Searching::Benchmark {
+using ::Benchmark::makeSearchQueries;
+using ::Benchmark::makeSortedIntegers;
+using ::Benchmark::SEARCH_QUERY_COUNT;
+
+void searchWithPredicate(benchmark::State& state) {
+	auto integers {makeSortedIntegers(static_cast<std::size_t>(state.range(0)))};
+	const auto queries {makeSearchQueries(integers.size())};
+	const auto binarySearcher {BinarySearcher<std::vector<int>> {integers}};
+	std::size_t queryIndex {0};
+	
+	for (auto _ : state) {
+		const BinarySearchPredicate<int> predicate {queries[queryIndex++ % SEARCH_QUERY_COUNT]};
+		benchmark::DoNotOptimize(binarySearcher.search(predicate));
+	}
+	
+	state.SetItemsProcessed(state.iterations());
+}
+
+void branchlessLowerBound(benchmark::State& state) {
+	auto integers {makeSortedIntegers(static_cast<std::size_t>(state.range(0)))};
+	const auto queries {makeSearchQueries(integers.size())};
+	const auto binarySearcher {BinarySearcher<std::vector<int>> {integers}};
+	std::size_t queryIndex {0};
+	
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(binarySearcher.lowerBound(queries[queryIndex++ % SEARCH_QUERY_COUNT]));
+	}
+	
+	state.SetItemsProcessed(state.iterations());
+}
+
+void standardLowerBound(benchmark::State& state) {
+	const auto integers {makeSortedIntegers(static_cast<std::size_t>(state.range(0)))};
+	const auto queries {makeSearchQueries(integers.size())};
+	std::size_t queryIndex {0};
+	
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(std::lower_bound(integers.begin(),
+		                                          integers.end(),
+		                                          queries[queryIndex++ % SEARCH_QUERY_COUNT]));
+	}
+	
+	state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(searchWithPredicate)->RangeMultiplier(4)->Range(1 << 13, 1 << 28);
+BENCHMARK(branchlessLowerBound)->RangeMultiplier(4)->Range(1 << 13, 1 << 28);
+BENCHMARK(standardLowerBound)->RangeMultiplier(4)->Range(1 << 13, 1 << 28);
+}
\ No newline at end of file
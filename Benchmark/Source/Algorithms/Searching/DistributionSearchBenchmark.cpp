@@ -0,0 +1,88 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+
+#include "Algorithms/Searching/BinarySearcher.hpp"
+#include "Algorithms/Searching/ExponentialSearcher.hpp"
+#include "Algorithms/Searching/InterpolationSearcher.hpp"
+#include "SearchBenchmarkData.hpp"
+
+namespace Core::Algorithms::Searching::Benchmark {
+using ::Benchmark::KeyDistribution;
+using ::Benchmark::makeDistributedSearchQueries;
+using ::Benchmark::makeDistributedSortedIntegers;
+using ::Benchmark::SEARCH_QUERY_COUNT;
+
+template<KeyDistribution Distribution>
+void binaryLowerBound(benchmark::State& state) {
+	auto keys {makeDistributedSortedIntegers(static_cast<std::size_t>(state.range(0)), Distribution)};
+	const auto queries {makeDistributedSearchQueries(keys)};
+	const auto binarySearcher {BinarySearcher<std::vector<int>> {keys}};
+	std::size_t queryIndex {0};
+	
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(binarySearcher.lowerBound(queries[queryIndex++ % SEARCH_QUERY_COUNT]));
+	}
+	
+	state.SetItemsProcessed(state.iterations());
+}
+
+template<KeyDistribution Distribution>
+void interpolationLowerBound(benchmark::State& state) {
+	auto keys {makeDistributedSortedIntegers(static_cast<std::size_t>(state.range(0)), Distribution)};
+	const auto queries {makeDistributedSearchQueries(keys)};
+	const auto interpolationSearcher {InterpolationSearcher<std::vector<int>> {keys}};
+	std::size_t queryIndex {0};
+	
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(interpolationSearcher.lowerBound(queries[queryIndex++ % SEARCH_QUERY_COUNT]));
+	}
+	
+	state.SetItemsProcessed(state.iterations());
+}
+
+template<KeyDistribution Distribution>
+void binaryLowerBoundOfSortedQueries(benchmark::State& state) {
+	auto keys {makeDistributedSortedIntegers(static_cast<std::size_t>(state.range(0)), Distribution)};
+	auto queries {makeDistributedSearchQueries(keys)};
+	std::sort(queries.begin(), queries.end());
+	const auto binarySearcher {BinarySearcher<std::vector<int>> {keys}};
+	std::size_t queryIndex {0};
+	
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(binarySearcher.lowerBound(queries[queryIndex++ % SEARCH_QUERY_COUNT]));
+	}
+	
+	state.SetItemsProcessed(state.iterations());
+}
+
+template<KeyDistribution Distribution>
+void hintedLowerBoundOfSortedQueries(benchmark::State& state) {
+	auto keys {makeDistributedSortedIntegers(static_cast<std::size_t>(state.range(0)), Distribution)};
+	auto queries {makeDistributedSearchQueries(keys)};
+	std::sort(queries.begin(), queries.end());
+	const auto exponentialSearcher {ExponentialSearcher<std::vector<int>> {keys}};
+	std::size_t queryIndex {0};
+	std::size_t previousResult {0};
+	
+	for (auto _ : state) {
+		previousResult = exponentialSearcher.hintedLowerBound(queries[queryIndex++ % SEARCH_QUERY_COUNT], previousResult);
+		benchmark::DoNotOptimize(previousResult);
+	}
+	
+	state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK_TEMPLATE(binaryLowerBound, KeyDistribution::Uniform)->RangeMultiplier(16)->Range(1 << 12, 1 << 24);
+BENCHMARK_TEMPLATE(binaryLowerBound, KeyDistribution::Skewed)->RangeMultiplier(16)->Range(1 << 12, 1 << 24);
+BENCHMARK_TEMPLATE(binaryLowerBound, KeyDistribution::Clustered)->RangeMultiplier(16)->Range(1 << 12, 1 << 24);
+BENCHMARK_TEMPLATE(interpolationLowerBound, KeyDistribution::Uniform)->RangeMultiplier(16)->Range(1 << 12, 1 << 24);
+BENCHMARK_TEMPLATE(interpolationLowerBound, KeyDistribution::Skewed)->RangeMultiplier(16)->Range(1 << 12, 1 << 24);
+BENCHMARK_TEMPLATE(interpolationLowerBound, KeyDistribution::Clustered)->RangeMultiplier(16)->Range(1 << 12, 1 << 24);
+BENCHMARK_TEMPLATE(binaryLowerBoundOfSortedQueries, KeyDistribution::Uniform)->RangeMultiplier(16)->Range(1 << 12, 1 << 24);
+BENCHMARK_TEMPLATE(binaryLowerBoundOfSortedQueries, KeyDistribution::Skewed)->RangeMultiplier(16)->Range(1 << 12, 1 << 24);
+BENCHMARK_TEMPLATE(binaryLowerBoundOfSortedQueries, KeyDistribution::Clustered)->RangeMultiplier(16)->Range(1 << 12, 1 << 24);
+BENCHMARK_TEMPLATE(hintedLowerBoundOfSortedQueries, KeyDistribution::Uniform)->RangeMultiplier(16)->Range(1 << 12, 1 << 24);
+BENCHMARK_TEMPLATE(hintedLowerBoundOfSortedQueries, KeyDistribution::Skewed)->RangeMultiplier(16)->Range(1 << 12, 1 << 24);
+BENCHMARK_TEMPLATE(hintedLowerBoundOfSortedQueries, KeyDistribution::Clustered)->RangeMultiplier(16)->Range(1 << 12, 1 << 24);
+}
\ No newline at end of file
@@ -0,0 +1,40 @@
+#include <benchmark/benchmark.h>
+
+#include "Algorithms/Searching/BinarySearcher.hpp"
+#include "Algorithms/Searching/EytzingerArray.hpp"
+#include "SearchBenchmarkData.hpp"
+
+namespace Core::Algorithms::Searching::Benchmark {
+using ::Benchmark::makeSearchQueries;
+using ::Benchmark::makeSortedIntegers;
+using ::Benchmark::SEARCH_QUERY_COUNT;
+
+void eytzingerLowerBound(benchmark::State& state) {
+	const auto integers {makeSortedIntegers(static_cast<std::size_t>(state.range(0)))};
+	const auto queries {makeSearchQueries(integers.size())};
+	const EytzingerArray<int> eytzingerArray {integers};
+	std::size_t queryIndex {0};
+	
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(eytzingerArray.lowerBound(queries[queryIndex++ % SEARCH_QUERY_COUNT]));
+	}
+	
+	state.SetItemsProcessed(state.iterations());
+}
+
+void sortedArrayLowerBound(benchmark::State& state) {
+	auto integers {makeSortedIntegers(static_cast<std::size_t>(state.range(0)))};
+	const auto queries {makeSearchQueries(integers.size())};
+	const auto binarySearcher {BinarySearcher<std::vector<int>> {integers}};
+	std::size_t queryIndex {0};
+	
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(binarySearcher.lowerBound(queries[queryIndex++ % SEARCH_QUERY_COUNT]));
+	}
+	
+	state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(eytzingerLowerBound)->RangeMultiplier(4)->Range(1 << 13, 1 << 28);
+BENCHMARK(sortedArrayLowerBound)->RangeMultiplier(4)->Range(1 << 13, 1 << 28);
+}
\ No newline at end of file
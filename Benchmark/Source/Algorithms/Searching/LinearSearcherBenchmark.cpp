@@ -0,0 +1,78 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+
+#include "Algorithms/Searching/LinearSearcher.hpp"
+#include "SearchBenchmarkData.hpp"
+
+namespace Core::Algorithms::Searching::Benchmark {
+using ::Benchmark::makeSortedIntegers;
+
+void linearSearchWithPredicate(benchmark::State& state) {
+	auto integers {makeSortedIntegers(static_cast<std::size_t>(state.range(0)))};
+	const auto linearSearcher {LinearSearcher<std::vector<int>> {integers}};
+	
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(linearSearcher.search([](const int& element) {
+			return element == -1;
+		}));
+	}
+	
+	state.SetBytesProcessed(state.iterations() * state.range(0) * static_cast<std::int64_t>(sizeof(int)));
+}
+
+template<bool IsVectorized>
+void linearFind(benchmark::State& state) {
+	auto integers {makeSortedIntegers(static_cast<std::size_t>(state.range(0)))};
+	const auto linearSearcher {LinearSearcher<std::vector<int>, IsVectorized> {integers}};
+	
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(linearSearcher.find(-1));
+	}
+	
+	state.SetBytesProcessed(state.iterations() * state.range(0) * static_cast<std::int64_t>(sizeof(int)));
+}
+
+template<bool IsVectorized>
+void linearCount(benchmark::State& state) {
+	auto integers {makeSortedIntegers(static_cast<std::size_t>(state.range(0)))};
+	const auto linearSearcher {LinearSearcher<std::vector<int>, IsVectorized> {integers}};
+	
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(linearSearcher.count(-1));
+	}
+	
+	state.SetBytesProcessed(state.iterations() * state.range(0) * static_cast<std::int64_t>(sizeof(int)));
+}
+
+template<bool IsVectorized>
+void linearParallelFind(benchmark::State& state) {
+	auto integers {makeSortedIntegers(static_cast<std::size_t>(state.range(0)))};
+	const auto linearSearcher {LinearSearcher<std::vector<int>, IsVectorized> {integers}};
+	
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(linearSearcher.parallelFind(-1));
+	}
+	
+	state.SetBytesProcessed(state.iterations() * state.range(0) * static_cast<std::int64_t>(sizeof(int)));
+}
+
+void standardFind(benchmark::State& state) {
+	const auto integers {makeSortedIntegers(static_cast<std::size_t>(state.range(0)))};
+	
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(std::find(integers.begin(), integers.end(), -1));
+	}
+	
+	state.SetBytesProcessed(state.iterations() * state.range(0) * static_cast<std::int64_t>(sizeof(int)));
+}
+
+BENCHMARK(linearSearchWithPredicate)->RangeMultiplier(16)->Range(1 << 10, 1 << 26);
+BENCHMARK_TEMPLATE(linearFind, true)->RangeMultiplier(16)->Range(1 << 10, 1 << 26);
+BENCHMARK_TEMPLATE(linearFind, false)->RangeMultiplier(16)->Range(1 << 10, 1 << 26);
+BENCHMARK_TEMPLATE(linearCount, true)->RangeMultiplier(16)->Range(1 << 10, 1 << 26);
+BENCHMARK_TEMPLATE(linearCount, false)->RangeMultiplier(16)->Range(1 << 10, 1 << 26);
+BENCHMARK_TEMPLATE(linearParallelFind, true)->RangeMultiplier(16)->Range(1 << 10, 1 << 26);
+BENCHMARK_TEMPLATE(linearParallelFind, false)->RangeMultiplier(16)->Range(1 << 10, 1 << 26);
+BENCHMARK(standardFind)->RangeMultiplier(16)->Range(1 << 10, 1 << 26);
+}
\ No newline at end of file
@@ -0,0 +1,69 @@
+#include <benchmark/benchmark.h>
+
+#include "Algorithms/Searching/BinarySearcher.hpp"
+#include "Algorithms/Searching/PiecewiseLinearIndex.hpp"
+#include "SearchBenchmarkData.hpp"
+
+namespace Core::Algorithms::Searching::Benchmark {
+using ::Benchmark::KeyDistribution;
+using ::Benchmark::makeDistributedSearchQueries;
+using ::Benchmark::makeDistributedSortedIntegers;
+using ::Benchmark::SEARCH_QUERY_COUNT;
+
+template<KeyDistribution Distribution>
+void buildPiecewiseLinearIndex(benchmark::State& state) {
+	auto keys {makeDistributedSortedIntegers(static_cast<std::size_t>(state.range(0)), Distribution)};
+	const auto epsilon {static_cast<std::size_t>(state.range(1))};
+	std::size_t segmentCount {0};
+	std::size_t modelSize {0};
+	
+	for (auto _ : state) {
+		const PiecewiseLinearIndex<std::vector<int>> piecewiseLinearIndex {keys, epsilon};
+		segmentCount = piecewiseLinearIndex.getSegmentCount();
+		modelSize = piecewiseLinearIndex.getModelSize();
+		benchmark::DoNotOptimize(segmentCount);
+	}
+	
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+	state.counters["segments"] = static_cast<double>(segmentCount);
+	state.counters["modelBytes"] = static_cast<double>(modelSize);
+}
+
+template<KeyDistribution Distribution>
+void piecewiseLinearIndexLowerBound(benchmark::State& state) {
+	auto keys {makeDistributedSortedIntegers(static_cast<std::size_t>(state.range(0)), Distribution)};
+	const auto queries {makeDistributedSearchQueries(keys)};
+	const PiecewiseLinearIndex<std::vector<int>> piecewiseLinearIndex {keys, static_cast<std::size_t>(state.range(1))};
+	std::size_t queryIndex {0};
+	
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(piecewiseLinearIndex.lowerBound(queries[queryIndex++ % SEARCH_QUERY_COUNT]));
+	}
+	
+	state.SetItemsProcessed(state.iterations());
+	state.counters["modelBytes"] = static_cast<double>(piecewiseLinearIndex.getModelSize());
+}
+
+template<KeyDistribution Distribution>
+void binarySearcherLowerBound(benchmark::State& state) {
+	auto keys {makeDistributedSortedIntegers(static_cast<std::size_t>(state.range(0)), Distribution)};
+	const auto queries {makeDistributedSearchQueries(keys)};
+	const auto binarySearcher {BinarySearcher<std::vector<int>> {keys}};
+	std::size_t queryIndex {0};
+	
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(binarySearcher.lowerBound(queries[queryIndex++ % SEARCH_QUERY_COUNT]));
+	}
+	
+	state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK_TEMPLATE(buildPiecewiseLinearIndex, KeyDistribution::Uniform)->ArgsProduct({{1 << 16, 1 << 20, 1 << 24}, {16, 64, 256}});
+BENCHMARK_TEMPLATE(buildPiecewiseLinearIndex, KeyDistribution::Clustered)->ArgsProduct({{1 << 16, 1 << 20, 1 << 24}, {16, 64, 256}});
+BENCHMARK_TEMPLATE(piecewiseLinearIndexLowerBound, KeyDistribution::Uniform)->ArgsProduct({{1 << 16, 1 << 20, 1 << 24}, {16, 64, 256}});
+BENCHMARK_TEMPLATE(piecewiseLinearIndexLowerBound, KeyDistribution::Skewed)->ArgsProduct({{1 << 16, 1 << 20, 1 << 24}, {16, 64, 256}});
+BENCHMARK_TEMPLATE(piecewiseLinearIndexLowerBound, KeyDistribution::Clustered)->ArgsProduct({{1 << 16, 1 << 20, 1 << 24}, {16, 64, 256}});
+BENCHMARK_TEMPLATE(binarySearcherLowerBound, KeyDistribution::Uniform)->RangeMultiplier(16)->Range(1 << 16, 1 << 24);
+BENCHMARK_TEMPLATE(binarySearcherLowerBound, KeyDistribution::Skewed)->RangeMultiplier(16)->Range(1 << 16, 1 << 24);
+BENCHMARK_TEMPLATE(binarySearcherLowerBound, KeyDistribution::Clustered)->RangeMultiplier(16)->Range(1 << 16, 1 << 24);
+}
\ No newline at end of file
@@ -0,0 +1,64 @@
+#include <benchmark/benchmark.h>
+
+#include <functional>
+
+#include "Algorithms/Searching/BinarySearcher.hpp"
+#include "Algorithms/Searching/StaticBPlusTree.hpp"
+#include "SearchBenchmarkData.hpp"
+
+namespace Core::Algorithms::Searching::Benchmark {
+using ::Benchmark::makeSearchQueries;
+using ::Benchmark::makeSortedIntegers;
+using ::Benchmark::SEARCH_QUERY_COUNT;
+
+template<typename Tree>
+void staticBPlusTreeLowerBound(benchmark::State& state) {
+	const auto integers {makeSortedIntegers(static_cast<std::size_t>(state.range(0)))};
+	const auto queries {makeSearchQueries(integers.size())};
+	const Tree staticBPlusTree {integers};
+	std::size_t queryIndex {0};
+	
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(staticBPlusTree.lowerBound(queries[queryIndex++ % SEARCH_QUERY_COUNT]));
+	}
+	
+	state.SetItemsProcessed(state.iterations());
+}
+
+template<typename Tree>
+void staticBPlusTreeCountInRange(benchmark::State& state) {
+	const auto integers {makeSortedIntegers(static_cast<std::size_t>(state.range(0)))};
+	const auto queries {makeSearchQueries(integers.size())};
+	const Tree staticBPlusTree {integers};
+	std::size_t queryIndex {0};
+	
+	for (auto _ : state) {
+		const auto lower {queries[queryIndex++ % SEARCH_QUERY_COUNT]};
+		benchmark::DoNotOptimize(staticBPlusTree.countInRange(lower, lower + 1000));
+	}
+	
+	state.SetItemsProcessed(state.iterations());
+}
+
+void binarySearcherCountInRange(benchmark::State& state) {
+	auto integers {makeSortedIntegers(static_cast<std::size_t>(state.range(0)))};
+	const auto queries {makeSearchQueries(integers.size())};
+	const auto binarySearcher {BinarySearcher<std::vector<int>> {integers}};
+	std::size_t queryIndex {0};
+	
+	for (auto _ : state) {
+		const auto lower {queries[queryIndex++ % SEARCH_QUERY_COUNT]};
+		benchmark::DoNotOptimize(binarySearcher.lowerBound(lower + 1001) - binarySearcher.lowerBound(lower));
+	}
+	
+	state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK_TEMPLATE(staticBPlusTreeLowerBound, StaticBPlusTree<int>)->RangeMultiplier(4)->Range(1 << 13, 1 << 28);
+BENCHMARK_TEMPLATE(staticBPlusTreeLowerBound, StaticBPlusTree<int, std::less<int>, false>)
+		->RangeMultiplier(4)->Range(1 << 13, 1 << 28);
+BENCHMARK_TEMPLATE(staticBPlusTreeCountInRange, StaticBPlusTree<int>)->RangeMultiplier(4)->Range(1 << 13, 1 << 28);
+BENCHMARK_TEMPLATE(staticBPlusTreeCountInRange, StaticBPlusTree<int, std::less<int>, false>)
+		->RangeMultiplier(4)->Range(1 << 13, 1 << 28);
+BENCHMARK(binarySearcherCountInRange)->RangeMultiplier(4)->Range(1 << 13, 1 << 28);
+}
\ No newline at end of file
@@ -0,0 +1,44 @@
+#include <benchmark/benchmark.h>
+
+#include <filesystem>
+#include <fstream>
+
+#include "Algorithms/Sorting/ExternalMergeSorter.hpp"
+#include "IntegerBenchmarkData.hpp"
+
+namespace Core::Algorithms::Sorting::Benchmark {
+using ::Benchmark::IntegerDistribution;
+using ::Benchmark::makeIntegers;
+
+template<IntegerDistribution Distribution>
+void externalSortIntegers(benchmark::State& state) {
+	const auto directory {std::filesystem::temp_directory_path() / "ExternalMergeSorterBenchmark"};
+	std::filesystem::create_directories(directory);
+	const auto inputPath {directory / "input.bin"};
+	const auto outputPath {directory / "output.bin"};
+	
+	{
+		const auto integers {makeIntegers(static_cast<std::size_t>(state.range(0)), Distribution)};
+		std::ofstream stream {inputPath, std::ios::binary | std::ios::trunc};
+		stream.write(reinterpret_cast<const char*>(integers.data()),
+		             static_cast<std::streamsize>(integers.size() * sizeof(int)));
+	}
+	
+	auto sorter {ExternalMergeSorter<int> {static_cast<std::size_t>(state.range(1)), directory}};
+	for (auto _ : state) {
+		if (!sorter.sort(inputPath, outputPath, std::less<int> {})) {
+			state.SkipWithError("The external merge sort failed.");
+			break;
+		}
+	}
+	
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+	state.SetBytesProcessed(state.iterations() * state.range(0) * static_cast<std::int64_t>(sizeof(int)));
+	std::filesystem::remove_all(directory);
+}
+
+BENCHMARK_TEMPLATE(externalSortIntegers, IntegerDistribution::Random)
+		->ArgsProduct({{1 << 20, 1 << 22, 1 << 24}, {1 << 20, 1 << 24}})->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(externalSortIntegers, IntegerDistribution::FewInversions)
+		->ArgsProduct({{1 << 20, 1 << 22, 1 << 24}, {1 << 20, 1 << 24}})->Unit(benchmark::kMillisecond);
+}
\ No newline at end of file
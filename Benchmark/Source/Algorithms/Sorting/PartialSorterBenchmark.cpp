@@ -0,0 +1,81 @@
+#include <benchmark/benchmark.h>
+
+#include "Algorithms/Sorting/NthElementSelector.hpp"
+#include "Algorithms/Sorting/PartialSorter.hpp"
+#include "Algorithms/Sorting/QuickSorter.hpp"
+#include "Algorithms/Sorting/TopK.hpp"
+#include "IntegerBenchmarkData.hpp"
+
+namespace Core::Algorithms::Sorting::Benchmark {
+using ::Benchmark::IntegerDistribution;
+using ::Benchmark::makeIntegers;
+
+static constexpr std::size_t ELEMENT_COUNT {10000000};
+
+void partialSortIntegers(benchmark::State& state) {
+	const auto data {makeIntegers(ELEMENT_COUNT, IntegerDistribution::Random)};
+	
+	for (auto _ : state) {
+		state.PauseTiming();
+		auto integers {data};
+		state.ResumeTiming();
+		
+		auto sorter {PartialSorter<std::vector<int>> {integers, static_cast<std::size_t>(state.range(0))}};
+		sorter.sort(std::less<int> {});
+		benchmark::DoNotOptimize(integers.data());
+	}
+	
+	state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(ELEMENT_COUNT));
+}
+
+void selectNthInteger(benchmark::State& state) {
+	const auto data {makeIntegers(ELEMENT_COUNT, IntegerDistribution::Random)};
+	
+	for (auto _ : state) {
+		state.PauseTiming();
+		auto integers {data};
+		state.ResumeTiming();
+		
+		auto selector {NthElementSelector<std::vector<int>> {integers}};
+		benchmark::DoNotOptimize(selector.select(static_cast<std::size_t>(state.range(0)) - 1, std::less<int> {}));
+	}
+	
+	state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(ELEMENT_COUNT));
+}
+
+void accumulateTopKIntegers(benchmark::State& state) {
+	const auto data {makeIntegers(ELEMENT_COUNT, IntegerDistribution::Random)};
+	
+	for (auto _ : state) {
+		TopK<int> topK {static_cast<std::size_t>(state.range(0)), std::less<int> {}};
+		for (const auto integer : data) {
+			topK.push(integer);
+		}
+		
+		benchmark::DoNotOptimize(topK.getSortedElements());
+	}
+	
+	state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(ELEMENT_COUNT));
+}
+
+void fullSortIntegers(benchmark::State& state) {
+	const auto data {makeIntegers(ELEMENT_COUNT, IntegerDistribution::Random)};
+	
+	for (auto _ : state) {
+		state.PauseTiming();
+		auto integers {data};
+		state.ResumeTiming();
+		
+		auto sorter {QuickSorter<std::vector<int>> {integers}};
+		sorter.sort(std::less<int> {});
+		benchmark::DoNotOptimize(integers.data());
+	}
+	
+	state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(ELEMENT_COUNT));
+}
+
+BENCHMARK(partialSortIntegers)->Arg(10)->Arg(1000)->Unit(benchmark::kMillisecond);
+BENCHMARK(selectNthInteger)->Arg(10)->Arg(1000)->Unit(benchmark::kMillisecond);
+BENCHMARK(accumulateTopKIntegers)->Arg(10)->Arg(1000)->Unit(benchmark::kMillisecond);
+BENCHMARK(fullSortIntegers)->Unit(benchmark::kMillisecond);
+}
\ No newline at end of file
@@ -0,0 +1,63 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+
+#include "Algorithms/Sorting/MergeSorter.hpp"
+#include "Algorithms/Sorting/TimSorter.hpp"
+#include "IntegerBenchmarkData.hpp"
+
+namespace Core::Algorithms::Sorting::Benchmark {
+using ::Benchmark::IntegerDistribution;
+using ::Benchmark::makeIntegers;
+
+template<typename Sorter, IntegerDistribution Distribution>
+void sortIntegers(benchmark::State& state) {
+	const auto data {makeIntegers(static_cast<std::size_t>(state.range(0)), Distribution)};
+	
+	for (auto _ : state) {
+		state.PauseTiming();
+		auto integers {data};
+		state.ResumeTiming();
+		
+		auto sorter {Sorter {integers}};
+		sorter.sort(std::less<int> {});
+		benchmark::DoNotOptimize(integers.data());
+	}
+	
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template<IntegerDistribution Distribution>
+void stableSortIntegers(benchmark::State& state) {
+	const auto data {makeIntegers(static_cast<std::size_t>(state.range(0)), Distribution)};
+	
+	for (auto _ : state) {
+		state.PauseTiming();
+		auto integers {data};
+		state.ResumeTiming();
+		
+		std::stable_sort(integers.begin(), integers.end());
+		benchmark::DoNotOptimize(integers.data());
+	}
+	
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK_TEMPLATE(sortIntegers, TimSorter<std::vector<int>>, IntegerDistribution::Sorted)
+		->RangeMultiplier(16)->Range(1 << 10, 1 << 22);
+BENCHMARK_TEMPLATE(sortIntegers, TimSorter<std::vector<int>>, IntegerDistribution::FewInversions)
+		->RangeMultiplier(16)->Range(1 << 10, 1 << 22);
+BENCHMARK_TEMPLATE(sortIntegers, TimSorter<std::vector<int>>, IntegerDistribution::Random)
+		->RangeMultiplier(16)->Range(1 << 10, 1 << 22);
+
+BENCHMARK_TEMPLATE(sortIntegers, MergeSorter<std::vector<int>>, IntegerDistribution::Sorted)
+		->RangeMultiplier(16)->Range(1 << 10, 1 << 22);
+BENCHMARK_TEMPLATE(sortIntegers, MergeSorter<std::vector<int>>, IntegerDistribution::FewInversions)
+		->RangeMultiplier(16)->Range(1 << 10, 1 << 22);
+BENCHMARK_TEMPLATE(sortIntegers, MergeSorter<std::vector<int>>, IntegerDistribution::Random)
+		->RangeMultiplier(16)->Range(1 << 10, 1 << 22);
+
+BENCHMARK_TEMPLATE(stableSortIntegers, IntegerDistribution::Sorted)->RangeMultiplier(16)->Range(1 << 10, 1 << 22);
+BENCHMARK_TEMPLATE(stableSortIntegers, IntegerDistribution::FewInversions)->RangeMultiplier(16)->Range(1 << 10, 1 << 22);
+BENCHMARK_TEMPLATE(stableSortIntegers, IntegerDistribution::Random)->RangeMultiplier(16)->Range(1 << 10, 1 << 22);
+}
\ No newline at end of file
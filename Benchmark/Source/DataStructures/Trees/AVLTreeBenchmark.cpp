@@ -0,0 +1,108 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <thread>
+
+#include "DataStructures/Trees/AVLTree.hpp"
+#include "DataStructures/Trees/BinarySearchTree.hpp"
+#include "IntegerBenchmarkData.hpp"
+
+namespace Core::DataStructures::Trees::Benchmark {
+using ::Benchmark::IntegerDistribution;
+using ::Benchmark::makeIntegers;
+
+void avlTreeAscendingInsertRemoveAll(benchmark::State& state) {
+	const auto elementCount {static_cast<int>(state.range(0))};
+	
+	for (auto _ : state) {
+		AVLTree<int> avlTree {};
+		for (auto element {0}; element < elementCount; ++element) {
+			avlTree.insert(element);
+		}
+		
+		benchmark::DoNotOptimize(avlTree.removeAll());
+	}
+	
+	state.SetItemsProcessed(state.iterations() * elementCount);
+}
+
+void avlTreeAscendingInsertRemoveMinimum(benchmark::State& state) {
+	const auto elementCount {static_cast<int>(state.range(0))};
+	
+	for (auto _ : state) {
+		AVLTree<int> avlTree {};
+		for (auto element {0}; element < elementCount; ++element) {
+			avlTree.insert(element);
+		}
+		
+		while (!avlTree.isEmpty()) {
+			benchmark::DoNotOptimize(avlTree.removeMinimum());
+		}
+	}
+	
+	state.SetItemsProcessed(state.iterations() * elementCount * 2);
+}
+
+void avlTreeBuildFromSorted(benchmark::State& state) {
+	auto sortedKeys {makeIntegers(static_cast<std::size_t>(state.range(0)), IntegerDistribution::Random)};
+	std::ranges::sort(sortedKeys);
+	
+	for (auto _ : state) {
+		const AVLTree<int> avlTree {sortedKeys};
+		benchmark::DoNotOptimize(avlTree);
+	}
+	
+	state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(sortedKeys.size()));
+	state.counters["BytesPerElement"] = static_cast<double>(sizeof(ParentLinkedBinaryTreeNode<int>));
+}
+
+void avlTreeBuildFromSortedInParallel(benchmark::State& state) {
+	auto sortedKeys {makeIntegers(static_cast<std::size_t>(state.range(0)), IntegerDistribution::Random)};
+	std::ranges::sort(sortedKeys);
+	
+	for (auto _ : state) {
+		const AVLTree<int> avlTree {sortedKeys, std::thread::hardware_concurrency()};
+		benchmark::DoNotOptimize(avlTree);
+	}
+	
+	state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(sortedKeys.size()));
+	state.counters["BytesPerElement"] = static_cast<double>(sizeof(ParentLinkedBinaryTreeNode<int>));
+}
+
+void avlTreeCopy(benchmark::State& state) {
+	AVLTree<int> avlTree {};
+	for (const auto key: makeIntegers(static_cast<std::size_t>(state.range(0)), IntegerDistribution::Random)) {
+		avlTree.insert(key);
+	}
+	
+	for (auto _ : state) {
+		const auto copiedAVLTree {avlTree};
+		benchmark::DoNotOptimize(copiedAVLTree);
+	}
+	
+	state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(avlTree.getNodeCount()));
+}
+
+void binarySearchTreeDegenerateCopy(benchmark::State& state) {
+	const auto elementCount {static_cast<int>(state.range(0))};
+	BinarySearchTree<int> binarySearchTree {};
+	for (auto element {0}; element < elementCount; ++element) {
+		binarySearchTree.insert(element);
+	}
+	
+	for (auto _ : state) {
+		BinarySearchTree<int> copiedBinarySearchTree {binarySearchTree};
+		benchmark::DoNotOptimize(copiedBinarySearchTree.removeAll());
+	}
+	
+	state.SetItemsProcessed(state.iterations() * elementCount);
+	state.counters["Height"] = static_cast<double>(binarySearchTree.getHeight());
+}
+
+BENCHMARK(avlTreeAscendingInsertRemoveAll)->RangeMultiplier(8)->Range(1 << 10, 1 << 22);
+BENCHMARK(avlTreeAscendingInsertRemoveMinimum)->RangeMultiplier(8)->Range(1 << 10, 1 << 22);
+BENCHMARK(avlTreeBuildFromSorted)->RangeMultiplier(8)->Range(1 << 10, 1 << 22);
+BENCHMARK(avlTreeBuildFromSortedInParallel)->RangeMultiplier(8)->Range(1 << 10, 1 << 22);
+BENCHMARK(avlTreeCopy)->RangeMultiplier(8)->Range(1 << 10, 1 << 22);
+BENCHMARK(binarySearchTreeDegenerateCopy)->RangeMultiplier(4)->Range(1 << 10, 1 << 16);
+}
\ No newline at end of file
@@ -0,0 +1,52 @@
+#include <benchmark/benchmark.h>
+
+#include "DataStructures/Trees/ArenaAVLTree.hpp"
+#include "IntegerBenchmarkData.hpp"
+#include "SearchBenchmarkData.hpp"
+
+namespace Core::DataStructures::Trees::Benchmark {
+using ::Benchmark::IntegerDistribution;
+using ::Benchmark::makeIntegers;
+using ::Benchmark::makeLookupKeys;
+using ::Benchmark::SEARCH_QUERY_COUNT;
+
+void arenaAVLTreeInsert(benchmark::State& state) {
+	const auto keys {makeIntegers(static_cast<std::size_t>(state.range(0)), IntegerDistribution::Random)};
+	std::size_t memoryUsage {0};
+	
+	for (auto _ : state) {
+		ArenaAVLTree<int> arenaAVLTree {};
+		for (const auto key: keys) {
+			arenaAVLTree.insert(key);
+		}
+		
+		memoryUsage = arenaAVLTree.getMemoryUsage();
+		benchmark::DoNotOptimize(arenaAVLTree);
+	}
+	
+	state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(keys.size()));
+	state.counters["BytesPerElement"] = static_cast<double>(memoryUsage) / static_cast<double>(keys.size());
+}
+
+void arenaAVLTreeFind(benchmark::State& state) {
+	const auto keys {makeIntegers(static_cast<std::size_t>(state.range(0)), IntegerDistribution::Random)};
+	const auto lookupKeys {makeLookupKeys(keys)};
+	ArenaAVLTree<int> arenaAVLTree {};
+	for (const auto key: keys) {
+		arenaAVLTree.insert(key);
+	}
+	
+	arenaAVLTree.compact();
+	
+	std::size_t lookupIndex {0};
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(arenaAVLTree.findFirst(lookupKeys[lookupIndex++ % SEARCH_QUERY_COUNT]));
+	}
+	
+	state.SetItemsProcessed(state.iterations());
+	state.counters["BytesPerElement"] = static_cast<double>(arenaAVLTree.getMemoryUsage()) / static_cast<double>(keys.size());
+}
+
+BENCHMARK(arenaAVLTreeInsert)->RangeMultiplier(8)->Range(1 << 10, 1 << 22);
+BENCHMARK(arenaAVLTreeFind)->RangeMultiplier(8)->Range(1 << 10, 1 << 22);
+}
\ No newline at end of file
@@ -0,0 +1,189 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+#include "DataStructures/Trees/AVLTree.hpp"
+#include "DataStructures/Trees/BTree.hpp"
+#include "DataStructures/Trees/BinarySearchTree.hpp"
+#include "IntegerBenchmarkData.hpp"
+#include "SearchBenchmarkData.hpp"
+
+namespace Core::DataStructures::Trees::Benchmark {
+using ::Benchmark::IntegerDistribution;
+using ::Benchmark::makeIntegers;
+using ::Benchmark::makeLookupKeys;
+using ::Benchmark::SEARCH_QUERY_COUNT;
+
+std::vector<std::pair<int, int>> makeSortedPairs(const std::vector<int>& keys) {
+	auto sortedKeys {keys};
+	std::ranges::sort(sortedKeys);
+	const auto [first, last] {std::ranges::unique(sortedKeys)};
+	sortedKeys.erase(first, last);
+	
+	std::vector<std::pair<int, int>> sortedPairs {};
+	sortedPairs.reserve(sortedKeys.size());
+	for (const auto key: sortedKeys) {
+		sortedPairs.emplace_back(key, key);
+	}
+	
+	return sortedPairs;
+}
+
+void bTreeInsert(benchmark::State& state) {
+	const auto keys {makeIntegers(static_cast<std::size_t>(state.range(0)), IntegerDistribution::Random)};
+	std::size_t memoryUsage {0};
+	std::size_t size {0};
+	
+	for (auto _ : state) {
+		BTree<int, int> bTree {};
+		for (const auto key: keys) {
+			bTree.insert(key, key);
+		}
+		
+		memoryUsage = bTree.getMemoryUsage();
+		size = bTree.getNodeCount();
+		benchmark::DoNotOptimize(bTree);
+	}
+	
+	state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(keys.size()));
+	state.counters["BytesPerElement"] = static_cast<double>(memoryUsage) / static_cast<double>(size);
+}
+
+void bTreeBulkLoad(benchmark::State& state) {
+	const auto sortedPairs {makeSortedPairs(makeIntegers(static_cast<std::size_t>(state.range(0)), IntegerDistribution::Random))};
+	std::size_t memoryUsage {0};
+	
+	for (auto _ : state) {
+		const BTree<int, int> bTree {sortedPairs};
+		memoryUsage = bTree.getMemoryUsage();
+		benchmark::DoNotOptimize(bTree);
+	}
+	
+	state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(sortedPairs.size()));
+	state.counters["BytesPerElement"] = static_cast<double>(memoryUsage) / static_cast<double>(sortedPairs.size());
+}
+
+void binarySearchTreeInsert(benchmark::State& state) {
+	const auto keys {makeIntegers(static_cast<std::size_t>(state.range(0)), IntegerDistribution::Random)};
+	
+	for (auto _ : state) {
+		BinarySearchTree<int> binarySearchTree {};
+		for (const auto key: keys) {
+			binarySearchTree.insert(key);
+		}
+		
+		benchmark::DoNotOptimize(binarySearchTree);
+	}
+	
+	state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(keys.size()));
+	state.counters["BytesPerElement"] = static_cast<double>(sizeof(ParentLinkedBinaryTreeNode<int>));
+}
+
+void avlTreeInsert(benchmark::State& state) {
+	const auto keys {makeIntegers(static_cast<std::size_t>(state.range(0)), IntegerDistribution::Random)};
+	
+	for (auto _ : state) {
+		AVLTree<int> avlTree {};
+		for (const auto key: keys) {
+			avlTree.insert(key);
+		}
+		
+		benchmark::DoNotOptimize(avlTree);
+	}
+	
+	state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(keys.size()));
+	state.counters["BytesPerElement"] = static_cast<double>(sizeof(ParentLinkedBinaryTreeNode<int>));
+}
+
+void bTreeFind(benchmark::State& state) {
+	const auto keys {makeIntegers(static_cast<std::size_t>(state.range(0)), IntegerDistribution::Random)};
+	const auto lookupKeys {makeLookupKeys(keys)};
+	const BTree<int, int> bTree {makeSortedPairs(keys)};
+	std::size_t lookupIndex {0};
+	
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(bTree.findFirst(lookupKeys[lookupIndex++ % SEARCH_QUERY_COUNT]));
+	}
+	
+	state.SetItemsProcessed(state.iterations());
+}
+
+void binarySearchTreeFind(benchmark::State& state) {
+	const auto keys {makeIntegers(static_cast<std::size_t>(state.range(0)), IntegerDistribution::Random)};
+	const auto lookupKeys {makeLookupKeys(keys)};
+	BinarySearchTree<int> binarySearchTree {};
+	for (const auto key: keys) {
+		binarySearchTree.insert(key);
+	}
+	
+	std::size_t lookupIndex {0};
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(binarySearchTree.findFirst(lookupKeys[lookupIndex++ % SEARCH_QUERY_COUNT]));
+	}
+	
+	state.SetItemsProcessed(state.iterations());
+}
+
+void avlTreeFind(benchmark::State& state) {
+	const auto keys {makeIntegers(static_cast<std::size_t>(state.range(0)), IntegerDistribution::Random)};
+	const auto lookupKeys {makeLookupKeys(keys)};
+	AVLTree<int> avlTree {};
+	for (const auto key: keys) {
+		avlTree.insert(key);
+	}
+	
+	std::size_t lookupIndex {0};
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(avlTree.findFirst(lookupKeys[lookupIndex++ % SEARCH_QUERY_COUNT]));
+	}
+	
+	state.SetItemsProcessed(state.iterations());
+}
+
+void bTreeRangeScan(benchmark::State& state) {
+	const auto keys {makeIntegers(static_cast<std::size_t>(state.range(0)), IntegerDistribution::Random)};
+	const BTree<int, int> bTree {makeSortedPairs(keys)};
+	
+	for (auto _ : state) {
+		long long sum {0};
+		for (auto iterator {bTree.cbegin()}; iterator != bTree.cend(); ++iterator) {
+			sum += (*iterator).second;
+		}
+		
+		benchmark::DoNotOptimize(sum);
+	}
+	
+	state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(bTree.getNodeCount()));
+}
+
+void binarySearchTreeRangeScan(benchmark::State& state) {
+	const auto keys {makeIntegers(static_cast<std::size_t>(state.range(0)), IntegerDistribution::Random)};
+	BinarySearchTree<int> binarySearchTree {};
+	for (const auto key: keys) {
+		binarySearchTree.insert(key);
+	}
+	
+	for (auto _ : state) {
+		long long sum {0};
+		for (auto iterator {binarySearchTree.cbeginInOrder()}; iterator != binarySearchTree.cendInOrder(); ++iterator) {
+			sum += *iterator;
+		}
+		
+		benchmark::DoNotOptimize(sum);
+	}
+	
+	state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(binarySearchTree.getNodeCount()));
+}
+
+BENCHMARK(bTreeInsert)->RangeMultiplier(8)->Range(1 << 10, 1 << 22);
+BENCHMARK(bTreeBulkLoad)->RangeMultiplier(8)->Range(1 << 10, 1 << 22);
+BENCHMARK(binarySearchTreeInsert)->RangeMultiplier(8)->Range(1 << 10, 1 << 22);
+BENCHMARK(avlTreeInsert)->RangeMultiplier(8)->Range(1 << 10, 1 << 22);
+BENCHMARK(bTreeFind)->RangeMultiplier(8)->Range(1 << 10, 1 << 22);
+BENCHMARK(binarySearchTreeFind)->RangeMultiplier(8)->Range(1 << 10, 1 << 22);
+BENCHMARK(avlTreeFind)->RangeMultiplier(8)->Range(1 << 10, 1 << 22);
+BENCHMARK(bTreeRangeScan)->RangeMultiplier(8)->Range(1 << 10, 1 << 22);
+BENCHMARK(binarySearchTreeRangeScan)->RangeMultiplier(8)->Range(1 << 10, 1 << 22);
+}
\ No newline at end of file
@@ -0,0 +1,151 @@
+#include <benchmark/benchmark.h>
+
+#include "DataStructures/Trees/BinarySearchTree.hpp"
+#include "DataStructures/Trees/BinaryTree.hpp"
+#include "IntegerBenchmarkData.hpp"
+
+namespace Core::DataStructures::Trees::Benchmark {
+using ::Benchmark::IntegerDistribution;
+using ::Benchmark::makeIntegers;
+
+BinarySearchTree<int> makeBinarySearchTree(const std::size_t size) {
+	BinarySearchTree<int> binarySearchTree {};
+	for (const auto integer: makeIntegers(size, IntegerDistribution::Random)) {
+		binarySearchTree.insert(integer);
+	}
+	
+	return binarySearchTree;
+}
+
+BinaryTree<int> makeBinaryTree(const std::size_t size) {
+	BinaryTree<int> binaryTree {};
+	for (const auto integer: makeIntegers(size, IntegerDistribution::Random)) {
+		binaryTree.insert(integer);
+	}
+	
+	return binaryTree;
+}
+
+void inOrderScan(benchmark::State& state) {
+	const auto binarySearchTree {makeBinarySearchTree(static_cast<std::size_t>(state.range(0)))};
+	
+	for (auto _ : state) {
+		long long sum {0};
+		for (auto iterator {binarySearchTree.cbeginInOrder()}; iterator != binarySearchTree.cendInOrder(); ++iterator) {
+			sum += *iterator;
+		}
+		
+		benchmark::DoNotOptimize(sum);
+	}
+	
+	state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(binarySearchTree.getNodeCount()));
+}
+
+void preOrderScan(benchmark::State& state) {
+	const auto binarySearchTree {makeBinarySearchTree(static_cast<std::size_t>(state.range(0)))};
+	
+	for (auto _ : state) {
+		long long sum {0};
+		for (auto iterator {binarySearchTree.cbeginPreOrder()}; iterator != binarySearchTree.cendPreOrder(); ++iterator) {
+			sum += *iterator;
+		}
+		
+		benchmark::DoNotOptimize(sum);
+	}
+	
+	state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(binarySearchTree.getNodeCount()));
+}
+
+void postOrderScan(benchmark::State& state) {
+	const auto binarySearchTree {makeBinarySearchTree(static_cast<std::size_t>(state.range(0)))};
+	
+	for (auto _ : state) {
+		long long sum {0};
+		for (auto iterator {binarySearchTree.cbeginPostOrder()}; iterator != binarySearchTree.cendPostOrder(); ++iterator) {
+			sum += *iterator;
+		}
+		
+		benchmark::DoNotOptimize(sum);
+	}
+	
+	state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(binarySearchTree.getNodeCount()));
+}
+
+void levelOrderScan(benchmark::State& state) {
+	const auto binarySearchTree {makeBinarySearchTree(static_cast<std::size_t>(state.range(0)))};
+	
+	for (auto _ : state) {
+		long long sum {0};
+		for (auto iterator {binarySearchTree.cbeginLevelOrder()}; iterator != binarySearchTree.cendLevelOrder(); ++iterator) {
+			sum += *iterator;
+		}
+		
+		benchmark::DoNotOptimize(sum);
+	}
+	
+	state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(binarySearchTree.getNodeCount()));
+}
+
+void inOrderIteratorCopy(benchmark::State& state) {
+	const auto binarySearchTree {makeBinarySearchTree(static_cast<std::size_t>(state.range(0)))};
+	const auto iterator {binarySearchTree.cbeginInOrder()};
+	
+	for (auto _ : state) {
+		auto copiedIterator {iterator};
+		benchmark::DoNotOptimize(copiedIterator);
+	}
+	
+	state.SetItemsProcessed(state.iterations());
+}
+
+void stackInOrderScan(benchmark::State& state) {
+	const auto binaryTree {makeBinaryTree(static_cast<std::size_t>(state.range(0)))};
+	
+	for (auto _ : state) {
+		long long sum {0};
+		for (auto iterator {binaryTree.cbeginInOrder()}; iterator != binaryTree.cendInOrder(); ++iterator) {
+			sum += *iterator;
+		}
+		
+		benchmark::DoNotOptimize(sum);
+	}
+	
+	state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(binaryTree.getNodeCount()));
+}
+
+void stackInOrderIteratorCopy(benchmark::State& state) {
+	const auto binaryTree {makeBinaryTree(static_cast<std::size_t>(state.range(0)))};
+	const auto iterator {binaryTree.cbeginInOrder()};
+	
+	for (auto _ : state) {
+		auto copiedIterator {iterator};
+		benchmark::DoNotOptimize(copiedIterator);
+	}
+	
+	state.SetItemsProcessed(state.iterations());
+}
+
+void binaryTreeInsert(benchmark::State& state) {
+	const auto elements {makeIntegers(static_cast<std::size_t>(state.range(0)), IntegerDistribution::Random)};
+	
+	for (auto _ : state) {
+		BinaryTree<int> binaryTree {};
+		for (const auto element: elements) {
+			binaryTree.insert(element);
+		}
+		
+		benchmark::DoNotOptimize(binaryTree);
+	}
+	
+	state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(elements.size()));
+}
+
+BENCHMARK(inOrderScan)->RangeMultiplier(8)->Range(1 << 10, 1 << 22);
+BENCHMARK(preOrderScan)->RangeMultiplier(8)->Range(1 << 10, 1 << 22);
+BENCHMARK(postOrderScan)->RangeMultiplier(8)->Range(1 << 10, 1 << 22);
+BENCHMARK(levelOrderScan)->RangeMultiplier(8)->Range(1 << 10, 1 << 22);
+BENCHMARK(inOrderIteratorCopy)->RangeMultiplier(8)->Range(1 << 10, 1 << 22);
+BENCHMARK(stackInOrderScan)->RangeMultiplier(8)->Range(1 << 10, 1 << 22);
+BENCHMARK(stackInOrderIteratorCopy)->RangeMultiplier(8)->Range(1 << 10, 1 << 22);
+BENCHMARK(binaryTreeInsert)->RangeMultiplier(8)->Range(1 << 10, 1 << 20);
+}
\ No newline at end of file
@@ -0,0 +1,71 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <iterator>
+
+#include "DataStructures/Trees/AVLTree.hpp"
+#include "DataStructures/Trees/BinarySearchTree.hpp"
+#include "IntegerBenchmarkData.hpp"
+
+namespace Core::DataStructures::Trees::Benchmark {
+using ::Benchmark::IntegerDistribution;
+using ::Benchmark::makeIntegers;
+
+template<typename TreeType>
+TreeType makeRandomTree(const std::size_t size) {
+	TreeType tree {};
+	for (const auto element: makeIntegers(size, IntegerDistribution::Random)) {
+		tree.insert(element);
+	}
+	
+	return tree;
+}
+
+template<typename TreeType>
+void selectPercentile(benchmark::State& state) {
+	const auto tree {makeRandomTree<TreeType>(static_cast<std::size_t>(state.range(0)))};
+	
+	std::size_t percentile {1};
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(tree.select(tree.getNodeCount() * percentile / 100));
+		percentile = percentile % 99 + 1;
+	}
+	
+	state.SetItemsProcessed(state.iterations());
+}
+
+template<typename TreeType>
+void inOrderPercentile(benchmark::State& state) {
+	const auto tree {makeRandomTree<TreeType>(static_cast<std::size_t>(state.range(0)))};
+	
+	std::size_t percentile {1};
+	for (auto _ : state) {
+		const auto index {static_cast<std::ptrdiff_t>(tree.getNodeCount() * percentile / 100)};
+		benchmark::DoNotOptimize(*std::next(tree.cbeginInOrder(), index));
+		percentile = percentile % 99 + 1;
+	}
+	
+	state.SetItemsProcessed(state.iterations());
+}
+
+template<typename TreeType>
+void countInRange(benchmark::State& state) {
+	const auto elements {makeIntegers(static_cast<std::size_t>(state.range(0)), IntegerDistribution::Random)};
+	const auto tree {makeRandomTree<TreeType>(elements.size())};
+	
+	std::size_t elementIndex {0};
+	for (auto _ : state) {
+		const auto first {elements[(elementIndex * 7919) % elements.size()]};
+		const auto second {elements[(elementIndex * 104729) % elements.size()]};
+		benchmark::DoNotOptimize(tree.countInRange(std::min(first, second), std::max(first, second)));
+		++elementIndex;
+	}
+	
+	state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK_TEMPLATE(selectPercentile, AVLTree<int>)->Arg(1 << 10)->Arg(1 << 16)->Arg(10'000'000);
+BENCHMARK_TEMPLATE(selectPercentile, BinarySearchTree<int>)->Arg(1 << 10)->Arg(1 << 16)->Arg(10'000'000);
+BENCHMARK_TEMPLATE(inOrderPercentile, AVLTree<int>)->Arg(1 << 10)->Arg(1 << 16)->Arg(10'000'000);
+BENCHMARK_TEMPLATE(countInRange, AVLTree<int>)->Arg(1 << 10)->Arg(1 << 16)->Arg(10'000'000);
+}
\ No newline at end of file
@@ -0,0 +1,78 @@
+#include <benchmark/benchmark.h>
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+
+#include "DataStructures/Trees/PersistentAVLTree.hpp"
+#include "IntegerBenchmarkData.hpp"
+
+namespace Core::DataStructures::Trees::Benchmark {
+using ::Benchmark::IntegerDistribution;
+using ::Benchmark::makeIntegers;
+
+PersistentAVLTree<int> makeRandomPersistentAVLTree(const std::size_t size) {
+	PersistentAVLTree<int> persistentAVLTree {};
+	for (const auto element: makeIntegers(size, IntegerDistribution::Random)) {
+		persistentAVLTree = persistentAVLTree.insert(element);
+	}
+	
+	return persistentAVLTree;
+}
+
+void persistentAVLTreeSnapshot(benchmark::State& state) {
+	const auto persistentAVLTree {makeRandomPersistentAVLTree(static_cast<std::size_t>(state.range(0)))};
+	
+	for (auto _ : state) {
+		const auto snapshot {persistentAVLTree};
+		benchmark::DoNotOptimize(snapshot);
+	}
+	
+	state.SetItemsProcessed(state.iterations());
+}
+
+void persistentAVLTreeMixedInsertRemove(benchmark::State& state) {
+	const auto elements {makeIntegers(static_cast<std::size_t>(state.range(0)), IntegerDistribution::Random)};
+	auto persistentAVLTree {makeRandomPersistentAVLTree(elements.size())};
+	
+	std::size_t elementIndex {0};
+	for (auto _ : state) {
+		const auto element {elements[(elementIndex++ * 7919) % elements.size()]};
+		persistentAVLTree = persistentAVLTree.removeFirst(element).insert(element);
+		benchmark::DoNotOptimize(persistentAVLTree);
+	}
+	
+	state.SetItemsProcessed(state.iterations() * 2);
+}
+
+void persistentAVLTreeFindUnderConcurrentWrites(benchmark::State& state) {
+	static std::atomic<std::shared_ptr<const PersistentAVLTree<int>>> publishedVersion {};
+	
+	const auto elements {makeIntegers(static_cast<std::size_t>(state.range(0)), IntegerDistribution::Random)};
+	if (state.thread_index() == 0) {
+		publishedVersion.store(
+				std::make_shared<const PersistentAVLTree<int>>(makeRandomPersistentAVLTree(elements.size())));
+	}
+	
+	std::size_t elementIndex {0};
+	for (auto _ : state) {
+		const auto element {elements[(elementIndex++ * 7919) % elements.size()]};
+		const auto snapshot {publishedVersion.load()};
+		
+		if (state.thread_index() == 0) {
+			publishedVersion.store(
+					std::make_shared<const PersistentAVLTree<int>>(snapshot->removeFirst(element).insert(element)));
+		} else {
+			benchmark::DoNotOptimize(snapshot->contains(element));
+		}
+	}
+	
+	if (state.thread_index() != 0) {
+		state.SetItemsProcessed(state.iterations());
+	}
+}
+
+BENCHMARK(persistentAVLTreeSnapshot)->RangeMultiplier(8)->Range(1 << 10, 1 << 20);
+BENCHMARK(persistentAVLTreeMixedInsertRemove)->RangeMultiplier(8)->Range(1 << 10, 1 << 20);
+BENCHMARK(persistentAVLTreeFindUnderConcurrentWrites)->Arg(1 << 16)->Arg(1 << 20)->ThreadRange(2, 8)->UseRealTime();
+}
\ No newline at end of file
@@ -0,0 +1,99 @@
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+#include "DataStructures/Trees/AVLTree.hpp"
+#include "IntegerBenchmarkData.hpp"
+
+namespace Core::DataStructures::Trees::Benchmark {
+using ::Benchmark::IntegerDistribution;
+using ::Benchmark::makeIntegers;
+
+constexpr int RANGE_WIDTH {64};
+
+AVLTree<int> makeSequentialAVLTree(const std::size_t size) {
+	AVLTree<int> tree {};
+	for (const auto element: makeIntegers(size, IntegerDistribution::Sorted)) {
+		tree.insert(element);
+	}
+	
+	return tree;
+}
+
+std::vector<int> makeRangeStarts(const std::size_t size) {
+	auto rangeStarts {makeIntegers(1 << 10, IntegerDistribution::Random)};
+	for (auto& rangeStart: rangeStarts) {
+		rangeStart %= static_cast<int>(size);
+	}
+	
+	return rangeStarts;
+}
+
+void rangeScanFromLowerBound(benchmark::State& state) {
+	const auto tree {makeSequentialAVLTree(static_cast<std::size_t>(state.range(0)))};
+	const auto rangeStarts {makeRangeStarts(tree.getNodeCount())};
+	
+	std::size_t rangeIndex {0};
+	for (auto _ : state) {
+		const auto rangeStart {rangeStarts[rangeIndex++ % rangeStarts.size()]};
+		const auto rangeEnd {tree.lowerBound(rangeStart + RANGE_WIDTH)};
+		
+		long long sum {0};
+		for (auto iterator {tree.lowerBound(rangeStart)}; iterator != rangeEnd; ++iterator) {
+			sum += *iterator;
+		}
+		
+		benchmark::DoNotOptimize(sum);
+	}
+	
+	state.SetItemsProcessed(state.iterations());
+}
+
+void rangeScanFromBegin(benchmark::State& state) {
+	const auto tree {makeSequentialAVLTree(static_cast<std::size_t>(state.range(0)))};
+	const auto rangeStarts {makeRangeStarts(tree.getNodeCount())};
+	
+	std::size_t rangeIndex {0};
+	for (auto _ : state) {
+		const auto rangeStart {rangeStarts[rangeIndex++ % rangeStarts.size()]};
+		
+		long long sum {0};
+		for (auto iterator {tree.cbeginInOrder()}; iterator != tree.cendInOrder(); ++iterator) {
+			if (!(*iterator < rangeStart + RANGE_WIDTH)) {
+				break;
+			}
+			
+			if (!(*iterator < rangeStart)) {
+				sum += *iterator;
+			}
+		}
+		
+		benchmark::DoNotOptimize(sum);
+	}
+	
+	state.SetItemsProcessed(state.iterations());
+}
+
+void rangeScanWithVisitor(benchmark::State& state) {
+	const auto tree {makeSequentialAVLTree(static_cast<std::size_t>(state.range(0)))};
+	const auto rangeStarts {makeRangeStarts(tree.getNodeCount())};
+	
+	std::size_t rangeIndex {0};
+	for (auto _ : state) {
+		const auto rangeStart {rangeStarts[rangeIndex++ % rangeStarts.size()]};
+		
+		long long sum {0};
+		tree.forEachInRange(rangeStart, rangeStart + RANGE_WIDTH - 1, [&sum](const int element) {
+			sum += element;
+		});
+		
+		benchmark::DoNotOptimize(sum);
+	}
+	
+	state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(rangeScanFromLowerBound)->RangeMultiplier(8)->Range(1 << 10, 1 << 19);
+BENCHMARK(rangeScanFromBegin)->RangeMultiplier(8)->Range(1 << 10, 1 << 19);
+BENCHMARK(rangeScanWithVisitor)->RangeMultiplier(8)->Range(1 << 10, 1 << 19);
+}
\ No newline at end of file
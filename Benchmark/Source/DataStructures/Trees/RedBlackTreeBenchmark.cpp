@@ -0,0 +1,51 @@
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+#include "DataStructures/Trees/AVLTree.hpp"
+#include "DataStructures/Trees/RedBlackTree.hpp"
+#include "IntegerBenchmarkData.hpp"
+
+namespace Core::DataStructures::Trees::Benchmark {
+using ::Benchmark::IntegerDistribution;
+using ::Benchmark::makeIntegers;
+
+template<typename TreeType>
+void mixedInsertRemove(benchmark::State& state) {
+	const auto elements {makeIntegers(static_cast<std::size_t>(state.range(0)), IntegerDistribution::Random)};
+	TreeType tree {};
+	for (const auto element: elements) {
+		tree.insert(element);
+	}
+	
+	std::size_t elementIndex {0};
+	for (auto _ : state) {
+		const auto element {elements[(elementIndex++ * 7919) % elements.size()]};
+		benchmark::DoNotOptimize(tree.removeFirst(element));
+		tree.insert(element);
+	}
+	
+	state.SetItemsProcessed(state.iterations() * 2);
+}
+
+template<typename TreeType>
+void removeMinimumInsert(benchmark::State& state) {
+	const auto elements {makeIntegers(static_cast<std::size_t>(state.range(0)), IntegerDistribution::Random)};
+	TreeType tree {};
+	for (const auto element: elements) {
+		tree.insert(element);
+	}
+	
+	for (auto _ : state) {
+		const auto minimum {tree.removeMinimum()};
+		tree.insert(*minimum + static_cast<int>(elements.size()));
+	}
+	
+	state.SetItemsProcessed(state.iterations() * 2);
+}
+
+BENCHMARK_TEMPLATE(mixedInsertRemove, RedBlackTree<int>)->RangeMultiplier(8)->Range(1 << 10, 1 << 22);
+BENCHMARK_TEMPLATE(mixedInsertRemove, AVLTree<int>)->RangeMultiplier(8)->Range(1 << 10, 1 << 22);
+BENCHMARK_TEMPLATE(removeMinimumInsert, RedBlackTree<int>)->RangeMultiplier(8)->Range(1 << 10, 1 << 22);
+BENCHMARK_TEMPLATE(removeMinimumInsert, AVLTree<int>)->RangeMultiplier(8)->Range(1 << 10, 1 << 22);
+}
\ No newline at end of file
@@ -0,0 +1,105 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "DataStructures/Trees/AVLTree.hpp"
+#include "IntegerBenchmarkData.hpp"
+
+namespace Core::DataStructures::Trees::Benchmark {
+using ::Benchmark::IntegerDistribution;
+using ::Benchmark::makeIntegers;
+
+std::pair<std::vector<int>, std::vector<int>> makeSortedOperands(const benchmark::State& state) {
+	auto firstElements {makeIntegers(static_cast<std::size_t>(state.range(0)), IntegerDistribution::Random)};
+	auto secondElements {makeIntegers(static_cast<std::size_t>(state.range(1)), IntegerDistribution::Random)};
+	std::ranges::sort(firstElements);
+	std::ranges::sort(secondElements);
+	
+	return {std::move(firstElements), std::move(secondElements)};
+}
+
+template<void (AVLTree<int>::*SetOperation)(AVLTree<int>&&, const std::size_t)>
+void avlTreeSetOperation(benchmark::State& state) {
+	const auto [firstElements, secondElements] {makeSortedOperands(state)};
+	const auto threadCount {static_cast<std::size_t>(state.range(2))};
+	
+	for (auto _ : state) {
+		state.PauseTiming();
+		AVLTree<int> firstAVLTree {firstElements};
+		AVLTree<int> secondAVLTree {secondElements};
+		state.ResumeTiming();
+		
+		(firstAVLTree.*SetOperation)(std::move(secondAVLTree), threadCount);
+		benchmark::DoNotOptimize(firstAVLTree);
+		
+		state.PauseTiming();
+		firstAVLTree.removeAll();
+		state.ResumeTiming();
+	}
+	
+	state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(secondElements.size()));
+}
+
+void avlTreeInsertEachElement(benchmark::State& state) {
+	const auto [firstElements, secondElements] {makeSortedOperands(state)};
+	
+	for (auto _ : state) {
+		state.PauseTiming();
+		AVLTree<int> firstAVLTree {firstElements};
+		state.ResumeTiming();
+		
+		for (const auto element: secondElements) {
+			if (!firstAVLTree.contains(element)) {
+				firstAVLTree.insert(element);
+			}
+		}
+		
+		benchmark::DoNotOptimize(firstAVLTree);
+		
+		state.PauseTiming();
+		firstAVLTree.removeAll();
+		state.ResumeTiming();
+	}
+	
+	state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(secondElements.size()));
+}
+
+void avlTreeRemoveEachElement(benchmark::State& state) {
+	const auto [firstElements, secondElements] {makeSortedOperands(state)};
+	
+	for (auto _ : state) {
+		state.PauseTiming();
+		AVLTree<int> firstAVLTree {firstElements};
+		state.ResumeTiming();
+		
+		for (const auto element: secondElements) {
+			while (firstAVLTree.removeFirst(element).has_value()) {
+				
+			}
+		}
+		
+		benchmark::DoNotOptimize(firstAVLTree);
+		
+		state.PauseTiming();
+		firstAVLTree.removeAll();
+		state.ResumeTiming();
+	}
+	
+	state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(secondElements.size()));
+}
+
+const auto hardwareThreadCount {static_cast<std::int64_t>(std::max(1U, std::thread::hardware_concurrency()))};
+
+BENCHMARK_TEMPLATE(avlTreeSetOperation, &AVLTree<int>::unionWith)
+		->ArgsProduct({{1 << 20}, {1 << 10, 1 << 16, 1 << 20}, {1, hardwareThreadCount}});
+BENCHMARK(avlTreeInsertEachElement)->ArgsProduct({{1 << 20}, {1 << 10, 1 << 16, 1 << 20}});
+BENCHMARK_TEMPLATE(avlTreeSetOperation, &AVLTree<int>::intersectWith)
+		->ArgsProduct({{1 << 20}, {1 << 10, 1 << 16, 1 << 20}, {1, hardwareThreadCount}});
+BENCHMARK_TEMPLATE(avlTreeSetOperation, &AVLTree<int>::differenceWith)
+		->ArgsProduct({{1 << 20}, {1 << 10, 1 << 16, 1 << 20}, {1, hardwareThreadCount}});
+BENCHMARK(avlTreeRemoveEachElement)->ArgsProduct({{1 << 20}, {1 << 10, 1 << 16, 1 << 20}});
+}
\ No newline at end of file
@@ -0,0 +1,86 @@
+#pragma once
+
+#include <cstddef>
+#include <new>
+
+namespace Core::Algorithms {
+/**
+ * @brief The size in bytes of a cache line on the processors this library targets.
+ */
+inline constexpr std::size_t CACHE_LINE_SIZE {64};
+
+/**
+ * @brief An allocator that aligns every allocation to the start of a cache line.
+ * @details Search layouts that group related elements into blocks of one cache line use this so that each block is
+ * fetched with a single memory access rather than straddling two cache lines.
+ * @class CacheAlignedAllocator
+ * @tparam ElementType: The type of the elements to allocate.
+ */
+template<typename ElementType>
+class CacheAlignedAllocator {
+public:
+	using value_type = ElementType;
+	
+	/**
+	 * @brief Instantiates a new cache aligned allocator.
+	 */
+	CacheAlignedAllocator() noexcept = default;
+	
+	/**
+	 * @brief Instantiates a new cache aligned allocator from a cache aligned allocator of another element type.
+	 * @tparam OtherElementType: The element type of the other allocator.
+	 * @param other: The allocator to convert.
+	 */
+	template<typename OtherElementType>
+	CacheAlignedAllocator(const CacheAlignedAllocator<OtherElementType>& other) noexcept;
+
+public:
+	/**
+	 * @brief Allocates uninitialized storage for the given number of elements, aligned to a cache line.
+	 * @param count: The number of elements to allocate storage for.
+	 * @return A pointer to the allocated storage.
+	 * @throws std::bad_alloc: Thrown if memory allocation fails.
+	 */
+	ElementType* allocate(const std::size_t count);
+	
+	/**
+	 * @brief Deallocates storage previously returned by allocate.
+	 * @param elements: A pointer to the storage to deallocate.
+	 * @param count: The number of elements the storage was allocated for.
+	 */
+	void deallocate(ElementType* elements, const std::size_t count) noexcept;
+	
+	/**
+	 * @brief Checks if this allocator is equal to the given allocator, which is always the case as it is stateless.
+	 * @tparam OtherElementType: The element type of the other allocator.
+	 * @param other: The allocator to compare to.
+	 * @return True.
+	 */
+	template<typename OtherElementType>
+	bool operator==(const CacheAlignedAllocator<OtherElementType>& other) const noexcept;
+};
+
+template<typename ElementType>
+template<typename OtherElementType>
+CacheAlignedAllocator<ElementType>::CacheAlignedAllocator(
+		[[maybe_unused]] const CacheAlignedAllocator<OtherElementType>& other) noexcept {
+	
+}
+
+template<typename ElementType>
+ElementType* CacheAlignedAllocator<ElementType>::allocate(const std::size_t count) {
+	return static_cast<ElementType*>(::operator new(count * sizeof(ElementType), std::align_val_t {CACHE_LINE_SIZE}));
+}
+
+template<typename ElementType>
+void CacheAlignedAllocator<ElementType>::deallocate(ElementType* elements, const std::size_t count) noexcept {
+	::operator delete(elements, count * sizeof(ElementType), std::align_val_t {CACHE_LINE_SIZE});
+}
+
+template<typename ElementType>
+template<typename OtherElementType>
+bool CacheAlignedAllocator<ElementType>::operator==(
+		[[maybe_unused]] const CacheAlignedAllocator<OtherElementType>& other) const noexcept {
+	return true;
+}
+}
\ No newline at end of file
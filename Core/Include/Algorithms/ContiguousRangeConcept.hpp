@@ -0,0 +1,14 @@
+#pragma once
+
+#include <ranges>
+
+namespace Core::Algorithms {
+/**
+ * @brief A concept that requires the container to be a sized range whose elements are stored contiguously in memory.
+ * @details This is satisfied by std::array, std::vector and std::pmr::vector, as well as by std::span, which allows a
+ * sub-range of any contiguous storage, such as a memory mapped file, to be used in place without copying it.
+ * @tparam Container: The container type.
+ */
+template<typename Container>
+concept ContiguousRangeConcept = std::ranges::contiguous_range<Container> && std::ranges::sized_range<Container>;
+}
\ No newline at end of file
@@ -0,0 +1,23 @@
+#pragma once
+
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <xmmintrin.h>
+#endif
+
+namespace Core::Algorithms {
+/**
+ * @brief Hints to the processor that the cache line containing the given address will be read soon.
+ * @details This compiles to a single prefetch instruction on GCC, Clang and MSVC and to nothing on other compilers. It
+ * never faults, so the address does not need to be dereferenceable.
+ * @param address: The address to prefetch.
+ */
+inline void prefetch(const void* address) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+	__builtin_prefetch(address);
+#elif defined(_MSC_VER)
+	_mm_prefetch(static_cast<const char*>(address), _MM_HINT_T0);
+#else
+	static_cast<void>(address);
+#endif
+}
+}
@@ -1,6 +1,15 @@
 #pragma once
 
-#include "Algorithms/ArrayOrVectorConcept.hpp"
+#include <algorithm>
+#include <array>
+#include <functional>
+#include <numeric>
+#include <ranges>
+#include <span>
+#include <vector>
+
+#include "Algorithms/ContiguousRangeConcept.hpp"
+#include "Algorithms/Prefetch.hpp"
 #include "SearchingAlgorithm.hpp"
 
 namespace Core::Algorithms::Searching {
@@ -8,8 +17,8 @@ namespace Core::Algorithms::Searching {
  * @brief An implementation of the binary search algorithm using iterators.
  * @tparam Container The type of the container to search.
  */
-template<ArrayOrVectorConcept Container>
-class BinarySearcher final : public SearchingAlgorithm<typename Container::value_type> {
+template<ContiguousRangeConcept Container>
+class BinarySearcher final : public SearchingAlgorithm<std::ranges::range_value_t<Container>> {
 public:
 	/**
 	 * @brief Instantiates a new binary searcher.
@@ -56,7 +65,75 @@ public:
 	 * However, this is not enforced by the compiler. Any other type might result in undefined behavior.
 	 * @return True if the value was found, false otherwise.
 	 */
-	bool search(const std::function<char(const typename Container::value_type&)>& predicate) const noexcept override;
+	bool search(const std::function<char(const std::ranges::range_value_t<Container>&)>& predicate) const noexcept override;
+	
+	/**
+	 * @brief Finds the first element in the container that does not come before the given target using a branchless
+	 * binary search.
+	 * @details The container must be sorted using the given comparison. Each step picks the next half with a
+	 * conditional move rather than a branch, so the loop runs the same number of iterations for every target and never
+	 * mispredicts, and the midpoints of both candidate halves are prefetched one step ahead. The comparison is a template
+	 * parameter rather than an std::function, so it is dispatched statically and can be inlined.
+	 * @tparam Compare: The type of the comparison.
+	 * @param target: The value to search for.
+	 * @param compare: The comparison that returns true if the first argument comes before the second.
+	 * @return The index of the first element that does not come before the target, or the size of the container if
+	 * every element comes before it.
+	 */
+	template<typename Compare = std::less<>>
+	std::size_t lowerBound(const std::ranges::range_value_t<Container>& target, Compare compare = {}) const noexcept;
+	
+	/**
+	 * @brief Finds the first element in the given index range that does not come before the given target using a
+	 * branchless binary search.
+	 * @details The elements in the index range must be sorted using the given comparison. The last index is clamped to
+	 * the size of the container.
+	 * @tparam Compare: The type of the comparison.
+	 * @param target: The value to search for.
+	 * @param first: The index of the first element in the range.
+	 * @param last: The index after the last element in the range.
+	 * @param compare: The comparison that returns true if the first argument comes before the second.
+	 * @return The index of the first element in the range that does not come before the target, or last if every
+	 * element in the range comes before it.
+	 */
+	template<typename Compare = std::less<>>
+	std::size_t lowerBound(const std::ranges::range_value_t<Container>& target,
+	                       const std::size_t first,
+	                       const std::size_t last,
+	                       Compare compare = {}) const noexcept;
+	
+	/**
+	 * @brief Finds the lower bound of every given target by advancing groups of branchless binary searches in lockstep.
+	 * @details A single binary search over a container larger than the cache spends most of its time waiting on one
+	 * cache miss after another. Because the branchless search runs the same number of iterations for every target, the
+	 * searches of a group can take each step together, so the cache misses of the whole group are in flight at the same
+	 * time rather than one after the other.
+	 * @tparam GroupSize: The number of searches that are advanced together.
+	 * @tparam Compare: The type of the comparison.
+	 * @param targets: The values to search for.
+	 * @param compare: The comparison that returns true if the first argument comes before the second.
+	 * @return A vector holding the lower bound index of each target, in the order of the targets.
+	 */
+	template<std::size_t GroupSize = 16, typename Compare = std::less<>>
+	requires (GroupSize > 0)
+	std::vector<std::size_t> batchLowerBound(std::span<const std::ranges::range_value_t<Container>> targets,
+	                                         Compare compare = {}) const;
+	
+	/**
+	 * @brief Finds the lower bound of every given target by searching the targets in sorted order.
+	 * @details The targets are sorted first, after which the lower bound of each target can be no earlier than the
+	 * lower bound of the one before it. Each search therefore gallops forward from the previous result and finishes
+	 * with a branchless binary search over the range it found, which costs O(log d) for a distance d between
+	 * consecutive results and touches the parts of the container the previous searches have already brought into the
+	 * cache.
+	 * @tparam Compare: The type of the comparison.
+	 * @param targets: The values to search for, in any order.
+	 * @param compare: The comparison that returns true if the first argument comes before the second.
+	 * @return A vector holding the lower bound index of each target, in the order of the targets.
+	 */
+	template<typename Compare = std::less<>>
+	std::vector<std::size_t> sortedBatchLowerBound(std::span<const std::ranges::range_value_t<Container>> targets,
+	                                               Compare compare = {}) const;
 
 private:
 	/**
@@ -70,28 +147,28 @@ private:
 	template<typename Iterator>
 	bool search(const Iterator& begin,
 	            const Iterator& end,
-	            const std::function<char(const typename Container::value_type&)>& predicate) const noexcept;
+	            const std::function<char(const std::ranges::range_value_t<Container>&)>& predicate) const noexcept;
 
 private:
 	Container& container;
 };
 
-template<ArrayOrVectorConcept Container>
+template<ContiguousRangeConcept Container>
 BinarySearcher<Container>::BinarySearcher(Container& container) noexcept
-		: SearchingAlgorithm<typename Container::value_type> {}, container {container} {
+		: SearchingAlgorithm<std::ranges::range_value_t<Container>> {}, container {container} {
 	
 }
 
-template<ArrayOrVectorConcept Container>
-bool BinarySearcher<Container>::search(const std::function<char(const typename Container::value_type&)>& predicate) const noexcept {
-	return search(container.cbegin(), container.cend(), predicate);
+template<ContiguousRangeConcept Container>
+bool BinarySearcher<Container>::search(const std::function<char(const std::ranges::range_value_t<Container>&)>& predicate) const noexcept {
+	return search(std::ranges::cbegin(container), std::ranges::cend(container), predicate);
 }
 
-template<ArrayOrVectorConcept Container>
+template<ContiguousRangeConcept Container>
 template<typename Iterator>
 bool BinarySearcher<Container>::search(const Iterator& begin,
                                        const Iterator& end,
-                                       const std::function<char(const typename Container::value_type&)>& predicate) const noexcept {
+                                       const std::function<char(const std::ranges::range_value_t<Container>&)>& predicate) const noexcept {
 	if (begin == end) {
 		return false;
 	}
@@ -116,4 +193,107 @@ bool BinarySearcher<Container>::search(const Iterator& begin,
 	
 	return false;
 }
+
+template<ContiguousRangeConcept Container>
+template<typename Compare>
+std::size_t BinarySearcher<Container>::lowerBound(const std::ranges::range_value_t<Container>& target,
+                                                  Compare compare) const noexcept {
+	return lowerBound(target, 0, std::ranges::size(container), compare);
+}
+
+template<ContiguousRangeConcept Container>
+template<typename Compare>
+std::size_t BinarySearcher<Container>::lowerBound(const std::ranges::range_value_t<Container>& target,
+                                                  const std::size_t first,
+                                                  const std::size_t last,
+                                                  Compare compare) const noexcept {
+	const auto end {std::min<std::size_t>(last, std::ranges::size(container))};
+	if (first >= end) {
+		return end;
+	}
+	
+	const auto* const data {std::ranges::data(container)};
+	const auto* base {data + first};
+	auto length {end - first};
+	
+	while (length > 1) {
+		const auto half {length / 2};
+		length -= half;
+		prefetch(base + length / 2);
+		prefetch(base + half + length / 2);
+		base = compare(base[half - 1], target) ? base + half : base;
+	}
+	
+	return static_cast<std::size_t>(base - data) + (compare(*base, target) ? 1 : 0);
+}
+
+template<ContiguousRangeConcept Container>
+template<std::size_t GroupSize, typename Compare>
+requires (GroupSize > 0)
+std::vector<std::size_t> BinarySearcher<Container>::batchLowerBound(std::span<const std::ranges::range_value_t<Container>> targets,
+                                                                    Compare compare) const {
+	std::vector<std::size_t> results(targets.size());
+	const auto size {std::ranges::size(container)};
+	if (size == 0) {
+		return results;
+	}
+	
+	const auto* const data {std::ranges::data(container)};
+	std::array<const std::ranges::range_value_t<Container>*, GroupSize> bases {};
+	
+	for (std::size_t groupBegin {0}; groupBegin < targets.size(); groupBegin += GroupSize) {
+		const auto groupSize {std::min(GroupSize, targets.size() - groupBegin)};
+		const auto groupTargets {targets.subspan(groupBegin, groupSize)};
+		bases.fill(data);
+		
+		auto length {size};
+		while (length > 1) {
+			const auto half {length / 2};
+			length -= half;
+			
+			for (std::size_t index {0}; index < groupSize; ++index) {
+				prefetch(bases[index] + length / 2);
+				prefetch(bases[index] + half + length / 2);
+				bases[index] = compare(bases[index][half - 1], groupTargets[index]) ? bases[index] + half : bases[index];
+			}
+		}
+		
+		for (std::size_t index {0}; index < groupSize; ++index) {
+			results[groupBegin + index] = static_cast<std::size_t>(bases[index] - data)
+			                              + (compare(*bases[index], groupTargets[index]) ? 1 : 0);
+		}
+	}
+	
+	return results;
+}
+
+template<ContiguousRangeConcept Container>
+template<typename Compare>
+std::vector<std::size_t> BinarySearcher<Container>::sortedBatchLowerBound(std::span<const std::ranges::range_value_t<Container>> targets,
+                                                                          Compare compare) const {
+	std::vector<std::size_t> order(targets.size());
+	std::iota(order.begin(), order.end(), 0);
+	std::ranges::sort(order, [&targets, &compare](const auto first, const auto second) {
+		return compare(targets[first], targets[second]);
+	});
+	
+	std::vector<std::size_t> results(targets.size());
+	const auto size {std::ranges::size(container)};
+	const auto* const data {std::ranges::data(container)};
+	std::size_t previous {0};
+	
+	for (const auto targetIndex : order) {
+		const auto& target {targets[targetIndex]};
+		
+		std::size_t step {1};
+		while (previous + step <= size && compare(data[previous + step - 1], target)) {
+			step *= 2;
+		}
+		
+		previous = lowerBound(target, previous + step / 2, std::min(previous + step, size), compare);
+		results[targetIndex] = previous;
+	}
+	
+	return results;
+}
 }
\ No newline at end of file
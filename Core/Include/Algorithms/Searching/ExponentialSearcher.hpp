@@ -0,0 +1,173 @@
+#pragma once
+
+#include <algorithm>
+#include <functional>
+#include <ranges>
+
+#include "Algorithms/ContiguousRangeConcept.hpp"
+#include "BinarySearcher.hpp"
+#include "SearchingAlgorithm.hpp"
+
+namespace Core::Algorithms::Searching {
+/**
+ * @brief An implementation of the exponential search algorithm using indices.
+ * @details Exponential search gallops away from a starting position in steps that double in size until it steps over
+ * the target, and then binary searches the last step. A target d elements away from the start is found in O(log d)
+ * comparisons, so searches near the front of the container, or near a hint such as the result of the previous search,
+ * are cheaper than a binary search of the whole container.
+ * @tparam Container The type of the container to search.
+ */
+template<ContiguousRangeConcept Container>
+class ExponentialSearcher final : public SearchingAlgorithm<std::ranges::range_value_t<Container>> {
+public:
+	/**
+	 * @brief Instantiates a new exponential searcher.
+	 * @param container: The container to search.
+	 */
+	explicit ExponentialSearcher(Container& container) noexcept;
+	
+	/**
+	 * @brief Instantiates a new exponential searcher by copying the given exponential searcher.
+	 * @param other: The exponential searcher to copy.
+	 */
+	ExponentialSearcher(const ExponentialSearcher& other) noexcept = default;
+	
+	/**
+	 * @brief Instantiates a new exponential searcher by moving the given exponential searcher.
+	 * @param other: The exponential searcher to move.
+	 */
+	ExponentialSearcher(ExponentialSearcher&& other) noexcept = default;
+	
+	/**
+	 * @brief Destroys the exponential searcher.
+	 */
+	~ExponentialSearcher() noexcept override = default;
+
+public:
+	/**
+	 * @brief Assigns the given exponential searcher to this exponential searcher using copy semantics.
+	 * @param other: The exponential searcher to copy.
+	 * @return A reference to this exponential searcher.
+	 */
+	ExponentialSearcher& operator=(const ExponentialSearcher& other) noexcept = default;
+	
+	/**
+	 * @brief Assigns the given exponential searcher to this exponential searcher using move semantics.
+	 * @param other: The exponential searcher to move.
+	 * @return A reference to this exponential searcher.
+	 */
+	ExponentialSearcher& operator=(ExponentialSearcher&& other) noexcept = default;
+
+public:
+	/**
+	 * @brief Searches the container for the given value using the given predicate and the exponential search
+	 * algorithm, galloping from the front of the container.
+	 * @param predicate: The predicate to use to search the container. It must be a BinarySearchPredicate type.
+	 * However, this is not enforced by the compiler. Any other type might result in undefined behavior.
+	 * @return True if the value was found, false otherwise.
+	 */
+	bool search(const std::function<char(const std::ranges::range_value_t<Container>&)>& predicate) const noexcept override;
+	
+	/**
+	 * @brief Finds the first element that does not come before the given target, galloping from the front of the
+	 * container.
+	 * @tparam Compare: The type of the comparison.
+	 * @param target: The value to search for.
+	 * @param compare: The comparison that returns true if the first argument comes before the second.
+	 * @return The index of the first element that does not come before the target, or the size of the container if
+	 * every element comes before it.
+	 */
+	template<typename Compare = std::less<>>
+	std::size_t lowerBound(const std::ranges::range_value_t<Container>& target, Compare compare = {}) const noexcept;
+	
+	/**
+	 * @brief Finds the first element that does not come before the given target, galloping from the given hint in
+	 * whichever direction the target lies.
+	 * @tparam Compare: The type of the comparison.
+	 * @param target: The value to search for.
+	 * @param hint: The index the result is expected to be near. It is clamped to the size of the container.
+	 * @param compare: The comparison that returns true if the first argument comes before the second.
+	 * @return The index of the first element that does not come before the target, or the size of the container if
+	 * every element comes before it.
+	 */
+	template<typename Compare = std::less<>>
+	std::size_t hintedLowerBound(const std::ranges::range_value_t<Container>& target,
+	                             const std::size_t hint,
+	                             Compare compare = {}) const noexcept;
+
+private:
+	Container& container;
+};
+
+template<ContiguousRangeConcept Container>
+ExponentialSearcher<Container>::ExponentialSearcher(Container& container) noexcept
+		: SearchingAlgorithm<std::ranges::range_value_t<Container>> {}, container {container} {
+	
+}
+
+template<ContiguousRangeConcept Container>
+bool ExponentialSearcher<Container>::search(const std::function<char(const std::ranges::range_value_t<Container>&)>& predicate) const noexcept {
+	const auto* const data {std::ranges::data(container)};
+	const auto size {std::ranges::size(container)};
+	
+	std::size_t bound {1};
+	while (bound <= size && predicate(data[bound - 1]) > 0) {
+		bound *= 2;
+	}
+	
+	auto low {bound / 2};
+	auto high {std::min(bound, size)};
+	
+	while (low < high) {
+		const auto middle {low + (high - low) / 2};
+		const auto result {predicate(data[middle])};
+		
+		if (result == 0) {
+			return true;
+		}
+		
+		if (result < 0) {
+			high = middle;
+		} else {
+			low = middle + 1;
+		}
+	}
+	
+	return false;
+}
+
+template<ContiguousRangeConcept Container>
+template<typename Compare>
+std::size_t ExponentialSearcher<Container>::lowerBound(const std::ranges::range_value_t<Container>& target,
+                                                       Compare compare) const noexcept {
+	return hintedLowerBound(target, 0, compare);
+}
+
+template<ContiguousRangeConcept Container>
+template<typename Compare>
+std::size_t ExponentialSearcher<Container>::hintedLowerBound(const std::ranges::range_value_t<Container>& target,
+                                                             const std::size_t hint,
+                                                             Compare compare) const noexcept {
+	const auto* const data {std::ranges::data(container)};
+	const auto size {std::ranges::size(container)};
+	const auto start {std::min(hint, size)};
+	const BinarySearcher<Container> binarySearcher {container};
+	
+	if (start < size && compare(data[start], target)) {
+		std::size_t step {1};
+		while (start + step < size && compare(data[start + step], target)) {
+			step *= 2;
+		}
+		
+		return binarySearcher.lowerBound(target, start + step / 2 + 1, std::min(start + step, size), compare);
+	}
+	
+	std::size_t step {1};
+	while (step <= start && !compare(data[start - step], target)) {
+		step *= 2;
+	}
+	
+	const auto first {step <= start ? start - step + 1 : 0};
+	return binarySearcher.lowerBound(target, first, start - step / 2, compare);
+}
+}
\ No newline at end of file
@@ -0,0 +1,192 @@
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <functional>
+#include <optional>
+#include <ranges>
+#include <utility>
+#include <vector>
+
+#include "Algorithms/CacheAlignedAllocator.hpp"
+#include "Algorithms/ContiguousRangeConcept.hpp"
+#include "Algorithms/Prefetch.hpp"
+#include "SearchingAlgorithm.hpp"
+
+namespace Core::Algorithms::Searching {
+/**
+ * @brief A static searchable array that stores sorted elements in the breadth first order of a complete binary search
+ * tree.
+ * @details The root is stored at index 1 and the children of the element at index k are stored at indices 2k and
+ * 2k + 1, so the first levels of the tree, which every search visits, share a handful of cache lines, and the 16
+ * descendants four levels below any element are contiguous and can be prefetched in a single cache line while the
+ * current comparisons are made. The layout is built once in O(n) time and cannot be modified afterwards.
+ * @class EytzingerArray
+ * @tparam ElementType: The type of the elements to search.
+ * @tparam Compare: The type of the comparison the elements are sorted by.
+ */
+template<typename ElementType, typename Compare = std::less<ElementType>>
+class EytzingerArray final : public SearchingAlgorithm<ElementType> {
+public:
+	/**
+	 * @brief Instantiates a new Eytzinger array from the given sorted container.
+	 * @tparam Container: The type of the sorted container.
+	 * @param sortedContainer: The container to copy the elements from. It must be sorted using the given comparison.
+	 * @param compare: The comparison that returns true if the first argument comes before the second.
+	 */
+	template<ContiguousRangeConcept Container>
+	explicit EytzingerArray(const Container& sortedContainer, Compare compare = {});
+	
+	/**
+	 * @brief Instantiates a new Eytzinger array by copying the given Eytzinger array.
+	 * @param other: The Eytzinger array to copy.
+	 */
+	EytzingerArray(const EytzingerArray& other) = default;
+	
+	/**
+	 * @brief Instantiates a new Eytzinger array by moving the given Eytzinger array.
+	 * @param other: The Eytzinger array to move.
+	 */
+	EytzingerArray(EytzingerArray&& other) noexcept = default;
+	
+	/**
+	 * @brief Destroys the Eytzinger array.
+	 */
+	~EytzingerArray() noexcept override = default;
+
+public:
+	/**
+	 * @brief Assigns the given Eytzinger array to this Eytzinger array using copy semantics.
+	 * @param other: The Eytzinger array to copy.
+	 * @return A reference to this Eytzinger array.
+	 */
+	EytzingerArray& operator=(const EytzingerArray& other) = default;
+	
+	/**
+	 * @brief Assigns the given Eytzinger array to this Eytzinger array using move semantics.
+	 * @param other: The Eytzinger array to move.
+	 * @return A reference to this Eytzinger array.
+	 */
+	EytzingerArray& operator=(EytzingerArray&& other) noexcept = default;
+
+public:
+	/**
+	 * @brief Searches the array for the given value using the given predicate by descending the implicit tree.
+	 * @param predicate: The predicate to use to search the array. It must be a BinarySearchPredicate type.
+	 * However, this is not enforced by the compiler. Any other type might result in undefined behavior.
+	 * @return True if the value was found, false otherwise.
+	 */
+	bool search(const std::function<char(const ElementType&)>& predicate) const noexcept override;
+	
+	/**
+	 * @brief Finds the first element in sorted order that does not come before the given target.
+	 * @details The descent always runs to a leaf and picks each child with the result of the comparison rather than a
+	 * branch. The element that was last descended right from is then recovered from the bits of the final index.
+	 * @param target: The value to search for.
+	 * @return The first element that does not come before the target, or std::nullopt if every element comes before it.
+	 */
+	std::optional<ElementType> lowerBound(const ElementType& target) const noexcept;
+	
+	/**
+	 * @brief Gets the number of elements in the array.
+	 * @return The number of elements in the array.
+	 */
+	std::size_t getSize() const noexcept;
+	
+	/**
+	 * @brief Checks if the array is empty.
+	 * @return True if the array is empty, false otherwise.
+	 */
+	bool isEmpty() const noexcept;
+
+private:
+	/**
+	 * @brief The number of descendants four levels below an element, which are prefetched during the descent.
+	 */
+	static constexpr std::size_t PREFETCH_DISTANCE {16};
+	
+	/**
+	 * @brief Copies the sorted elements into the subtree rooted at the given index using an in-order traversal.
+	 * @tparam Iterator: The type of the iterator.
+	 * @param iterator: An iterator to the next sorted element to copy, which is advanced past every copied element.
+	 * @param index: The index of the root of the subtree.
+	 */
+	template<typename Iterator>
+	void build(Iterator& iterator, const std::size_t index);
+
+private:
+	std::vector<ElementType, CacheAlignedAllocator<ElementType>> elements;
+	Compare compare;
+	std::size_t size;
+};
+
+template<typename ElementType, typename Compare>
+template<ContiguousRangeConcept Container>
+EytzingerArray<ElementType, Compare>::EytzingerArray(const Container& sortedContainer, Compare compare) :
+		SearchingAlgorithm<ElementType> {}, compare {std::move(compare)}, size {std::ranges::size(sortedContainer)} {
+	if (size == 0) {
+		return;
+	}
+	
+	auto iterator {std::ranges::cbegin(sortedContainer)};
+	elements.assign(size + 1, *iterator);
+	build(iterator, 1);
+}
+
+template<typename ElementType, typename Compare>
+bool EytzingerArray<ElementType, Compare>::search(const std::function<char(const ElementType&)>& predicate) const noexcept {
+	std::size_t index {1};
+	while (index <= size) {
+		const auto result {predicate(elements[index])};
+		
+		if (result == 0) {
+			return true;
+		}
+		
+		index = 2 * index + (result < 0 ? 0 : 1);
+	}
+	
+	return false;
+}
+
+template<typename ElementType, typename Compare>
+std::optional<ElementType> EytzingerArray<ElementType, Compare>::lowerBound(const ElementType& target) const noexcept {
+	const auto* const data {elements.data()};
+	std::size_t index {1};
+	
+	while (index <= size) {
+		prefetch(data + std::min(PREFETCH_DISTANCE * index, size));
+		index = 2 * index + (compare(data[index], target) ? 1 : 0);
+	}
+	
+	index >>= std::countr_one(index) + 1;
+	if (index == 0) {
+		return std::nullopt;
+	}
+	
+	return data[index];
+}
+
+template<typename ElementType, typename Compare>
+std::size_t EytzingerArray<ElementType, Compare>::getSize() const noexcept {
+	return size;
+}
+
+template<typename ElementType, typename Compare>
+bool EytzingerArray<ElementType, Compare>::isEmpty() const noexcept {
+	return size == 0;
+}
+
+template<typename ElementType, typename Compare>
+template<typename Iterator>
+void EytzingerArray<ElementType, Compare>::build(Iterator& iterator, const std::size_t index) {
+	if (index > size) {
+		return;
+	}
+	
+	build(iterator, 2 * index);
+	elements[index] = *iterator;
+	++iterator;
+	build(iterator, 2 * index + 1);
+}
+}
\ No newline at end of file
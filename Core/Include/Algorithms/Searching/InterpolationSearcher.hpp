@@ -0,0 +1,175 @@
+#pragma once
+
+#include <algorithm>
+#include <functional>
+#include <ranges>
+#include <type_traits>
+
+#include "Algorithms/ContiguousRangeConcept.hpp"
+#include "SearchingAlgorithm.hpp"
+
+namespace Core::Algorithms::Searching {
+/**
+ * @brief An implementation of the interpolation search algorithm using indices.
+ * @details Instead of probing the middle of the remaining range, interpolation search probes where the target would be
+ * if the elements between the two ends of the range were evenly spaced, which finds a target among n uniformly
+ * distributed elements in O(log log n) probes on average. Whenever a probe fails to halve the remaining range a
+ * bisection step is taken as well, so skewed distributions never need more than twice the probes of a binary search.
+ * Probes also fall back to bisection when the keys at both ends of the range are too close to tell apart as doubles.
+ * @tparam Container The type of the container to search. Its elements must be of an arithmetic type.
+ */
+template<ContiguousRangeConcept Container>
+requires std::is_arithmetic_v<std::ranges::range_value_t<Container>>
+class InterpolationSearcher final : public SearchingAlgorithm<std::ranges::range_value_t<Container>> {
+public:
+	/**
+	 * @brief Instantiates a new interpolation searcher.
+	 * @param container: The container to search.
+	 */
+	explicit InterpolationSearcher(Container& container) noexcept;
+	
+	/**
+	 * @brief Instantiates a new interpolation searcher by copying the given interpolation searcher.
+	 * @param other: The interpolation searcher to copy.
+	 */
+	InterpolationSearcher(const InterpolationSearcher& other) noexcept = default;
+	
+	/**
+	 * @brief Instantiates a new interpolation searcher by moving the given interpolation searcher.
+	 * @param other: The interpolation searcher to move.
+	 */
+	InterpolationSearcher(InterpolationSearcher&& other) noexcept = default;
+	
+	/**
+	 * @brief Destroys the interpolation searcher.
+	 */
+	~InterpolationSearcher() noexcept override = default;
+
+public:
+	/**
+	 * @brief Assigns the given interpolation searcher to this interpolation searcher using copy semantics.
+	 * @param other: The interpolation searcher to copy.
+	 * @return A reference to this interpolation searcher.
+	 */
+	InterpolationSearcher& operator=(const InterpolationSearcher& other) noexcept = default;
+	
+	/**
+	 * @brief Assigns the given interpolation searcher to this interpolation searcher using move semantics.
+	 * @param other: The interpolation searcher to move.
+	 * @return A reference to this interpolation searcher.
+	 */
+	InterpolationSearcher& operator=(InterpolationSearcher&& other) noexcept = default;
+
+public:
+	/**
+	 * @brief Searches the container for the given value using the given predicate.
+	 * @details A predicate only tells on which side of an element the value lies, not how far away it is, so this
+	 * bisects the container. Use lowerBound to search by interpolation.
+	 * @param predicate: The predicate to use to search the container. It must be a BinarySearchPredicate type.
+	 * However, this is not enforced by the compiler. Any other type might result in undefined behavior.
+	 * @return True if the value was found, false otherwise.
+	 */
+	bool search(const std::function<char(const std::ranges::range_value_t<Container>&)>& predicate) const noexcept override;
+	
+	/**
+	 * @brief Finds the first element in the ascending container that is not less than the given target using
+	 * interpolation search.
+	 * @param target: The value to search for.
+	 * @return The index of the first element that is not less than the target, or the size of the container if every
+	 * element is less than it.
+	 */
+	std::size_t lowerBound(const std::ranges::range_value_t<Container>& target) const noexcept;
+
+private:
+	/**
+	 * @brief Ranges no longer than this are finished with a linear scan.
+	 */
+	static constexpr std::size_t LINEAR_SCAN_THRESHOLD {8};
+
+private:
+	Container& container;
+};
+
+template<ContiguousRangeConcept Container>
+requires std::is_arithmetic_v<std::ranges::range_value_t<Container>>
+InterpolationSearcher<Container>::InterpolationSearcher(Container& container) noexcept
+		: SearchingAlgorithm<std::ranges::range_value_t<Container>> {}, container {container} {
+	
+}
+
+template<ContiguousRangeConcept Container>
+requires std::is_arithmetic_v<std::ranges::range_value_t<Container>>
+bool InterpolationSearcher<Container>::search(const std::function<char(const std::ranges::range_value_t<Container>&)>& predicate) const noexcept {
+	const auto* const data {std::ranges::data(container)};
+	std::size_t low {0};
+	auto high {std::ranges::size(container)};
+	
+	while (low < high) {
+		const auto middle {low + (high - low) / 2};
+		const auto result {predicate(data[middle])};
+		
+		if (result == 0) {
+			return true;
+		}
+		
+		if (result < 0) {
+			high = middle;
+		} else {
+			low = middle + 1;
+		}
+	}
+	
+	return false;
+}
+
+template<ContiguousRangeConcept Container>
+requires std::is_arithmetic_v<std::ranges::range_value_t<Container>>
+std::size_t InterpolationSearcher<Container>::lowerBound(const std::ranges::range_value_t<Container>& target) const noexcept {
+	const auto* const data {std::ranges::data(container)};
+	std::size_t low {0};
+	auto high {std::ranges::size(container)};
+	
+	while (high - low > LINEAR_SCAN_THRESHOLD) {
+		const auto first {data[low]};
+		const auto last {data[high - 1]};
+		
+		if (!(first < target)) {
+			return low;
+		}
+		
+		if (last < target) {
+			return high;
+		}
+		
+		const auto fraction {(static_cast<double>(target) - static_cast<double>(first))
+		                     / (static_cast<double>(last) - static_cast<double>(first))};
+		const auto span {high - 1 - low};
+		const auto offset {fraction >= 0.0 && fraction <= 1.0 ? static_cast<std::size_t>(fraction * static_cast<double>(span))
+		                                                      : span / 2};
+		const auto probe {std::min(low + offset, high - 1)};
+		const auto length {high - low};
+		
+		if (data[probe] < target) {
+			low = probe + 1;
+		} else {
+			high = probe;
+		}
+		
+		if (2 * (high - low) > length) {
+			const auto middle {low + (high - low) / 2};
+			
+			if (data[middle] < target) {
+				low = middle + 1;
+			} else {
+				high = middle;
+			}
+		}
+	}
+	
+	while (low < high && data[low] < target) {
+		++low;
+	}
+	
+	return low;
+}
+}
\ No newline at end of file
@@ -1,15 +1,35 @@
 #pragma once
 
-#include "Algorithms/ArrayOrVectorConcept.hpp"
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <functional>
+#include <future>
+#include <optional>
+#include <ranges>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+#include "Algorithms/ContiguousRangeConcept.hpp"
 #include "SearchingAlgorithm.hpp"
 
 namespace Core::Algorithms::Searching {
 /**
  * @brief An implementation of the linear search algorithm using iterators.
+ * @details Besides the predicate based search, which works for any element type, the searcher can find, count and
+ * collect the positions of the elements equal to a target. For integral and floating point elements these compare 32
+ * bytes of elements at a time with AVX2 when it is enabled by the ENABLE_AVX2 CMake option, and each has a parallel
+ * variant that splits the container into chunks scanned on separate threads.
  * @tparam Container The type of the container to search.
+ * @tparam IsVectorized Whether AVX2 may be used, which false turns off to measure the scalar loop.
  */
-template<ArrayOrVectorConcept Container>
-class LinearSearcher final : public SearchingAlgorithm<typename Container::value_type> {
+template<ContiguousRangeConcept Container, bool IsVectorized = true>
+class LinearSearcher final : public SearchingAlgorithm<std::ranges::range_value_t<Container>> {
 public:
 	/**
 	 * @brief Instantiates a new linear searcher.
@@ -55,7 +75,148 @@ public:
 	 * @param predicate: The predicate to use to search the container.
 	 * @return True if the value was found, false otherwise.
 	 */
-	bool search(const std::function<char(const typename Container::value_type&)>& predicate) const noexcept override;
+	bool search(const std::function<char(const std::ranges::range_value_t<Container>&)>& predicate) const noexcept override;
+	
+	/**
+	 * @brief Finds the first element that is equal to the given target.
+	 * @param target: The value to search for.
+	 * @return The index of the first element equal to the target, or std::nullopt if there is none.
+	 */
+	std::optional<std::size_t> find(const std::ranges::range_value_t<Container>& target) const noexcept;
+	
+	/**
+	 * @brief Counts the elements that are equal to the given target.
+	 * @param target: The value to count.
+	 * @return The number of elements equal to the target.
+	 */
+	std::size_t count(const std::ranges::range_value_t<Container>& target) const noexcept;
+	
+	/**
+	 * @brief Finds every element that is equal to the given target.
+	 * @param target: The value to search for.
+	 * @return A vector holding the indices of the elements equal to the target in ascending order.
+	 */
+	std::vector<std::size_t> findAll(const std::ranges::range_value_t<Container>& target) const;
+	
+	/**
+	 * @brief Finds the first element that is equal to the given target by scanning chunks of the container in parallel.
+	 * @details Every chunk is scanned to its first match, so this pays off for large containers in which the target is
+	 * rare or absent. Containers too small to be worth splitting are scanned on the calling thread.
+	 * @param target: The value to search for.
+	 * @param threadCount: The maximum number of threads to use, including the calling thread.
+	 * @return The index of the first element equal to the target, or std::nullopt if there is none.
+	 */
+	std::optional<std::size_t> parallelFind(const std::ranges::range_value_t<Container>& target,
+	                                        const std::size_t threadCount = std::thread::hardware_concurrency()) const;
+	
+	/**
+	 * @brief Counts the elements that are equal to the given target by scanning chunks of the container in parallel.
+	 * @param target: The value to count.
+	 * @param threadCount: The maximum number of threads to use, including the calling thread.
+	 * @return The number of elements equal to the target.
+	 */
+	std::size_t parallelCount(const std::ranges::range_value_t<Container>& target,
+	                          const std::size_t threadCount = std::thread::hardware_concurrency()) const;
+	
+	/**
+	 * @brief Finds every element that is equal to the given target by scanning chunks of the container in parallel.
+	 * @param target: The value to search for.
+	 * @param threadCount: The maximum number of threads to use, including the calling thread.
+	 * @return A vector holding the indices of the elements equal to the target in ascending order.
+	 */
+	std::vector<std::size_t> parallelFindAll(const std::ranges::range_value_t<Container>& target,
+	                                         const std::size_t threadCount = std::thread::hardware_concurrency()) const;
+
+private:
+	using ValueType = std::ranges::range_value_t<Container>;
+	
+	/**
+	 * @brief Whether the element type is compared with vector instructions when they are available.
+	 */
+	static constexpr bool IS_VECTORIZABLE {IsVectorized
+	                                       && (std::is_integral_v<ValueType> || std::is_same_v<ValueType, float>
+	                                           || std::is_same_v<ValueType, double>)
+	                                       && (sizeof(ValueType) == 1 || sizeof(ValueType) == 2 || sizeof(ValueType) == 4
+	                                           || sizeof(ValueType) == 8)};
+	
+	/**
+	 * @brief The smallest number of elements a parallel scan gives to each thread.
+	 */
+	static constexpr std::size_t MINIMUM_CHUNK_SIZE {1 << 16};
+
+#if defined(__AVX2__)
+	/**
+	 * @brief The number of elements compared by a single vector instruction.
+	 */
+	static constexpr std::size_t VECTOR_SIZE {sizeof(__m256i) / sizeof(ValueType)};
+	
+	/**
+	 * @brief The bits a single element occupies in a match mask.
+	 */
+	static constexpr std::uint32_t ELEMENT_MASK {(1u << sizeof(ValueType)) - 1};
+	
+	/**
+	 * @brief Broadcasts the given target to every element of a vector.
+	 * @param target: The value to broadcast.
+	 * @return A vector holding a copy of the target in every element.
+	 */
+	static __m256i broadcast(const ValueType& target) noexcept;
+	
+	/**
+	 * @brief Compares the elements starting at the given pointer with the broadcast target.
+	 * @param elements: A pointer to the first of VECTOR_SIZE elements to compare.
+	 * @param targets: The broadcast target.
+	 * @return A mask with sizeof(ValueType) consecutive bits set for each element equal to the target.
+	 */
+	static std::uint32_t matchMask(const ValueType* elements, const __m256i targets) noexcept;
+#endif
+
+	/**
+	 * @brief Finds the first element equal to the target in the given index range.
+	 * @param first: The index of the first element in the range.
+	 * @param last: The index after the last element in the range.
+	 * @param target: The value to search for.
+	 * @return The index of the first element equal to the target, or std::nullopt if there is none.
+	 */
+	std::optional<std::size_t> findInRange(const std::size_t first, const std::size_t last, const ValueType& target) const noexcept;
+	
+	/**
+	 * @brief Counts the elements equal to the target in the given index range.
+	 * @param first: The index of the first element in the range.
+	 * @param last: The index after the last element in the range.
+	 * @param target: The value to count.
+	 * @return The number of elements equal to the target.
+	 */
+	std::size_t countInRange(const std::size_t first, const std::size_t last, const ValueType& target) const noexcept;
+	
+	/**
+	 * @brief Appends the index of every element equal to the target in the given index range to the given vector.
+	 * @param first: The index of the first element in the range.
+	 * @param last: The index after the last element in the range.
+	 * @param target: The value to search for.
+	 * @param indices: The vector to append the indices to.
+	 */
+	void findAllInRange(const std::size_t first,
+	                    const std::size_t last,
+	                    const ValueType& target,
+	                    std::vector<std::size_t>& indices) const;
+	
+	/**
+	 * @brief Splits the container into chunks and applies the given scan to each of them on its own thread.
+	 * @details The last chunk is scanned on the calling thread.
+	 * @tparam Scan: The type of the scan, which is called with the first and last index of a chunk.
+	 * @param threadCount: The maximum number of threads to use, including the calling thread.
+	 * @param scan: The scan to apply to each chunk.
+	 * @return A vector holding the result of each chunk in the order of the chunks.
+	 */
+	template<typename Scan>
+	auto scanChunks(const std::size_t threadCount, const Scan& scan) const;
+	
+	/**
+	 * @brief Gets a pointer to the first element of the container.
+	 * @return A pointer to the first element of the container.
+	 */
+	const ValueType* getData() const noexcept;
 
 private:
 	/**
@@ -69,28 +230,28 @@ private:
 	template<typename Iterator>
 	bool linearSearch(const Iterator begin,
 	                  const Iterator end,
-	                  const std::function<char(const typename Container::value_type&)>& predicate) const noexcept;
+	                  const std::function<char(const std::ranges::range_value_t<Container>&)>& predicate) const noexcept;
 
 private:
 	Container& container;
 };
 
-template<ArrayOrVectorConcept Container>
-LinearSearcher<Container>::LinearSearcher(Container& container) noexcept :
-		SearchingAlgorithm<typename Container::value_type> {}, container {container} {
+template<ContiguousRangeConcept Container, bool IsVectorized>
+LinearSearcher<Container, IsVectorized>::LinearSearcher(Container& container) noexcept :
+		SearchingAlgorithm<std::ranges::range_value_t<Container>> {}, container {container} {
 	
 }
 
-template<ArrayOrVectorConcept Container>
-bool LinearSearcher<Container>::search(const std::function<char(const typename Container::value_type&)>& predicate) const noexcept {
-	return linearSearch(container.cbegin(), container.cend(), predicate);
+template<ContiguousRangeConcept Container, bool IsVectorized>
+bool LinearSearcher<Container, IsVectorized>::search(const std::function<char(const std::ranges::range_value_t<Container>&)>& predicate) const noexcept {
+	return linearSearch(std::ranges::cbegin(container), std::ranges::cend(container), predicate);
 }
 
-template<ArrayOrVectorConcept Container>
+template<ContiguousRangeConcept Container, bool IsVectorized>
 template<typename Iterator>
-bool LinearSearcher<Container>::linearSearch(const Iterator begin,
-                                             const Iterator end,
-                                             const std::function<char(const typename Container::value_type&)>& predicate) const noexcept {
+bool LinearSearcher<Container, IsVectorized>::linearSearch(const Iterator begin,
+                                                           const Iterator end,
+                                                           const std::function<char(const std::ranges::range_value_t<Container>&)>& predicate) const noexcept {
 	for (auto iterator {begin}; iterator != end; ++iterator) {
 		if (predicate(*iterator)) {
 			return true;
@@ -99,4 +260,222 @@ bool LinearSearcher<Container>::linearSearch(const Iterator begin,
 	
 	return false;
 }
+
+template<ContiguousRangeConcept Container, bool IsVectorized>
+std::optional<std::size_t> LinearSearcher<Container, IsVectorized>::find(const std::ranges::range_value_t<Container>& target) const noexcept {
+	return findInRange(0, std::ranges::size(container), target);
+}
+
+template<ContiguousRangeConcept Container, bool IsVectorized>
+std::size_t LinearSearcher<Container, IsVectorized>::count(const std::ranges::range_value_t<Container>& target) const noexcept {
+	return countInRange(0, std::ranges::size(container), target);
+}
+
+template<ContiguousRangeConcept Container, bool IsVectorized>
+std::vector<std::size_t> LinearSearcher<Container, IsVectorized>::findAll(const std::ranges::range_value_t<Container>& target) const {
+	std::vector<std::size_t> indices {};
+	findAllInRange(0, std::ranges::size(container), target, indices);
+	
+	return indices;
+}
+
+template<ContiguousRangeConcept Container, bool IsVectorized>
+std::optional<std::size_t> LinearSearcher<Container, IsVectorized>::parallelFind(const std::ranges::range_value_t<Container>& target,
+                                                                                 const std::size_t threadCount) const {
+	const auto results {scanChunks(threadCount, [this, &target](const std::size_t first, const std::size_t last) {
+		return findInRange(first, last, target);
+	})};
+	
+	for (const auto& result : results) {
+		if (result.has_value()) {
+			return result;
+		}
+	}
+	
+	return std::nullopt;
+}
+
+template<ContiguousRangeConcept Container, bool IsVectorized>
+std::size_t LinearSearcher<Container, IsVectorized>::parallelCount(const std::ranges::range_value_t<Container>& target,
+                                                                   const std::size_t threadCount) const {
+	const auto results {scanChunks(threadCount, [this, &target](const std::size_t first, const std::size_t last) {
+		return countInRange(first, last, target);
+	})};
+	
+	std::size_t total {0};
+	for (const auto result : results) {
+		total += result;
+	}
+	
+	return total;
+}
+
+template<ContiguousRangeConcept Container, bool IsVectorized>
+std::vector<std::size_t> LinearSearcher<Container, IsVectorized>::parallelFindAll(const std::ranges::range_value_t<Container>& target,
+                                                                                  const std::size_t threadCount) const {
+	const auto results {scanChunks(threadCount, [this, &target](const std::size_t first, const std::size_t last) {
+		std::vector<std::size_t> indices {};
+		findAllInRange(first, last, target, indices);
+		return indices;
+	})};
+	
+	std::vector<std::size_t> indices {};
+	for (const auto& result : results) {
+		indices.insert(indices.end(), result.begin(), result.end());
+	}
+	
+	return indices;
+}
+
+#if defined(__AVX2__)
+template<ContiguousRangeConcept Container, bool IsVectorized>
+__m256i LinearSearcher<Container, IsVectorized>::broadcast(const ValueType& target) noexcept {
+	if constexpr (std::is_same_v<ValueType, float>) {
+		return _mm256_castps_si256(_mm256_set1_ps(target));
+	} else if constexpr (std::is_same_v<ValueType, double>) {
+		return _mm256_castpd_si256(_mm256_set1_pd(target));
+	} else if constexpr (sizeof(ValueType) == 1) {
+		return _mm256_set1_epi8(std::bit_cast<std::int8_t>(target));
+	} else if constexpr (sizeof(ValueType) == 2) {
+		return _mm256_set1_epi16(std::bit_cast<std::int16_t>(target));
+	} else if constexpr (sizeof(ValueType) == 4) {
+		return _mm256_set1_epi32(std::bit_cast<std::int32_t>(target));
+	} else {
+		return _mm256_set1_epi64x(std::bit_cast<std::int64_t>(target));
+	}
+}
+
+template<ContiguousRangeConcept Container, bool IsVectorized>
+std::uint32_t LinearSearcher<Container, IsVectorized>::matchMask(const ValueType* elements, const __m256i targets) noexcept {
+	const auto block {_mm256_loadu_si256(reinterpret_cast<const __m256i*>(elements))};
+	
+	__m256i matches;
+	if constexpr (std::is_same_v<ValueType, float>) {
+		matches = _mm256_castps_si256(_mm256_cmp_ps(_mm256_castsi256_ps(block), _mm256_castsi256_ps(targets), _CMP_EQ_OQ));
+	} else if constexpr (std::is_same_v<ValueType, double>) {
+		matches = _mm256_castpd_si256(_mm256_cmp_pd(_mm256_castsi256_pd(block), _mm256_castsi256_pd(targets), _CMP_EQ_OQ));
+	} else if constexpr (sizeof(ValueType) == 1) {
+		matches = _mm256_cmpeq_epi8(block, targets);
+	} else if constexpr (sizeof(ValueType) == 2) {
+		matches = _mm256_cmpeq_epi16(block, targets);
+	} else if constexpr (sizeof(ValueType) == 4) {
+		matches = _mm256_cmpeq_epi32(block, targets);
+	} else {
+		matches = _mm256_cmpeq_epi64(block, targets);
+	}
+	
+	return static_cast<std::uint32_t>(_mm256_movemask_epi8(matches));
+}
+#endif
+
+template<ContiguousRangeConcept Container, bool IsVectorized>
+std::optional<std::size_t> LinearSearcher<Container, IsVectorized>::findInRange(const std::size_t first,
+                                                                                const std::size_t last,
+                                                                                const ValueType& target) const noexcept {
+	const auto* const data {getData()};
+	auto index {first};
+
+#if defined(__AVX2__)
+	if constexpr (IS_VECTORIZABLE) {
+		const auto targets {broadcast(target)};
+		for (; index + VECTOR_SIZE <= last; index += VECTOR_SIZE) {
+			const auto mask {matchMask(data + index, targets)};
+			if (mask != 0) {
+				return index + static_cast<std::size_t>(std::countr_zero(mask)) / sizeof(ValueType);
+			}
+		}
+	}
+#endif
+
+	for (; index < last; ++index) {
+		if (data[index] == target) {
+			return index;
+		}
+	}
+	
+	return std::nullopt;
+}
+
+template<ContiguousRangeConcept Container, bool IsVectorized>
+std::size_t LinearSearcher<Container, IsVectorized>::countInRange(const std::size_t first,
+                                                                  const std::size_t last,
+                                                                  const ValueType& target) const noexcept {
+	const auto* const data {getData()};
+	auto index {first};
+	std::size_t matchCount {0};
+
+#if defined(__AVX2__)
+	if constexpr (IS_VECTORIZABLE) {
+		const auto targets {broadcast(target)};
+		for (; index + VECTOR_SIZE <= last; index += VECTOR_SIZE) {
+			matchCount += static_cast<std::size_t>(std::popcount(matchMask(data + index, targets))) / sizeof(ValueType);
+		}
+	}
+#endif
+
+	for (; index < last; ++index) {
+		matchCount += data[index] == target ? 1 : 0;
+	}
+	
+	return matchCount;
+}
+
+template<ContiguousRangeConcept Container, bool IsVectorized>
+void LinearSearcher<Container, IsVectorized>::findAllInRange(const std::size_t first,
+                                                             const std::size_t last,
+                                                             const ValueType& target,
+                                                             std::vector<std::size_t>& indices) const {
+	const auto* const data {getData()};
+	auto index {first};
+
+#if defined(__AVX2__)
+	if constexpr (IS_VECTORIZABLE) {
+		const auto targets {broadcast(target)};
+		for (; index + VECTOR_SIZE <= last; index += VECTOR_SIZE) {
+			for (auto mask {matchMask(data + index, targets)}; mask != 0; ) {
+				const auto bit {std::countr_zero(mask)};
+				indices.push_back(index + static_cast<std::size_t>(bit) / sizeof(ValueType));
+				mask &= ~(ELEMENT_MASK << bit);
+			}
+		}
+	}
+#endif
+
+	for (; index < last; ++index) {
+		if (data[index] == target) {
+			indices.push_back(index);
+		}
+	}
+}
+
+template<ContiguousRangeConcept Container, bool IsVectorized>
+template<typename Scan>
+auto LinearSearcher<Container, IsVectorized>::scanChunks(const std::size_t threadCount, const Scan& scan) const {
+	using Result = std::invoke_result_t<const Scan&, std::size_t, std::size_t>;
+	
+	const auto size {std::ranges::size(container)};
+	const auto chunkCount {std::max<std::size_t>(1, std::min(threadCount, size / MINIMUM_CHUNK_SIZE))};
+	const auto chunkSize {(size + chunkCount - 1) / chunkCount};
+	
+	std::vector<std::future<Result>> pendingScans {};
+	for (std::size_t chunk {0}; chunk + 1 < chunkCount; ++chunk) {
+		pendingScans.push_back(std::async(std::launch::async, scan, chunk * chunkSize, (chunk + 1) * chunkSize));
+	}
+	
+	std::vector<Result> results {};
+	results.reserve(chunkCount);
+	
+	auto lastResult {scan((chunkCount - 1) * chunkSize, size)};
+	for (auto& pendingScan : pendingScans) {
+		results.push_back(pendingScan.get());
+	}
+	
+	results.push_back(std::move(lastResult));
+	return results;
+}
+
+template<ContiguousRangeConcept Container, bool IsVectorized>
+const typename LinearSearcher<Container, IsVectorized>::ValueType* LinearSearcher<Container, IsVectorized>::getData() const noexcept {
+	return std::ranges::data(container);
+}
 }
\ No newline at end of file
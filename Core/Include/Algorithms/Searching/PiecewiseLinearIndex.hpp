@@ -0,0 +1,221 @@
+#pragma once
+
+#include <algorithm>
+#include <limits>
+#include <ranges>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+#include "Algorithms/ContiguousRangeConcept.hpp"
+#include "BinarySearcher.hpp"
+
+namespace Core::Algorithms::Searching {
+/**
+ * @brief A learned index that approximates the positions of the keys in a sorted container with a piecewise linear
+ * model whose error is bounded.
+ * @details The keys are split into segments, each of which predicts the position of a key from a slope and the first key
+ * of the segment, such that every prediction is at most epsilon positions away from the actual position of the key.
+ * The segments are found in a single pass with the shrinking cone algorithm, which keeps the range of slopes that fit
+ * every key seen so far and starts a new segment when that range becomes empty. A query binary searches the first keys
+ * of the segments, which are a small fraction of the keys, and then binary searches only the 2 * epsilon positions
+ * around the prediction, so it touches a few cache lines of the container instead of one per level of a binary search.
+ * The container must not be modified while the index is used.
+ * @class PiecewiseLinearIndex
+ * @tparam Container The type of the container to index. Its elements must be of an arithmetic type and sorted in
+ * ascending order.
+ */
+template<ContiguousRangeConcept Container>
+requires std::is_arithmetic_v<std::ranges::range_value_t<Container>>
+class PiecewiseLinearIndex final {
+public:
+	/**
+	 * @brief Instantiates a new piecewise linear index and builds its model in O(n) time.
+	 * @param container: The sorted container to index.
+	 * @param epsilon: The maximum distance between the predicted and actual position of a key.
+	 * @throws std::invalid_argument: Thrown if the epsilon is 0.
+	 */
+	explicit PiecewiseLinearIndex(Container& container, const std::size_t epsilon = 64);
+	
+	/**
+	 * @brief Instantiates a new piecewise linear index by copying the given piecewise linear index.
+	 * @param other: The piecewise linear index to copy.
+	 */
+	PiecewiseLinearIndex(const PiecewiseLinearIndex& other) = default;
+	
+	/**
+	 * @brief Instantiates a new piecewise linear index by moving the given piecewise linear index.
+	 * @param other: The piecewise linear index to move.
+	 */
+	PiecewiseLinearIndex(PiecewiseLinearIndex&& other) noexcept = default;
+	
+	/**
+	 * @brief Destroys the piecewise linear index.
+	 */
+	~PiecewiseLinearIndex() noexcept = default;
+
+public:
+	/**
+	 * @brief Assigns the given piecewise linear index to this piecewise linear index using copy semantics.
+	 * @param other: The piecewise linear index to copy.
+	 * @return A reference to this piecewise linear index.
+	 */
+	PiecewiseLinearIndex& operator=(const PiecewiseLinearIndex& other) = default;
+	
+	/**
+	 * @brief Assigns the given piecewise linear index to this piecewise linear index using move semantics.
+	 * @param other: The piecewise linear index to move.
+	 * @return A reference to this piecewise linear index.
+	 */
+	PiecewiseLinearIndex& operator=(PiecewiseLinearIndex&& other) noexcept = default;
+
+public:
+	/**
+	 * @brief Finds the first key in the container that is not less than the given target.
+	 * @param target: The value to search for.
+	 * @return The index of the first key that is not less than the target, or the size of the container if every key is
+	 * less than it.
+	 */
+	std::size_t lowerBound(const std::ranges::range_value_t<Container>& target) const noexcept;
+	
+	/**
+	 * @brief Gets the maximum distance between the predicted and actual position of a key.
+	 * @return The maximum distance between the predicted and actual position of a key.
+	 */
+	std::size_t getEpsilon() const noexcept;
+	
+	/**
+	 * @brief Gets the number of linear segments in the model.
+	 * @return The number of linear segments in the model.
+	 */
+	std::size_t getSegmentCount() const noexcept;
+	
+	/**
+	 * @brief Gets the number of bytes the model occupies, not counting the indexed container.
+	 * @return The number of bytes the model occupies.
+	 */
+	std::size_t getModelSize() const noexcept;
+
+private:
+	using ValueType = std::ranges::range_value_t<Container>;
+	
+	/**
+	 * @brief A linear model of the positions of the keys in a segment.
+	 */
+	struct Segment final {
+		/**
+		 * @brief The number of positions the prediction advances per unit of key.
+		 */
+		double slope;
+		
+		/**
+		 * @brief The position of the first key of the segment.
+		 */
+		std::size_t start;
+	};
+	
+	/**
+	 * @brief Splits the keys of the container into segments using the shrinking cone algorithm.
+	 */
+	void build();
+
+private:
+	Container& container;
+	std::vector<ValueType> firstKeys;
+	std::vector<Segment> segments;
+	std::size_t epsilon;
+};
+
+template<ContiguousRangeConcept Container>
+requires std::is_arithmetic_v<std::ranges::range_value_t<Container>>
+PiecewiseLinearIndex<Container>::PiecewiseLinearIndex(Container& container, const std::size_t epsilon) :
+		container {container}, epsilon {epsilon} {
+	if (epsilon == 0) {
+		throw std::invalid_argument {"The epsilon must be greater than 0."};
+	}
+	
+	build();
+}
+
+template<ContiguousRangeConcept Container>
+requires std::is_arithmetic_v<std::ranges::range_value_t<Container>>
+std::size_t PiecewiseLinearIndex<Container>::lowerBound(const std::ranges::range_value_t<Container>& target) const noexcept {
+	const auto segmentIndex {BinarySearcher<const std::vector<ValueType>> {firstKeys}.lowerBound(target)};
+	if (segmentIndex == 0) {
+		return 0;
+	}
+	
+	const auto& segment {segments[segmentIndex - 1]};
+	const auto end {segmentIndex < segments.size() ? segments[segmentIndex].start : std::ranges::size(container)};
+	const auto offset {segment.slope * (static_cast<double>(target) - static_cast<double>(firstKeys[segmentIndex - 1]))};
+	const auto prediction {segment.start + static_cast<std::size_t>(std::clamp(offset, 0.0, static_cast<double>(end - segment.start)))};
+	
+	const auto first {prediction - std::min(prediction - segment.start, epsilon + 1)};
+	const auto last {std::min(prediction + epsilon + 2, end)};
+	return BinarySearcher<Container> {container}.lowerBound(target, first, last);
+}
+
+template<ContiguousRangeConcept Container>
+requires std::is_arithmetic_v<std::ranges::range_value_t<Container>>
+std::size_t PiecewiseLinearIndex<Container>::getEpsilon() const noexcept {
+	return epsilon;
+}
+
+template<ContiguousRangeConcept Container>
+requires std::is_arithmetic_v<std::ranges::range_value_t<Container>>
+std::size_t PiecewiseLinearIndex<Container>::getSegmentCount() const noexcept {
+	return segments.size();
+}
+
+template<ContiguousRangeConcept Container>
+requires std::is_arithmetic_v<std::ranges::range_value_t<Container>>
+std::size_t PiecewiseLinearIndex<Container>::getModelSize() const noexcept {
+	return firstKeys.capacity() * sizeof(ValueType) + segments.capacity() * sizeof(Segment);
+}
+
+template<ContiguousRangeConcept Container>
+requires std::is_arithmetic_v<std::ranges::range_value_t<Container>>
+void PiecewiseLinearIndex<Container>::build() {
+	const auto* const data {std::ranges::data(container)};
+	const auto size {std::ranges::size(container)};
+	const auto error {static_cast<double>(epsilon)};
+	
+	std::size_t start {0};
+	while (start < size) {
+		const auto firstKey {static_cast<double>(data[start])};
+		auto lowestSlope {0.0};
+		auto highestSlope {std::numeric_limits<double>::infinity()};
+		
+		auto index {start + 1};
+		for (; index < size; ++index) {
+			const auto keyDistance {static_cast<double>(data[index]) - firstKey};
+			const auto positionDistance {static_cast<double>(index - start)};
+			
+			if (keyDistance <= 0.0) {
+				if (positionDistance > error) {
+					break;
+				}
+				
+				continue;
+			}
+			
+			const auto lowSlope {std::max(lowestSlope, (positionDistance - error) / keyDistance)};
+			const auto highSlope {std::min(highestSlope, (positionDistance + error) / keyDistance)};
+			if (lowSlope > highSlope) {
+				break;
+			}
+			
+			lowestSlope = lowSlope;
+			highestSlope = highSlope;
+		}
+		
+		const auto slope {highestSlope == std::numeric_limits<double>::infinity() ? lowestSlope : (lowestSlope + highestSlope) / 2};
+		firstKeys.push_back(data[start]);
+		segments.push_back(Segment {slope, start});
+		start = index;
+	}
+	
+	firstKeys.shrink_to_fit();
+	segments.shrink_to_fit();
+}
+}
\ No newline at end of file
@@ -0,0 +1,315 @@
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <functional>
+#include <ranges>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+#include "Algorithms/CacheAlignedAllocator.hpp"
+#include "Algorithms/ContiguousRangeConcept.hpp"
+
+namespace Core::Algorithms::Searching {
+/**
+ * @brief A static, pointer-free B+ tree over sorted elements whose nodes are blocks of 16 keys.
+ * @details The bottom layer is a copy of the sorted elements and every layer above it stores, for each node, the
+ * smallest element of its 2nd to 17th children, so the children of the node at block k of a layer are the blocks
+ * 17k to 17k + 16 of the layer below and no pointers are stored. A query reads one block per layer, which for 32 bit
+ * keys is exactly one cache line, and ranks the target within it by comparing against all 16 keys at once. When AVX2
+ * is available and the elements are 32 bit integers compared with std::less the comparisons are done with two vector
+ * compares and a popcount, otherwise a branchless scalar loop is used. AVX2 is enabled by the ENABLE_AVX2 CMake option.
+ * Trailing slots of partially filled blocks are padded with the largest element.
+ * @class StaticBPlusTree
+ * @tparam ElementType: The type of the elements to search.
+ * @tparam Compare: The type of the comparison the elements are sorted by.
+ * @tparam IsVectorized: Whether nodes may be ranked with AVX2, which false turns off to measure the scalar loop.
+ */
+template<typename ElementType, typename Compare = std::less<ElementType>, bool IsVectorized = true>
+class StaticBPlusTree final {
+public:
+	/**
+	 * @brief Instantiates a new static B+ tree from the given sorted container.
+	 * @tparam Container: The type of the sorted container.
+	 * @param sortedContainer: The container to copy the elements from. It must be sorted using the given comparison.
+	 * @param compare: The comparison that returns true if the first argument comes before the second.
+	 */
+	template<ContiguousRangeConcept Container>
+	explicit StaticBPlusTree(const Container& sortedContainer, Compare compare = {});
+	
+	/**
+	 * @brief Instantiates a new static B+ tree by copying the given static B+ tree.
+	 * @param other: The static B+ tree to copy.
+	 */
+	StaticBPlusTree(const StaticBPlusTree& other) = default;
+	
+	/**
+	 * @brief Instantiates a new static B+ tree by moving the given static B+ tree.
+	 * @param other: The static B+ tree to move.
+	 */
+	StaticBPlusTree(StaticBPlusTree&& other) noexcept = default;
+	
+	/**
+	 * @brief Destroys the static B+ tree.
+	 */
+	~StaticBPlusTree() noexcept = default;
+
+public:
+	/**
+	 * @brief Assigns the given static B+ tree to this static B+ tree using copy semantics.
+	 * @param other: The static B+ tree to copy.
+	 * @return A reference to this static B+ tree.
+	 */
+	StaticBPlusTree& operator=(const StaticBPlusTree& other) = default;
+	
+	/**
+	 * @brief Assigns the given static B+ tree to this static B+ tree using move semantics.
+	 * @param other: The static B+ tree to move.
+	 * @return A reference to this static B+ tree.
+	 */
+	StaticBPlusTree& operator=(StaticBPlusTree&& other) noexcept = default;
+
+public:
+	/**
+	 * @brief Finds the first element that does not come before the given target.
+	 * @param target: The value to search for.
+	 * @return The index of the element in sorted order, or the size of the tree if every element comes before it.
+	 */
+	std::size_t lowerBound(const ElementType& target) const noexcept;
+	
+	/**
+	 * @brief Finds the first element that comes after the given target.
+	 * @param target: The value to search for.
+	 * @return The index of the element in sorted order, or the size of the tree if no element comes after it.
+	 */
+	std::size_t upperBound(const ElementType& target) const noexcept;
+	
+	/**
+	 * @brief Counts the elements that neither come before the lower value nor after the upper value.
+	 * @param lower: The first value of the range.
+	 * @param upper: The last value of the range.
+	 * @return The number of elements in the closed range, or 0 if the upper value comes before the lower value.
+	 */
+	std::size_t countInRange(const ElementType& lower, const ElementType& upper) const noexcept;
+	
+	/**
+	 * @brief Gets the number of elements in the tree.
+	 * @return The number of elements in the tree.
+	 */
+	std::size_t getSize() const noexcept;
+	
+	/**
+	 * @brief Gets the number of layers in the tree, including the bottom layer.
+	 * @return The number of layers in the tree, or 0 if the tree is empty.
+	 */
+	std::size_t getHeight() const noexcept;
+	
+	/**
+	 * @brief Checks if the tree is empty.
+	 * @return True if the tree is empty, false otherwise.
+	 */
+	bool isEmpty() const noexcept;
+
+private:
+	/**
+	 * @brief The number of keys in a node.
+	 */
+	static constexpr std::size_t BLOCK_SIZE {16};
+	
+	/**
+	 * @brief Whether nodes are ranked with AVX2 vector compares.
+	 */
+	static constexpr bool USES_SIMD {IsVectorized && std::is_same_v<ElementType, std::int32_t>
+	                                 && (std::is_same_v<Compare, std::less<std::int32_t>> || std::is_same_v<Compare, std::less<>>)};
+	
+	/**
+	 * @brief Gets the number of blocks needed to hold the given number of keys.
+	 * @param keyCount: The number of keys.
+	 * @return The number of blocks.
+	 */
+	static std::size_t getBlockCount(const std::size_t keyCount) noexcept;
+	
+	/**
+	 * @brief Gets the number of keys in the layer above a layer with the given number of keys.
+	 * @param keyCount: The number of keys in the layer below.
+	 * @return The number of keys in the layer above, which is a multiple of the block size.
+	 */
+	static std::size_t getParentKeyCount(const std::size_t keyCount) noexcept;
+	
+	/**
+	 * @brief Descends from the root to the bottom layer, ranking the target in one node of every layer.
+	 * @details The target must not come after the largest element, or not come after or equal it if Inclusive is true,
+	 * so that padded slots are never counted and every child visited exists.
+	 * @tparam Inclusive: Whether keys equal to the target are counted, which finds the upper rather than lower bound.
+	 * @param target: The value to search for.
+	 * @return The index of the bound in sorted order.
+	 */
+	template<bool Inclusive>
+	std::size_t descend(const ElementType& target) const noexcept;
+	
+	/**
+	 * @brief Counts the keys in the given block that come before the target, or do not come after it if Inclusive is
+	 * true.
+	 * @tparam Inclusive: Whether keys equal to the target are counted.
+	 * @param block: A pointer to the first key of the block.
+	 * @param target: The value to rank.
+	 * @return The number of counted keys.
+	 */
+	template<bool Inclusive>
+	std::size_t rank(const ElementType* block, const ElementType& target) const noexcept;
+
+private:
+	std::vector<ElementType, CacheAlignedAllocator<ElementType>> keys;
+	std::vector<std::size_t> layerOffsets;
+	Compare compare;
+	std::size_t size;
+};
+
+template<typename ElementType, typename Compare, bool IsVectorized>
+template<ContiguousRangeConcept Container>
+StaticBPlusTree<ElementType, Compare, IsVectorized>::StaticBPlusTree(const Container& sortedContainer,
+                                                                     Compare compare) :
+		compare {std::move(compare)}, size {std::ranges::size(sortedContainer)} {
+	if (size == 0) {
+		return;
+	}
+	
+	layerOffsets.push_back(0);
+	for (auto keyCount {size}; ; keyCount = getParentKeyCount(keyCount)) {
+		layerOffsets.push_back(layerOffsets.back() + getBlockCount(keyCount) * BLOCK_SIZE);
+		
+		if (keyCount <= BLOCK_SIZE) {
+			break;
+		}
+	}
+	
+	const auto& largest {*(std::ranges::cbegin(sortedContainer) + static_cast<std::ptrdiff_t>(size - 1))};
+	keys.assign(layerOffsets.back(), largest);
+	std::ranges::copy(sortedContainer, keys.begin());
+	
+	for (std::size_t layer {1}; layer < getHeight(); ++layer) {
+		const auto layerKeyCount {layerOffsets[layer + 1] - layerOffsets[layer]};
+		
+		for (std::size_t index {0}; index < layerKeyCount; ++index) {
+			auto block {(index / BLOCK_SIZE) * (BLOCK_SIZE + 1) + index % BLOCK_SIZE + 1};
+			for (std::size_t level {1}; level < layer; ++level) {
+				block *= BLOCK_SIZE + 1;
+			}
+			
+			if (block * BLOCK_SIZE < size) {
+				keys[layerOffsets[layer] + index] = keys[block * BLOCK_SIZE];
+			}
+		}
+	}
+}
+
+template<typename ElementType, typename Compare, bool IsVectorized>
+std::size_t StaticBPlusTree<ElementType, Compare, IsVectorized>::lowerBound(const ElementType& target) const noexcept {
+	if (size == 0 || compare(keys[size - 1], target)) {
+		return size;
+	}
+	
+	return descend<false>(target);
+}
+
+template<typename ElementType, typename Compare, bool IsVectorized>
+std::size_t StaticBPlusTree<ElementType, Compare, IsVectorized>::upperBound(const ElementType& target) const noexcept {
+	if (size == 0 || !compare(target, keys[size - 1])) {
+		return size;
+	}
+	
+	return descend<true>(target);
+}
+
+template<typename ElementType, typename Compare, bool IsVectorized>
+std::size_t StaticBPlusTree<ElementType, Compare, IsVectorized>::countInRange(const ElementType& lower,
+                                                                              const ElementType& upper) const noexcept {
+	if (compare(upper, lower)) {
+		return 0;
+	}
+	
+	return upperBound(upper) - lowerBound(lower);
+}
+
+template<typename ElementType, typename Compare, bool IsVectorized>
+std::size_t StaticBPlusTree<ElementType, Compare, IsVectorized>::getSize() const noexcept {
+	return size;
+}
+
+template<typename ElementType, typename Compare, bool IsVectorized>
+std::size_t StaticBPlusTree<ElementType, Compare, IsVectorized>::getHeight() const noexcept {
+	return layerOffsets.empty() ? 0 : layerOffsets.size() - 1;
+}
+
+template<typename ElementType, typename Compare, bool IsVectorized>
+bool StaticBPlusTree<ElementType, Compare, IsVectorized>::isEmpty() const noexcept {
+	return size == 0;
+}
+
+template<typename ElementType, typename Compare, bool IsVectorized>
+std::size_t StaticBPlusTree<ElementType, Compare, IsVectorized>::getBlockCount(const std::size_t keyCount) noexcept {
+	return (keyCount + BLOCK_SIZE - 1) / BLOCK_SIZE;
+}
+
+template<typename ElementType, typename Compare, bool IsVectorized>
+std::size_t StaticBPlusTree<ElementType, Compare, IsVectorized>::getParentKeyCount(
+		const std::size_t keyCount) noexcept {
+	return (getBlockCount(keyCount) + BLOCK_SIZE) / (BLOCK_SIZE + 1) * BLOCK_SIZE;
+}
+
+template<typename ElementType, typename Compare, bool IsVectorized>
+template<bool Inclusive>
+std::size_t StaticBPlusTree<ElementType, Compare, IsVectorized>::descend(const ElementType& target) const noexcept {
+	const auto* const data {keys.data()};
+	std::size_t offset {0};
+	
+	for (auto layer {getHeight() - 1}; layer > 0; --layer) {
+		const auto childIndex {rank<Inclusive>(data + layerOffsets[layer] + offset, target)};
+		offset = offset * (BLOCK_SIZE + 1) + childIndex * BLOCK_SIZE;
+	}
+	
+	return offset + rank<Inclusive>(data + offset, target);
+}
+
+template<typename ElementType, typename Compare, bool IsVectorized>
+template<bool Inclusive>
+std::size_t StaticBPlusTree<ElementType, Compare, IsVectorized>::rank(const ElementType* block,
+                                                                      const ElementType& target) const noexcept {
+#if defined(__AVX2__)
+	if constexpr (USES_SIMD) {
+		const auto targets {_mm256_set1_epi32(target)};
+		const auto firstKeys {_mm256_load_si256(reinterpret_cast<const __m256i*>(block))};
+		const auto secondKeys {_mm256_load_si256(reinterpret_cast<const __m256i*>(block + BLOCK_SIZE / 2))};
+		
+		if constexpr (Inclusive) {
+			const auto greater {_mm256_packs_epi32(_mm256_cmpgt_epi32(firstKeys, targets),
+			                                       _mm256_cmpgt_epi32(secondKeys, targets))};
+			const auto mask {static_cast<std::uint32_t>(_mm256_movemask_epi8(greater))};
+			return BLOCK_SIZE - static_cast<std::size_t>(std::popcount(mask)) / 2;
+		} else {
+			const auto less {_mm256_packs_epi32(_mm256_cmpgt_epi32(targets, firstKeys),
+			                                    _mm256_cmpgt_epi32(targets, secondKeys))};
+			const auto mask {static_cast<std::uint32_t>(_mm256_movemask_epi8(less))};
+			return static_cast<std::size_t>(std::popcount(mask)) / 2;
+		}
+	}
+#endif
+
+	std::size_t count {0};
+	for (std::size_t index {0}; index < BLOCK_SIZE; ++index) {
+		if constexpr (Inclusive) {
+			count += compare(target, block[index]) ? 0 : 1;
+		} else {
+			count += compare(block[index], target) ? 1 : 0;
+		}
+	}
+	
+	return count;
+}
+}
\ No newline at end of file
@@ -2,7 +2,7 @@
 
 #include <algorithm>
 
-#include "Algorithms/ArrayOrVectorConcept.hpp"
+#include "Algorithms/ContiguousRangeConcept.hpp"
 #include "SortingAlgorithm.hpp"
 
 namespace Core::Algorithms::Sorting {
@@ -10,8 +10,8 @@ namespace Core::Algorithms::Sorting {
  * @brief An implementation of the bubble sort algorithm using iterators.
  * @tparam Container: The type of the container to sort.
  */
-template<ArrayOrVectorConcept Container>
-class BubbleSorter final : public SortingAlgorithm<typename Container::value_type> {
+template<ContiguousRangeConcept Container>
+class BubbleSorter final : public SortingAlgorithm<std::ranges::range_value_t<Container>> {
 public:
 	/**
 	 * @brief Instantiates a new bubble sorter.
@@ -56,8 +56,8 @@ public:
 	 * @brief Sorts the container using the given predicate and the bubble sort algorithm.
 	 * @param predicate: The predicate to use to sort the container.
 	 */
-	void sort(const std::function<bool(const typename Container::value_type&,
-	                                           const typename Container::value_type&)>& predicate) noexcept override;
+	void sort(const std::function<bool(const std::ranges::range_value_t<Container>&,
+	                                           const std::ranges::range_value_t<Container>&)>& predicate) noexcept override;
 
 private:
 	/**
@@ -70,31 +70,31 @@ private:
 	template<typename Iterator>
 	void bubbleSort(Iterator begin,
 	                Iterator end,
-	                const std::function<bool(const typename Container::value_type&,
-	                                         const typename Container::value_type&)>& predicate) noexcept;
+	                const std::function<bool(const std::ranges::range_value_t<Container>&,
+	                                         const std::ranges::range_value_t<Container>&)>& predicate) noexcept;
 
 private:
 	Container& container;
 };
 
-template<ArrayOrVectorConcept Container>
+template<ContiguousRangeConcept Container>
 BubbleSorter<Container>::BubbleSorter(Container& container) noexcept :
-		SortingAlgorithm<typename Container::value_type> {}, container {container} {
+		SortingAlgorithm<std::ranges::range_value_t<Container>> {}, container {container} {
 	
 }
 
-template<ArrayOrVectorConcept Container>
-void BubbleSorter<Container>::sort(const std::function<bool(const typename Container::value_type&,
-                                                            const typename Container::value_type&)>& predicate) noexcept {
+template<ContiguousRangeConcept Container>
+void BubbleSorter<Container>::sort(const std::function<bool(const std::ranges::range_value_t<Container>&,
+                                                            const std::ranges::range_value_t<Container>&)>& predicate) noexcept {
 	bubbleSort(container.begin(), container.end(), predicate);
 }
 
-template<ArrayOrVectorConcept Container>
+template<ContiguousRangeConcept Container>
 template<typename Iterator>
 void BubbleSorter<Container>::bubbleSort(Iterator begin,
                                          Iterator end,
-                                         const std::function<bool(const typename Container::value_type&,
-                                                                  const typename Container::value_type&)>& predicate) noexcept {
+                                         const std::function<bool(const std::ranges::range_value_t<Container>&,
+                                                                  const std::ranges::range_value_t<Container>&)>& predicate) noexcept {
 	bool wasElementSwapped;
 	
 	for (auto passIterator {begin}; passIterator != end - 1; ++passIterator) {
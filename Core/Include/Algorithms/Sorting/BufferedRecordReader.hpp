@@ -0,0 +1,165 @@
+#pragma once
+
+#include <filesystem>
+#include <fstream>
+#include <future>
+#include <optional>
+#include <stdexcept>
+#include <vector>
+
+#include "FixedSizeRecordConcept.hpp"
+
+namespace Core::Algorithms::Sorting {
+/**
+ * @brief Reads fixed size records sequentially from a binary file using double buffering.
+ * @details While the records of one block are consumed, the next block is read asynchronously into a second buffer,
+ * so disk reads overlap with the work done on the records that have already been read.
+ * @class BufferedRecordReader
+ * @tparam RecordType: The type of the records to read.
+ */
+template<FixedSizeRecordConcept RecordType>
+class BufferedRecordReader final {
+public:
+	/**
+	 * @brief Instantiates a new buffered record reader and starts reading the first block.
+	 * @param path: The path of the file to read.
+	 * @param blockRecordCount: The number of records to read per block.
+	 * @throws std::invalid_argument: Thrown if the block record count is 0.
+	 */
+	BufferedRecordReader(const std::filesystem::path& path, const std::size_t blockRecordCount);
+	
+	/**
+	 * @brief Deleted copy constructor.
+	 */
+	BufferedRecordReader(const BufferedRecordReader& other) = delete;
+	
+	/**
+	 * @brief Deleted move constructor.
+	 */
+	BufferedRecordReader(BufferedRecordReader&& other) noexcept = delete;
+	
+	/**
+	 * @brief Waits for any pending read and destroys the buffered record reader.
+	 */
+	~BufferedRecordReader() noexcept;
+
+public:
+	/**
+	 * @brief Deleted copy assignment operator.
+	 */
+	BufferedRecordReader& operator=(const BufferedRecordReader& other) = delete;
+	
+	/**
+	 * @brief Deleted move assignment operator.
+	 */
+	BufferedRecordReader& operator=(BufferedRecordReader&& other) noexcept = delete;
+
+public:
+	/**
+	 * @brief Reads the next record.
+	 * @return The next record, or std::nullopt if the end of the file has been reached or a read failed.
+	 */
+	std::optional<RecordType> next();
+	
+	/**
+	 * @brief Checks if the file was opened and every read so far has succeeded.
+	 * @details A trailing partial record is treated as a failed read.
+	 * @return True if no error has occurred, false otherwise.
+	 */
+	bool isGood() const noexcept;
+
+private:
+	/**
+	 * @brief Starts reading the next block into the back buffer asynchronously.
+	 */
+	void startReadingNextBlock();
+	
+	/**
+	 * @brief Reads the next block from the file into the given buffer.
+	 * @param buffer: The buffer to read into. It is resized to the number of complete records read.
+	 * @return True if the read succeeded, false otherwise.
+	 */
+	bool readBlock(std::vector<RecordType>& buffer);
+
+private:
+	std::ifstream stream;
+	std::size_t blockRecordCount;
+	std::vector<RecordType> frontBuffer;
+	std::vector<RecordType> backBuffer;
+	std::future<bool> pendingRead;
+	std::size_t position {0};
+	bool good;
+};
+
+template<FixedSizeRecordConcept RecordType>
+BufferedRecordReader<RecordType>::BufferedRecordReader(const std::filesystem::path& path,
+                                                       const std::size_t blockRecordCount)
+		: stream {path, std::ios::binary}, blockRecordCount {blockRecordCount}, good {stream.is_open()} {
+	if (blockRecordCount == 0) {
+		throw std::invalid_argument {"The block record count must be greater than 0."};
+	}
+	
+	if (good) {
+		startReadingNextBlock();
+	}
+}
+
+template<FixedSizeRecordConcept RecordType>
+BufferedRecordReader<RecordType>::~BufferedRecordReader() noexcept {
+	if (pendingRead.valid()) {
+		pendingRead.wait();
+	}
+}
+
+template<FixedSizeRecordConcept RecordType>
+std::optional<RecordType> BufferedRecordReader<RecordType>::next() {
+	if (position == frontBuffer.size()) {
+		if (!pendingRead.valid()) {
+			return std::nullopt;
+		}
+		
+		good = pendingRead.get() && good;
+		std::swap(frontBuffer, backBuffer);
+		position = 0;
+		
+		if (frontBuffer.empty()) {
+			return std::nullopt;
+		}
+		
+		if (frontBuffer.size() == blockRecordCount && good) {
+			startReadingNextBlock();
+		}
+	}
+	
+	return frontBuffer[position++];
+}
+
+template<FixedSizeRecordConcept RecordType>
+bool BufferedRecordReader<RecordType>::isGood() const noexcept {
+	return good;
+}
+
+template<FixedSizeRecordConcept RecordType>
+void BufferedRecordReader<RecordType>::startReadingNextBlock() {
+	pendingRead = std::async(std::launch::async, [this]() {
+		return readBlock(backBuffer);
+	});
+}
+
+template<FixedSizeRecordConcept RecordType>
+bool BufferedRecordReader<RecordType>::readBlock(std::vector<RecordType>& buffer) {
+	buffer.resize(blockRecordCount);
+	
+	const auto requestedBytes {static_cast<std::streamsize>(blockRecordCount * sizeof(RecordType))};
+	stream.read(reinterpret_cast<char*>(buffer.data()), requestedBytes);
+	
+	const auto readBytes {static_cast<std::size_t>(stream.gcount())};
+	buffer.resize(readBytes / sizeof(RecordType));
+	
+	if (stream.bad() || readBytes % sizeof(RecordType) != 0) {
+		return false;
+	}
+	
+	return readBytes == static_cast<std::size_t>(requestedBytes) || stream.eof();
+}
+}
\ No newline at end of file
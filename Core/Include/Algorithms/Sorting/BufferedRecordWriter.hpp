@@ -0,0 +1,119 @@
+#pragma once
+
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <vector>
+
+#include "FixedSizeRecordConcept.hpp"
+
+namespace Core::Algorithms::Sorting {
+/**
+ * @brief Writes fixed size records sequentially to a binary file, one block at a time.
+ * @class BufferedRecordWriter
+ * @tparam RecordType: The type of the records to write.
+ */
+template<FixedSizeRecordConcept RecordType>
+class BufferedRecordWriter final {
+public:
+	/**
+	 * @brief Instantiates a new buffered record writer, truncating the file if it exists.
+	 * @param path: The path of the file to write.
+	 * @param blockRecordCount: The number of records to buffer before writing them to the file.
+	 * @throws std::invalid_argument: Thrown if the block record count is 0.
+	 */
+	BufferedRecordWriter(const std::filesystem::path& path, const std::size_t blockRecordCount);
+	
+	/**
+	 * @brief Deleted copy constructor.
+	 */
+	BufferedRecordWriter(const BufferedRecordWriter& other) = delete;
+	
+	/**
+	 * @brief Deleted move constructor.
+	 */
+	BufferedRecordWriter(BufferedRecordWriter&& other) noexcept = delete;
+	
+	/**
+	 * @brief Destroys the buffered record writer without flushing the buffered records.
+	 */
+	~BufferedRecordWriter() noexcept = default;
+
+public:
+	/**
+	 * @brief Deleted copy assignment operator.
+	 */
+	BufferedRecordWriter& operator=(const BufferedRecordWriter& other) = delete;
+	
+	/**
+	 * @brief Deleted move assignment operator.
+	 */
+	BufferedRecordWriter& operator=(BufferedRecordWriter&& other) noexcept = delete;
+
+public:
+	/**
+	 * @brief Buffers the given record, writing the buffer to the file once it is full.
+	 * @param record: The record to write.
+	 * @return True if no error has occurred, false otherwise.
+	 */
+	bool write(const RecordType& record);
+	
+	/**
+	 * @brief Writes the buffered records to the file and flushes the file.
+	 * @return True if no error has occurred, false otherwise.
+	 */
+	bool flush();
+
+private:
+	/**
+	 * @brief Writes the buffered records to the file.
+	 * @return True if no error has occurred, false otherwise.
+	 */
+	bool writeBuffer();
+
+private:
+	std::ofstream stream;
+	std::vector<RecordType> buffer;
+	std::size_t blockRecordCount;
+};
+
+template<FixedSizeRecordConcept RecordType>
+BufferedRecordWriter<RecordType>::BufferedRecordWriter(const std::filesystem::path& path,
+                                                       const std::size_t blockRecordCount)
+		: stream {path, std::ios::binary | std::ios::trunc}, blockRecordCount {blockRecordCount} {
+	if (blockRecordCount == 0) {
+		throw std::invalid_argument {"The block record count must be greater than 0."};
+	}
+	
+	buffer.reserve(blockRecordCount);
+}
+
+template<FixedSizeRecordConcept RecordType>
+bool BufferedRecordWriter<RecordType>::write(const RecordType& record) {
+	buffer.push_back(record);
+	
+	if (buffer.size() == blockRecordCount) {
+		return writeBuffer();
+	}
+	
+	return stream.good();
+}
+
+template<FixedSizeRecordConcept RecordType>
+bool BufferedRecordWriter<RecordType>::flush() {
+	if (!writeBuffer()) {
+		return false;
+	}
+	
+	stream.flush();
+	return stream.good();
+}
+
+template<FixedSizeRecordConcept RecordType>
+bool BufferedRecordWriter<RecordType>::writeBuffer() {
+	stream.write(reinterpret_cast<const char*>(buffer.data()),
+	             static_cast<std::streamsize>(buffer.size() * sizeof(RecordType)));
+	buffer.clear();
+	return stream.good();
+}
+}
\ No newline at end of file
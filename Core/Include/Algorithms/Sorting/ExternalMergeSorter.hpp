@@ -0,0 +1,408 @@
+#pragma once
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <future>
+#include <memory>
+#include <optional>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <vector>
+
+#include "BufferedRecordReader.hpp"
+#include "BufferedRecordWriter.hpp"
+#include "FixedSizeRecordConcept.hpp"
+#include "LoserTree.hpp"
+#include "TimSorter.hpp"
+
+namespace Core::Algorithms::Sorting {
+/**
+ * @brief An implementation of the external merge sort algorithm for binary files of fixed size records.
+ * @details The input file is streamed in chunks that fit within the memory limit. Each chunk is sorted in memory with
+ * tim sort and written to a temporary run file while the next chunk is read asynchronously. The runs are then merged
+ * with a loser tree, using as many passes as needed to keep the number of runs merged at once, and so the number of
+ * read buffers, within the memory limit. Every run is read with double buffered sequential reads. Files that fit
+ * within a single chunk are sorted entirely in memory without creating any temporary files.
+ * @class ExternalMergeSorter
+ * @tparam RecordType: The type of the records stored in the files.
+ */
+template<FixedSizeRecordConcept RecordType>
+class ExternalMergeSorter final {
+public:
+	/**
+	 * @brief Instantiates a new external merge sorter.
+	 * @param memoryLimit: The maximum number of bytes to use for records held in memory.
+	 * @param temporaryDirectory: The directory in which to create the temporary run files.
+	 * @throws std::invalid_argument: Thrown if the memory limit cannot hold the records needed to merge two runs.
+	 */
+	explicit ExternalMergeSorter(const std::size_t memoryLimit,
+	                             std::filesystem::path temporaryDirectory = std::filesystem::temp_directory_path());
+	
+	/**
+	 * @brief Instantiates a new external merge sorter by copying the given external merge sorter.
+	 * @param other: The external merge sorter to copy.
+	 */
+	ExternalMergeSorter(const ExternalMergeSorter& other) = default;
+	
+	/**
+	 * @brief Instantiates a new external merge sorter by moving the given external merge sorter.
+	 * @param other: The external merge sorter to move.
+	 */
+	ExternalMergeSorter(ExternalMergeSorter&& other) noexcept = default;
+	
+	/**
+	 * @brief Destroys the external merge sorter.
+	 */
+	~ExternalMergeSorter() noexcept = default;
+
+public:
+	/**
+	 * @brief Assigns the given external merge sorter to this external merge sorter using copy semantics.
+	 * @param other: The external merge sorter to copy.
+	 * @return A reference to this external merge sorter.
+	 */
+	ExternalMergeSorter& operator=(const ExternalMergeSorter& other) = default;
+	
+	/**
+	 * @brief Assigns the given external merge sorter to this external merge sorter using move semantics.
+	 * @param other: The external merge sorter to move.
+	 * @return A reference to this external merge sorter.
+	 */
+	ExternalMergeSorter& operator=(ExternalMergeSorter&& other) noexcept = default;
+
+public:
+	/**
+	 * @brief Sorts the records of the input file into the output file.
+	 * @details The sort is stable. The input and output paths may refer to the same file.
+	 * @param inputPath: The path of the file containing the records to sort.
+	 * @param outputPath: The path of the file to write the sorted records to.
+	 * @param predicate: The predicate that returns true if the first record should come before the second.
+	 * @return True if the records were sorted, false if the input file could not be read, its size is not a multiple of
+	 * the record size, or a temporary or output file could not be written.
+	 */
+	bool sort(const std::filesystem::path& inputPath,
+	          const std::filesystem::path& outputPath,
+	          const std::function<bool(const RecordType&, const RecordType&)>& predicate);
+
+private:
+	/**
+	 * @brief Sorts a file that fits within a single chunk entirely in memory.
+	 * @param inputPath: The path of the file containing the records to sort.
+	 * @param outputPath: The path of the file to write the sorted records to.
+	 * @param recordCount: The number of records in the input file.
+	 * @param predicate: The predicate that returns true if the first record should come before the second.
+	 * @return True if the records were sorted, false otherwise.
+	 */
+	bool sortInMemory(const std::filesystem::path& inputPath,
+	                  const std::filesystem::path& outputPath,
+	                  const std::size_t recordCount,
+	                  const std::function<bool(const RecordType&, const RecordType&)>& predicate) const;
+	
+	/**
+	 * @brief Sorts a file by creating sorted runs in the given directory and merging them into the output file.
+	 * @param inputPath: The path of the file containing the records to sort.
+	 * @param outputPath: The path of the file to write the sorted records to.
+	 * @param runDirectory: The directory in which to create the run files.
+	 * @param predicate: The predicate that returns true if the first record should come before the second.
+	 * @return True if the records were sorted, false otherwise.
+	 */
+	bool sortUsingRuns(const std::filesystem::path& inputPath,
+	                   const std::filesystem::path& outputPath,
+	                   const std::filesystem::path& runDirectory,
+	                   const std::function<bool(const RecordType&, const RecordType&)>& predicate) const;
+	
+	/**
+	 * @brief Splits the input file into chunks, sorts each chunk in memory and writes it to its own run file.
+	 * @param inputPath: The path of the file containing the records to sort.
+	 * @param runDirectory: The directory in which to create the run files.
+	 * @param predicate: The predicate that returns true if the first record should come before the second.
+	 * @return The paths of the run files in input order, or std::nullopt if a file could not be read or written.
+	 */
+	std::optional<std::vector<std::filesystem::path>> createSortedRuns(const std::filesystem::path& inputPath,
+	                                                                   const std::filesystem::path& runDirectory,
+	                                                                   const std::function<bool(const RecordType&,
+	                                                                                            const RecordType&)>& predicate) const;
+	
+	/**
+	 * @brief Merges the given runs into a single sorted file.
+	 * @param runs: The paths of the run files to merge, in input order.
+	 * @param outputPath: The path of the file to write the merged records to.
+	 * @param predicate: The predicate that returns true if the first record should come before the second.
+	 * @return True if the runs were merged, false otherwise.
+	 */
+	bool mergeRuns(const std::vector<std::filesystem::path>& runs,
+	               const std::filesystem::path& outputPath,
+	               const std::function<bool(const RecordType&, const RecordType&)>& predicate) const;
+	
+	/**
+	 * @brief Creates a uniquely named directory for the run files within the temporary directory.
+	 * @return The path of the created directory, or std::nullopt if it could not be created.
+	 */
+	std::optional<std::filesystem::path> createRunDirectory() const;
+	
+	/**
+	 * @brief Writes the given records to the given file, truncating it if it exists.
+	 * @param path: The path of the file to write.
+	 * @param records: The records to write.
+	 * @return True if the records were written, false otherwise.
+	 */
+	static bool writeRecords(const std::filesystem::path& path, const std::vector<RecordType>& records);
+	
+	/**
+	 * @brief Gets the number of records that fit within the memory limit.
+	 * @return The number of records that fit within the memory limit.
+	 */
+	std::size_t getMemoryRecordCount() const noexcept;
+	
+	/**
+	 * @brief Gets the number of records sorted in memory per run.
+	 * @details A third of the memory limit is used per chunk, leaving room for the chunk being read asynchronously and
+	 * the merge buffer used by tim sort.
+	 * @return The number of records per chunk.
+	 */
+	std::size_t getChunkRecordCount() const noexcept;
+	
+	/**
+	 * @brief Gets the maximum number of runs that are merged at once.
+	 * @details Each run needs two read buffers and the output needs one write buffer, all of which should hold at least
+	 * MINIMUM_BLOCK_SIZE bytes so that reads and writes stay large and sequential.
+	 * @return The maximum number of runs that are merged at once, which is at least 2.
+	 */
+	std::size_t getMaximumFanIn() const noexcept;
+
+private:
+	static constexpr std::size_t MINIMUM_MEMORY_RECORD_COUNT {5};
+	static constexpr std::size_t MINIMUM_BLOCK_SIZE {64 * 1024};
+	
+	std::size_t memoryLimit;
+	std::filesystem::path temporaryDirectory;
+};
+
+template<FixedSizeRecordConcept RecordType>
+ExternalMergeSorter<RecordType>::ExternalMergeSorter(const std::size_t memoryLimit,
+                                                     std::filesystem::path temporaryDirectory)
+		: memoryLimit {memoryLimit}, temporaryDirectory {std::move(temporaryDirectory)} {
+	if (getMemoryRecordCount() < MINIMUM_MEMORY_RECORD_COUNT) {
+		throw std::invalid_argument {"The memory limit must hold at least 5 records."};
+	}
+}
+
+template<FixedSizeRecordConcept RecordType>
+bool ExternalMergeSorter<RecordType>::sort(const std::filesystem::path& inputPath,
+                                           const std::filesystem::path& outputPath,
+                                           const std::function<bool(const RecordType&,
+                                                                    const RecordType&)>& predicate) {
+	std::error_code errorCode {};
+	const auto fileSize {std::filesystem::file_size(inputPath, errorCode)};
+	if (errorCode || fileSize % sizeof(RecordType) != 0) {
+		return false;
+	}
+	
+	const auto recordCount {static_cast<std::size_t>(fileSize / sizeof(RecordType))};
+	if (recordCount <= getChunkRecordCount()) {
+		return sortInMemory(inputPath, outputPath, recordCount, predicate);
+	}
+	
+	const auto runDirectory {createRunDirectory()};
+	if (!runDirectory.has_value()) {
+		return false;
+	}
+	
+	const auto isSorted {sortUsingRuns(inputPath, outputPath, *runDirectory, predicate)};
+	std::filesystem::remove_all(*runDirectory, errorCode);
+	return isSorted;
+}
+
+template<FixedSizeRecordConcept RecordType>
+bool ExternalMergeSorter<RecordType>::sortInMemory(const std::filesystem::path& inputPath,
+                                                   const std::filesystem::path& outputPath,
+                                                   const std::size_t recordCount,
+                                                   const std::function<bool(const RecordType&,
+                                                                            const RecordType&)>& predicate) const {
+	std::vector<RecordType> records(recordCount);
+	
+	{
+		std::ifstream stream {inputPath, std::ios::binary};
+		stream.read(reinterpret_cast<char*>(records.data()),
+		            static_cast<std::streamsize>(recordCount * sizeof(RecordType)));
+		if (!stream) {
+			return false;
+		}
+	}
+	
+	TimSorter<std::vector<RecordType>> sorter {records};
+	sorter.sort(predicate);
+	
+	return writeRecords(outputPath, records);
+}
+
+template<FixedSizeRecordConcept RecordType>
+bool ExternalMergeSorter<RecordType>::sortUsingRuns(const std::filesystem::path& inputPath,
+                                                    const std::filesystem::path& outputPath,
+                                                    const std::filesystem::path& runDirectory,
+                                                    const std::function<bool(const RecordType&,
+                                                                             const RecordType&)>& predicate) const {
+	auto runs {createSortedRuns(inputPath, runDirectory, predicate)};
+	if (!runs.has_value()) {
+		return false;
+	}
+	
+	const auto maximumFanIn {getMaximumFanIn()};
+	auto nextRunIndex {runs->size()};
+	std::error_code errorCode {};
+	
+	while (runs->size() > maximumFanIn) {
+		std::vector<std::filesystem::path> mergedRuns {};
+		mergedRuns.reserve((runs->size() + maximumFanIn - 1) / maximumFanIn);
+		
+		for (std::size_t first {0}; first < runs->size(); first += maximumFanIn) {
+			const auto last {std::min(first + maximumFanIn, runs->size())};
+			if (last - first == 1) {
+				mergedRuns.push_back((*runs)[first]);
+				continue;
+			}
+			
+			const std::vector<std::filesystem::path> group(runs->begin() + first, runs->begin() + last);
+			auto mergedRun {runDirectory / ("run-" + std::to_string(nextRunIndex++) + ".bin")};
+			if (!mergeRuns(group, mergedRun, predicate)) {
+				return false;
+			}
+			
+			for (const auto& run : group) {
+				std::filesystem::remove(run, errorCode);
+			}
+			
+			mergedRuns.push_back(std::move(mergedRun));
+		}
+		
+		runs = std::move(mergedRuns);
+	}
+	
+	return mergeRuns(*runs, outputPath, predicate);
+}
+
+template<FixedSizeRecordConcept RecordType>
+std::optional<std::vector<std::filesystem::path>> ExternalMergeSorter<RecordType>::createSortedRuns(
+		const std::filesystem::path& inputPath,
+		const std::filesystem::path& runDirectory,
+		const std::function<bool(const RecordType&, const RecordType&)>& predicate) const {
+	std::ifstream stream {inputPath, std::ios::binary};
+	if (!stream.is_open()) {
+		return std::nullopt;
+	}
+	
+	const auto chunkRecordCount {getChunkRecordCount()};
+	const auto readChunk {[&stream, chunkRecordCount](std::vector<RecordType>& chunk) {
+		chunk.resize(chunkRecordCount);
+		stream.read(reinterpret_cast<char*>(chunk.data()),
+		            static_cast<std::streamsize>(chunkRecordCount * sizeof(RecordType)));
+		chunk.resize(static_cast<std::size_t>(stream.gcount()) / sizeof(RecordType));
+		return !stream.bad();
+	}};
+	
+	std::vector<RecordType> chunk {};
+	std::vector<RecordType> nextChunk {};
+	if (!readChunk(chunk)) {
+		return std::nullopt;
+	}
+	
+	std::vector<std::filesystem::path> runs {};
+	while (!chunk.empty()) {
+		auto pendingRead {std::async(std::launch::async, readChunk, std::ref(nextChunk))};
+		
+		TimSorter<std::vector<RecordType>> sorter {chunk};
+		sorter.sort(predicate);
+		
+		auto run {runDirectory / ("run-" + std::to_string(runs.size()) + ".bin")};
+		const auto isWritten {writeRecords(run, chunk)};
+		if (!pendingRead.get() || !isWritten) {
+			return std::nullopt;
+		}
+		
+		runs.push_back(std::move(run));
+		std::swap(chunk, nextChunk);
+	}
+	
+	return runs;
+}
+
+template<FixedSizeRecordConcept RecordType>
+bool ExternalMergeSorter<RecordType>::mergeRuns(const std::vector<std::filesystem::path>& runs,
+                                                const std::filesystem::path& outputPath,
+                                                const std::function<bool(const RecordType&,
+                                                                         const RecordType&)>& predicate) const {
+	const auto blockRecordCount {std::max<std::size_t>(1, getMemoryRecordCount() / (2 * runs.size() + 1))};
+	
+	std::vector<std::unique_ptr<BufferedRecordReader<RecordType>>> readers {};
+	std::vector<std::optional<RecordType>> leaves {};
+	readers.reserve(runs.size());
+	leaves.reserve(runs.size());
+	for (const auto& run : runs) {
+		readers.push_back(std::make_unique<BufferedRecordReader<RecordType>>(run, blockRecordCount));
+		leaves.push_back(readers.back()->next());
+	}
+	
+	LoserTree<RecordType> loserTree {std::move(leaves), predicate};
+	BufferedRecordWriter<RecordType> writer {outputPath, blockRecordCount};
+	while (!loserTree.isEmpty()) {
+		if (!writer.write(loserTree.getWinner())) {
+			return false;
+		}
+		
+		loserTree.replaceWinner(readers[loserTree.getWinnerIndex()]->next());
+	}
+	
+	const auto isEveryRunRead {std::ranges::all_of(readers, [](const auto& reader) {
+		return reader->isGood();
+	})};
+	
+	return writer.flush() && isEveryRunRead;
+}
+
+template<FixedSizeRecordConcept RecordType>
+std::optional<std::filesystem::path> ExternalMergeSorter<RecordType>::createRunDirectory() const {
+	std::random_device randomDevice {};
+	std::error_code errorCode {};
+	
+	for (auto attempt {0}; attempt < 16; ++attempt) {
+		auto runDirectory {temporaryDirectory / ("ExternalMergeSorter-" + std::to_string(randomDevice()))};
+		if (std::filesystem::create_directory(runDirectory, errorCode)) {
+			return runDirectory;
+		}
+	}
+	
+	return std::nullopt;
+}
+
+template<FixedSizeRecordConcept RecordType>
+bool ExternalMergeSorter<RecordType>::writeRecords(const std::filesystem::path& path,
+                                                   const std::vector<RecordType>& records) {
+	std::ofstream stream {path, std::ios::binary | std::ios::trunc};
+	stream.write(reinterpret_cast<const char*>(records.data()),
+	             static_cast<std::streamsize>(records.size() * sizeof(RecordType)));
+	stream.flush();
+	return stream.good();
+}
+
+template<FixedSizeRecordConcept RecordType>
+std::size_t ExternalMergeSorter<RecordType>::getMemoryRecordCount() const noexcept {
+	return memoryLimit / sizeof(RecordType);
+}
+
+template<FixedSizeRecordConcept RecordType>
+std::size_t ExternalMergeSorter<RecordType>::getChunkRecordCount() const noexcept {
+	return std::max<std::size_t>(1, getMemoryRecordCount() / 3);
+}
+
+template<FixedSizeRecordConcept RecordType>
+std::size_t ExternalMergeSorter<RecordType>::getMaximumFanIn() const noexcept {
+	const auto minimumBlockRecordCount {std::max<std::size_t>(1, MINIMUM_BLOCK_SIZE / sizeof(RecordType))};
+	const auto blockCount {getMemoryRecordCount() / minimumBlockRecordCount};
+	
+	return blockCount < 5 ? 2 : (blockCount - 1) / 2;
+}
+}
\ No newline at end of file
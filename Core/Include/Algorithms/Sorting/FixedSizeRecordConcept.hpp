@@ -0,0 +1,13 @@
+#pragma once
+
+#include <type_traits>
+
+namespace Core::Algorithms::Sorting {
+/**
+ * @brief A concept that requires the record to have a fixed size and be safe to read and write as raw bytes.
+ * @tparam RecordType: The record type.
+ */
+template<typename RecordType>
+concept FixedSizeRecordConcept = std::is_trivially_copyable_v<RecordType> &&
+                                 std::is_default_constructible_v<RecordType>;
+}
\ No newline at end of file
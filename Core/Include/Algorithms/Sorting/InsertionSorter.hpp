@@ -1,6 +1,6 @@
 #pragma once
 
-#include "Algorithms/ArrayOrVectorConcept.hpp"
+#include "Algorithms/ContiguousRangeConcept.hpp"
 #include "SortingAlgorithm.hpp"
 
 namespace Core::Algorithms::Sorting {
@@ -8,8 +8,8 @@ namespace Core::Algorithms::Sorting {
  * @brief An implementation of the insertion sort algorithm using iterators.
  * @tparam Container: The type of the container to sort.
  */
-template<ArrayOrVectorConcept Container>
-class InsertionSorter final : public SortingAlgorithm<typename Container::value_type> {
+template<ContiguousRangeConcept Container>
+class InsertionSorter final : public SortingAlgorithm<std::ranges::range_value_t<Container>> {
 public:
 	/**
 	 * @brief Instantiates a new insertion sorter.
@@ -54,8 +54,8 @@ public:
 	 * @brief Sorts the container using the given predicate and the insertion sort algorithm.
 	 * @param predicate: The predicate to use to sort the container.
 	 */
-	void sort(const std::function<bool(const typename Container::value_type&,
-	                                           const typename Container::value_type&)>& predicate) noexcept override;
+	void sort(const std::function<bool(const std::ranges::range_value_t<Container>&,
+	                                           const std::ranges::range_value_t<Container>&)>& predicate) noexcept override;
 
 private:
 	/**
@@ -68,30 +68,30 @@ private:
 	template<typename Iterator>
 	void insertionSort(Iterator begin,
 	                   Iterator end,
-	                   const std::function<bool(const typename Container::value_type&,
-	                                            const typename Container::value_type&)>& predicate) noexcept;
+	                   const std::function<bool(const std::ranges::range_value_t<Container>&,
+	                                            const std::ranges::range_value_t<Container>&)>& predicate) noexcept;
 
 private:
 	Container& container;
 };
 
-template<ArrayOrVectorConcept Container>
+template<ContiguousRangeConcept Container>
 InsertionSorter<Container>::InsertionSorter(Container& container) noexcept :
-		SortingAlgorithm<typename Container::value_type> {}, container {container} {
+		SortingAlgorithm<std::ranges::range_value_t<Container>> {}, container {container} {
 }
 
-template<ArrayOrVectorConcept Container>
-void InsertionSorter<Container>::sort(const std::function<bool(const typename Container::value_type&,
-                                                               const typename Container::value_type&)>& predicate) noexcept {
+template<ContiguousRangeConcept Container>
+void InsertionSorter<Container>::sort(const std::function<bool(const std::ranges::range_value_t<Container>&,
+                                                               const std::ranges::range_value_t<Container>&)>& predicate) noexcept {
 	insertionSort(container.begin(), container.end(), predicate);
 }
 
-template<ArrayOrVectorConcept Container>
+template<ContiguousRangeConcept Container>
 template<typename Iterator>
 void InsertionSorter<Container>::insertionSort(Iterator begin,
                                                Iterator end,
-                                               const std::function<bool(const typename Container::value_type&,
-                                                                        const typename Container::value_type&)>& predicate) noexcept {
+                                               const std::function<bool(const std::ranges::range_value_t<Container>&,
+                                                                        const std::ranges::range_value_t<Container>&)>& predicate) noexcept {
 	for (auto elementIterator {begin + 1}; elementIterator != end; ++elementIterator) {
 		auto currentElement {*elementIterator};
 		auto currentIterator {elementIterator};
@@ -0,0 +1,184 @@
+#pragma once
+
+#include <cassert>
+#include <functional>
+#include <optional>
+#include <utility>
+#include <vector>
+
+namespace Core::Algorithms::Sorting {
+/**
+ * @brief A tournament tree of losers used to repeatedly select the minimum of k sorted sources.
+ * @details Each internal node stores the index of the source that lost the match played at that node, so replacing
+ * the winner only replays the matches on the path from its leaf to the root, costing ceil(log2(k)) comparisons instead
+ * of the 2 * log2(k) a binary heap needs. Exhausted sources lose every match. Ties are won by the source with the lower
+ * index, which keeps a k-way merge of stable runs stable.
+ * @class LoserTree
+ * @tparam ElementType: The type of the elements being merged.
+ */
+template<typename ElementType>
+class LoserTree final {
+public:
+	/**
+	 * @brief Instantiates a new loser tree and plays the initial tournament.
+	 * @param leaves: The first element of each source, or std::nullopt if the source is empty.
+	 * @param predicate: The predicate that returns true if the first element should come before the second.
+	 */
+	LoserTree(std::vector<std::optional<ElementType>> leaves,
+	          std::function<bool(const ElementType&, const ElementType&)> predicate);
+	
+	/**
+	 * @brief Instantiates a new loser tree by copying the given loser tree.
+	 * @param other: The loser tree to copy.
+	 */
+	LoserTree(const LoserTree& other) = default;
+	
+	/**
+	 * @brief Instantiates a new loser tree by moving the given loser tree.
+	 * @param other: The loser tree to move.
+	 */
+	LoserTree(LoserTree&& other) noexcept = default;
+	
+	/**
+	 * @brief Destroys the loser tree.
+	 */
+	~LoserTree() noexcept = default;
+
+public:
+	/**
+	 * @brief Assigns the given loser tree to this loser tree using copy semantics.
+	 * @param other: The loser tree to copy.
+	 * @return A reference to this loser tree.
+	 */
+	LoserTree& operator=(const LoserTree& other) = default;
+	
+	/**
+	 * @brief Assigns the given loser tree to this loser tree using move semantics.
+	 * @param other: The loser tree to move.
+	 * @return A reference to this loser tree.
+	 */
+	LoserTree& operator=(LoserTree&& other) noexcept = default;
+
+public:
+	/**
+	 * @brief Gets the overall winner of the tournament.
+	 * @note The loser tree must not be empty.
+	 * @return A const reference to the element that should come first among all sources.
+	 */
+	const ElementType& getWinner() const noexcept;
+	
+	/**
+	 * @brief Gets the index of the source that the overall winner came from.
+	 * @return The index of the winning source.
+	 */
+	std::size_t getWinnerIndex() const noexcept;
+	
+	/**
+	 * @brief Replaces the overall winner with the next element from the same source and replays its matches.
+	 * @param element: The next element of the winning source, or std::nullopt if the source is exhausted.
+	 */
+	void replaceWinner(std::optional<ElementType> element);
+	
+	/**
+	 * @brief Checks if every source is exhausted.
+	 * @return True if every source is exhausted, false otherwise.
+	 */
+	bool isEmpty() const noexcept;
+
+private:
+	/**
+	 * @brief Checks if the first source wins its match against the second source.
+	 * @param first: The index of the first source.
+	 * @param second: The index of the second source.
+	 * @return True if the first source wins, false otherwise.
+	 */
+	bool beats(const std::size_t first, const std::size_t second) const;
+	
+	/**
+	 * @brief Plays the initial matches of the subtree rooted at the given node.
+	 * @param node: The index of the node in the implicit tree, where the leaves occupy [k, 2k).
+	 * @return The index of the source that wins the subtree.
+	 */
+	std::size_t playInitialMatches(const std::size_t node);
+
+private:
+	std::vector<std::optional<ElementType>> leaves;
+	std::vector<std::size_t> losers;
+	std::function<bool(const ElementType&, const ElementType&)> predicate;
+	std::size_t winnerIndex {0};
+};
+
+template<typename ElementType>
+LoserTree<ElementType>::LoserTree(std::vector<std::optional<ElementType>> leaves,
+                                  std::function<bool(const ElementType&, const ElementType&)> predicate) :
+		leaves {std::move(leaves)}, losers(this->leaves.size()), predicate {std::move(predicate)} {
+	if (!this->leaves.empty()) {
+		winnerIndex = playInitialMatches(1);
+	}
+}
+
+template<typename ElementType>
+const ElementType& LoserTree<ElementType>::getWinner() const noexcept {
+	assert(!isEmpty() && "Cannot get the winner of an empty loser tree.");
+	return *leaves[winnerIndex];
+}
+
+template<typename ElementType>
+std::size_t LoserTree<ElementType>::getWinnerIndex() const noexcept {
+	return winnerIndex;
+}
+
+template<typename ElementType>
+void LoserTree<ElementType>::replaceWinner(std::optional<ElementType> element) {
+	leaves[winnerIndex] = std::move(element);
+	
+	auto winner {winnerIndex};
+	for (auto node {(winnerIndex + leaves.size()) / 2}; node > 0; node /= 2) {
+		if (beats(losers[node], winner)) {
+			std::swap(losers[node], winner);
+		}
+	}
+	
+	winnerIndex = winner;
+}
+
+template<typename ElementType>
+bool LoserTree<ElementType>::isEmpty() const noexcept {
+	return leaves.empty() || !leaves[winnerIndex].has_value();
+}
+
+template<typename ElementType>
+bool LoserTree<ElementType>::beats(const std::size_t first, const std::size_t second) const {
+	if (!leaves[second].has_value()) {
+		return leaves[first].has_value();
+	}
+	
+	if (!leaves[first].has_value()) {
+		return false;
+	}
+	
+	if (predicate(*leaves[first], *leaves[second])) {
+		return true;
+	}
+	
+	return !predicate(*leaves[second], *leaves[first]) && first < second;
+}
+
+template<typename ElementType>
+std::size_t LoserTree<ElementType>::playInitialMatches(const std::size_t node) {
+	if (node >= leaves.size()) {
+		return node - leaves.size();
+	}
+	
+	const auto leftWinner {playInitialMatches(2 * node)};
+	const auto rightWinner {playInitialMatches(2 * node + 1)};
+	
+	if (beats(leftWinner, rightWinner)) {
+		losers[node] = rightWinner;
+		return leftWinner;
+	}
+	
+	losers[node] = leftWinner;
+	return rightWinner;
+}
+}
\ No newline at end of file
@@ -1,6 +1,6 @@
 #pragma once
 
-#include "Algorithms/ArrayOrVectorConcept.hpp"
+#include "Algorithms/ContiguousRangeConcept.hpp"
 #include "SortingAlgorithm.hpp"
 
 namespace Core::Algorithms::Sorting {
@@ -8,8 +8,8 @@ namespace Core::Algorithms::Sorting {
  * @brief An implementation of the merge sort algorithm using iterators.
  * @tparam Container: The type of the container to sort.
  */
-template<ArrayOrVectorConcept Container>
-class MergeSorter final : public SortingAlgorithm<typename Container::value_type> {
+template<ContiguousRangeConcept Container>
+class MergeSorter final : public SortingAlgorithm<std::ranges::range_value_t<Container>> {
 public:
 	/**
 	 * @brief Instantiates a new merge sorter.
@@ -54,8 +54,8 @@ public:
 	 * @brief Sorts the container using the given predicate and the merge sort algorithm.
 	 * @param predicate: The predicate to use to sort the container.
 	 */
-	void sort(const std::function<bool(const typename Container::value_type&,
-	                                           const typename Container::value_type&)>& predicate) noexcept override;
+	void sort(const std::function<bool(const std::ranges::range_value_t<Container>&,
+	                                           const std::ranges::range_value_t<Container>&)>& predicate) noexcept override;
 
 private:
 	/**
@@ -68,8 +68,8 @@ private:
 	template<typename Iterator>
 	void mergeSort(Iterator begin,
 	               Iterator end,
-	               const std::function<bool(const typename Container::value_type&,
-	                                        const typename Container::value_type&)>& predicate) noexcept;
+	               const std::function<bool(const std::ranges::range_value_t<Container>&,
+	                                        const std::ranges::range_value_t<Container>&)>& predicate) noexcept;
 	
 	/**
 	 * @brief Merges the two halves of the container.
@@ -83,31 +83,31 @@ private:
 	void merge(Iterator begin,
 	           Iterator middle,
 	           Iterator end,
-	           const std::function<bool(const typename Container::value_type&,
-	                                    const typename Container::value_type&)>& predicate) noexcept;
+	           const std::function<bool(const std::ranges::range_value_t<Container>&,
+	                                    const std::ranges::range_value_t<Container>&)>& predicate) noexcept;
 
 private:
 	Container& container;
 };
 
-template<ArrayOrVectorConcept Container>
+template<ContiguousRangeConcept Container>
 MergeSorter<Container>::MergeSorter(Container& container) noexcept :
-		SortingAlgorithm<typename Container::value_type> {}, container {container} {
+		SortingAlgorithm<std::ranges::range_value_t<Container>> {}, container {container} {
 	
 }
 
-template<ArrayOrVectorConcept Container>
-void MergeSorter<Container>::sort(const std::function<bool(const typename Container::value_type&,
-                                                           const typename Container::value_type&)>& predicate) noexcept {
+template<ContiguousRangeConcept Container>
+void MergeSorter<Container>::sort(const std::function<bool(const std::ranges::range_value_t<Container>&,
+                                                           const std::ranges::range_value_t<Container>&)>& predicate) noexcept {
 	mergeSort(container.begin(), container.end(), predicate);
 }
 
-template<ArrayOrVectorConcept Container>
+template<ContiguousRangeConcept Container>
 template<typename Iterator>
 void MergeSorter<Container>::mergeSort(Iterator begin,
                                        Iterator end,
-                                       const std::function<bool(const typename Container::value_type&,
-                                                                const typename Container::value_type&)>& predicate) noexcept {
+                                       const std::function<bool(const std::ranges::range_value_t<Container>&,
+                                                                const std::ranges::range_value_t<Container>&)>& predicate) noexcept {
 	const auto size {std::distance(begin, end)};
 	if (size < 2) {
 		return;
@@ -122,13 +122,13 @@ void MergeSorter<Container>::mergeSort(Iterator begin,
 	merge(begin, middle, end, predicate);
 }
 
-template<ArrayOrVectorConcept Container>
+template<ContiguousRangeConcept Container>
 template<typename Iterator>
 void MergeSorter<Container>::merge(Iterator begin,
                                    Iterator middle,
                                    Iterator end,
-                                   const std::function<bool(const typename Container::value_type&,
-                                                            const typename Container::value_type&)>& predicate) noexcept {
+                                   const std::function<bool(const std::ranges::range_value_t<Container>&,
+                                                            const std::ranges::range_value_t<Container>&)>& predicate) noexcept {
 	auto buffer {std::vector<typename std::iterator_traits<Iterator>::value_type> {begin, end}};
 	auto leftIterator {buffer.begin()};
 	auto rightIterator {buffer.begin() + (middle - begin)};
@@ -0,0 +1,260 @@
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <functional>
+#include <iterator>
+#include <optional>
+
+#include "Algorithms/ContiguousRangeConcept.hpp"
+
+namespace Core::Algorithms::Sorting {
+/**
+ * @brief An implementation of the introselect algorithm using iterators.
+ * @details Introselect partitions the container around median of three pivots like quick select, but only recurses
+ * into the side that contains the requested position, so it runs in O(n) time on average. If the partitions become
+ * too unbalanced it falls back to heap selection, which bounds the worst case to O(n log n).
+ * @tparam Container: The type of the container to select from.
+ */
+template<ContiguousRangeConcept Container>
+class NthElementSelector final {
+public:
+	/**
+	 * @brief Instantiates a new nth element selector.
+	 * @param container: The container to select from.
+	 */
+	explicit NthElementSelector(Container& container) noexcept;
+	
+	/**
+	 * @brief Instantiates a new nth element selector by copying the given nth element selector.
+	 * @param other: The nth element selector to copy.
+	 */
+	NthElementSelector(const NthElementSelector& other) noexcept = default;
+	
+	/**
+	 * @brief Instantiates a new nth element selector by moving the given nth element selector.
+	 * @param other: The nth element selector to move.
+	 */
+	NthElementSelector(NthElementSelector&& other) noexcept = default;
+	
+	/**
+	 * @brief Destroys the nth element selector.
+	 */
+	~NthElementSelector() noexcept = default;
+
+public:
+	/**
+	 * @brief Assigns the given nth element selector to this nth element selector using copy semantics.
+	 * @param other: The nth element selector to copy.
+	 * @return A reference to this nth element selector.
+	 */
+	NthElementSelector& operator=(const NthElementSelector& other) noexcept = default;
+	
+	/**
+	 * @brief Assigns the given nth element selector to this nth element selector using move semantics.
+	 * @param other: The nth element selector to move.
+	 * @return A reference to this nth element selector.
+	 */
+	NthElementSelector& operator=(NthElementSelector&& other) noexcept = default;
+
+public:
+	/**
+	 * @brief Rearranges the container so that the element at the given position is the element that would be there if
+	 * the container was sorted using the given predicate.
+	 * @details No element before the position comes after it, and no element after the position comes before it. The
+	 * elements on either side are otherwise left in an unspecified order.
+	 * @param position: The zero-based position of the element to select.
+	 * @param predicate: The predicate to use to order the container.
+	 * @return The selected element, or std::nullopt if the position is out of range.
+	 */
+	std::optional<std::ranges::range_value_t<Container>> select(const std::size_t position,
+	                                                     const std::function<bool(const std::ranges::range_value_t<Container>&,
+	                                                                              const std::ranges::range_value_t<Container>&)>& predicate) noexcept;
+
+private:
+	using ValueType = std::ranges::range_value_t<Container>;
+	using Predicate = std::function<bool(const ValueType&, const ValueType&)>;
+	
+	/**
+	 * @brief Ranges no longer than this are finished with insertion sort.
+	 */
+	static constexpr std::ptrdiff_t INSERTION_SORT_THRESHOLD {16};
+	
+	/**
+	 * @brief Selects the nth element of the range using the introselect algorithm.
+	 * @tparam Iterator: The type of the iterator.
+	 * @param begin: An iterator to the beginning of the range.
+	 * @param nth: An iterator to the position to select.
+	 * @param end: An iterator to the end of the range.
+	 * @param depthLimit: The number of partitions allowed before falling back to heap selection.
+	 * @param predicate: The predicate to use to order the range.
+	 */
+	template<typename Iterator>
+	static void introSelect(Iterator begin, Iterator nth, Iterator end, std::size_t depthLimit, const Predicate& predicate);
+	
+	/**
+	 * @brief Partitions the range around the median of its first, middle and last elements.
+	 * @details The range must hold at least three elements. The smallest and largest of the three sampled elements act
+	 * as sentinels, so the partition loops need no bounds checks, and elements equal to the pivot are split evenly
+	 * between both sides.
+	 * @tparam Iterator: The type of the iterator.
+	 * @param begin: An iterator to the beginning of the range.
+	 * @param end: An iterator to the end of the range.
+	 * @param predicate: The predicate to use to order the range.
+	 * @return An iterator to the pivot, which is in its sorted position.
+	 */
+	template<typename Iterator>
+	static Iterator partition(Iterator begin, Iterator end, const Predicate& predicate);
+	
+	/**
+	 * @brief Selects the nth element of the range using a max heap of the elements up to and including the nth.
+	 * @tparam Iterator: The type of the iterator.
+	 * @param begin: An iterator to the beginning of the range.
+	 * @param nth: An iterator to the position to select.
+	 * @param end: An iterator to the end of the range.
+	 * @param predicate: The predicate to use to order the range.
+	 */
+	template<typename Iterator>
+	static void heapSelect(Iterator begin, Iterator nth, Iterator end, const Predicate& predicate);
+	
+	/**
+	 * @brief Sorts the range using insertion sort.
+	 * @tparam Iterator: The type of the iterator.
+	 * @param begin: An iterator to the beginning of the range.
+	 * @param end: An iterator to the end of the range.
+	 * @param predicate: The predicate to use to order the range.
+	 */
+	template<typename Iterator>
+	static void insertionSort(Iterator begin, Iterator end, const Predicate& predicate);
+
+private:
+	Container& container;
+};
+
+template<ContiguousRangeConcept Container>
+NthElementSelector<Container>::NthElementSelector(Container& container) noexcept : container {container} {
+}
+
+template<ContiguousRangeConcept Container>
+std::optional<std::ranges::range_value_t<Container>> NthElementSelector<Container>::select(const std::size_t position,
+                                                                                    const std::function<bool(const std::ranges::range_value_t<Container>&,
+                                                                                                             const std::ranges::range_value_t<Container>&)>& predicate) noexcept {
+	if (position >= container.size()) {
+		return std::nullopt;
+	}
+	
+	const auto depthLimit {2 * static_cast<std::size_t>(std::bit_width(container.size()))};
+	const auto nth {container.begin() + static_cast<std::ptrdiff_t>(position)};
+	introSelect(container.begin(), nth, container.end(), depthLimit, predicate);
+	
+	return *nth;
+}
+
+template<ContiguousRangeConcept Container>
+template<typename Iterator>
+void NthElementSelector<Container>::introSelect(Iterator begin,
+                                                Iterator nth,
+                                                Iterator end,
+                                                std::size_t depthLimit,
+                                                const Predicate& predicate) {
+	while (std::distance(begin, end) > INSERTION_SORT_THRESHOLD) {
+		if (depthLimit == 0) {
+			heapSelect(begin, nth, end, predicate);
+			return;
+		}
+		
+		--depthLimit;
+		
+		const auto pivot {partition(begin, end, predicate)};
+		if (pivot == nth) {
+			return;
+		}
+		
+		if (nth < pivot) {
+			end = pivot;
+		} else {
+			begin = pivot + 1;
+		}
+	}
+	
+	insertionSort(begin, end, predicate);
+}
+
+template<ContiguousRangeConcept Container>
+template<typename Iterator>
+Iterator NthElementSelector<Container>::partition(Iterator begin, Iterator end, const Predicate& predicate) {
+	const auto middle {begin + std::distance(begin, end) / 2};
+	const auto last {end - 1};
+	
+	if (predicate(*middle, *begin)) {
+		std::iter_swap(middle, begin);
+	}
+	
+	if (predicate(*last, *middle)) {
+		std::iter_swap(last, middle);
+		
+		if (predicate(*middle, *begin)) {
+			std::iter_swap(middle, begin);
+		}
+	}
+	
+	const auto pivot {last - 1};
+	std::iter_swap(middle, pivot);
+	
+	auto left {begin};
+	auto right {pivot};
+	while (true) {
+		while (predicate(*++left, *pivot)) {
+		}
+		
+		while (predicate(*pivot, *--right)) {
+		}
+		
+		if (left >= right) {
+			break;
+		}
+		
+		std::iter_swap(left, right);
+	}
+	
+	std::iter_swap(left, pivot);
+	return left;
+}
+
+template<ContiguousRangeConcept Container>
+template<typename Iterator>
+void NthElementSelector<Container>::heapSelect(Iterator begin, Iterator nth, Iterator end, const Predicate& predicate) {
+	const auto heapEnd {nth + 1};
+	std::make_heap(begin, heapEnd, predicate);
+	
+	for (auto iterator {heapEnd}; iterator != end; ++iterator) {
+		if (predicate(*iterator, *begin)) {
+			std::pop_heap(begin, heapEnd, predicate);
+			std::iter_swap(nth, iterator);
+			std::push_heap(begin, heapEnd, predicate);
+		}
+	}
+	
+	std::iter_swap(begin, nth);
+}
+
+template<ContiguousRangeConcept Container>
+template<typename Iterator>
+void NthElementSelector<Container>::insertionSort(Iterator begin, Iterator end, const Predicate& predicate) {
+	if (begin == end) {
+		return;
+	}
+	
+	for (auto iterator {begin + 1}; iterator != end; ++iterator) {
+		auto element {std::move(*iterator)};
+		auto hole {iterator};
+		
+		while (hole != begin && predicate(element, *(hole - 1))) {
+			*hole = std::move(*(hole - 1));
+			--hole;
+		}
+		
+		*hole = std::move(element);
+	}
+}
+}
\ No newline at end of file
@@ -0,0 +1,97 @@
+#pragma once
+
+#include <algorithm>
+
+#include "Algorithms/ContiguousRangeConcept.hpp"
+#include "NthElementSelector.hpp"
+#include "SortingAlgorithm.hpp"
+
+namespace Core::Algorithms::Sorting {
+/**
+ * @brief An implementation of partial sort that only sorts the elements that would come first in the container.
+ * @details The container is first partitioned around the last requested position using introselect in O(n) time on
+ * average, and only the elements before it are then heap sorted, so sorting the first k of n elements costs
+ * O(n + k log k) time rather than the O(n log n) of a full sort.
+ * @tparam Container: The type of the container to sort.
+ */
+template<ContiguousRangeConcept Container>
+class PartialSorter final : public SortingAlgorithm<std::ranges::range_value_t<Container>> {
+public:
+	/**
+	 * @brief Instantiates a new partial sorter.
+	 * @param container: The container to sort.
+	 * @param count: The number of elements at the front of the container to sort. If it is greater than the size of
+	 * the container then the whole container is sorted.
+	 */
+	PartialSorter(Container& container, const std::size_t count) noexcept;
+	
+	/**
+	 * @brief Instantiates a new partial sorter by copying the given partial sorter.
+	 * @param other: The partial sorter to copy.
+	 */
+	PartialSorter(const PartialSorter& other) noexcept = default;
+	
+	/**
+	 * @brief Instantiates a new partial sorter by moving the given partial sorter.
+	 * @param other: The partial sorter to move.
+	 */
+	PartialSorter(PartialSorter&& other) noexcept = default;
+	
+	/**
+	 * @brief Destroys the partial sorter.
+	 */
+	~PartialSorter() noexcept override = default;
+
+public:
+	/**
+	 * @brief Assigns the given partial sorter to this partial sorter using copy semantics.
+	 * @param other: The partial sorter to copy.
+	 * @return A reference to this partial sorter.
+	 */
+	PartialSorter& operator=(const PartialSorter& other) noexcept = default;
+	
+	/**
+	 * @brief Assigns the given partial sorter to this partial sorter using move semantics.
+	 * @param other: The partial sorter to move.
+	 * @return A reference to this partial sorter.
+	 */
+	PartialSorter& operator=(PartialSorter&& other) noexcept = default;
+
+public:
+	/**
+	 * @brief Sorts the first count elements of the container using the given predicate.
+	 * @details After sorting, the front of the container holds the count elements that come first according to the
+	 * predicate in sorted order. The remaining elements are left in an unspecified order.
+	 * @param predicate: The predicate to use to sort the container.
+	 */
+	void sort(const std::function<bool(const std::ranges::range_value_t<Container>&,
+	                                   const std::ranges::range_value_t<Container>&)>& predicate) noexcept override;
+
+private:
+	Container& container;
+	std::size_t count;
+};
+
+template<ContiguousRangeConcept Container>
+PartialSorter<Container>::PartialSorter(Container& container, const std::size_t count) noexcept :
+		SortingAlgorithm<std::ranges::range_value_t<Container>> {}, container {container}, count {count} {
+}
+
+template<ContiguousRangeConcept Container>
+void PartialSorter<Container>::sort(const std::function<bool(const std::ranges::range_value_t<Container>&,
+                                                             const std::ranges::range_value_t<Container>&)>& predicate) noexcept {
+	const auto sortedCount {std::min(count, container.size())};
+	if (sortedCount == 0) {
+		return;
+	}
+	
+	if (sortedCount < container.size()) {
+		NthElementSelector<Container> selector {container};
+		selector.select(sortedCount - 1, predicate);
+	}
+	
+	const auto sortedEnd {container.begin() + static_cast<std::ptrdiff_t>(sortedCount)};
+	std::make_heap(container.begin(), sortedEnd, predicate);
+	std::sort_heap(container.begin(), sortedEnd, predicate);
+}
+}
\ No newline at end of file
@@ -2,7 +2,7 @@
 
 #include <algorithm>
 
-#include "Algorithms/ArrayOrVectorConcept.hpp"
+#include "Algorithms/ContiguousRangeConcept.hpp"
 #include "SortingAlgorithm.hpp"
 
 namespace Core::Algorithms::Sorting {
@@ -10,8 +10,8 @@ namespace Core::Algorithms::Sorting {
  * @brief An implementation of the quick sort algorithm using iterators.
  * @tparam Container: The type of the container to sort.
  */
-template<ArrayOrVectorConcept Container>
-class QuickSorter final : public SortingAlgorithm<typename Container::value_type> {
+template<ContiguousRangeConcept Container>
+class QuickSorter final : public SortingAlgorithm<std::ranges::range_value_t<Container>> {
 public:
 	/**
 	 * @brief Instantiates a new quick sorter.
@@ -56,8 +56,8 @@ public:
 	 * @brief Sorts the container using the given predicate and the quick sort algorithm.
 	 * @param predicate: The predicate to use to sort the container.
 	 */
-	void sort(const std::function<bool(const typename Container::value_type&,
-	                                           const typename Container::value_type&)>& predicate) noexcept override;
+	void sort(const std::function<bool(const std::ranges::range_value_t<Container>&,
+	                                           const std::ranges::range_value_t<Container>&)>& predicate) noexcept override;
 
 private:
 	/**
@@ -70,30 +70,30 @@ private:
 	template<typename Iterator>
 	void quickSort(Iterator begin,
 	               Iterator end,
-	               const std::function<bool(const typename Container::value_type&,
-	                                        const typename Container::value_type&)>& predicate) noexcept;
+	               const std::function<bool(const std::ranges::range_value_t<Container>&,
+	                                        const std::ranges::range_value_t<Container>&)>& predicate) noexcept;
 
 private:
 	Container& container;
 };
 
-template<ArrayOrVectorConcept Container>
+template<ContiguousRangeConcept Container>
 QuickSorter<Container>::QuickSorter(Container& container) noexcept :
-		SortingAlgorithm<typename Container::value_type> {}, container {container} {
+		SortingAlgorithm<std::ranges::range_value_t<Container>> {}, container {container} {
 }
 
-template<ArrayOrVectorConcept Container>
-void QuickSorter<Container>::sort(const std::function<bool(const typename Container::value_type&,
-                                                           const typename Container::value_type&)>& predicate) noexcept {
+template<ContiguousRangeConcept Container>
+void QuickSorter<Container>::sort(const std::function<bool(const std::ranges::range_value_t<Container>&,
+                                                           const std::ranges::range_value_t<Container>&)>& predicate) noexcept {
 	quickSort(container.begin(), container.end(), predicate);
 }
 
-template<ArrayOrVectorConcept Container>
+template<ContiguousRangeConcept Container>
 template<typename Iterator>
 void QuickSorter<Container>::quickSort(Iterator begin,
                                        Iterator end,
-                                       const std::function<bool(const typename Container::value_type&,
-                                                                const typename Container::value_type&)>& predicate) noexcept {
+                                       const std::function<bool(const std::ranges::range_value_t<Container>&,
+                                                                const std::ranges::range_value_t<Container>&)>& predicate) noexcept {
 	const auto size {std::distance(begin, end)};
 	if (size <= 1) {
 		return;
@@ -2,7 +2,7 @@
 
 #include <algorithm>
 
-#include "Algorithms/ArrayOrVectorConcept.hpp"
+#include "Algorithms/ContiguousRangeConcept.hpp"
 #include "SortingAlgorithm.hpp"
 
 namespace Core::Algorithms::Sorting {
@@ -10,8 +10,8 @@ namespace Core::Algorithms::Sorting {
  * @brief An implementation of the selection sort algorithm using iterators.
  * @tparam Container: The type of the container to sort.
  */
-template<ArrayOrVectorConcept Container>
-class SelectionSorter final : public SortingAlgorithm<typename Container::value_type> {
+template<ContiguousRangeConcept Container>
+class SelectionSorter final : public SortingAlgorithm<std::ranges::range_value_t<Container>> {
 public:
 	/**
 	 * @brief Instantiates a new selection sorter.
@@ -56,8 +56,8 @@ public:
 	 * @brief Sorts the container using the given predicate and the selection sort algorithm.
 	 * @param predicate: The predicate to use to sort the container.
 	 */
-	void sort(const std::function<bool(const typename Container::value_type&,
-	                                           const typename Container::value_type&)>& predicate) noexcept override;
+	void sort(const std::function<bool(const std::ranges::range_value_t<Container>&,
+	                                           const std::ranges::range_value_t<Container>&)>& predicate) noexcept override;
 
 private:
 	/**
@@ -70,31 +70,31 @@ private:
 	template<typename Iterator>
 	void selectionSort(Iterator begin,
 	                   Iterator end,
-	                   const std::function<bool(const typename Container::value_type&,
-	                                            const typename Container::value_type&)>& predicate) noexcept;
+	                   const std::function<bool(const std::ranges::range_value_t<Container>&,
+	                                            const std::ranges::range_value_t<Container>&)>& predicate) noexcept;
 
 private:
 	Container& container;
 };
 
-template<ArrayOrVectorConcept Container>
+template<ContiguousRangeConcept Container>
 SelectionSorter<Container>::SelectionSorter(Container& container) noexcept :
-		SortingAlgorithm<typename Container::value_type> {}, container {container} {
+		SortingAlgorithm<std::ranges::range_value_t<Container>> {}, container {container} {
 	
 }
 
-template<ArrayOrVectorConcept Container>
-void SelectionSorter<Container>::sort(const std::function<bool(const typename Container::value_type&,
-                                                               const typename Container::value_type&)>& predicate) noexcept {
+template<ContiguousRangeConcept Container>
+void SelectionSorter<Container>::sort(const std::function<bool(const std::ranges::range_value_t<Container>&,
+                                                               const std::ranges::range_value_t<Container>&)>& predicate) noexcept {
 	selectionSort(container.begin(), container.end(), predicate);
 }
 
-template<ArrayOrVectorConcept Container>
+template<ContiguousRangeConcept Container>
 template<typename Iterator>
 void SelectionSorter<Container>::selectionSort(Iterator begin,
                                                Iterator end,
-                                               const std::function<bool(const typename Container::value_type&,
-                                                                        const typename Container::value_type&)>& predicate) noexcept {
+                                               const std::function<bool(const std::ranges::range_value_t<Container>&,
+                                                                        const std::ranges::range_value_t<Container>&)>& predicate) noexcept {
 	for (auto partitionIterator {begin}; partitionIterator != end; ++partitionIterator) {
 		auto selectedIterator {partitionIterator};
 		
@@ -0,0 +1,725 @@
+#pragma once
+
+#include <algorithm>
+#include <iterator>
+#include <vector>
+
+#include "Algorithms/ContiguousRangeConcept.hpp"
+#include "SortingAlgorithm.hpp"
+
+namespace Core::Algorithms::Sorting {
+/**
+ * @brief An implementation of the tim sort algorithm using iterators.
+ * @details Tim sort is an adaptive, stable merge sort. It detects naturally occurring ascending and descending runs,
+ * extends short runs to a minimum length using binary insertion sort, and merges the runs kept on a stack whose
+ * lengths are kept balanced. Merging switches to galloping mode when one run repeatedly wins, so already sorted and
+ * nearly sorted inputs are sorted in close to linear time.
+ * @tparam Container: The type of the container to sort.
+ */
+template<ContiguousRangeConcept Container>
+class TimSorter final : public SortingAlgorithm<std::ranges::range_value_t<Container>> {
+public:
+	/**
+	 * @brief Instantiates a new tim sorter.
+	 * @param container: The container to sort.
+	 */
+	explicit TimSorter(Container& container) noexcept;
+	
+	/**
+	 * @brief Instantiates a new tim sorter by copying the given tim sorter.
+	 * @param other: The tim sorter to copy.
+	 */
+	TimSorter(const TimSorter& other) noexcept = default;
+	
+	/**
+	 * @brief Instantiates a new tim sorter by moving the given tim sorter.
+	 * @param other: The tim sorter to move.
+	 */
+	TimSorter(TimSorter&& other) noexcept = default;
+	
+	/**
+	 * @brief Destroys the tim sorter.
+	 */
+	~TimSorter() noexcept override = default;
+
+public:
+	/**
+	 * @brief Assigns the given tim sorter to this tim sorter using copy semantics.
+	 * @param other: The tim sorter to copy.
+	 * @return A reference to this tim sorter.
+	 */
+	TimSorter& operator=(const TimSorter& other) noexcept = default;
+	
+	/**
+	 * @brief Assigns the given tim sorter to this tim sorter using move semantics.
+	 * @param other: The tim sorter to move.
+	 * @return A reference to this tim sorter.
+	 */
+	TimSorter& operator=(TimSorter&& other) noexcept = default;
+
+public:
+	/**
+	 * @brief Sorts the container using the given predicate and the tim sort algorithm.
+	 * @param predicate: The predicate to use to sort the container.
+	 */
+	void sort(const std::function<bool(const std::ranges::range_value_t<Container>&,
+	                                   const std::ranges::range_value_t<Container>&)>& predicate) noexcept override;
+
+private:
+	using ValueType = std::ranges::range_value_t<Container>;
+	using Predicate = std::function<bool(const ValueType&, const ValueType&)>;
+	
+	/**
+	 * @brief A run of sorted elements waiting on the run stack to be merged.
+	 */
+	struct Run {
+		std::ptrdiff_t base;
+		std::ptrdiff_t length;
+	};
+	
+	/**
+	 * @brief Runs shorter than this are sorted with binary insertion sort alone.
+	 */
+	static constexpr std::ptrdiff_t MINIMUM_MERGE {32};
+	
+	/**
+	 * @brief The initial number of consecutive wins by one run before galloping mode is entered.
+	 */
+	static constexpr std::ptrdiff_t MINIMUM_GALLOP {7};
+	
+	/**
+	 * @brief Sorts the range using the given predicate and the tim sort algorithm.
+	 * @tparam Iterator: The type of the iterator.
+	 * @param begin: An iterator to the beginning of the range.
+	 * @param end: An iterator to the end of the range.
+	 * @param predicate: The predicate to use to sort the range.
+	 */
+	template<typename Iterator>
+	void timSort(Iterator begin, Iterator end, const Predicate& predicate);
+	
+	/**
+	 * @brief Computes the minimum run length for a range of the given size.
+	 * @details The result is in [MINIMUM_MERGE / 2, MINIMUM_MERGE] and is chosen so that size / result is close to,
+	 * but no more than, a power of two, which keeps the final merges balanced.
+	 * @param size: The size of the range.
+	 * @return The minimum run length.
+	 */
+	static std::ptrdiff_t computeMinimumRunLength(std::ptrdiff_t size) noexcept;
+	
+	/**
+	 * @brief Finds the length of the run starting at the beginning of the range and reverses it if it is strictly
+	 * descending.
+	 * @details Only strictly descending runs are reversed so that equal elements keep their relative order.
+	 * @tparam Iterator: The type of the iterator.
+	 * @param begin: An iterator to the beginning of the range.
+	 * @param end: An iterator to the end of the range.
+	 * @param predicate: The predicate to use to sort the range.
+	 * @return The length of the run, which is ascending once this function returns.
+	 */
+	template<typename Iterator>
+	static std::ptrdiff_t countRunAndMakeAscending(Iterator begin, Iterator end, const Predicate& predicate);
+	
+	/**
+	 * @brief Sorts the range using binary insertion sort, given that the elements before sortedEnd are already sorted.
+	 * @tparam Iterator: The type of the iterator.
+	 * @param begin: An iterator to the beginning of the range.
+	 * @param sortedEnd: An iterator to the end of the already sorted prefix of the range.
+	 * @param end: An iterator to the end of the range.
+	 * @param predicate: The predicate to use to sort the range.
+	 */
+	template<typename Iterator>
+	static void binaryInsertionSort(Iterator begin, Iterator sortedEnd, Iterator end, const Predicate& predicate);
+	
+	/**
+	 * @brief Finds the leftmost position at which the key could be inserted into the sorted range.
+	 * @details The search starts at the given hint and gallops outwards exponentially before finishing with a binary
+	 * search, so it costs O(log d) comparisons where d is the distance between the hint and the result.
+	 * @tparam Iterator: The type of the iterator.
+	 * @param key: The key to find the position of.
+	 * @param base: An iterator to the beginning of the sorted range.
+	 * @param length: The length of the sorted range. It must be greater than zero.
+	 * @param hint: The offset at which to begin the search, in [0, length).
+	 * @param predicate: The predicate the range is sorted by.
+	 * @return The offset k such that every element before k is less than the key and no element from k is.
+	 */
+	template<typename Iterator>
+	static std::ptrdiff_t gallopLeft(const ValueType& key,
+	                                 Iterator base,
+	                                 std::ptrdiff_t length,
+	                                 std::ptrdiff_t hint,
+	                                 const Predicate& predicate);
+	
+	/**
+	 * @brief Finds the rightmost position at which the key could be inserted into the sorted range.
+	 * @details Like gallopLeft, except that the key is placed after any elements equal to it.
+	 * @tparam Iterator: The type of the iterator.
+	 * @param key: The key to find the position of.
+	 * @param base: An iterator to the beginning of the sorted range.
+	 * @param length: The length of the sorted range. It must be greater than zero.
+	 * @param hint: The offset at which to begin the search, in [0, length).
+	 * @param predicate: The predicate the range is sorted by.
+	 * @return The offset k such that no element before k is greater than the key and every element from k is.
+	 */
+	template<typename Iterator>
+	static std::ptrdiff_t gallopRight(const ValueType& key,
+	                                  Iterator base,
+	                                  std::ptrdiff_t length,
+	                                  std::ptrdiff_t hint,
+	                                  const Predicate& predicate);
+	
+	/**
+	 * @brief Merges runs on the run stack until the stack invariants hold again.
+	 * @details The invariants are that each run is longer than the next run on the stack and longer than the sum of
+	 * the next two, which bounds the stack depth logarithmically and keeps merges balanced.
+	 * @tparam Iterator: The type of the iterator.
+	 * @param begin: An iterator to the beginning of the range being sorted.
+	 * @param predicate: The predicate to use to sort the range.
+	 */
+	template<typename Iterator>
+	void mergeCollapse(Iterator begin, const Predicate& predicate);
+	
+	/**
+	 * @brief Merges all runs on the run stack into a single run.
+	 * @tparam Iterator: The type of the iterator.
+	 * @param begin: An iterator to the beginning of the range being sorted.
+	 * @param predicate: The predicate to use to sort the range.
+	 */
+	template<typename Iterator>
+	void mergeForceCollapse(Iterator begin, const Predicate& predicate);
+	
+	/**
+	 * @brief Merges the runs at the given index and the index after it on the run stack.
+	 * @tparam Iterator: The type of the iterator.
+	 * @param begin: An iterator to the beginning of the range being sorted.
+	 * @param index: The index of the first of the two runs on the run stack.
+	 * @param predicate: The predicate to use to sort the range.
+	 */
+	template<typename Iterator>
+	void mergeAt(Iterator begin, std::size_t index, const Predicate& predicate);
+	
+	/**
+	 * @brief Merges two adjacent runs in place, buffering the left run, where the left run is the shorter of the two.
+	 * @details The first element of the right run must be less than the first element of the left run, and the last
+	 * element of the left run must be greater than every element of the right run.
+	 * @tparam Iterator: The type of the iterator.
+	 * @param leftBase: An iterator to the beginning of the left run.
+	 * @param leftLength: The length of the left run.
+	 * @param rightBase: An iterator to the beginning of the right run.
+	 * @param rightLength: The length of the right run.
+	 * @param predicate: The predicate to use to sort the range.
+	 */
+	template<typename Iterator>
+	void mergeLow(Iterator leftBase,
+	              std::ptrdiff_t leftLength,
+	              Iterator rightBase,
+	              std::ptrdiff_t rightLength,
+	              const Predicate& predicate);
+	
+	/**
+	 * @brief Merges two adjacent runs in place, buffering the right run, where the right run is the shorter of the two.
+	 * @details Has the same preconditions as mergeLow but fills the merged run from the back.
+	 * @tparam Iterator: The type of the iterator.
+	 * @param leftBase: An iterator to the beginning of the left run.
+	 * @param leftLength: The length of the left run.
+	 * @param rightBase: An iterator to the beginning of the right run.
+	 * @param rightLength: The length of the right run.
+	 * @param predicate: The predicate to use to sort the range.
+	 */
+	template<typename Iterator>
+	void mergeHigh(Iterator leftBase,
+	               std::ptrdiff_t leftLength,
+	               Iterator rightBase,
+	               std::ptrdiff_t rightLength,
+	               const Predicate& predicate);
+
+private:
+	Container& container;
+	std::vector<Run> runStack {};
+	std::vector<ValueType> mergeBuffer {};
+	std::ptrdiff_t minimumGallop {MINIMUM_GALLOP};
+};
+
+template<ContiguousRangeConcept Container>
+TimSorter<Container>::TimSorter(Container& container) noexcept :
+		SortingAlgorithm<std::ranges::range_value_t<Container>> {}, container {container} {
+}
+
+template<ContiguousRangeConcept Container>
+void TimSorter<Container>::sort(const std::function<bool(const std::ranges::range_value_t<Container>&,
+                                                         const std::ranges::range_value_t<Container>&)>& predicate) noexcept {
+	runStack.clear();
+	minimumGallop = MINIMUM_GALLOP;
+	
+	timSort(container.begin(), container.end(), predicate);
+	
+	runStack.clear();
+	mergeBuffer.clear();
+}
+
+template<ContiguousRangeConcept Container>
+template<typename Iterator>
+void TimSorter<Container>::timSort(Iterator begin, Iterator end, const Predicate& predicate) {
+	const auto size {std::distance(begin, end)};
+	if (size < 2) {
+		return;
+	}
+	
+	if (size < MINIMUM_MERGE) {
+		const auto runLength {countRunAndMakeAscending(begin, end, predicate)};
+		binaryInsertionSort(begin, begin + runLength, end, predicate);
+		return;
+	}
+	
+	const auto minimumRunLength {computeMinimumRunLength(size)};
+	std::ptrdiff_t offset {0};
+	
+	while (offset < size) {
+		const auto runBegin {begin + offset};
+		auto runLength {countRunAndMakeAscending(runBegin, end, predicate)};
+		
+		if (runLength < minimumRunLength) {
+			const auto forcedRunLength {std::min(size - offset, minimumRunLength)};
+			binaryInsertionSort(runBegin, runBegin + runLength, runBegin + forcedRunLength, predicate);
+			runLength = forcedRunLength;
+		}
+		
+		runStack.push_back(Run {offset, runLength});
+		mergeCollapse(begin, predicate);
+		
+		offset += runLength;
+	}
+	
+	mergeForceCollapse(begin, predicate);
+}
+
+template<ContiguousRangeConcept Container>
+std::ptrdiff_t TimSorter<Container>::computeMinimumRunLength(std::ptrdiff_t size) noexcept {
+	std::ptrdiff_t remainder {0};
+	
+	while (size >= MINIMUM_MERGE) {
+		remainder |= size & 1;
+		size >>= 1;
+	}
+	
+	return size + remainder;
+}
+
+template<ContiguousRangeConcept Container>
+template<typename Iterator>
+std::ptrdiff_t TimSorter<Container>::countRunAndMakeAscending(Iterator begin,
+                                                              Iterator end,
+                                                              const Predicate& predicate) {
+	auto runEnd {std::next(begin)};
+	if (runEnd == end) {
+		return 1;
+	}
+	
+	if (predicate(*runEnd, *begin)) {
+		++runEnd;
+		while (runEnd != end && predicate(*runEnd, *(runEnd - 1))) {
+			++runEnd;
+		}
+		
+		std::reverse(begin, runEnd);
+	} else {
+		++runEnd;
+		while (runEnd != end && !predicate(*runEnd, *(runEnd - 1))) {
+			++runEnd;
+		}
+	}
+	
+	return std::distance(begin, runEnd);
+}
+
+template<ContiguousRangeConcept Container>
+template<typename Iterator>
+void TimSorter<Container>::binaryInsertionSort(Iterator begin,
+                                               Iterator sortedEnd,
+                                               Iterator end,
+                                               const Predicate& predicate) {
+	if (sortedEnd == begin) {
+		++sortedEnd;
+	}
+	
+	for (auto elementIterator {sortedEnd}; elementIterator < end; ++elementIterator) {
+		auto pivot {std::move(*elementIterator)};
+		
+		auto left {begin};
+		auto right {elementIterator};
+		
+		while (left < right) {
+			const auto middle {left + (right - left) / 2};
+			
+			if (predicate(pivot, *middle)) {
+				right = middle;
+			} else {
+				left = middle + 1;
+			}
+		}
+		
+		std::move_backward(left, elementIterator, elementIterator + 1);
+		*left = std::move(pivot);
+	}
+}
+
+template<ContiguousRangeConcept Container>
+template<typename Iterator>
+std::ptrdiff_t TimSorter<Container>::gallopLeft(const ValueType& key,
+                                                Iterator base,
+                                                const std::ptrdiff_t length,
+                                                const std::ptrdiff_t hint,
+                                                const Predicate& predicate) {
+	std::ptrdiff_t lastOffset {0};
+	std::ptrdiff_t offset {1};
+	
+	if (predicate(base[hint], key)) {
+		const auto maximumOffset {length - hint};
+		while (offset < maximumOffset && predicate(base[hint + offset], key)) {
+			lastOffset = offset;
+			offset = (offset << 1) + 1;
+		}
+		
+		offset = std::min(offset, maximumOffset);
+		lastOffset += hint;
+		offset += hint;
+	} else {
+		const auto maximumOffset {hint + 1};
+		while (offset < maximumOffset && !predicate(base[hint - offset], key)) {
+			lastOffset = offset;
+			offset = (offset << 1) + 1;
+		}
+		
+		offset = std::min(offset, maximumOffset);
+		const auto previousLastOffset {lastOffset};
+		lastOffset = hint - offset;
+		offset = hint - previousLastOffset;
+	}
+	
+	++lastOffset;
+	while (lastOffset < offset) {
+		const auto middle {lastOffset + (offset - lastOffset) / 2};
+		
+		if (predicate(base[middle], key)) {
+			lastOffset = middle + 1;
+		} else {
+			offset = middle;
+		}
+	}
+	
+	return offset;
+}
+
+template<ContiguousRangeConcept Container>
+template<typename Iterator>
+std::ptrdiff_t TimSorter<Container>::gallopRight(const ValueType& key,
+                                                 Iterator base,
+                                                 const std::ptrdiff_t length,
+                                                 const std::ptrdiff_t hint,
+                                                 const Predicate& predicate) {
+	std::ptrdiff_t lastOffset {0};
+	std::ptrdiff_t offset {1};
+	
+	if (predicate(key, base[hint])) {
+		const auto maximumOffset {hint + 1};
+		while (offset < maximumOffset && predicate(key, base[hint - offset])) {
+			lastOffset = offset;
+			offset = (offset << 1) + 1;
+		}
+		
+		offset = std::min(offset, maximumOffset);
+		const auto previousLastOffset {lastOffset};
+		lastOffset = hint - offset;
+		offset = hint - previousLastOffset;
+	} else {
+		const auto maximumOffset {length - hint};
+		while (offset < maximumOffset && !predicate(key, base[hint + offset])) {
+			lastOffset = offset;
+			offset = (offset << 1) + 1;
+		}
+		
+		offset = std::min(offset, maximumOffset);
+		lastOffset += hint;
+		offset += hint;
+	}
+	
+	++lastOffset;
+	while (lastOffset < offset) {
+		const auto middle {lastOffset + (offset - lastOffset) / 2};
+		
+		if (predicate(key, base[middle])) {
+			offset = middle;
+		} else {
+			lastOffset = middle + 1;
+		}
+	}
+	
+	return offset;
+}
+
+template<ContiguousRangeConcept Container>
+template<typename Iterator>
+void TimSorter<Container>::mergeCollapse(Iterator begin, const Predicate& predicate) {
+	while (runStack.size() > 1) {
+		auto index {runStack.size() - 2};
+		
+		if ((index > 0 && runStack[index - 1].length <= runStack[index].length + runStack[index + 1].length) ||
+		    (index > 1 && runStack[index - 2].length <= runStack[index - 1].length + runStack[index].length)) {
+			if (runStack[index - 1].length < runStack[index + 1].length) {
+				--index;
+			}
+		} else if (runStack[index].length > runStack[index + 1].length) {
+			break;
+		}
+		
+		mergeAt(begin, index, predicate);
+	}
+}
+
+template<ContiguousRangeConcept Container>
+template<typename Iterator>
+void TimSorter<Container>::mergeForceCollapse(Iterator begin, const Predicate& predicate) {
+	while (runStack.size() > 1) {
+		auto index {runStack.size() - 2};
+		
+		if (index > 0 && runStack[index - 1].length < runStack[index + 1].length) {
+			--index;
+		}
+		
+		mergeAt(begin, index, predicate);
+	}
+}
+
+template<ContiguousRangeConcept Container>
+template<typename Iterator>
+void TimSorter<Container>::mergeAt(Iterator begin, const std::size_t index, const Predicate& predicate) {
+	auto leftBase {begin + runStack[index].base};
+	auto leftLength {runStack[index].length};
+	auto rightBase {begin + runStack[index + 1].base};
+	auto rightLength {runStack[index + 1].length};
+	
+	runStack[index].length = leftLength + rightLength;
+	runStack.erase(runStack.begin() + static_cast<std::ptrdiff_t>(index) + 1);
+	
+	const auto alreadyInPlaceCount {gallopRight(*rightBase, leftBase, leftLength, 0, predicate)};
+	leftBase += alreadyInPlaceCount;
+	leftLength -= alreadyInPlaceCount;
+	if (leftLength == 0) {
+		return;
+	}
+	
+	rightLength = gallopLeft(*(leftBase + leftLength - 1), rightBase, rightLength, rightLength - 1, predicate);
+	if (rightLength == 0) {
+		return;
+	}
+	
+	if (leftLength <= rightLength) {
+		mergeLow(leftBase, leftLength, rightBase, rightLength, predicate);
+	} else {
+		mergeHigh(leftBase, leftLength, rightBase, rightLength, predicate);
+	}
+}
+
+template<ContiguousRangeConcept Container>
+template<typename Iterator>
+void TimSorter<Container>::mergeLow(Iterator leftBase,
+                                    std::ptrdiff_t leftLength,
+                                    Iterator rightBase,
+                                    std::ptrdiff_t rightLength,
+                                    const Predicate& predicate) {
+	mergeBuffer.assign(std::make_move_iterator(leftBase), std::make_move_iterator(leftBase + leftLength));
+	
+	auto leftIterator {mergeBuffer.begin()};
+	auto rightIterator {rightBase};
+	auto destinationIterator {leftBase};
+	
+	*destinationIterator++ = std::move(*rightIterator++);
+	--rightLength;
+	
+	auto currentMinimumGallop {minimumGallop};
+	
+	const auto mergeUntilOneRunIsExhausted {[&]() {
+		if (rightLength == 0 || leftLength == 1) {
+			return;
+		}
+		
+		while (true) {
+			std::ptrdiff_t leftWinCount {0};
+			std::ptrdiff_t rightWinCount {0};
+			
+			do {
+				if (predicate(*rightIterator, *leftIterator)) {
+					*destinationIterator++ = std::move(*rightIterator++);
+					++rightWinCount;
+					leftWinCount = 0;
+					
+					if (--rightLength == 0) {
+						return;
+					}
+				} else {
+					*destinationIterator++ = std::move(*leftIterator++);
+					++leftWinCount;
+					rightWinCount = 0;
+					
+					if (--leftLength == 1) {
+						return;
+					}
+				}
+			} while ((leftWinCount | rightWinCount) < currentMinimumGallop);
+			
+			do {
+				leftWinCount = gallopRight(*rightIterator, leftIterator, leftLength, 0, predicate);
+				if (leftWinCount != 0) {
+					destinationIterator = std::move(leftIterator, leftIterator + leftWinCount, destinationIterator);
+					leftIterator += leftWinCount;
+					leftLength -= leftWinCount;
+					
+					if (leftLength <= 1) {
+						return;
+					}
+				}
+				
+				*destinationIterator++ = std::move(*rightIterator++);
+				if (--rightLength == 0) {
+					return;
+				}
+				
+				rightWinCount = gallopLeft(*leftIterator, rightIterator, rightLength, 0, predicate);
+				if (rightWinCount != 0) {
+					destinationIterator = std::move(rightIterator, rightIterator + rightWinCount, destinationIterator);
+					rightIterator += rightWinCount;
+					rightLength -= rightWinCount;
+					
+					if (rightLength == 0) {
+						return;
+					}
+				}
+				
+				*destinationIterator++ = std::move(*leftIterator++);
+				if (--leftLength == 1) {
+					return;
+				}
+				
+				--currentMinimumGallop;
+			} while (leftWinCount >= MINIMUM_GALLOP || rightWinCount >= MINIMUM_GALLOP);
+			
+			currentMinimumGallop = std::max(currentMinimumGallop, std::ptrdiff_t {0}) + 2;
+		}
+	}};
+	
+	mergeUntilOneRunIsExhausted();
+	minimumGallop = std::max(currentMinimumGallop, std::ptrdiff_t {1});
+	
+	if (leftLength == 1 && rightLength > 0) {
+		destinationIterator = std::move(rightIterator, rightIterator + rightLength, destinationIterator);
+		*destinationIterator = std::move(*leftIterator);
+	} else {
+		std::move(leftIterator, leftIterator + leftLength, destinationIterator);
+	}
+}
+
+template<ContiguousRangeConcept Container>
+template<typename Iterator>
+void TimSorter<Container>::mergeHigh(Iterator leftBase,
+                                     std::ptrdiff_t leftLength,
+                                     Iterator rightBase,
+                                     std::ptrdiff_t rightLength,
+                                     const Predicate& predicate) {
+	mergeBuffer.assign(std::make_move_iterator(rightBase), std::make_move_iterator(rightBase + rightLength));
+	
+	const auto bufferBase {mergeBuffer.begin()};
+	
+	*(leftBase + (leftLength + rightLength - 1)) = std::move(*(leftBase + (leftLength - 1)));
+	--leftLength;
+	
+	auto currentMinimumGallop {minimumGallop};
+	
+	const auto mergeUntilOneRunIsExhausted {[&]() {
+		if (leftLength == 0 || rightLength == 1) {
+			return;
+		}
+		
+		while (true) {
+			std::ptrdiff_t leftWinCount {0};
+			std::ptrdiff_t rightWinCount {0};
+			
+			do {
+				if (predicate(*(bufferBase + (rightLength - 1)), *(leftBase + (leftLength - 1)))) {
+					*(leftBase + (leftLength + rightLength - 1)) = std::move(*(leftBase + (leftLength - 1)));
+					++leftWinCount;
+					rightWinCount = 0;
+					
+					if (--leftLength == 0) {
+						return;
+					}
+				} else {
+					*(leftBase + (leftLength + rightLength - 1)) = std::move(*(bufferBase + (rightLength - 1)));
+					++rightWinCount;
+					leftWinCount = 0;
+					
+					if (--rightLength == 1) {
+						return;
+					}
+				}
+			} while ((leftWinCount | rightWinCount) < currentMinimumGallop);
+			
+			do {
+				leftWinCount = leftLength - gallopRight(*(bufferBase + (rightLength - 1)),
+				                                        leftBase,
+				                                        leftLength,
+				                                        leftLength - 1,
+				                                        predicate);
+				if (leftWinCount != 0) {
+					std::move_backward(leftBase + (leftLength - leftWinCount),
+					                   leftBase + leftLength,
+					                   leftBase + (leftLength + rightLength));
+					leftLength -= leftWinCount;
+					
+					if (leftLength == 0) {
+						return;
+					}
+				}
+				
+				*(leftBase + (leftLength + rightLength - 1)) = std::move(*(bufferBase + (rightLength - 1)));
+				if (--rightLength == 1) {
+					return;
+				}
+				
+				rightWinCount = rightLength - gallopLeft(*(leftBase + (leftLength - 1)),
+				                                         bufferBase,
+				                                         rightLength,
+				                                         rightLength - 1,
+				                                         predicate);
+				if (rightWinCount != 0) {
+					std::move_backward(bufferBase + (rightLength - rightWinCount),
+					                   bufferBase + rightLength,
+					                   leftBase + (leftLength + rightLength));
+					rightLength -= rightWinCount;
+					
+					if (rightLength <= 1) {
+						return;
+					}
+				}
+				
+				*(leftBase + (leftLength + rightLength - 1)) = std::move(*(leftBase + (leftLength - 1)));
+				if (--leftLength == 0) {
+					return;
+				}
+				
+				--currentMinimumGallop;
+			} while (leftWinCount >= MINIMUM_GALLOP || rightWinCount >= MINIMUM_GALLOP);
+			
+			currentMinimumGallop = std::max(currentMinimumGallop, std::ptrdiff_t {0}) + 2;
+		}
+	}};
+	
+	mergeUntilOneRunIsExhausted();
+	minimumGallop = std::max(currentMinimumGallop, std::ptrdiff_t {1});
+	
+	if (rightLength == 1 && leftLength > 0) {
+		std::move_backward(leftBase, leftBase + leftLength, leftBase + (leftLength + 1));
+		*leftBase = std::move(*bufferBase);
+	} else {
+		std::move(bufferBase, bufferBase + rightLength, leftBase + leftLength);
+	}
+}
+}
\ No newline at end of file
@@ -0,0 +1,253 @@
+#pragma once
+
+#include <algorithm>
+#include <functional>
+#include <optional>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace Core::Algorithms::Sorting {
+/**
+ * @brief A streaming accumulator that keeps the k elements that come first according to a predicate.
+ * @details The retained elements are kept in a heap whose root is the retained element that comes last, so each pushed
+ * element is compared against the root once and only elements that displace it cost O(log k) time. A stream of n
+ * elements is therefore processed in O(n log k) time using O(k) memory, regardless of the length of the stream.
+ * @class TopK
+ * @tparam ElementType: The type of the elements to accumulate.
+ */
+template<typename ElementType>
+class TopK final {
+public:
+	/**
+	 * @brief Instantiates a new top k accumulator.
+	 * @param capacity: The number of elements to retain.
+	 * @param predicate: The predicate that returns true if the first element should come before the second.
+	 * @throws std::invalid_argument: Thrown if the capacity is 0.
+	 */
+	TopK(const std::size_t capacity, std::function<bool(const ElementType&, const ElementType&)> predicate);
+	
+	/**
+	 * @brief Instantiates a new top k accumulator by copying the given top k accumulator.
+	 * @param other: The top k accumulator to copy.
+	 */
+	TopK(const TopK& other) = default;
+	
+	/**
+	 * @brief Instantiates a new top k accumulator by moving the given top k accumulator.
+	 * @param other: The top k accumulator to move.
+	 */
+	TopK(TopK&& other) noexcept = default;
+	
+	/**
+	 * @brief Destroys the top k accumulator.
+	 */
+	~TopK() noexcept = default;
+
+public:
+	/**
+	 * @brief Assigns the given top k accumulator to this top k accumulator using copy semantics.
+	 * @param other: The top k accumulator to copy.
+	 * @return A reference to this top k accumulator.
+	 */
+	TopK& operator=(const TopK& other) = default;
+	
+	/**
+	 * @brief Assigns the given top k accumulator to this top k accumulator using move semantics.
+	 * @param other: The top k accumulator to move.
+	 * @return A reference to this top k accumulator.
+	 */
+	TopK& operator=(TopK&& other) noexcept = default;
+
+public:
+	/**
+	 * @brief Offers the given element to the accumulator.
+	 * @param element: The element to offer.
+	 * @return True if the element was retained, false if it was discarded.
+	 */
+	bool push(const ElementType& element);
+	
+	/**
+	 * @brief Offers the given element to the accumulator.
+	 * @param element: The element to offer.
+	 * @return True if the element was retained, false if it was discarded.
+	 */
+	bool push(ElementType&& element);
+	
+	/**
+	 * @brief Gets the retained element that comes last, which any newly pushed element must come before to be retained
+	 * once the accumulator is full.
+	 * @return The retained element that comes last, or std::nullopt if no elements have been retained.
+	 */
+	std::optional<ElementType> peekThreshold() const noexcept(std::is_nothrow_copy_constructible_v<ElementType>);
+	
+	/**
+	 * @brief Gets the retained elements in the order defined by the predicate.
+	 * @return A vector containing the retained elements in sorted order.
+	 */
+	std::vector<ElementType> getSortedElements() const;
+	
+	/**
+	 * @brief Removes all retained elements.
+	 */
+	void clear() noexcept;
+	
+	/**
+	 * @brief Gets the number of retained elements.
+	 * @return The number of retained elements.
+	 */
+	std::size_t getSize() const noexcept;
+	
+	/**
+	 * @brief Gets the maximum number of retained elements.
+	 * @return The maximum number of retained elements.
+	 */
+	std::size_t getCapacity() const noexcept;
+	
+	/**
+	 * @brief Checks if the accumulator has not retained any elements.
+	 * @return True if the accumulator has not retained any elements, false otherwise.
+	 */
+	bool isEmpty() const noexcept;
+
+private:
+	/**
+	 * @brief Offers the given element to the accumulator.
+	 * @tparam Element: The type of the element, which is forwarded into the heap.
+	 * @param element: The element to offer.
+	 * @return True if the element was retained, false if it was discarded.
+	 */
+	template<typename Element>
+	bool offer(Element&& element);
+	
+	/**
+	 * @brief Moves the element at the given index up the heap until its parent comes after it.
+	 * @param index: The index of the element to move.
+	 */
+	void siftUp(std::size_t index);
+	
+	/**
+	 * @brief Moves the element at the given index down the heap until neither of its children come after it.
+	 * @param index: The index of the element to move.
+	 */
+	void siftDown(std::size_t index);
+
+private:
+	std::vector<ElementType> heap;
+	std::function<bool(const ElementType&, const ElementType&)> predicate;
+	std::size_t capacity;
+};
+
+template<typename ElementType>
+TopK<ElementType>::TopK(const std::size_t capacity,
+                        std::function<bool(const ElementType&, const ElementType&)> predicate) :
+		predicate {std::move(predicate)}, capacity {capacity} {
+	if (capacity == 0) {
+		throw std::invalid_argument {"The capacity must be greater than 0."};
+	}
+	
+	heap.reserve(capacity);
+}
+
+template<typename ElementType>
+bool TopK<ElementType>::push(const ElementType& element) {
+	return offer(element);
+}
+
+template<typename ElementType>
+bool TopK<ElementType>::push(ElementType&& element) {
+	return offer(std::move(element));
+}
+
+template<typename ElementType>
+std::optional<ElementType> TopK<ElementType>::peekThreshold() const noexcept(std::is_nothrow_copy_constructible_v<ElementType>) {
+	if (heap.empty()) {
+		return std::nullopt;
+	}
+	
+	return heap.front();
+}
+
+template<typename ElementType>
+std::vector<ElementType> TopK<ElementType>::getSortedElements() const {
+	auto elements {heap};
+	std::sort_heap(elements.begin(), elements.end(), predicate);
+	
+	return elements;
+}
+
+template<typename ElementType>
+void TopK<ElementType>::clear() noexcept {
+	heap.clear();
+}
+
+template<typename ElementType>
+std::size_t TopK<ElementType>::getSize() const noexcept {
+	return heap.size();
+}
+
+template<typename ElementType>
+std::size_t TopK<ElementType>::getCapacity() const noexcept {
+	return capacity;
+}
+
+template<typename ElementType>
+bool TopK<ElementType>::isEmpty() const noexcept {
+	return heap.empty();
+}
+
+template<typename ElementType>
+template<typename Element>
+bool TopK<ElementType>::offer(Element&& element) {
+	if (heap.size() < capacity) {
+		heap.push_back(std::forward<Element>(element));
+		siftUp(heap.size() - 1);
+		return true;
+	}
+	
+	if (!predicate(element, heap.front())) {
+		return false;
+	}
+	
+	heap.front() = std::forward<Element>(element);
+	siftDown(0);
+	return true;
+}
+
+template<typename ElementType>
+void TopK<ElementType>::siftUp(std::size_t index) {
+	while (index > 0) {
+		const auto parentIndex {(index - 1) / 2};
+		if (!predicate(heap[parentIndex], heap[index])) {
+			return;
+		}
+		
+		std::swap(heap[parentIndex], heap[index]);
+		index = parentIndex;
+	}
+}
+
+template<typename ElementType>
+void TopK<ElementType>::siftDown(std::size_t index) {
+	while (true) {
+		const auto leftChildIndex {2 * index + 1};
+		if (leftChildIndex >= heap.size()) {
+			return;
+		}
+		
+		auto selectedChildIndex {leftChildIndex};
+		const auto rightChildIndex {leftChildIndex + 1};
+		if (rightChildIndex < heap.size() && predicate(heap[leftChildIndex], heap[rightChildIndex])) {
+			selectedChildIndex = rightChildIndex;
+		}
+		
+		if (!predicate(heap[index], heap[selectedChildIndex])) {
+			return;
+		}
+		
+		std::swap(heap[index], heap[selectedChildIndex]);
+		index = selectedChildIndex;
+	}
+}
+}
\ No newline at end of file
@@ -3,6 +3,7 @@
 #include <algorithm>
 #include <functional>
 #include <optional>
+#include <utility>
 #include <vector>
 
 #include "DataStructures/LinkedLists/Iterators/DoublyLinkedListConstBidirectionalIterator.hpp"
@@ -234,6 +235,32 @@ public:
 	 */
 	void reverse() noexcept;
 	
+	/**
+	 * @brief Sorts the doubly linked list using the given predicate and a bottom-up merge sort.
+	 * @details The sort is stable and runs in O(n log n) time using O(1) extra memory. Only the links between the nodes
+	 * are changed, so no nodes are allocated, freed or copied and iterators to the nodes remain valid.
+	 * @param predicate: The predicate that returns true if the first element should come before the second.
+	 */
+	void sort(const std::function<bool(const ElementType&, const ElementType&)>& predicate) noexcept;
+	
+	/**
+	 * @brief Moves all nodes of the given doubly linked list to the tail of this doubly linked list in O(1) time.
+	 * @details No nodes are allocated, freed or copied. The given doubly linked list is left empty.
+	 * @param other: The doubly linked list whose nodes to move.
+	 */
+	void splice(DoublyLinkedList<ElementType>& other) noexcept;
+	
+	/**
+	 * @brief Merges the nodes of the given sorted doubly linked list into this sorted doubly linked list.
+	 * @details Both doubly linked lists must already be sorted using the given predicate. The merge runs in O(n + m)
+	 * time by relinking the nodes, so no nodes are allocated, freed or copied. Equal elements keep their relative
+	 * order, with the elements of this doubly linked list first. The given doubly linked list is left empty.
+	 * @param other: The sorted doubly linked list whose nodes to merge.
+	 * @param predicate: The predicate that returns true if the first element should come before the second.
+	 */
+	void merge(DoublyLinkedList<ElementType>& other,
+	           const std::function<bool(const ElementType&, const ElementType&)>& predicate) noexcept;
+	
 	/**
 	 * @brief Checks if the doubly linked list contains a node that satisfies the given predicate.
 	 * @param predicate: The predicate to satisfy.
@@ -262,6 +289,34 @@ public:
 	 */
 	std::size_t getNodeCount() const noexcept;
 
+private:
+	/**
+	 * @brief Detaches the chain of nodes starting at the given node after the given number of nodes.
+	 * @param node: The first node of the chain.
+	 * @param count: The number of nodes to keep in the chain.
+	 * @return The first node after the kept nodes, or nullptr if the chain has no more than count nodes.
+	 */
+	static DoublyLinkedListNode<ElementType>* splitAfter(DoublyLinkedListNode<ElementType>* node,
+	                                                     const std::size_t count) noexcept;
+	
+	/**
+	 * @brief Merges two sorted, null terminated chains of nodes by relinking their next nodes.
+	 * @details Equal elements keep their relative order, with the elements of the left chain first.
+	 * @param leftNode: The first node of the left chain.
+	 * @param rightNode: The first node of the right chain.
+	 * @param predicate: The predicate that returns true if the first element should come before the second.
+	 * @return The first and last nodes of the merged chain.
+	 */
+	static std::pair<DoublyLinkedListNode<ElementType>*, DoublyLinkedListNode<ElementType>*> mergeChains(
+			DoublyLinkedListNode<ElementType>* leftNode,
+			DoublyLinkedListNode<ElementType>* rightNode,
+			const std::function<bool(const ElementType&, const ElementType&)>& predicate) noexcept;
+	
+	/**
+	 * @brief Sets the previous node of every node from the head node onwards and updates the tail node.
+	 */
+	void relinkPreviousNodes() noexcept;
+
 private:
 	std::size_t nodeCount {0};
 	DoublyLinkedListNode<ElementType>* headNode {nullptr};
@@ -637,6 +692,78 @@ void DoublyLinkedList<ElementType>::reverse() noexcept {
 	tailNode = tempNode;
 }
 
+template<typename ElementType>
+void DoublyLinkedList<ElementType>::sort(const std::function<bool(const ElementType&, const ElementType&)>& predicate) noexcept {
+	if (nodeCount < 2) {
+		return;
+	}
+	
+	for (std::size_t width {1}; width < nodeCount; width *= 2) {
+		DoublyLinkedListNode<ElementType>* remainingNode {headNode};
+		DoublyLinkedListNode<ElementType>* mergedHeadNode {nullptr};
+		DoublyLinkedListNode<ElementType>* mergedTailNode {nullptr};
+		
+		while (remainingNode != nullptr) {
+			auto* leftNode {remainingNode};
+			auto* rightNode {splitAfter(leftNode, width)};
+			remainingNode = splitAfter(rightNode, width);
+			
+			const auto [firstNode, lastNode] {mergeChains(leftNode, rightNode, predicate)};
+			if (mergedTailNode == nullptr) {
+				mergedHeadNode = firstNode;
+			} else {
+				mergedTailNode->setNextNode(firstNode);
+			}
+			
+			mergedTailNode = lastNode;
+		}
+		
+		headNode = mergedHeadNode;
+		tailNode = mergedTailNode;
+	}
+	
+	relinkPreviousNodes();
+}
+
+template<typename ElementType>
+void DoublyLinkedList<ElementType>::splice(DoublyLinkedList<ElementType>& other) noexcept {
+	if (this == &other || other.headNode == nullptr) {
+		return;
+	}
+	
+	if (headNode == nullptr) {
+		headNode = other.headNode;
+	} else {
+		tailNode->setNextNode(other.headNode);
+		other.headNode->setPreviousNode(tailNode);
+	}
+	
+	tailNode = other.tailNode;
+	nodeCount += other.nodeCount;
+	
+	other.nodeCount = 0;
+	other.headNode = nullptr;
+	other.tailNode = nullptr;
+}
+
+template<typename ElementType>
+void DoublyLinkedList<ElementType>::merge(DoublyLinkedList<ElementType>& other,
+                                          const std::function<bool(const ElementType&, const ElementType&)>& predicate) noexcept {
+	if (this == &other || other.headNode == nullptr) {
+		return;
+	}
+	
+	const auto [firstNode, lastNode] {mergeChains(headNode, other.headNode, predicate)};
+	headNode = firstNode;
+	tailNode = lastNode;
+	nodeCount += other.nodeCount;
+	relinkPreviousNodes();
+	
+	other.nodeCount = 0;
+	other.headNode = nullptr;
+	other.tailNode = nullptr;
+}
+
 template<typename ElementType>
 bool DoublyLinkedList<ElementType>::contains(const std::function<bool(const ElementType&)>& predicate) const noexcept {
 	return std::any_of(cbegin(), cend(), predicate);
@@ -658,4 +785,70 @@ template<typename ElementType>
 std::size_t DoublyLinkedList<ElementType>::getNodeCount() const noexcept {
 	return nodeCount;
 }
+
+template<typename ElementType>
+DoublyLinkedListNode<ElementType>* DoublyLinkedList<ElementType>::splitAfter(DoublyLinkedListNode<ElementType>* node,
+                                                                             const std::size_t count) noexcept {
+	for (std::size_t index {1}; node != nullptr && index < count; ++index) {
+		node = node->getNextNode();
+	}
+	
+	if (node == nullptr) {
+		return nullptr;
+	}
+	
+	auto* nextNode {node->getNextNode()};
+	node->setNextNode(nullptr);
+	
+	return nextNode;
+}
+
+template<typename ElementType>
+std::pair<DoublyLinkedListNode<ElementType>*, DoublyLinkedListNode<ElementType>*> DoublyLinkedList<ElementType>::mergeChains(
+		DoublyLinkedListNode<ElementType>* leftNode,
+		DoublyLinkedListNode<ElementType>* rightNode,
+		const std::function<bool(const ElementType&, const ElementType&)>& predicate) noexcept {
+	DoublyLinkedListNode<ElementType>* firstNode {nullptr};
+	DoublyLinkedListNode<ElementType>* lastNode {nullptr};
+	const auto append {[&firstNode, &lastNode](DoublyLinkedListNode<ElementType>* node) {
+		if (lastNode == nullptr) {
+			firstNode = node;
+		} else {
+			lastNode->setNextNode(node);
+		}
+		
+		lastNode = node;
+	}};
+	
+	while (leftNode != nullptr && rightNode != nullptr) {
+		if (predicate(rightNode->getElement(), leftNode->getElement())) {
+			append(rightNode);
+			rightNode = rightNode->getNextNode();
+		} else {
+			append(leftNode);
+			leftNode = leftNode->getNextNode();
+		}
+	}
+	
+	auto* remainingNode {leftNode != nullptr ? leftNode : rightNode};
+	if (remainingNode != nullptr) {
+		append(remainingNode);
+		while (lastNode->getNextNode() != nullptr) {
+			lastNode = lastNode->getNextNode();
+		}
+	}
+	
+	return {firstNode, lastNode};
+}
+
+template<typename ElementType>
+void DoublyLinkedList<ElementType>::relinkPreviousNodes() noexcept {
+	DoublyLinkedListNode<ElementType>* previousNode {nullptr};
+	for (auto* currentNode {headNode}; currentNode != nullptr; currentNode = currentNode->getNextNode()) {
+		currentNode->setPreviousNode(previousNode);
+		previousNode = currentNode;
+	}
+	
+	tailNode = previousNode;
+}
 }
\ No newline at end of file
@@ -3,6 +3,7 @@
 #include <algorithm>
 #include <functional>
 #include <optional>
+#include <utility>
 #include <vector>
 
 #include "DataStructures/LinkedLists/Iterators/SinglyLinkedListConstForwardIterator.hpp"
@@ -190,6 +191,32 @@ public:
 	 */
 	void reverse() noexcept;
 	
+	/**
+	 * @brief Sorts the singly linked list using the given predicate and a bottom-up merge sort.
+	 * @details The sort is stable and runs in O(n log n) time using O(1) extra memory. Only the links between the nodes
+	 * are changed, so no nodes are allocated, freed or copied and iterators to the nodes remain valid.
+	 * @param predicate: The predicate that returns true if the first element should come before the second.
+	 */
+	void sort(const std::function<bool(const ElementType&, const ElementType&)>& predicate) noexcept;
+	
+	/**
+	 * @brief Moves all nodes of the given singly linked list to the tail of this singly linked list in O(1) time.
+	 * @details No nodes are allocated, freed or copied. The given singly linked list is left empty.
+	 * @param other: The singly linked list whose nodes to move.
+	 */
+	void splice(SinglyLinkedList<ElementType>& other) noexcept;
+	
+	/**
+	 * @brief Merges the nodes of the given sorted singly linked list into this sorted singly linked list.
+	 * @details Both singly linked lists must already be sorted using the given predicate. The merge runs in O(n + m)
+	 * time by relinking the nodes, so no nodes are allocated, freed or copied. Equal elements keep their relative
+	 * order, with the elements of this singly linked list first. The given singly linked list is left empty.
+	 * @param other: The sorted singly linked list whose nodes to merge.
+	 * @param predicate: The predicate that returns true if the first element should come before the second.
+	 */
+	void merge(SinglyLinkedList<ElementType>& other,
+	           const std::function<bool(const ElementType&, const ElementType&)>& predicate) noexcept;
+	
 	/**
 	 * @brief Checks if the singly linked list contains a node that satisfies the given predicate.
 	 * @param predicate: The predicate to satisfy.
@@ -218,6 +245,29 @@ public:
 	 */
 	std::size_t getNodeCount() const noexcept;
 
+private:
+	/**
+	 * @brief Detaches the chain of nodes starting at the given node after the given number of nodes.
+	 * @param node: The first node of the chain.
+	 * @param count: The number of nodes to keep in the chain.
+	 * @return The first node after the kept nodes, or nullptr if the chain has no more than count nodes.
+	 */
+	static SinglyLinkedListNode<ElementType>* splitAfter(SinglyLinkedListNode<ElementType>* node,
+	                                                     const std::size_t count) noexcept;
+	
+	/**
+	 * @brief Merges two sorted, null terminated chains of nodes by relinking their next nodes.
+	 * @details Equal elements keep their relative order, with the elements of the left chain first.
+	 * @param leftNode: The first node of the left chain.
+	 * @param rightNode: The first node of the right chain.
+	 * @param predicate: The predicate that returns true if the first element should come before the second.
+	 * @return The first and last nodes of the merged chain.
+	 */
+	static std::pair<SinglyLinkedListNode<ElementType>*, SinglyLinkedListNode<ElementType>*> mergeChains(
+			SinglyLinkedListNode<ElementType>* leftNode,
+			SinglyLinkedListNode<ElementType>* rightNode,
+			const std::function<bool(const ElementType&, const ElementType&)>& predicate) noexcept;
+
 private:
 	std::size_t nodeCount {0};
 	SinglyLinkedListNode<ElementType>* headNode {nullptr};
@@ -555,6 +605,74 @@ void SinglyLinkedList<ElementType>::reverse() noexcept {
 	headNode = previousNode;
 }
 
+template<typename ElementType>
+void SinglyLinkedList<ElementType>::sort(const std::function<bool(const ElementType&, const ElementType&)>& predicate) noexcept {
+	if (nodeCount < 2) {
+		return;
+	}
+	
+	for (std::size_t width {1}; width < nodeCount; width *= 2) {
+		SinglyLinkedListNode<ElementType>* remainingNode {headNode};
+		SinglyLinkedListNode<ElementType>* mergedHeadNode {nullptr};
+		SinglyLinkedListNode<ElementType>* mergedTailNode {nullptr};
+		
+		while (remainingNode != nullptr) {
+			auto* leftNode {remainingNode};
+			auto* rightNode {splitAfter(leftNode, width)};
+			remainingNode = splitAfter(rightNode, width);
+			
+			const auto [firstNode, lastNode] {mergeChains(leftNode, rightNode, predicate)};
+			if (mergedTailNode == nullptr) {
+				mergedHeadNode = firstNode;
+			} else {
+				mergedTailNode->setNextNode(firstNode);
+			}
+			
+			mergedTailNode = lastNode;
+		}
+		
+		headNode = mergedHeadNode;
+		tailNode = mergedTailNode;
+	}
+}
+
+template<typename ElementType>
+void SinglyLinkedList<ElementType>::splice(SinglyLinkedList<ElementType>& other) noexcept {
+	if (this == &other || other.headNode == nullptr) {
+		return;
+	}
+	
+	if (headNode == nullptr) {
+		headNode = other.headNode;
+	} else {
+		tailNode->setNextNode(other.headNode);
+	}
+	
+	tailNode = other.tailNode;
+	nodeCount += other.nodeCount;
+	
+	other.nodeCount = 0;
+	other.headNode = nullptr;
+	other.tailNode = nullptr;
+}
+
+template<typename ElementType>
+void SinglyLinkedList<ElementType>::merge(SinglyLinkedList<ElementType>& other,
+                                          const std::function<bool(const ElementType&, const ElementType&)>& predicate) noexcept {
+	if (this == &other || other.headNode == nullptr) {
+		return;
+	}
+	
+	const auto [firstNode, lastNode] {mergeChains(headNode, other.headNode, predicate)};
+	headNode = firstNode;
+	tailNode = lastNode;
+	nodeCount += other.nodeCount;
+	
+	other.nodeCount = 0;
+	other.headNode = nullptr;
+	other.tailNode = nullptr;
+}
+
 template<typename ElementType>
 bool SinglyLinkedList<ElementType>::contains(const std::function<bool(const ElementType&)>& predicate) const noexcept {
 	return std::any_of(cbegin(), cend(), predicate);
@@ -576,4 +694,59 @@ template<typename ElementType>
 std::size_t SinglyLinkedList<ElementType>::getNodeCount() const noexcept {
 	return nodeCount;
 }
+
+template<typename ElementType>
+SinglyLinkedListNode<ElementType>* SinglyLinkedList<ElementType>::splitAfter(SinglyLinkedListNode<ElementType>* node,
+                                                                             const std::size_t count) noexcept {
+	for (std::size_t index {1}; node != nullptr && index < count; ++index) {
+		node = node->getNextNode();
+	}
+	
+	if (node == nullptr) {
+		return nullptr;
+	}
+	
+	auto* nextNode {node->getNextNode()};
+	node->setNextNode(nullptr);
+	
+	return nextNode;
+}
+
+template<typename ElementType>
+std::pair<SinglyLinkedListNode<ElementType>*, SinglyLinkedListNode<ElementType>*> SinglyLinkedList<ElementType>::mergeChains(
+		SinglyLinkedListNode<ElementType>* leftNode,
+		SinglyLinkedListNode<ElementType>* rightNode,
+		const std::function<bool(const ElementType&, const ElementType&)>& predicate) noexcept {
+	SinglyLinkedListNode<ElementType>* firstNode {nullptr};
+	SinglyLinkedListNode<ElementType>* lastNode {nullptr};
+	const auto append {[&firstNode, &lastNode](SinglyLinkedListNode<ElementType>* node) {
+		if (lastNode == nullptr) {
+			firstNode = node;
+		} else {
+			lastNode->setNextNode(node);
+		}
+		
+		lastNode = node;
+	}};
+	
+	while (leftNode != nullptr && rightNode != nullptr) {
+		if (predicate(rightNode->getElement(), leftNode->getElement())) {
+			append(rightNode);
+			rightNode = rightNode->getNextNode();
+		} else {
+			append(leftNode);
+			leftNode = leftNode->getNextNode();
+		}
+	}
+	
+	auto* remainingNode {leftNode != nullptr ? leftNode : rightNode};
+	if (remainingNode != nullptr) {
+		append(remainingNode);
+		while (lastNode->getNextNode() != nullptr) {
+			lastNode = lastNode->getNextNode();
+		}
+	}
+	
+	return {firstNode, lastNode};
+}
 }
\ No newline at end of file
@@ -1,10 +1,18 @@
 #pragma once
 
+#include <algorithm>
+#include <array>
 #include <functional>
+#include <future>
+#include <iterator>
+#include <memory>
 #include <optional>
+#include <ranges>
+#include <stdexcept>
+#include <system_error>
+#include <utility>
 #include <vector>
 
-#include"DataStructures/Trees/BinaryTreeNode.hpp"
 #include "DataStructures/Trees/Iterators/BinaryTreeConstInOrderIterator.hpp"
 #include "DataStructures/Trees/Iterators/BinaryTreeConstLevelOrderIterator.hpp"
 #include "DataStructures/Trees/Iterators/BinaryTreeConstPostOrderIterator.hpp"
@@ -14,11 +22,20 @@
 #include "DataStructures/Trees/Iterators/BinaryTreeLevelOrderIterator.hpp"
 #include "DataStructures/Trees/Iterators/BinaryTreePostOrderIterator.hpp"
 #include "DataStructures/Trees/Iterators/BinaryTreePreOrderIterator.hpp"
+#include "DataStructures/Trees/Iterators/ParentLinkedBinaryTreeConstInOrderIterator.hpp"
+#include "DataStructures/Trees/Iterators/ParentLinkedBinaryTreeInOrderIterator.hpp"
+#include "DataStructures/Trees/NodeBlock.hpp"
+#include "DataStructures/Trees/ParentLinkedBinaryTreeNode.hpp"
 #include "BinarySearchTreeConcepts.hpp"
 
 namespace Core::DataStructures::Trees {
 /**
  * @brief An Adelson-Velsky and Landis tree.
+ * @details The nodes link to their parents, which rotations keep up to date, so in-order iterators are a single node
+ * pointer and remain valid across rebalancing caused by other insertions and removals. A tree built from sorted
+ * elements or copied from another tree places all of its nodes in a single contiguous block, which is released once the
+ * last of them is removed. Splits, joins and set operations relink nodes between trees in O(log n) time per split or
+ * join, so the trees involved share their blocks.
  * @class AVLTree
  * @tparam ElementType The type of the elements stored in the avl tree.
  */
@@ -30,8 +47,26 @@ public:
 	 */
 	AVLTree() noexcept = default;
 	
+	/**
+	 * @brief Instantiates a new avl tree by building a perfectly balanced tree from the given sorted elements in O(n)
+	 * time.
+	 * @details The nodes are allocated in a single contiguous block in ascending order, and the median of every range
+	 * of elements becomes the root of the subtree holding that range, so no rotations are needed. The left and right
+	 * subtrees of large ranges are built concurrently until the given number of threads is used up.
+	 * @tparam Range The type of the range of elements.
+	 * @param sortedElements The elements to build the avl tree from, sorted in ascending order.
+	 * @param threadCount The maximum number of threads to use, including the calling thread.
+	 * @throws std::invalid_argument Thrown if the elements are not sorted in ascending order.
+	 */
+	template<std::ranges::random_access_range Range>
+	requires std::ranges::sized_range<Range> &&
+	         std::convertible_to<std::ranges::range_reference_t<const Range>, const ElementType&>
+	explicit AVLTree(const Range& sortedElements, const std::size_t threadCount = 1);
+	
 	/**
 	 * @brief Instantiates a new avl tree by copying the given avl tree.
+	 * @details The nodes are cloned directly into a single contiguous block in ascending order, so the copy has the
+	 * same shape as the original and takes O(n) time without any comparisons or rotations.
 	 * @param other The avl tree to copy.
 	 */
 	AVLTree(const AVLTree& other);
@@ -73,14 +108,14 @@ public:
 
 public:
 	using value_type = ElementType;
-	using ConstInOrderIterator = Iterators::BinaryTreeConstInOrderIterator<ElementType>;
-	using ConstLevelOrderIterator = Iterators::BinaryTreeConstLevelOrderIterator<ElementType>;
-	using ConstPostOrderIterator = Iterators::BinaryTreeConstPostOrderIterator<ElementType>;
-	using ConstPreOrderIterator = Iterators::BinaryTreeConstPreOrderIterator<ElementType>;
-	using InOrderIterator = Iterators::BinaryTreeInOrderIterator<ElementType>;
-	using LevelOrderIterator = Iterators::BinaryTreeLevelOrderIterator<ElementType>;
-	using PostOrderIterator = Iterators::BinaryTreePostOrderIterator<ElementType>;
-	using PreOrderIterator = Iterators::BinaryTreePreOrderIterator<ElementType>;
+	using ConstInOrderIterator = Iterators::ParentLinkedBinaryTreeConstInOrderIterator<ElementType>;
+	using ConstLevelOrderIterator = Iterators::BinaryTreeConstLevelOrderIterator<ElementType, ParentLinkedBinaryTreeNode<ElementType>>;
+	using ConstPostOrderIterator = Iterators::BinaryTreeConstPostOrderIterator<ElementType, ParentLinkedBinaryTreeNode<ElementType>>;
+	using ConstPreOrderIterator = Iterators::BinaryTreeConstPreOrderIterator<ElementType, ParentLinkedBinaryTreeNode<ElementType>>;
+	using InOrderIterator = Iterators::ParentLinkedBinaryTreeInOrderIterator<ElementType>;
+	using LevelOrderIterator = Iterators::BinaryTreeLevelOrderIterator<ElementType, ParentLinkedBinaryTreeNode<ElementType>>;
+	using PostOrderIterator = Iterators::BinaryTreePostOrderIterator<ElementType, ParentLinkedBinaryTreeNode<ElementType>>;
+	using PreOrderIterator = Iterators::BinaryTreePreOrderIterator<ElementType, ParentLinkedBinaryTreeNode<ElementType>>;
 	
 	/**
 	 * @brief Gets a const in-order iterator to the first node in the avl tree.
@@ -237,6 +272,75 @@ public:
 	 */
 	std::optional<ElementType> findMaximum() const noexcept;
 	
+	/**
+	 * @brief Finds the element at the given position in ascending order in O(log n) time for a balanced tree.
+	 * @details Each node knows the size of its subtree, so the search descends into the subtree that holds the position
+	 * instead of visiting the elements before it.
+	 * @param index The zero-based position of the element, such that 0 selects the minimum element.
+	 * @return The element at the given position, or std::nullopt if the position is not less than the number of nodes.
+	 */
+	std::optional<ElementType> select(std::size_t index) const noexcept;
+	
+	/**
+	 * @brief Counts the elements in the avl tree that are less than the given element in O(log n) time for a
+	 * balanced tree.
+	 * @param element The element to rank.
+	 * @return The number of elements less than the given element, which is the position select returns it from if it is
+	 * in the avl tree.
+	 */
+	std::size_t rank(const ElementType& element) const noexcept;
+	
+	/**
+	 * @brief Counts the elements in the avl tree that are neither less than the given lower bound nor greater than
+	 * the given upper bound in O(log n) time for a balanced tree.
+	 * @param lowerBound The smallest element to count.
+	 * @param upperBound The largest element to count.
+	 * @return The number of elements in the closed range, or 0 if the upper bound is less than the lower bound.
+	 */
+	std::size_t countInRange(const ElementType& lowerBound, const ElementType& upperBound) const noexcept;
+	
+	/**
+	 * @brief Finds the first element in the avl tree that is not less than the given element in O(log n) time for a
+	 * balanced tree.
+	 * @details Iterating from the lower bound of one element to the lower bound of another visits the half-open range
+	 * between them without visiting any element before it.
+	 * @param element The element to search for.
+	 * @return A const in-order iterator to the first element not less than the given element, or the end iterator if
+	 * every element is less than it.
+	 */
+	ConstInOrderIterator lowerBound(const ElementType& element) const noexcept;
+	
+	/**
+	 * @brief Finds the first element in the avl tree that is greater than the given element in O(log n) time for a
+	 * balanced tree.
+	 * @param element The element to search for.
+	 * @return A const in-order iterator to the first element greater than the given element, or the end iterator if no
+	 * element is greater than it.
+	 */
+	ConstInOrderIterator upperBound(const ElementType& element) const noexcept;
+	
+	/**
+	 * @brief Finds the range of elements in the avl tree that are equivalent to the given element.
+	 * @param element The element to search for.
+	 * @return A pair of the lower bound and the upper bound of the given element, which are equal if the avl tree
+	 * does not contain it.
+	 */
+	std::pair<ConstInOrderIterator, ConstInOrderIterator> equalRange(const ElementType& element) const noexcept;
+	
+	/**
+	 * @brief Applies the given function to every element that is neither less than the lower bound nor greater than the
+	 * upper bound, in ascending order.
+	 * @details The search descends to the lower bound and then follows the in-order successors until the upper bound is
+	 * passed, so subtrees outside the range are never entered and a call takes O(log n + k) time for k elements in the
+	 * range of a balanced tree.
+	 * @param lowerBound The smallest element of the range.
+	 * @param upperBound The largest element of the range.
+	 * @param function The function to apply to each element in the range.
+	 */
+	void forEachInRange(const ElementType& lowerBound,
+	                    const ElementType& upperBound,
+	                    const std::function<void(const ElementType&)>& function) const;
+	
 	/**
 	 * @brief Traverses the avl tree using the given function on each node in the avl tree.
 	 * @tparam ConstIteratorType The type of const iterator to use to traverse the avl tree.
@@ -245,7 +349,7 @@ public:
 	 * @param function The function to use to traverse the avl tree.
 	 */
 	template<typename ConstIteratorType>
-	requires Iterators::AllowedConstIterator<ConstIteratorType, ElementType>
+	requires Iterators::AllowedConstIterator<ConstIteratorType, ElementType, ParentLinkedBinaryTreeNode<ElementType>>
 	void traverse(ConstIteratorType begin,
 	              ConstIteratorType end,
 	              const std::function<void(const ElementType&)>& function) const noexcept;
@@ -258,7 +362,7 @@ public:
 	 * @param function The function to use to traverse the avl tree.
 	 */
 	template<typename IteratorType>
-	requires Iterators::AllowedIterator<IteratorType, ElementType>
+	requires Iterators::AllowedIterator<IteratorType, ElementType, ParentLinkedBinaryTreeNode<ElementType>>
 	void traverse(IteratorType begin,
 	              IteratorType end,
 	              const std::function<void(ElementType&)>& function) const noexcept;
@@ -287,112 +391,419 @@ public:
 	 * @return The height of the avl tree.
 	 */
 	int getHeight() const noexcept;
+	
+	/**
+	 * @brief Splits the avl tree at the given element in O(log n) time.
+	 * @details The elements less than the given element stay in this avl tree, and the rest are moved into the returned
+	 * avl tree without copying any node.
+	 * @param element The element to split at.
+	 * @return An avl tree holding the elements that are not less than the given element.
+	 */
+	AVLTree<ElementType> split(const ElementType& element);
+	
+	/**
+	 * @brief Moves every element of the given avl tree into this avl tree in O(log n) time.
+	 * @param other The avl tree to join, whose elements must not be less than any element in this avl tree.
+	 * @throws std::invalid_argument Thrown if an element of the given avl tree is less than an element of this avl
+	 * tree.
+	 */
+	void join(AVLTree<ElementType>&& other);
+	
+	/**
+	 * @brief Moves the elements of the given avl tree that are not equivalent to any element in this avl tree into this
+	 * avl tree.
+	 * @details Both avl trees are split around the root element of the smaller one, the lesser and greater halves are
+	 * united recursively and the results are joined back together, which takes O(m log(n / m + 1)) time for avl trees
+	 * of sizes m and n with m <= n. The two halves of large subtrees are united concurrently until the given number of
+	 * threads is used up.
+	 * @param other The avl tree to unite with, which is left empty.
+	 * @param threadCount The maximum number of threads to use, including the calling thread.
+	 */
+	void unionWith(AVLTree<ElementType>&& other, const std::size_t threadCount = 1);
+	
+	/**
+	 * @brief Removes the elements of this avl tree that are not equivalent to any element in the given avl tree.
+	 * @details This takes O(m log(n / m + 1)) time like unionWith and runs on up to the given number of threads.
+	 * @param other The avl tree to intersect with, which is left empty.
+	 * @param threadCount The maximum number of threads to use, including the calling thread.
+	 */
+	void intersectWith(AVLTree<ElementType>&& other, const std::size_t threadCount = 1);
+	
+	/**
+	 * @brief Removes the elements of this avl tree that are equivalent to any element in the given avl tree.
+	 * @details This takes O(m log(n / m + 1)) time like unionWith and runs on up to the given number of threads.
+	 * @param other The avl tree to subtract, which is left empty.
+	 * @param threadCount The maximum number of threads to use, including the calling thread.
+	 */
+	void differenceWith(AVLTree<ElementType>&& other, const std::size_t threadCount = 1);
 
 private:
 	/**
-	 * @brief Inserts the given element into the avl tree using copy semantics recursively.
-	 * @param node The node to start inserting from.
-	 * @param element The element to insert.
-	 * @return The node that was inserted.
+	 * @brief The set operations that combine two avl trees.
 	 */
-	BinaryTreeNode<ElementType>* insert(BinaryTreeNode<ElementType>* node, const ElementType& element);
+	enum class SetOperation {
+		Union,
+		Intersection,
+		Difference
+	};
+	
+	using NodeBlocks = std::vector<std::shared_ptr<NodeBlock<ParentLinkedBinaryTreeNode<ElementType>>>>;
+	using SubtreePair = std::pair<ParentLinkedBinaryTreeNode<ElementType>*, ParentLinkedBinaryTreeNode<ElementType>*>;
 	
 	/**
-	 * @brief Inserts the given element into the avl tree using move semantics recursively.
-	 * @param node The node to start inserting from.
-	 * @param element The element to insert.
-	 * @return The node that was inserted.
+	 * @brief The greatest height of an avl tree whose node count fits in std::size_t, since an avl tree of height h has
+	 * at least F(h + 3) - 1 nodes and F(94) exceeds 2^64.
 	 */
-	BinaryTreeNode<ElementType>* insert(BinaryTreeNode<ElementType>* node, ElementType&& element);
+	static constexpr std::size_t MAX_HEIGHT {90};
 	
 	/**
-	 * @brief Removes the first occurrence of the given element from the avl tree recursively.
-	 * @param node The node to start removing from.
-	 * @param element The element to remove.
-	 * @param removedElement The element that was removed from the avl tree.
-	 * @return The node that was removed.
+	 * @brief The nodes on the path from the root down to a node, which insertions and removals record on their way
+	 * down and rebalance on their way back up instead of recursing.
+	 */
+	using NodePath = std::array<ParentLinkedBinaryTreeNode<ElementType>*, MAX_HEIGHT + 1>;
+	
+	/**
+	 * @brief Links the given leaf node into the avl tree after the elements equivalent to its element, in a single
+	 * descent followed by a retrace of the recorded path.
+	 * @param node The leaf node to insert.
+	 */
+	void insertNode(ParentLinkedBinaryTreeNode<ElementType>* node) noexcept;
+	
+	/**
+	 * @brief Unlinks and frees the given node, replacing it with its in-order successor if it has two children, and
+	 * rebalances its ancestors.
+	 * @param path The ancestors of the node, starting at the root node, which is extended to the in-order successor.
+	 * @param depth The number of ancestors of the node.
+	 * @param node The node to remove.
+	 */
+	void removeNode(NodePath& path, std::size_t depth, ParentLinkedBinaryTreeNode<ElementType>* node) noexcept;
+	
+	/**
+	 * @brief Rebalances the nodes of the given path from the bottom up, linking each rotated subtree into its parent.
+	 * @details Every node on the path is visited because the subtree sizes change all the way up to the root node.
+	 * @param path The nodes to rebalance, starting at the root node.
+	 * @param depth The number of nodes to rebalance.
 	 */
-	BinaryTreeNode<ElementType>* removeFirst(BinaryTreeNode<ElementType>* node,
-	                                         const ElementType& element,
-	                                         std::optional<ElementType>& removedElement);
+	void rebalancePath(const NodePath& path, std::size_t depth) noexcept;
 	
 	/**
-	 * @brief Gets the in-order successor of the given node.
-	 * @param node The node to get the in-order successor of.
-	 * @return The in-order successor of the given node.
+	 * @brief Replaces the given child of the given parent node, or the root node if there is no parent node.
+	 * @param parentNode The parent node of the child, or nullptr if the child is the root node.
+	 * @param childNode The child to replace.
+	 * @param newChildNode The node to put in place of the child, which may be nullptr.
 	 */
-	BinaryTreeNode<ElementType>* getInOrderSuccessor(BinaryTreeNode<ElementType>* node) noexcept;
+	void replaceChild(ParentLinkedBinaryTreeNode<ElementType>* parentNode,
+	                  const ParentLinkedBinaryTreeNode<ElementType>* childNode,
+	                  ParentLinkedBinaryTreeNode<ElementType>* newChildNode) noexcept;
 	
 	/**
-	 * @brief Removes the minimum element from the avl tree recursively.
-	 * @param node The node to start removing from.
-	 * @param removedElement The element that was removed from the avl tree.
-	 * @return The node that was removed.
+	 * @brief Gets the node with the minimum element in the subtree rooted at the given node.
+	 * @param node The root of the subtree.
+	 * @return The node with the minimum element, or nullptr if the subtree is empty.
 	 */
-	BinaryTreeNode<ElementType>* removeMinimum(BinaryTreeNode<ElementType>* node,
-	                                           std::optional<ElementType>& removedElement);
+	static ParentLinkedBinaryTreeNode<ElementType>* getMinimumNode(
+			ParentLinkedBinaryTreeNode<ElementType>* node) noexcept;
 	
 	/**
-	 * @brief Removes the maximum element from the avl tree recursively.
-	 * @param node The node to start removing from.
-	 * @param removedElement The element that was removed from the avl tree.
-	 * @return The node that was removed.
+	 * @brief Gets the node with the maximum element in the subtree rooted at the given node.
+	 * @param node The root of the subtree.
+	 * @return The node with the maximum element, or nullptr if the subtree is empty.
 	 */
-	BinaryTreeNode<ElementType>* removeMaximum(BinaryTreeNode<ElementType>* node,
-	                                           std::optional<ElementType>& removedElement);
+	static ParentLinkedBinaryTreeNode<ElementType>* getMaximumNode(
+			ParentLinkedBinaryTreeNode<ElementType>* node) noexcept;
 	
 	/**
-	 * @brief Removes all elements from the avl tree recursively.
-	 * @param node The node to start removing from.
+	 * @brief Gets the first node in post-order of the subtree rooted at the given node, which is the leaf reached by
+	 * always descending to the left child if there is one and to the right child otherwise.
+	 * @param node The root of the subtree, which may be nullptr.
+	 * @return The first node in post-order, or nullptr if the subtree is empty.
+	 */
+	static ParentLinkedBinaryTreeNode<ElementType>* getFirstPostOrderNode(
+			ParentLinkedBinaryTreeNode<ElementType>* node) noexcept;
+	
+	/**
+	 * @brief Unlinks the node with the minimum element from the subtree rooted at the given node without freeing it.
+	 * @param node The root of the subtree, which must not be empty.
+	 * @param minimumNode Set to the node that was unlinked.
+	 * @return The root of the rebalanced subtree.
+	 */
+	static ParentLinkedBinaryTreeNode<ElementType>* detachMinimum(
+			ParentLinkedBinaryTreeNode<ElementType>* node, ParentLinkedBinaryTreeNode<ElementType>*& minimumNode) noexcept;
+	
+	/**
+	 * @brief Removes all elements of the subtree rooted at the given node in post-order, following the parent links
+	 * instead of recursing.
+	 * @param node The root of the subtree to remove, whose parent must be nullptr.
 	 * @param elements The elements that were removed from the avl tree.
 	 */
-	void removeAll(BinaryTreeNode<ElementType>* node, std::vector<ElementType>& elements);
+	void removeAll(ParentLinkedBinaryTreeNode<ElementType>* node, std::vector<ElementType>& elements);
+	
+	/**
+	 * @brief Builds a perfectly balanced subtree in the given node block from the sorted elements in the given index
+	 * range.
+	 * @tparam Range The type of the range of elements.
+	 * @param sortedElements The elements to build the avl tree from, sorted in ascending order.
+	 * @param nodeBlock The node block to place the nodes in, at the indices of their elements.
+	 * @param first The index of the first element of the subtree.
+	 * @param last The index after the last element of the subtree.
+	 * @param threadCount The maximum number of threads to use, including the calling thread.
+	 * @return The root of the subtree, or nullptr if the index range is empty.
+	 */
+	template<typename Range>
+	static ParentLinkedBinaryTreeNode<ElementType>* buildSubtree(
+			const Range& sortedElements, NodeBlock<ParentLinkedBinaryTreeNode<ElementType>>& nodeBlock,
+			const std::size_t first, const std::size_t last, const std::size_t threadCount);
+	
+	/**
+	 * @brief Copies the nodes of the given avl tree into a new node block of this empty avl tree.
+	 * @param other The avl tree to copy.
+	 */
+	void copyNodes(const AVLTree& other);
+	
+	/**
+	 * @brief Clones the subtree rooted at the given node into the given node block, placing every node at its in-order
+	 * index.
+	 * @param node The root of the subtree to clone, which may be nullptr.
+	 * @param nodeBlock The node block to place the cloned nodes in.
+	 * @param first The in-order index of the first node of the subtree.
+	 * @return The root of the cloned subtree, or nullptr if the given subtree is empty.
+	 */
+	static ParentLinkedBinaryTreeNode<ElementType>* copySubtree(
+			const ParentLinkedBinaryTreeNode<ElementType>* node,
+			NodeBlock<ParentLinkedBinaryTreeNode<ElementType>>& nodeBlock, const std::size_t first) noexcept;
+	
+	/**
+	 * @brief Destroys the given node and forgets the node block that held it if that node block has become empty.
+	 * @param node The node to destroy.
+	 */
+	void deleteNode(ParentLinkedBinaryTreeNode<ElementType>* node) noexcept;
+	
+	/**
+	 * @brief Destroys the given node and releases its memory, which for a node stored in one of the given node blocks
+	 * happens once the last node in that block is destroyed.
+	 * @param node The node to destroy.
+	 * @param nodeBlocks The node blocks that may hold the node, sorted by address.
+	 */
+	static void destroyNode(ParentLinkedBinaryTreeNode<ElementType>* node, const NodeBlocks& nodeBlocks) noexcept;
+	
+	/**
+	 * @brief Finds the node block that holds the given node by binary searching the given node blocks.
+	 * @details The node blocks that are not empty cover disjoint address ranges, so only the last node block that
+	 * starts at or before the node can hold it.
+	 * @param node The node to find the node block of.
+	 * @param nodeBlocks The node blocks to search, sorted by address.
+	 * @return An iterator to the node block that holds the node, or the end of the node blocks if the node was
+	 * allocated on its own.
+	 */
+	static typename NodeBlocks::const_iterator findNodeBlock(
+			const ParentLinkedBinaryTreeNode<ElementType>* node, const NodeBlocks& nodeBlocks) noexcept;
+	
+	/**
+	 * @brief Adds the given node block to the node blocks of the avl tree, keeping them sorted by address.
+	 * @details The node blocks that have become empty are forgotten first, since the memory they were released from
+	 * may be reused by the added node block.
+	 * @param nodeBlock The node block to add.
+	 */
+	void addNodeBlock(std::shared_ptr<NodeBlock<ParentLinkedBinaryTreeNode<ElementType>>> nodeBlock);
+	
+	/**
+	 * @brief Gets the address of the given node block, which orders the node blocks of the avl tree.
+	 * @param nodeBlock The node block to get the address of.
+	 * @return The address of the first slot of the node block.
+	 */
+	static const ParentLinkedBinaryTreeNode<ElementType>* getNodeBlockAddress(
+			const std::shared_ptr<NodeBlock<ParentLinkedBinaryTreeNode<ElementType>>>& nodeBlock) noexcept;
+	
+	/**
+	 * @brief Destroys every node in the subtree rooted at the given node.
+	 * @param node The root of the subtree, which may be nullptr.
+	 * @param nodeBlocks The node blocks that may hold the nodes.
+	 */
+	static void destroySubtree(ParentLinkedBinaryTreeNode<ElementType>* node, const NodeBlocks& nodeBlocks) noexcept;
+	
+	/**
+	 * @brief Takes over the node blocks of the given avl tree, which is about to hand its nodes to this avl tree.
+	 * @details Both sorted node blocks are merged in a single pass, and a node block shared by both avl trees is kept
+	 * once.
+	 * @param other The avl tree to take the node blocks of.
+	 */
+	void adoptNodeBlocks(AVLTree<ElementType>& other);
+	
+	/**
+	 * @brief Makes the given node the root of the avl tree and updates the node count from its subtree size.
+	 * @param node The new root, which may be nullptr.
+	 */
+	void setRootNode(ParentLinkedBinaryTreeNode<ElementType>* node) noexcept;
+	
+	/**
+	 * @brief Joins the given subtrees under the given middle node, descending the spine of the taller subtree until
+	 * the heights match and rebalancing on the way back up.
+	 * @param leftSubtree The subtree whose elements are not greater than the element of the middle node.
+	 * @param middleNode The node to join the subtrees with, whose links are overwritten.
+	 * @param rightSubtree The subtree whose elements are not less than the element of the middle node.
+	 * @return The root of the joined subtree.
+	 */
+	static ParentLinkedBinaryTreeNode<ElementType>* joinWithNode(
+			ParentLinkedBinaryTreeNode<ElementType>* leftSubtree,
+			ParentLinkedBinaryTreeNode<ElementType>* middleNode,
+			ParentLinkedBinaryTreeNode<ElementType>* rightSubtree) noexcept;
+	
+	/**
+	 * @brief Joins the given subtrees by using the minimum node of the right subtree as the middle node.
+	 * @param leftSubtree The subtree whose elements are not greater than any element of the right subtree.
+	 * @param rightSubtree The subtree whose elements are not less than any element of the left subtree.
+	 * @return The root of the joined subtree.
+	 */
+	static ParentLinkedBinaryTreeNode<ElementType>* joinSubtrees(
+			ParentLinkedBinaryTreeNode<ElementType>* leftSubtree,
+			ParentLinkedBinaryTreeNode<ElementType>* rightSubtree) noexcept;
+	
+	/**
+	 * @brief Splits the subtree rooted at the given node into the elements less than the given element, or not greater
+	 * than it if inclusive, and the rest.
+	 * @param node The root of the subtree to split, which may be nullptr.
+	 * @param element The element to split at.
+	 * @param isInclusive True to put the elements equivalent to the given element into the left subtree, false
+	 * otherwise.
+	 * @return The roots of the left and right subtrees.
+	 */
+	static SubtreePair splitSubtree(
+			ParentLinkedBinaryTreeNode<ElementType>* node, const ElementType& element, const bool isInclusive) noexcept;
+	
+	/**
+	 * @brief Moves the elements of the given avl tree into this avl tree with the given set operation.
+	 * @param other The avl tree to combine with, which is left empty.
+	 * @param setOperation The set operation to combine the avl trees with.
+	 * @param threadCount The maximum number of threads to use, including the calling thread.
+	 */
+	void combineWith(AVLTree<ElementType>& other, const SetOperation setOperation, const std::size_t threadCount);
+	
+	/**
+	 * @brief Combines the given subtrees with the given set operation and destroys the nodes left out of the result.
+	 * @details Both subtrees are split around the root element of the smaller one, so the work is bounded by the size
+	 * of the smaller subtree. Only the nodes equivalent to that root element decide what is kept, as described for
+	 * unionWith, intersectWith and differenceWith.
+	 * @param first The root of the first subtree.
+	 * @param second The root of the second subtree.
+	 * @param setOperation The set operation to combine the subtrees with.
+	 * @param nodeBlocks The node blocks that may hold the destroyed nodes.
+	 * @param threadCount The maximum number of threads to use, including the calling thread.
+	 * @return The root of the combined subtree.
+	 */
+	static ParentLinkedBinaryTreeNode<ElementType>* combineSubtrees(
+			ParentLinkedBinaryTreeNode<ElementType>* first,
+			ParentLinkedBinaryTreeNode<ElementType>* second,
+			const SetOperation setOperation,
+			const NodeBlocks& nodeBlocks,
+			const std::size_t threadCount);
+	
+	/**
+	 * @brief Invokes the given functions, running the left function on a thread of its own if concurrent.
+	 * @details A left function whose thread cannot be started runs on the calling thread after the right function.
+	 * @tparam LeftFunction The type of the function that builds the left subtree.
+	 * @tparam RightFunction The type of the function that builds the right subtree.
+	 * @param leftFunction The function that builds the left subtree.
+	 * @param rightFunction The function that builds the right subtree.
+	 * @param isConcurrent True to run the left function on a thread of its own, false otherwise.
+	 * @return The roots returned by the left and right functions.
+	 */
+	template<typename LeftFunction, typename RightFunction>
+	static SubtreePair invokeSubtreeFunctions(
+			const LeftFunction& leftFunction, const RightFunction& rightFunction, const bool isConcurrent);
 	
 	/**
-	 * @brief Gets the height of the given node recursively.
-	 * @param node The node to get the height of.
-	 * @return The height of the given node.
+	 * @brief Gets the cached height of the given node.
+	 * @param node The node to get the height of, which may be nullptr.
+	 * @return The height of the given node, or -1 if the node is nullptr.
 	 */
-	int getHeight(const BinaryTreeNode<ElementType>* const node) const noexcept;
+	static int getHeight(const ParentLinkedBinaryTreeNode<ElementType>* const node) noexcept;
 	
 	/**
-	 * @brief Gets the balance factor of the given node recursively.
+	 * @brief Gets the balance factor of the given node from the cached heights of its children.
 	 * @param node The node to get the balance factor of.
 	 * @return The balance factor of the given node.
 	 */
-	int getBalanceFactor(const BinaryTreeNode<ElementType>* const node) const noexcept;
+	static int getBalanceFactor(const ParentLinkedBinaryTreeNode<ElementType>* const node) noexcept;
 	
 	/**
-	 * @brief Rebalances the given node recursively.
+	 * @brief Updates the cached subtree size and height of the given node and rebalances it.
 	 * @param node The node to rebalance.
 	 * @return The node that was rebalanced.
 	 */
-	BinaryTreeNode<ElementType>* rebalance(BinaryTreeNode<ElementType>* node) noexcept;
+	static ParentLinkedBinaryTreeNode<ElementType>* rebalance(ParentLinkedBinaryTreeNode<ElementType>* node) noexcept;
 	
 	/**
 	 * @brief Rotates the given node left recursively.
 	 * @param node The node to rotate left.
 	 * @return The node that was rotated left.
 	 */
-	BinaryTreeNode<ElementType>* rotateLeft(BinaryTreeNode<ElementType>* node) noexcept;
+	static ParentLinkedBinaryTreeNode<ElementType>* rotateLeft(ParentLinkedBinaryTreeNode<ElementType>* node) noexcept;
 	
 	/**
 	 * @brief Rotates the given node right recursively.
 	 * @param node The node to rotate right.
 	 * @return The node that was rotated right.
 	 */
-	BinaryTreeNode<ElementType>* rotateRight(BinaryTreeNode<ElementType>* node) noexcept;
+	static ParentLinkedBinaryTreeNode<ElementType>* rotateRight(ParentLinkedBinaryTreeNode<ElementType>* node) noexcept;
+	
+	/**
+	 * @brief Counts the elements that come before the given element, or that are not greater than it if inclusive.
+	 * @param element The element to count up to.
+	 * @param isInclusive True to also count the elements equivalent to the given element, false otherwise.
+	 * @return The number of elements before the given element.
+	 */
+	std::size_t countPreceding(const ElementType& element, const bool isInclusive) const noexcept;
+	
+	/**
+	 * @brief Finds the first node whose element is not less than the given element, or greater than it if upper.
+	 * @param element The element to search for.
+	 * @param isUpper True to skip the elements equivalent to the given element, false otherwise.
+	 * @return The first node after the elements that precede the bound, or nullptr if there is no such node.
+	 */
+	const ParentLinkedBinaryTreeNode<ElementType>* findBound(const ElementType& element,
+	                                                         const bool isUpper) const noexcept;
+	
+	/**
+	 * @brief Gets the number of nodes in the subtree rooted at the given node.
+	 * @param node The root of the subtree, which may be nullptr.
+	 * @return The number of nodes in the subtree, or 0 if the subtree is empty.
+	 */
+	static std::size_t getSubtreeSize(const ParentLinkedBinaryTreeNode<ElementType>* node) noexcept;
 
 private:
+	/**
+	 * @brief The smallest number of elements in a subtree that is built or combined on a thread of its own.
+	 */
+	static constexpr std::size_t MINIMUM_PARALLEL_SUBTREE_SIZE {1 << 16};
+	
 	std::size_t nodeCount {0};
-	BinaryTreeNode<ElementType>* rootNode {nullptr};
+	ParentLinkedBinaryTreeNode<ElementType>* rootNode {nullptr};
+	NodeBlocks nodeBlocks {};
 };
 
 template<ElementTypeWithLessThanOperator ElementType>
-AVLTree<ElementType>::AVLTree(const AVLTree<ElementType>& other) {
-	for (auto iterator {other.cbeginLevelOrder()}; iterator != other.cendLevelOrder(); ++iterator) {
-		insert(*iterator);
+template<std::ranges::random_access_range Range>
+requires std::ranges::sized_range<Range> &&
+         std::convertible_to<std::ranges::range_reference_t<const Range>, const ElementType&>
+AVLTree<ElementType>::AVLTree(const Range& sortedElements, const std::size_t threadCount) {
+	if (!std::is_sorted(std::ranges::begin(sortedElements), std::ranges::end(sortedElements))) {
+		throw std::invalid_argument {"The elements must be sorted in ascending order."};
 	}
+	
+	const auto size {static_cast<std::size_t>(std::ranges::size(sortedElements))};
+	if (size == 0) {
+		return;
+	}
+	
+	auto nodeBlock {std::make_shared<NodeBlock<ParentLinkedBinaryTreeNode<ElementType>>>(size)};
+	addNodeBlock(nodeBlock);
+	nodeCount = size;
+	rootNode = buildSubtree(sortedElements, *nodeBlock, 0, size, std::max<std::size_t>(1, threadCount));
+}
+
+template<ElementTypeWithLessThanOperator ElementType>
+AVLTree<ElementType>::AVLTree(const AVLTree<ElementType>& other) {
+	copyNodes(other);
 }
 
 template<ElementTypeWithLessThanOperator ElementType>
@@ -401,9 +812,11 @@ AVLTree<ElementType>::AVLTree(AVLTree<ElementType>&& other) noexcept {
 	
 	nodeCount = other.nodeCount;
 	rootNode = other.rootNode;
+	nodeBlocks = std::move(other.nodeBlocks);
 	
 	other.nodeCount = 0;
 	other.rootNode = nullptr;
+	other.nodeBlocks.clear();
 }
 
 template<ElementTypeWithLessThanOperator ElementType>
@@ -418,10 +831,7 @@ AVLTree<ElementType>& AVLTree<ElementType>::operator=(const AVLTree& other) {
 	}
 	
 	removeAll();
-	
-	for (auto iterator {other.cbeginInOrder()}; iterator != other.cendInOrder(); ++iterator) {
-		insert(*iterator);
-	}
+	copyNodes(other);
 	
 	return *this;
 }
@@ -436,9 +846,11 @@ AVLTree<ElementType>& AVLTree<ElementType>::operator=(AVLTree&& other) noexcept
 	
 	nodeCount = other.nodeCount;
 	rootNode = other.rootNode;
+	nodeBlocks = std::move(other.nodeBlocks);
 	
 	other.nodeCount = 0;
 	other.rootNode = nullptr;
+	other.nodeBlocks.clear();
 	
 	return *this;
 }
@@ -454,7 +866,7 @@ bool AVLTree<ElementType>::operator==(const AVLTree& other) const noexcept {
 
 template<ElementTypeWithLessThanOperator ElementType>
 AVLTree<ElementType>::ConstInOrderIterator AVLTree<ElementType>::AVLTree::cbeginInOrder() const noexcept {
-	return ConstInOrderIterator {rootNode};
+	return ConstInOrderIterator {getMinimumNode(rootNode)};
 }
 
 template<ElementTypeWithLessThanOperator ElementType>
@@ -494,7 +906,7 @@ AVLTree<ElementType>::ConstPreOrderIterator AVLTree<ElementType>::AVLTree::cendP
 
 template<ElementTypeWithLessThanOperator ElementType>
 AVLTree<ElementType>::InOrderIterator AVLTree<ElementType>::AVLTree::beginInOrder() noexcept {
-	return InOrderIterator {rootNode};
+	return InOrderIterator {getMinimumNode(rootNode)};
 }
 
 template<ElementTypeWithLessThanOperator ElementType>
@@ -534,25 +946,40 @@ AVLTree<ElementType>::PreOrderIterator AVLTree<ElementType>::AVLTree::endPreOrde
 
 template<ElementTypeWithLessThanOperator ElementType>
 void AVLTree<ElementType>::AVLTree::insert(const ElementType& element) noexcept {
-	rootNode = insert(rootNode, element);
-	++nodeCount;
+	insertNode(new ParentLinkedBinaryTreeNode<ElementType> {element});
 }
 
 template<ElementTypeWithLessThanOperator ElementType>
 void AVLTree<ElementType>::AVLTree::insert(ElementType&& element) noexcept {
-	rootNode = insert(rootNode, std::move(element));
-	++nodeCount;
+	insertNode(new ParentLinkedBinaryTreeNode<ElementType> {std::move(element)});
 }
 
 template<ElementTypeWithLessThanOperator ElementType>
 std::optional<ElementType> AVLTree<ElementType>::removeFirst(const ElementType& element) {
-	std::optional<ElementType> removedElement;
-	rootNode = removeFirst(rootNode, element, removedElement);
+	NodePath path;
+	std::size_t depth {0};
+	auto* currentNode {rootNode};
+	
+	while (currentNode != nullptr) {
+		const auto& currentNodeElement {currentNode->getElement()};
+		if (element < currentNodeElement) {
+			path[depth++] = currentNode;
+			currentNode = currentNode->getLeftChild();
+		} else if (currentNodeElement < element) {
+			path[depth++] = currentNode;
+			currentNode = currentNode->getRightChild();
+		} else {
+			break;
+		}
+	}
 	
-	if (removedElement.has_value()) {
-		--nodeCount;
+	if (currentNode == nullptr) {
+		return std::nullopt;
 	}
 	
+	std::optional<ElementType> removedElement {std::move(currentNode->getElement())};
+	removeNode(path, depth, currentNode);
+	
 	return removedElement;
 }
 
@@ -562,13 +989,18 @@ std::optional<ElementType> AVLTree<ElementType>::removeMinimum() {
 		return std::nullopt;
 	}
 	
-	std::optional<ElementType> removedElement;
-	rootNode = removeMinimum(rootNode, removedElement);
+	NodePath path;
+	std::size_t depth {0};
+	auto* currentNode {rootNode};
 	
-	if (removedElement.has_value()) {
-		--nodeCount;
+	while (currentNode->getLeftChild() != nullptr) {
+		path[depth++] = currentNode;
+		currentNode = currentNode->getLeftChild();
 	}
 	
+	std::optional<ElementType> removedElement {std::move(currentNode->getElement())};
+	removeNode(path, depth, currentNode);
+	
 	return removedElement;
 }
 
@@ -578,13 +1010,18 @@ std::optional<ElementType> AVLTree<ElementType>::removeMaximum() {
 		return std::nullopt;
 	}
 	
-	std::optional<ElementType> removedElement;
-	rootNode = removeMaximum(rootNode, removedElement);
+	NodePath path;
+	std::size_t depth {0};
+	auto* currentNode {rootNode};
 	
-	if (removedElement.has_value()) {
-		--nodeCount;
+	while (currentNode->getRightChild() != nullptr) {
+		path[depth++] = currentNode;
+		currentNode = currentNode->getRightChild();
 	}
 	
+	std::optional<ElementType> removedElement {std::move(currentNode->getElement())};
+	removeNode(path, depth, currentNode);
+	
 	return removedElement;
 }
 
@@ -653,9 +1090,75 @@ std::optional<ElementType> AVLTree<ElementType>::findMaximum() const noexcept {
 	return currentNode->getElement();
 }
 
+template<ElementTypeWithLessThanOperator ElementType>
+std::optional<ElementType> AVLTree<ElementType>::select(std::size_t index) const noexcept {
+	if (index >= nodeCount) {
+		return std::nullopt;
+	}
+	
+	const auto* currentNode {rootNode};
+	
+	while (true) {
+		const auto leftSubtreeSize {getSubtreeSize(currentNode->getLeftChild())};
+		
+		if (index < leftSubtreeSize) {
+			currentNode = currentNode->getLeftChild();
+		} else if (index == leftSubtreeSize) {
+			return currentNode->getElement();
+		} else {
+			index -= leftSubtreeSize + 1;
+			currentNode = currentNode->getRightChild();
+		}
+	}
+}
+
+template<ElementTypeWithLessThanOperator ElementType>
+std::size_t AVLTree<ElementType>::rank(const ElementType& element) const noexcept {
+	return countPreceding(element, false);
+}
+
+template<ElementTypeWithLessThanOperator ElementType>
+std::size_t AVLTree<ElementType>::countInRange(const ElementType& lowerBound,
+                                               const ElementType& upperBound) const noexcept {
+	if (upperBound < lowerBound) {
+		return 0;
+	}
+	
+	return countPreceding(upperBound, true) - countPreceding(lowerBound, false);
+}
+
+template<ElementTypeWithLessThanOperator ElementType>
+AVLTree<ElementType>::ConstInOrderIterator AVLTree<ElementType>::lowerBound(const ElementType& element) const noexcept {
+	return ConstInOrderIterator {findBound(element, false)};
+}
+
+template<ElementTypeWithLessThanOperator ElementType>
+AVLTree<ElementType>::ConstInOrderIterator AVLTree<ElementType>::upperBound(const ElementType& element) const noexcept {
+	return ConstInOrderIterator {findBound(element, true)};
+}
+
+template<ElementTypeWithLessThanOperator ElementType>
+std::pair<typename AVLTree<ElementType>::ConstInOrderIterator, typename AVLTree<ElementType>::ConstInOrderIterator>
+AVLTree<ElementType>::equalRange(const ElementType& element) const noexcept {
+	return {lowerBound(element), upperBound(element)};
+}
+
+template<ElementTypeWithLessThanOperator ElementType>
+void AVLTree<ElementType>::forEachInRange(const ElementType& lowerBound,
+                                          const ElementType& upperBound,
+                                          const std::function<void(const ElementType&)>& function) const {
+	for (auto iterator {this->lowerBound(lowerBound)}; iterator != cendInOrder(); ++iterator) {
+		if (upperBound < *iterator) {
+			return;
+		}
+		
+		function(*iterator);
+	}
+}
+
 template<ElementTypeWithLessThanOperator ElementType>
 template<typename ConstIteratorType>
-requires Iterators::AllowedConstIterator<ConstIteratorType, ElementType>
+requires Iterators::AllowedConstIterator<ConstIteratorType, ElementType, ParentLinkedBinaryTreeNode<ElementType>>
 void AVLTree<ElementType>::traverse(ConstIteratorType begin,
                                     ConstIteratorType end,
                                     const std::function<void(const ElementType&)>& function) const noexcept {
@@ -664,7 +1167,7 @@ void AVLTree<ElementType>::traverse(ConstIteratorType begin,
 
 template<ElementTypeWithLessThanOperator ElementType>
 template<typename IteratorType>
-requires Iterators::AllowedIterator<IteratorType, ElementType>
+requires Iterators::AllowedIterator<IteratorType, ElementType, ParentLinkedBinaryTreeNode<ElementType>>
 void AVLTree<ElementType>::traverse(IteratorType begin,
                                     IteratorType end,
                                     const std::function<void(ElementType&)>& function) const noexcept {
@@ -692,164 +1195,532 @@ int AVLTree<ElementType>::getHeight() const noexcept {
 }
 
 template<ElementTypeWithLessThanOperator ElementType>
-BinaryTreeNode<ElementType>* AVLTree<ElementType>::insert(BinaryTreeNode<ElementType>* node,
-                                                          const ElementType& element) {
-	if (node == nullptr) {
-		return new BinaryTreeNode<ElementType> {element};
+AVLTree<ElementType> AVLTree<ElementType>::split(const ElementType& element) {
+	AVLTree<ElementType> upperAVLTree {};
+	upperAVLTree.nodeBlocks = nodeBlocks;
+	
+	const auto [lowerSubtree, upperSubtree] {splitSubtree(rootNode, element, false)};
+	setRootNode(lowerSubtree);
+	upperAVLTree.setRootNode(upperSubtree);
+	
+	return upperAVLTree;
+}
+
+template<ElementTypeWithLessThanOperator ElementType>
+void AVLTree<ElementType>::join(AVLTree<ElementType>&& other) {
+	if (this == &other) {
+		throw std::invalid_argument {"An avl tree cannot be joined with itself."};
 	}
 	
-	if (const auto& nodeElement {node->getElement()}; element < nodeElement) {
-		node->setLeftChild(insert(node->getLeftChild(), element));
-	} else {
-		node->setRightChild(insert(node->getRightChild(), element));
+	if (rootNode != nullptr && other.rootNode != nullptr &&
+	    getMinimumNode(other.rootNode)->getElement() < getMaximumNode(rootNode)->getElement()) {
+		throw std::invalid_argument {"The joined avl tree must not contain elements less than those of this avl tree."};
 	}
 	
-	return rebalance(node);
+	adoptNodeBlocks(other);
+	setRootNode(joinSubtrees(rootNode, other.rootNode));
+	other.setRootNode(nullptr);
 }
 
 template<ElementTypeWithLessThanOperator ElementType>
-BinaryTreeNode<ElementType>* AVLTree<ElementType>::insert(BinaryTreeNode<ElementType>* node, ElementType&& element) {
-	if (node == nullptr) {
-		return new BinaryTreeNode<ElementType> {std::move(element)};
+void AVLTree<ElementType>::unionWith(AVLTree<ElementType>&& other, const std::size_t threadCount) {
+	if (this != &other) {
+		combineWith(other, SetOperation::Union, threadCount);
 	}
-	
-	if (const auto& nodeElement {node->getElement()}; element < nodeElement) {
-		node->setLeftChild(insert(node->getLeftChild(), std::move(element)));
-	} else {
-		node->setRightChild(insert(node->getRightChild(), std::move(element)));
+}
+
+template<ElementTypeWithLessThanOperator ElementType>
+void AVLTree<ElementType>::intersectWith(AVLTree<ElementType>&& other, const std::size_t threadCount) {
+	if (this != &other) {
+		combineWith(other, SetOperation::Intersection, threadCount);
+	}
+}
+
+template<ElementTypeWithLessThanOperator ElementType>
+void AVLTree<ElementType>::differenceWith(AVLTree<ElementType>&& other, const std::size_t threadCount) {
+	if (this == &other) {
+		removeAll();
+		return;
 	}
 	
-	return rebalance(node);
+	combineWith(other, SetOperation::Difference, threadCount);
 }
 
 template<ElementTypeWithLessThanOperator ElementType>
-BinaryTreeNode<ElementType>* AVLTree<ElementType>::removeFirst(BinaryTreeNode<ElementType>* node,
-                                                               const ElementType& element,
-                                                               std::optional<ElementType>& removedElement) {
-	if (node == nullptr) {
-		return nullptr;
+void AVLTree<ElementType>::insertNode(ParentLinkedBinaryTreeNode<ElementType>* node) noexcept {
+	NodePath path;
+	std::size_t depth {0};
+	auto* currentNode {rootNode};
+	
+	const auto& nodeElement {node->getElement()};
+	while (currentNode != nullptr) {
+		path[depth++] = currentNode;
+		
+		if (nodeElement < currentNode->getElement()) {
+			currentNode = currentNode->getLeftChild();
+		} else {
+			currentNode = currentNode->getRightChild();
+		}
 	}
 	
-	if (const auto& nodeElement {node->getElement()}; element < nodeElement) {
-		node->setLeftChild(removeFirst(node->getLeftChild(), element, removedElement));
-	} else if (element > nodeElement) {
-		node->setRightChild(removeFirst(node->getRightChild(), element, removedElement));
+	if (depth == 0) {
+		rootNode = node;
+	} else if (auto* parentNode {path[depth - 1]}; nodeElement < parentNode->getElement()) {
+		parentNode->setLeftChild(node);
 	} else {
-		removedElement = node->getElement();
+		parentNode->setRightChild(node);
+	}
+	
+	rebalancePath(path, depth);
+	++nodeCount;
+}
+
+template<ElementTypeWithLessThanOperator ElementType>
+void AVLTree<ElementType>::removeNode(NodePath& path,
+                                      std::size_t depth,
+                                      ParentLinkedBinaryTreeNode<ElementType>* node) noexcept {
+	auto* parentNode {depth == 0 ? nullptr : path[depth - 1]};
+	auto* leftChild {node->getLeftChild()};
+	auto* rightChild {node->getRightChild()};
+	
+	if (leftChild == nullptr || rightChild == nullptr) {
+		replaceChild(parentNode, node, leftChild != nullptr ? leftChild : rightChild);
+	} else {
+		const auto nodeDepth {depth++};
+		auto* inOrderSuccessor {rightChild};
 		
-		if (node->getLeftChild() != nullptr && node->getRightChild() != nullptr) {
-			auto* inOrderSuccessorParent {node};
-			auto* inOrderSuccessor {getInOrderSuccessor(node->getRightChild())};
-			
-			if (inOrderSuccessorParent != node) {
-				inOrderSuccessorParent->setLeftChild(inOrderSuccessor->getRightChild());
-			} else {
-				inOrderSuccessorParent->setRightChild(inOrderSuccessor->getRightChild());
-			}
-			
-			inOrderSuccessor->setLeftChild(node->getLeftChild());
-			inOrderSuccessor->setRightChild(
-					node->getRightChild() == inOrderSuccessor ? inOrderSuccessorParent : node->getRightChild());
-			
-			delete node;
-			
-			node = inOrderSuccessor;
-		} else {
-			
-			auto* childNode {node->getLeftChild() != nullptr ? node->getLeftChild() : node->getRightChild()};
-			
-			delete node;
-			
-			node = childNode;
+		while (inOrderSuccessor->getLeftChild() != nullptr) {
+			path[depth++] = inOrderSuccessor;
+			inOrderSuccessor = inOrderSuccessor->getLeftChild();
 		}
+		
+		if (inOrderSuccessor != rightChild) {
+			path[depth - 1]->setLeftChild(inOrderSuccessor->getRightChild());
+			inOrderSuccessor->setRightChild(rightChild);
+		}
+		
+		inOrderSuccessor->setLeftChild(leftChild);
+		replaceChild(parentNode, node, inOrderSuccessor);
+		path[nodeDepth] = inOrderSuccessor;
 	}
 	
+	deleteNode(node);
+	rebalancePath(path, depth);
+	--nodeCount;
+}
+
+template<ElementTypeWithLessThanOperator ElementType>
+void AVLTree<ElementType>::rebalancePath(const NodePath& path, std::size_t depth) noexcept {
+	while (depth > 0) {
+		auto* node {path[--depth]};
+		if (auto* subtreeRoot {rebalance(node)}; subtreeRoot != node) {
+			replaceChild(depth == 0 ? nullptr : path[depth - 1], node, subtreeRoot);
+		}
+	}
+}
+
+template<ElementTypeWithLessThanOperator ElementType>
+void AVLTree<ElementType>::replaceChild(ParentLinkedBinaryTreeNode<ElementType>* parentNode,
+                                        const ParentLinkedBinaryTreeNode<ElementType>* childNode,
+                                        ParentLinkedBinaryTreeNode<ElementType>* newChildNode) noexcept {
+	if (parentNode == nullptr) {
+		rootNode = newChildNode;
+		if (rootNode != nullptr) {
+			rootNode->setParent(nullptr);
+		}
+	} else if (parentNode->getLeftChild() == childNode) {
+		parentNode->setLeftChild(newChildNode);
+	} else {
+		parentNode->setRightChild(newChildNode);
+	}
+}
+
+template<ElementTypeWithLessThanOperator ElementType>
+ParentLinkedBinaryTreeNode<ElementType>* AVLTree<ElementType>::getMinimumNode(
+		ParentLinkedBinaryTreeNode<ElementType>* node) noexcept {
 	if (node == nullptr) {
-		return node;
+		return nullptr;
 	}
 	
-	return rebalance(node);
+	while (node->getLeftChild() != nullptr) {
+		node = node->getLeftChild();
+	}
+	
+	return node;
 }
 
 template<ElementTypeWithLessThanOperator ElementType>
-BinaryTreeNode<ElementType>* AVLTree<ElementType>::getInOrderSuccessor(BinaryTreeNode<ElementType>* node) noexcept {
-	auto* currentNode {node};
+ParentLinkedBinaryTreeNode<ElementType>* AVLTree<ElementType>::getMaximumNode(
+		ParentLinkedBinaryTreeNode<ElementType>* node) noexcept {
+	if (node == nullptr) {
+		return nullptr;
+	}
 	
-	while (currentNode != nullptr && currentNode->getLeftChild() != nullptr) {
-		currentNode = currentNode->getLeftChild();
+	while (node->getRightChild() != nullptr) {
+		node = node->getRightChild();
 	}
 	
-	return currentNode;
+	return node;
 }
 
 template<ElementTypeWithLessThanOperator ElementType>
-BinaryTreeNode<ElementType>* AVLTree<ElementType>::removeMinimum(BinaryTreeNode<ElementType>* node,
-                                                                 std::optional<ElementType>& removedElement) {
+ParentLinkedBinaryTreeNode<ElementType>* AVLTree<ElementType>::getFirstPostOrderNode(
+		ParentLinkedBinaryTreeNode<ElementType>* node) noexcept {
 	if (node == nullptr) {
 		return nullptr;
 	}
 	
+	while (node->getLeftChild() != nullptr || node->getRightChild() != nullptr) {
+		node = node->getLeftChild() != nullptr ? node->getLeftChild() : node->getRightChild();
+	}
+	
+	return node;
+}
+
+template<ElementTypeWithLessThanOperator ElementType>
+ParentLinkedBinaryTreeNode<ElementType>* AVLTree<ElementType>::detachMinimum(
+		ParentLinkedBinaryTreeNode<ElementType>* node, ParentLinkedBinaryTreeNode<ElementType>*& minimumNode) noexcept {
 	if (node->getLeftChild() == nullptr) {
-		removedElement = node->getElement();
-		auto* rightChild {node->getRightChild()};
-		delete node;
-		
-		return rightChild;
+		minimumNode = node;
+		return node->getRightChild();
 	}
 	
-	node->setLeftChild(removeMinimum(node->getLeftChild(), removedElement));
+	node->setLeftChild(detachMinimum(node->getLeftChild(), minimumNode));
 	
 	return rebalance(node);
 }
 
 template<ElementTypeWithLessThanOperator ElementType>
-BinaryTreeNode<ElementType>* AVLTree<ElementType>::removeMaximum(BinaryTreeNode<ElementType>* node,
-                                                                 std::optional<ElementType>& removedElement) {
+void AVLTree<ElementType>::removeAll(ParentLinkedBinaryTreeNode<ElementType>* node,
+                                     std::vector<ElementType>& elements) {
+	node = getFirstPostOrderNode(node);
+	
+	while (node != nullptr) {
+		auto* parentNode {node->getParent()};
+		const auto isLeftChild {parentNode != nullptr && parentNode->getLeftChild() == node};
+		
+		elements.emplace_back(std::move(node->getElement()));
+		deleteNode(node);
+		
+		if (isLeftChild && parentNode->getRightChild() != nullptr) {
+			node = getFirstPostOrderNode(parentNode->getRightChild());
+		} else {
+			node = parentNode;
+		}
+	}
+}
+
+template<ElementTypeWithLessThanOperator ElementType>
+template<typename Range>
+ParentLinkedBinaryTreeNode<ElementType>* AVLTree<ElementType>::buildSubtree(
+		const Range& sortedElements, NodeBlock<ParentLinkedBinaryTreeNode<ElementType>>& nodeBlock,
+		const std::size_t first, const std::size_t last, const std::size_t threadCount) {
+	if (first == last) {
+		return nullptr;
+	}
+	
+	const auto middle {first + (last - first) / 2};
+	auto* node {nodeBlock.construct(middle, std::ranges::begin(sortedElements)[middle])};
+	
+	const auto [leftSubtree, rightSubtree] {invokeSubtreeFunctions(
+			[&sortedElements, &nodeBlock, first, middle, threadCount]() {
+				return buildSubtree(sortedElements, nodeBlock, first, middle, threadCount / 2);
+			},
+			[&sortedElements, &nodeBlock, middle, last, threadCount]() {
+				return buildSubtree(sortedElements, nodeBlock, middle + 1, last, threadCount - threadCount / 2);
+			},
+			threadCount > 1 && last - first >= MINIMUM_PARALLEL_SUBTREE_SIZE)};
+	
+	node->setLeftChild(leftSubtree);
+	node->setRightChild(rightSubtree);
+	node->update();
+	
+	return node;
+}
+
+template<ElementTypeWithLessThanOperator ElementType>
+void AVLTree<ElementType>::copyNodes(const AVLTree& other) {
+	if (other.nodeCount == 0) {
+		return;
+	}
+	
+	auto nodeBlock {std::make_shared<NodeBlock<ParentLinkedBinaryTreeNode<ElementType>>>(other.nodeCount)};
+	addNodeBlock(nodeBlock);
+	nodeCount = other.nodeCount;
+	rootNode = copySubtree(other.rootNode, *nodeBlock, 0);
+}
+
+template<ElementTypeWithLessThanOperator ElementType>
+ParentLinkedBinaryTreeNode<ElementType>* AVLTree<ElementType>::copySubtree(
+		const ParentLinkedBinaryTreeNode<ElementType>* node,
+		NodeBlock<ParentLinkedBinaryTreeNode<ElementType>>& nodeBlock, const std::size_t first) noexcept {
 	if (node == nullptr) {
 		return nullptr;
 	}
 	
-	if (node->getRightChild() == nullptr) {
-		removedElement = node->getElement();
-		auto* leftChild {node->getLeftChild()};
+	const auto index {first + getSubtreeSize(node->getLeftChild())};
+	auto* copiedNode {nodeBlock.construct(index, node->getElement())};
+	copiedNode->setLeftChild(copySubtree(node->getLeftChild(), nodeBlock, first));
+	copiedNode->setRightChild(copySubtree(node->getRightChild(), nodeBlock, index + 1));
+	copiedNode->update();
+	
+	return copiedNode;
+}
+
+template<ElementTypeWithLessThanOperator ElementType>
+void AVLTree<ElementType>::deleteNode(ParentLinkedBinaryTreeNode<ElementType>* node) noexcept {
+	const auto nodeBlock {findNodeBlock(node, nodeBlocks)};
+	if (nodeBlock == nodeBlocks.cend()) {
 		delete node;
-		
-		return leftChild;
+		return;
 	}
 	
-	node->setRightChild(removeMaximum(node->getRightChild(), removedElement));
+	(*nodeBlock)->destroy(node);
+	if ((*nodeBlock)->isEmpty()) {
+		nodeBlocks.erase(nodeBlock);
+	}
+}
+
+template<ElementTypeWithLessThanOperator ElementType>
+void AVLTree<ElementType>::destroyNode(
+		ParentLinkedBinaryTreeNode<ElementType>* node, const NodeBlocks& nodeBlocks) noexcept {
+	if (const auto nodeBlock {findNodeBlock(node, nodeBlocks)}; nodeBlock != nodeBlocks.cend()) {
+		(*nodeBlock)->destroy(node);
+	} else {
+		delete node;
+	}
+}
+
+template<ElementTypeWithLessThanOperator ElementType>
+typename AVLTree<ElementType>::NodeBlocks::const_iterator AVLTree<ElementType>::findNodeBlock(
+		const ParentLinkedBinaryTreeNode<ElementType>* node, const NodeBlocks& nodeBlocks) noexcept {
+	const auto nextNodeBlock {std::ranges::upper_bound(
+			nodeBlocks, node, std::less<const ParentLinkedBinaryTreeNode<ElementType>*> {}, getNodeBlockAddress)};
+	if (nextNodeBlock == nodeBlocks.cbegin() || !(*std::ranges::prev(nextNodeBlock))->contains(node)) {
+		return nodeBlocks.cend();
+	}
 	
-	return rebalance(node);
+	return std::ranges::prev(nextNodeBlock);
+}
+
+template<ElementTypeWithLessThanOperator ElementType>
+void AVLTree<ElementType>::addNodeBlock(std::shared_ptr<NodeBlock<ParentLinkedBinaryTreeNode<ElementType>>> nodeBlock) {
+	std::erase_if(nodeBlocks, [](const auto& otherNodeBlock) {
+		return otherNodeBlock->isEmpty();
+	});
+	
+	const auto nextNodeBlock {std::ranges::upper_bound(nodeBlocks, nodeBlock->getAddress(),
+	                                                   std::less<const ParentLinkedBinaryTreeNode<ElementType>*> {},
+	                                                   getNodeBlockAddress)};
+	nodeBlocks.insert(nextNodeBlock, std::move(nodeBlock));
+}
+
+template<ElementTypeWithLessThanOperator ElementType>
+const ParentLinkedBinaryTreeNode<ElementType>* AVLTree<ElementType>::getNodeBlockAddress(
+		const std::shared_ptr<NodeBlock<ParentLinkedBinaryTreeNode<ElementType>>>& nodeBlock) noexcept {
+	return nodeBlock->getAddress();
 }
 
 template<ElementTypeWithLessThanOperator ElementType>
-void AVLTree<ElementType>::removeAll(BinaryTreeNode<ElementType>* node, std::vector<ElementType>& elements) {
+void AVLTree<ElementType>::destroySubtree(
+		ParentLinkedBinaryTreeNode<ElementType>* node, const NodeBlocks& nodeBlocks) noexcept {
 	if (node == nullptr) {
 		return;
 	}
 	
-	removeAll(node->getLeftChild(), elements);
-	removeAll(node->getRightChild(), elements);
+	destroySubtree(node->getLeftChild(), nodeBlocks);
+	destroySubtree(node->getRightChild(), nodeBlocks);
+	destroyNode(node, nodeBlocks);
+}
+
+template<ElementTypeWithLessThanOperator ElementType>
+void AVLTree<ElementType>::adoptNodeBlocks(AVLTree<ElementType>& other) {
+	const auto isEmpty {[](const auto& nodeBlock) {
+		return nodeBlock->isEmpty();
+	}};
+	std::erase_if(nodeBlocks, isEmpty);
+	std::erase_if(other.nodeBlocks, isEmpty);
+	
+	NodeBlocks mergedNodeBlocks {};
+	mergedNodeBlocks.reserve(nodeBlocks.size() + other.nodeBlocks.size());
+	std::ranges::set_union(nodeBlocks,
+	                       other.nodeBlocks,
+	                       std::back_inserter(mergedNodeBlocks),
+	                       std::less<const ParentLinkedBinaryTreeNode<ElementType>*> {},
+	                       getNodeBlockAddress,
+	                       getNodeBlockAddress);
+	
+	nodeBlocks = std::move(mergedNodeBlocks);
+	other.nodeBlocks.clear();
+}
+
+template<ElementTypeWithLessThanOperator ElementType>
+void AVLTree<ElementType>::setRootNode(ParentLinkedBinaryTreeNode<ElementType>* node) noexcept {
+	rootNode = node;
+	nodeCount = getSubtreeSize(node);
+	
+	if (node != nullptr) {
+		node->setParent(nullptr);
+	}
+}
+
+template<ElementTypeWithLessThanOperator ElementType>
+ParentLinkedBinaryTreeNode<ElementType>* AVLTree<ElementType>::joinWithNode(
+		ParentLinkedBinaryTreeNode<ElementType>* leftSubtree,
+		ParentLinkedBinaryTreeNode<ElementType>* middleNode,
+		ParentLinkedBinaryTreeNode<ElementType>* rightSubtree) noexcept {
+	if (getHeight(leftSubtree) > getHeight(rightSubtree) + 1) {
+		leftSubtree->setRightChild(joinWithNode(leftSubtree->getRightChild(), middleNode, rightSubtree));
+		return rebalance(leftSubtree);
+	}
+	
+	if (getHeight(rightSubtree) > getHeight(leftSubtree) + 1) {
+		rightSubtree->setLeftChild(joinWithNode(leftSubtree, middleNode, rightSubtree->getLeftChild()));
+		return rebalance(rightSubtree);
+	}
 	
-	elements.emplace_back(node->getElement());
+	middleNode->setLeftChild(leftSubtree);
+	middleNode->setRightChild(rightSubtree);
+	middleNode->update();
 	
-	delete node;
+	return middleNode;
 }
 
 template<ElementTypeWithLessThanOperator ElementType>
-int AVLTree<ElementType>::AVLTree::getHeight(const BinaryTreeNode<ElementType>* const node) const noexcept {
+ParentLinkedBinaryTreeNode<ElementType>* AVLTree<ElementType>::joinSubtrees(
+		ParentLinkedBinaryTreeNode<ElementType>* leftSubtree,
+		ParentLinkedBinaryTreeNode<ElementType>* rightSubtree) noexcept {
+	if (leftSubtree == nullptr) {
+		return rightSubtree;
+	}
+	
+	if (rightSubtree == nullptr) {
+		return leftSubtree;
+	}
+	
+	ParentLinkedBinaryTreeNode<ElementType>* middleNode {nullptr};
+	rightSubtree = detachMinimum(rightSubtree, middleNode);
+	
+	return joinWithNode(leftSubtree, middleNode, rightSubtree);
+}
+
+template<ElementTypeWithLessThanOperator ElementType>
+typename AVLTree<ElementType>::SubtreePair AVLTree<ElementType>::splitSubtree(
+		ParentLinkedBinaryTreeNode<ElementType>* node, const ElementType& element, const bool isInclusive) noexcept {
 	if (node == nullptr) {
-		return -1;
+		return {nullptr, nullptr};
 	}
 	
-	const auto leftSubtreeHeight {getHeight(node->getLeftChild())};
-	const auto rightSubtreeHeight {getHeight(node->getRightChild())};
+	auto* leftChild {node->getLeftChild()};
+	auto* rightChild {node->getRightChild()};
 	
-	return std::max(leftSubtreeHeight, rightSubtreeHeight) + 1;
+	if (isInclusive ? element < node->getElement() : !(node->getElement() < element)) {
+		const auto [leftSubtree, middleSubtree] {splitSubtree(leftChild, element, isInclusive)};
+		return {leftSubtree, joinWithNode(middleSubtree, node, rightChild)};
+	}
+	
+	const auto [middleSubtree, rightSubtree] {splitSubtree(rightChild, element, isInclusive)};
+	return {joinWithNode(leftChild, node, middleSubtree), rightSubtree};
 }
 
 template<ElementTypeWithLessThanOperator ElementType>
-int AVLTree<ElementType>::getBalanceFactor(const BinaryTreeNode<ElementType>* node) const noexcept {
+void AVLTree<ElementType>::combineWith(AVLTree<ElementType>& other,
+                                       const SetOperation setOperation,
+                                       const std::size_t threadCount) {
+	adoptNodeBlocks(other);
+	auto* otherRootNode {other.rootNode};
+	other.setRootNode(nullptr);
+	
+	setRootNode(combineSubtrees(
+			rootNode, otherRootNode, setOperation, nodeBlocks, std::max<std::size_t>(1, threadCount)));
+	std::erase_if(nodeBlocks, [](const auto& nodeBlock) {
+		return nodeBlock->isEmpty();
+	});
+}
+
+template<ElementTypeWithLessThanOperator ElementType>
+ParentLinkedBinaryTreeNode<ElementType>* AVLTree<ElementType>::combineSubtrees(
+		ParentLinkedBinaryTreeNode<ElementType>* first,
+		ParentLinkedBinaryTreeNode<ElementType>* second,
+		const SetOperation setOperation,
+		const NodeBlocks& nodeBlocks,
+		const std::size_t threadCount) {
+	if (first == nullptr || second == nullptr) {
+		if (setOperation == SetOperation::Union) {
+			return first == nullptr ? second : first;
+		}
+		
+		destroySubtree(second, nodeBlocks);
+		
+		if (setOperation == SetOperation::Intersection) {
+			destroySubtree(first, nodeBlocks);
+			return nullptr;
+		}
+		
+		return first;
+	}
+	
+	const auto subtreeSize {getSubtreeSize(first) + getSubtreeSize(second)};
+	const auto& pivotElement {(getSubtreeSize(first) < getSubtreeSize(second) ? first : second)->getElement()};
+	
+	const auto [firstLessSubtree, firstNotLessSubtree] {splitSubtree(first, pivotElement, false)};
+	const auto [secondLessSubtree, secondNotLessSubtree] {splitSubtree(second, pivotElement, false)};
+	const auto [firstEquivalentSubtree, firstGreaterSubtree] {splitSubtree(firstNotLessSubtree, pivotElement, true)};
+	const auto [secondEquivalentSubtree, secondGreaterSubtree] {
+			splitSubtree(secondNotLessSubtree, pivotElement, true)};
+	
+	auto* equivalentSubtree {firstEquivalentSubtree};
+	if (setOperation == SetOperation::Union && firstEquivalentSubtree == nullptr) {
+		equivalentSubtree = secondEquivalentSubtree;
+	} else {
+		const auto isFound {secondEquivalentSubtree != nullptr};
+		destroySubtree(secondEquivalentSubtree, nodeBlocks);
+		
+		if (setOperation != SetOperation::Union && isFound != (setOperation == SetOperation::Intersection)) {
+			destroySubtree(firstEquivalentSubtree, nodeBlocks);
+			equivalentSubtree = nullptr;
+		}
+	}
+	
+	const auto [leftSubtree, rightSubtree] {invokeSubtreeFunctions(
+			[firstLessSubtree, secondLessSubtree, setOperation, &nodeBlocks, threadCount]() {
+				return combineSubtrees(firstLessSubtree, secondLessSubtree, setOperation, nodeBlocks, threadCount / 2);
+			},
+			[firstGreaterSubtree, secondGreaterSubtree, setOperation, &nodeBlocks, threadCount]() {
+				return combineSubtrees(
+						firstGreaterSubtree, secondGreaterSubtree, setOperation, nodeBlocks, threadCount - threadCount / 2);
+			},
+			threadCount > 1 && subtreeSize >= MINIMUM_PARALLEL_SUBTREE_SIZE)};
+	
+	return joinSubtrees(joinSubtrees(leftSubtree, equivalentSubtree), rightSubtree);
+}
+
+template<ElementTypeWithLessThanOperator ElementType>
+template<typename LeftFunction, typename RightFunction>
+typename AVLTree<ElementType>::SubtreePair AVLTree<ElementType>::invokeSubtreeFunctions(
+		const LeftFunction& leftFunction, const RightFunction& rightFunction, const bool isConcurrent) {
+	std::future<ParentLinkedBinaryTreeNode<ElementType>*> pendingLeftSubtree {};
+	if (isConcurrent) {
+		try {
+			pendingLeftSubtree = std::async(std::launch::async, leftFunction);
+		} catch (const std::system_error&) {
+			
+		}
+	}
+	
+	auto* rightSubtree {rightFunction()};
+	auto* leftSubtree {pendingLeftSubtree.valid() ? pendingLeftSubtree.get() : leftFunction()};
+	
+	return {leftSubtree, rightSubtree};
+}
+
+template<ElementTypeWithLessThanOperator ElementType>
+int AVLTree<ElementType>::AVLTree::getHeight(const ParentLinkedBinaryTreeNode<ElementType>* const node) noexcept {
+	return node == nullptr ? -1 : node->getHeight();
+}
+
+template<ElementTypeWithLessThanOperator ElementType>
+int AVLTree<ElementType>::getBalanceFactor(const ParentLinkedBinaryTreeNode<ElementType>* node) noexcept {
 	if (node == nullptr) {
 		return 0;
 	}
@@ -861,7 +1732,9 @@ int AVLTree<ElementType>::getBalanceFactor(const BinaryTreeNode<ElementType>* no
 }
 
 template<ElementTypeWithLessThanOperator ElementType>
-BinaryTreeNode<ElementType>* AVLTree<ElementType>::rebalance(BinaryTreeNode<ElementType>* node) noexcept {
+ParentLinkedBinaryTreeNode<ElementType>* AVLTree<ElementType>::rebalance(
+		ParentLinkedBinaryTreeNode<ElementType>* node) noexcept {
+	node->update();
 	const auto balanceFactor {getBalanceFactor(node)};
 	
 	if (balanceFactor > 1) {
@@ -884,20 +1757,72 @@ BinaryTreeNode<ElementType>* AVLTree<ElementType>::rebalance(BinaryTreeNode<Elem
 }
 
 template<ElementTypeWithLessThanOperator ElementType>
-BinaryTreeNode<ElementType>* AVLTree<ElementType>::rotateLeft(BinaryTreeNode<ElementType>* node) noexcept {
+ParentLinkedBinaryTreeNode<ElementType>* AVLTree<ElementType>::rotateLeft(
+		ParentLinkedBinaryTreeNode<ElementType>* node) noexcept {
 	auto* newParent {node->getRightChild()};
 	node->setRightChild(newParent->getLeftChild());
 	newParent->setLeftChild(node);
 	
+	node->update();
+	newParent->update();
+	
 	return newParent;
 }
 
 template<ElementTypeWithLessThanOperator ElementType>
-BinaryTreeNode<ElementType>* AVLTree<ElementType>::rotateRight(BinaryTreeNode<ElementType>* node) noexcept {
+ParentLinkedBinaryTreeNode<ElementType>* AVLTree<ElementType>::rotateRight(
+		ParentLinkedBinaryTreeNode<ElementType>* node) noexcept {
 	auto* newParent {node->getLeftChild()};
 	node->setLeftChild(newParent->getRightChild());
 	newParent->setRightChild(node);
 	
+	node->update();
+	newParent->update();
+	
 	return newParent;
 }
+
+template<ElementTypeWithLessThanOperator ElementType>
+std::size_t AVLTree<ElementType>::countPreceding(const ElementType& element, const bool isInclusive) const noexcept {
+	std::size_t count {0};
+	const auto* currentNode {rootNode};
+	
+	while (currentNode != nullptr) {
+		const auto& currentNodeElement {currentNode->getElement()};
+		
+		if (isInclusive ? element < currentNodeElement : !(currentNodeElement < element)) {
+			currentNode = currentNode->getLeftChild();
+		} else {
+			count += getSubtreeSize(currentNode->getLeftChild()) + 1;
+			currentNode = currentNode->getRightChild();
+		}
+	}
+	
+	return count;
+}
+
+template<ElementTypeWithLessThanOperator ElementType>
+const ParentLinkedBinaryTreeNode<ElementType>* AVLTree<ElementType>::findBound(const ElementType& element,
+                                                                               const bool isUpper) const noexcept {
+	const ParentLinkedBinaryTreeNode<ElementType>* boundNode {nullptr};
+	const auto* currentNode {rootNode};
+	
+	while (currentNode != nullptr) {
+		const auto& currentNodeElement {currentNode->getElement()};
+		
+		if (isUpper ? element < currentNodeElement : !(currentNodeElement < element)) {
+			boundNode = currentNode;
+			currentNode = currentNode->getLeftChild();
+		} else {
+			currentNode = currentNode->getRightChild();
+		}
+	}
+	
+	return boundNode;
+}
+
+template<ElementTypeWithLessThanOperator ElementType>
+std::size_t AVLTree<ElementType>::getSubtreeSize(const ParentLinkedBinaryTreeNode<ElementType>* node) noexcept {
+	return node == nullptr ? 0 : node->getSubtreeSize();
+}
 }
\ No newline at end of file
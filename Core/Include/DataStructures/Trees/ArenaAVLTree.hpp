@@ -0,0 +1,788 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "DataStructures/Trees/ArenaAVLTreeNode.hpp"
+#include "DataStructures/Trees/Iterators/ArenaBinaryTreeConstInOrderIterator.hpp"
+#include "BinarySearchTreeConcepts.hpp"
+
+namespace Core::DataStructures::Trees {
+/**
+ * @brief An avl tree that stores all of its nodes contiguously in a single arena and links them by 32-bit indices.
+ * @details The nodes live in one std::vector instead of one heap allocation each, so allocating a node is an amortized
+ * O(1) append, a search walks nodes that are densely packed in memory, copying the avl tree is a single contiguous
+ * copy, and for 4-byte elements every node takes 16 bytes. Removed nodes are threaded into a free list and reused by
+ * later insertions, and the arena is emptied once the last node is removed. The arena holds at most 2^32 - 1 nodes, and
+ * any insertion may reallocate it, which invalidates every iterator.
+ * @class ArenaAVLTree
+ * @tparam ElementType The type of the elements stored in the arena avl tree.
+ */
+template<ElementTypeWithLessThanOperator ElementType>
+class ArenaAVLTree final {
+public:
+	/**
+	 * @brief Instantiates a new arena avl tree with no nodes.
+	 */
+	ArenaAVLTree() noexcept = default;
+	
+	/**
+	 * @brief Instantiates a new arena avl tree by copying the arena of the given arena avl tree in one allocation.
+	 * @param other The arena avl tree to copy.
+	 */
+	ArenaAVLTree(const ArenaAVLTree& other) = default;
+	
+	/**
+	 * @brief Instantiates a new arena avl tree by moving the given arena avl tree, which is left empty.
+	 * @param other The arena avl tree to move.
+	 */
+	ArenaAVLTree(ArenaAVLTree&& other) noexcept;
+	
+	/**
+	 * @brief Destroys the arena avl tree and its arena.
+	 */
+	~ArenaAVLTree() noexcept = default;
+
+public:
+	/**
+	 * @brief Assigns the given arena avl tree to this arena avl tree using copy semantics.
+	 * @param other The arena avl tree to copy.
+	 * @return A reference to this arena avl tree.
+	 */
+	ArenaAVLTree<ElementType>& operator=(const ArenaAVLTree& other) = default;
+	
+	/**
+	 * @brief Assigns the given arena avl tree to this arena avl tree using move semantics, leaving the given arena avl
+	 * tree empty.
+	 * @param other The arena avl tree to move.
+	 * @return A reference to this arena avl tree.
+	 */
+	ArenaAVLTree<ElementType>& operator=(ArenaAVLTree&& other) noexcept;
+	
+	/**
+	 * @brief Checks if the given arena avl tree is equal to this arena avl tree.
+	 * @details Two arena avl trees are equal if they have the same number of nodes and contain the same elements in
+	 * the same order, regardless of where the nodes are placed in their arenas.
+	 * @param other The arena avl tree to check.
+	 * @return True if the given arena avl tree is equal to this arena avl tree, false otherwise.
+	 */
+	bool operator==(const ArenaAVLTree& other) const noexcept;
+
+public:
+	using value_type = ElementType;
+	using ConstInOrderIterator = Iterators::ArenaBinaryTreeConstInOrderIterator<ElementType, ArenaAVLTreeNode<ElementType>>;
+	
+	/**
+	 * @brief Gets a const in-order iterator to the first node in the arena avl tree.
+	 * @return A const in-order iterator to the first node in the arena avl tree.
+	 */
+	ConstInOrderIterator cbeginInOrder() const noexcept;
+	
+	/**
+	 * @brief Gets a const in-order iterator to the node after the last node in the arena avl tree.
+	 * @return A const in-order iterator to the node after the last node in the arena avl tree.
+	 */
+	ConstInOrderIterator cendInOrder() const noexcept;
+
+public:
+	/**
+	 * @brief Inserts the given element into the arena avl tree using copy semantics.
+	 * @param element The element to insert.
+	 * @throws std::length_error If the arena already holds 2^32 - 1 nodes.
+	 */
+	void insert(const ElementType& element);
+	
+	/**
+	 * @brief Inserts the given element into the arena avl tree using move semantics.
+	 * @param element The element to insert.
+	 * @throws std::length_error If the arena already holds 2^32 - 1 nodes.
+	 */
+	void insert(ElementType&& element);
+	
+	/**
+	 * @brief Removes the first occurrence of the given element from the arena avl tree.
+	 * @param element The element to remove.
+	 * @return The removed element, or std::nullopt if the element was not found.
+	 */
+	std::optional<ElementType> removeFirst(const ElementType& element);
+	
+	/**
+	 * @brief Removes the minimum element from the arena avl tree.
+	 * @return The removed element, or std::nullopt if the arena avl tree is empty.
+	 */
+	std::optional<ElementType> removeMinimum();
+	
+	/**
+	 * @brief Removes the maximum element from the arena avl tree.
+	 * @return The removed element, or std::nullopt if the arena avl tree is empty.
+	 */
+	std::optional<ElementType> removeMaximum();
+	
+	/**
+	 * @brief Removes all elements from the arena avl tree and releases its arena.
+	 * @return The removed elements in post-order.
+	 */
+	std::vector<ElementType> removeAll();
+	
+	/**
+	 * @brief Finds the first occurrence of the given element in the arena avl tree.
+	 * @param element The element to find.
+	 * @return The first occurrence of the given element in the arena avl tree, or std::nullopt if the element is not
+	 * found.
+	 */
+	std::optional<ElementType> findFirst(const ElementType& element) const noexcept;
+	
+	/**
+	 * @brief Finds the minimum element in the arena avl tree.
+	 * @return The minimum element in the arena avl tree, or std::nullopt if the arena avl tree is empty.
+	 */
+	std::optional<ElementType> findMinimum() const noexcept;
+	
+	/**
+	 * @brief Finds the maximum element in the arena avl tree.
+	 * @return The maximum element in the arena avl tree, or std::nullopt if the arena avl tree is empty.
+	 */
+	std::optional<ElementType> findMaximum() const noexcept;
+	
+	/**
+	 * @brief Checks if the arena avl tree contains the given element.
+	 * @param element The element to check.
+	 * @return True if the arena avl tree contains the given element, false otherwise.
+	 */
+	bool contains(const ElementType& element) const noexcept;
+	
+	/**
+	 * @brief Checks if the arena avl tree is empty.
+	 * @return True if the arena avl tree is empty, false otherwise.
+	 */
+	bool isEmpty() const noexcept;
+	
+	/**
+	 * @brief Gets the number of nodes in the arena avl tree.
+	 * @return The number of nodes in the arena avl tree.
+	 */
+	std::size_t getNodeCount() const noexcept;
+	
+	/**
+	 * @brief Gets the height of the arena avl tree.
+	 * @return The height of the arena avl tree, or -1 if the arena avl tree is empty.
+	 */
+	int getHeight() const noexcept;
+	
+	/**
+	 * @brief Reserves room in the arena for the given number of nodes, so that inserting up to that many nodes does
+	 * not reallocate it.
+	 * @param nodeCount The number of nodes to reserve room for.
+	 * @throws std::length_error If the given number of nodes exceeds 2^32 - 1.
+	 */
+	void reserve(const std::size_t nodeCount);
+	
+	/**
+	 * @brief Rewrites the arena in level order in O(n) time, dropping free slots and excess capacity.
+	 * @details A random insertion order leaves parents and children scattered across the arena. After compacting, the
+	 * nodes of the top levels that every search passes through share a handful of cache lines, and the rest of each
+	 * search path moves steadily forward through memory.
+	 */
+	void compact();
+	
+	/**
+	 * @brief Gets the number of bytes occupied by the arena of the arena avl tree, including reserved and reusable
+	 * slots but not counting allocator overhead.
+	 * @return The number of bytes occupied by the arena of the arena avl tree.
+	 */
+	std::size_t getMemoryUsage() const noexcept;
+
+private:
+	static constexpr std::uint32_t NULL_INDEX {ArenaAVLTreeNode<ElementType>::NULL_INDEX};
+	
+	/**
+	 * @brief Places a new leaf node with the given element in a free slot of the arena, or at its end if no slot is
+	 * free.
+	 * @param element The element of the new node.
+	 * @return The index of the new node.
+	 * @throws std::length_error If the arena already holds 2^32 - 1 nodes.
+	 */
+	std::uint32_t allocateNode(ElementType&& element);
+	
+	/**
+	 * @brief Threads the slot of the given node into the free list, or empties the arena if it was the last node.
+	 * @param index The index of the node to free.
+	 */
+	void freeNode(const std::uint32_t index) noexcept;
+	
+	/**
+	 * @brief Inserts the given element into the subtree rooted at the given node.
+	 * @details The arena may be reallocated by the insertion, so no reference to a node is held across the recursive
+	 * call.
+	 * @param index The index of the root of the subtree, which may be NULL_INDEX.
+	 * @param element The element to insert.
+	 * @return The index of the root of the rebalanced subtree.
+	 */
+	std::uint32_t insert(const std::uint32_t index, ElementType&& element);
+	
+	/**
+	 * @brief Removes the first occurrence of the given element from the subtree rooted at the given node.
+	 * @param index The index of the root of the subtree, which may be NULL_INDEX.
+	 * @param element The element to remove.
+	 * @param removedElement Set to the removed element if it was found.
+	 * @return The index of the root of the rebalanced subtree.
+	 */
+	std::uint32_t removeFirst(const std::uint32_t index,
+	                          const ElementType& element,
+	                          std::optional<ElementType>& removedElement);
+	
+	/**
+	 * @brief Detaches the node with the minimum element from the subtree rooted at the given node without freeing it.
+	 * @param index The index of the root of the subtree, which must not be NULL_INDEX.
+	 * @param minimumIndex Set to the index of the detached node.
+	 * @return The index of the root of the rebalanced subtree.
+	 */
+	std::uint32_t detachMinimum(const std::uint32_t index, std::uint32_t& minimumIndex) noexcept;
+	
+	/**
+	 * @brief Removes the minimum element from the subtree rooted at the given node.
+	 * @param index The index of the root of the subtree, which must not be NULL_INDEX.
+	 * @param removedElement Set to the removed element.
+	 * @return The index of the root of the rebalanced subtree.
+	 */
+	std::uint32_t removeMinimum(const std::uint32_t index, std::optional<ElementType>& removedElement);
+	
+	/**
+	 * @brief Removes the maximum element from the subtree rooted at the given node.
+	 * @param index The index of the root of the subtree, which must not be NULL_INDEX.
+	 * @param removedElement Set to the removed element.
+	 * @return The index of the root of the rebalanced subtree.
+	 */
+	std::uint32_t removeMaximum(const std::uint32_t index, std::optional<ElementType>& removedElement);
+	
+	/**
+	 * @brief Moves the elements of the subtree rooted at the given node into the given vector in post-order.
+	 * @param index The index of the root of the subtree, which may be NULL_INDEX.
+	 * @param elements The vector to append the elements to.
+	 */
+	void removeAll(const std::uint32_t index, std::vector<ElementType>& elements);
+	
+	/**
+	 * @brief Finds the first node on the search path whose element is equivalent to the given element.
+	 * @details The child to descend into is picked by indexing with the comparison result rather than by branching on
+	 * it, so a search does not pay for a mispredicted branch at every level.
+	 * @param element The element to find.
+	 * @return The index of the node with the given element, or NULL_INDEX if the element is not found.
+	 */
+	std::uint32_t findNode(const ElementType& element) const noexcept;
+	
+	/**
+	 * @brief Gets the node with the minimum element in the subtree rooted at the given node.
+	 * @param index The index of the root of the subtree, which may be NULL_INDEX.
+	 * @return The index of the node with the minimum element, or NULL_INDEX if the subtree is empty.
+	 */
+	std::uint32_t getMinimumNode(std::uint32_t index) const noexcept;
+	
+	/**
+	 * @brief Gets the node with the maximum element in the subtree rooted at the given node.
+	 * @param index The index of the root of the subtree, which may be NULL_INDEX.
+	 * @return The index of the node with the maximum element, or NULL_INDEX if the subtree is empty.
+	 */
+	std::uint32_t getMaximumNode(std::uint32_t index) const noexcept;
+	
+	/**
+	 * @brief Gets the height of the given node.
+	 * @param index The index of the node, which may be NULL_INDEX.
+	 * @return The height of the given node, or -1 if the index is NULL_INDEX.
+	 */
+	int getHeight(const std::uint32_t index) const noexcept;
+	
+	/**
+	 * @brief Gets the balance factor of the given node from the cached heights of its children.
+	 * @param index The index of the node, which may be NULL_INDEX.
+	 * @return The balance factor of the given node, or 0 if the index is NULL_INDEX.
+	 */
+	int getBalanceFactor(const std::uint32_t index) const noexcept;
+	
+	/**
+	 * @brief Updates the cached height of the given node and rebalances it.
+	 * @param index The index of the node to rebalance.
+	 * @return The index of the root of the rebalanced subtree.
+	 */
+	std::uint32_t rebalance(const std::uint32_t index) noexcept;
+	
+	/**
+	 * @brief Rotates the given node left.
+	 * @param index The index of the node to rotate left.
+	 * @return The index of the new root of the subtree.
+	 */
+	std::uint32_t rotateLeft(const std::uint32_t index) noexcept;
+	
+	/**
+	 * @brief Rotates the given node right.
+	 * @param index The index of the node to rotate right.
+	 * @return The index of the new root of the subtree.
+	 */
+	std::uint32_t rotateRight(const std::uint32_t index) noexcept;
+	
+	/**
+	 * @brief Updates the cached height of the given node from the heights of its children.
+	 * @param index The index of the node to update.
+	 */
+	void updateHeight(const std::uint32_t index) noexcept;
+
+private:
+	std::vector<ArenaAVLTreeNode<ElementType>> nodes {};
+	std::uint32_t rootIndex {NULL_INDEX};
+	std::uint32_t freeIndex {NULL_INDEX};
+	std::size_t nodeCount {0};
+};
+
+template<ElementTypeWithLessThanOperator ElementType>
+ArenaAVLTree<ElementType>::ArenaAVLTree(ArenaAVLTree&& other) noexcept :
+		nodes {std::move(other.nodes)},
+		rootIndex {std::exchange(other.rootIndex, NULL_INDEX)},
+		freeIndex {std::exchange(other.freeIndex, NULL_INDEX)},
+		nodeCount {std::exchange(other.nodeCount, 0)} {
+	other.nodes.clear();
+}
+
+template<ElementTypeWithLessThanOperator ElementType>
+ArenaAVLTree<ElementType>& ArenaAVLTree<ElementType>::operator=(ArenaAVLTree&& other) noexcept {
+	if (this == &other) {
+		return *this;
+	}
+	
+	nodes = std::move(other.nodes);
+	other.nodes.clear();
+	rootIndex = std::exchange(other.rootIndex, NULL_INDEX);
+	freeIndex = std::exchange(other.freeIndex, NULL_INDEX);
+	nodeCount = std::exchange(other.nodeCount, 0);
+	
+	return *this;
+}
+
+template<ElementTypeWithLessThanOperator ElementType>
+bool ArenaAVLTree<ElementType>::operator==(const ArenaAVLTree& other) const noexcept {
+	if (nodeCount != other.nodeCount) {
+		return false;
+	}
+	
+	return std::equal(cbeginInOrder(), cendInOrder(), other.cbeginInOrder(), other.cendInOrder());
+}
+
+template<ElementTypeWithLessThanOperator ElementType>
+ArenaAVLTree<ElementType>::ConstInOrderIterator ArenaAVLTree<ElementType>::cbeginInOrder() const noexcept {
+	return ConstInOrderIterator {nodes.data(), rootIndex};
+}
+
+template<ElementTypeWithLessThanOperator ElementType>
+ArenaAVLTree<ElementType>::ConstInOrderIterator ArenaAVLTree<ElementType>::cendInOrder() const noexcept {
+	return ConstInOrderIterator {nodes.data(), NULL_INDEX};
+}
+
+template<ElementTypeWithLessThanOperator ElementType>
+void ArenaAVLTree<ElementType>::insert(const ElementType& element) {
+	rootIndex = insert(rootIndex, ElementType {element});
+}
+
+template<ElementTypeWithLessThanOperator ElementType>
+void ArenaAVLTree<ElementType>::insert(ElementType&& element) {
+	rootIndex = insert(rootIndex, std::move(element));
+}
+
+template<ElementTypeWithLessThanOperator ElementType>
+std::optional<ElementType> ArenaAVLTree<ElementType>::removeFirst(const ElementType& element) {
+	std::optional<ElementType> removedElement {std::nullopt};
+	rootIndex = removeFirst(rootIndex, element, removedElement);
+	
+	return removedElement;
+}
+
+template<ElementTypeWithLessThanOperator ElementType>
+std::optional<ElementType> ArenaAVLTree<ElementType>::removeMinimum() {
+	if (rootIndex == NULL_INDEX) {
+		return std::nullopt;
+	}
+	
+	std::optional<ElementType> removedElement {std::nullopt};
+	rootIndex = removeMinimum(rootIndex, removedElement);
+	
+	return removedElement;
+}
+
+template<ElementTypeWithLessThanOperator ElementType>
+std::optional<ElementType> ArenaAVLTree<ElementType>::removeMaximum() {
+	if (rootIndex == NULL_INDEX) {
+		return std::nullopt;
+	}
+	
+	std::optional<ElementType> removedElement {std::nullopt};
+	rootIndex = removeMaximum(rootIndex, removedElement);
+	
+	return removedElement;
+}
+
+template<ElementTypeWithLessThanOperator ElementType>
+std::vector<ElementType> ArenaAVLTree<ElementType>::removeAll() {
+	std::vector<ElementType> elements {};
+	elements.reserve(nodeCount);
+	removeAll(rootIndex, elements);
+	
+	nodes = std::vector<ArenaAVLTreeNode<ElementType>> {};
+	rootIndex = NULL_INDEX;
+	freeIndex = NULL_INDEX;
+	nodeCount = 0;
+	
+	return elements;
+}
+
+template<ElementTypeWithLessThanOperator ElementType>
+std::optional<ElementType> ArenaAVLTree<ElementType>::findFirst(const ElementType& element) const noexcept {
+	const auto index {findNode(element)};
+	if (index == NULL_INDEX) {
+		return std::nullopt;
+	}
+	
+	return nodes[index].getElement();
+}
+
+template<ElementTypeWithLessThanOperator ElementType>
+std::optional<ElementType> ArenaAVLTree<ElementType>::findMinimum() const noexcept {
+	const auto index {getMinimumNode(rootIndex)};
+	if (index == NULL_INDEX) {
+		return std::nullopt;
+	}
+	
+	return nodes[index].getElement();
+}
+
+template<ElementTypeWithLessThanOperator ElementType>
+std::optional<ElementType> ArenaAVLTree<ElementType>::findMaximum() const noexcept {
+	const auto index {getMaximumNode(rootIndex)};
+	if (index == NULL_INDEX) {
+		return std::nullopt;
+	}
+	
+	return nodes[index].getElement();
+}
+
+template<ElementTypeWithLessThanOperator ElementType>
+bool ArenaAVLTree<ElementType>::contains(const ElementType& element) const noexcept {
+	return findNode(element) != NULL_INDEX;
+}
+
+template<ElementTypeWithLessThanOperator ElementType>
+bool ArenaAVLTree<ElementType>::isEmpty() const noexcept {
+	return rootIndex == NULL_INDEX;
+}
+
+template<ElementTypeWithLessThanOperator ElementType>
+std::size_t ArenaAVLTree<ElementType>::getNodeCount() const noexcept {
+	return nodeCount;
+}
+
+template<ElementTypeWithLessThanOperator ElementType>
+int ArenaAVLTree<ElementType>::getHeight() const noexcept {
+	return getHeight(rootIndex);
+}
+
+template<ElementTypeWithLessThanOperator ElementType>
+void ArenaAVLTree<ElementType>::reserve(const std::size_t nodeCount) {
+	if (nodeCount > NULL_INDEX) {
+		throw std::length_error {"An arena avl tree cannot hold more than 2^32 - 1 nodes."};
+	}
+	
+	nodes.reserve(nodeCount);
+}
+
+template<ElementTypeWithLessThanOperator ElementType>
+void ArenaAVLTree<ElementType>::compact() {
+	std::vector<ArenaAVLTreeNode<ElementType>> compactNodes {};
+	compactNodes.reserve(nodeCount);
+	if (rootIndex != NULL_INDEX) {
+		compactNodes.emplace_back(std::move(nodes[rootIndex]));
+	}
+	
+	for (std::size_t index {0}; index < compactNodes.size(); ++index) {
+		if (const auto leftChild {compactNodes[index].getLeftChild()}; leftChild != NULL_INDEX) {
+			compactNodes[index].setLeftChild(static_cast<std::uint32_t>(compactNodes.size()));
+			compactNodes.emplace_back(std::move(nodes[leftChild]));
+		}
+		
+		if (const auto rightChild {compactNodes[index].getRightChild()}; rightChild != NULL_INDEX) {
+			compactNodes[index].setRightChild(static_cast<std::uint32_t>(compactNodes.size()));
+			compactNodes.emplace_back(std::move(nodes[rightChild]));
+		}
+	}
+	
+	nodes = std::move(compactNodes);
+	rootIndex = nodes.empty() ? NULL_INDEX : 0;
+	freeIndex = NULL_INDEX;
+}
+
+template<ElementTypeWithLessThanOperator ElementType>
+std::size_t ArenaAVLTree<ElementType>::getMemoryUsage() const noexcept {
+	return nodes.capacity() * sizeof(ArenaAVLTreeNode<ElementType>);
+}
+
+template<ElementTypeWithLessThanOperator ElementType>
+std::uint32_t ArenaAVLTree<ElementType>::allocateNode(ElementType&& element) {
+	if (freeIndex != NULL_INDEX) {
+		const auto index {freeIndex};
+		freeIndex = nodes[index].getLeftChild();
+		nodes[index] = ArenaAVLTreeNode<ElementType> {std::move(element)};
+		++nodeCount;
+		
+		return index;
+	}
+	
+	if (nodes.size() == NULL_INDEX) {
+		throw std::length_error {"An arena avl tree cannot hold more than 2^32 - 1 nodes."};
+	}
+	
+	nodes.emplace_back(std::move(element));
+	++nodeCount;
+	
+	return static_cast<std::uint32_t>(nodes.size() - 1);
+}
+
+template<ElementTypeWithLessThanOperator ElementType>
+void ArenaAVLTree<ElementType>::freeNode(const std::uint32_t index) noexcept {
+	if (--nodeCount == 0) {
+		nodes.clear();
+		freeIndex = NULL_INDEX;
+		return;
+	}
+	
+	nodes[index].setLeftChild(freeIndex);
+	nodes[index].setRightChild(NULL_INDEX);
+	freeIndex = index;
+}
+
+template<ElementTypeWithLessThanOperator ElementType>
+std::uint32_t ArenaAVLTree<ElementType>::insert(const std::uint32_t index, ElementType&& element) {
+	if (index == NULL_INDEX) {
+		return allocateNode(std::move(element));
+	}
+	
+	if (element < nodes[index].getElement()) {
+		const auto leftChild {insert(nodes[index].getLeftChild(), std::move(element))};
+		nodes[index].setLeftChild(leftChild);
+	} else {
+		const auto rightChild {insert(nodes[index].getRightChild(), std::move(element))};
+		nodes[index].setRightChild(rightChild);
+	}
+	
+	return rebalance(index);
+}
+
+template<ElementTypeWithLessThanOperator ElementType>
+std::uint32_t ArenaAVLTree<ElementType>::removeFirst(const std::uint32_t index,
+                                                     const ElementType& element,
+                                                     std::optional<ElementType>& removedElement) {
+	if (index == NULL_INDEX) {
+		return NULL_INDEX;
+	}
+	
+	auto& node {nodes[index]};
+	auto subtreeRootIndex {index};
+	
+	if (element < node.getElement()) {
+		node.setLeftChild(removeFirst(node.getLeftChild(), element, removedElement));
+	} else if (node.getElement() < element) {
+		node.setRightChild(removeFirst(node.getRightChild(), element, removedElement));
+	} else {
+		removedElement = std::move(node.getElement());
+		
+		if (node.getLeftChild() != NULL_INDEX && node.getRightChild() != NULL_INDEX) {
+			std::uint32_t inOrderSuccessor {NULL_INDEX};
+			const auto rightSubtree {detachMinimum(node.getRightChild(), inOrderSuccessor)};
+			
+			nodes[inOrderSuccessor].setLeftChild(node.getLeftChild());
+			nodes[inOrderSuccessor].setRightChild(rightSubtree);
+			
+			subtreeRootIndex = inOrderSuccessor;
+		} else {
+			subtreeRootIndex = node.getLeftChild() != NULL_INDEX ? node.getLeftChild() : node.getRightChild();
+		}
+		
+		freeNode(index);
+	}
+	
+	if (subtreeRootIndex == NULL_INDEX) {
+		return subtreeRootIndex;
+	}
+	
+	return rebalance(subtreeRootIndex);
+}
+
+template<ElementTypeWithLessThanOperator ElementType>
+std::uint32_t ArenaAVLTree<ElementType>::detachMinimum(const std::uint32_t index,
+                                                       std::uint32_t& minimumIndex) noexcept {
+	if (nodes[index].getLeftChild() == NULL_INDEX) {
+		minimumIndex = index;
+		return nodes[index].getRightChild();
+	}
+	
+	nodes[index].setLeftChild(detachMinimum(nodes[index].getLeftChild(), minimumIndex));
+	
+	return rebalance(index);
+}
+
+template<ElementTypeWithLessThanOperator ElementType>
+std::uint32_t ArenaAVLTree<ElementType>::removeMinimum(const std::uint32_t index,
+                                                       std::optional<ElementType>& removedElement) {
+	if (nodes[index].getLeftChild() == NULL_INDEX) {
+		removedElement = std::move(nodes[index].getElement());
+		const auto rightChild {nodes[index].getRightChild()};
+		freeNode(index);
+		
+		return rightChild;
+	}
+	
+	nodes[index].setLeftChild(removeMinimum(nodes[index].getLeftChild(), removedElement));
+	
+	return rebalance(index);
+}
+
+template<ElementTypeWithLessThanOperator ElementType>
+std::uint32_t ArenaAVLTree<ElementType>::removeMaximum(const std::uint32_t index,
+                                                       std::optional<ElementType>& removedElement) {
+	if (nodes[index].getRightChild() == NULL_INDEX) {
+		removedElement = std::move(nodes[index].getElement());
+		const auto leftChild {nodes[index].getLeftChild()};
+		freeNode(index);
+		
+		return leftChild;
+	}
+	
+	nodes[index].setRightChild(removeMaximum(nodes[index].getRightChild(), removedElement));
+	
+	return rebalance(index);
+}
+
+template<ElementTypeWithLessThanOperator ElementType>
+void ArenaAVLTree<ElementType>::removeAll(const std::uint32_t index, std::vector<ElementType>& elements) {
+	if (index == NULL_INDEX) {
+		return;
+	}
+	
+	removeAll(nodes[index].getLeftChild(), elements);
+	removeAll(nodes[index].getRightChild(), elements);
+	
+	elements.emplace_back(std::move(nodes[index].getElement()));
+}
+
+template<ElementTypeWithLessThanOperator ElementType>
+std::uint32_t ArenaAVLTree<ElementType>::findNode(const ElementType& element) const noexcept {
+	auto currentIndex {rootIndex};
+	
+	while (currentIndex != NULL_INDEX) {
+		const auto& currentNode {nodes[currentIndex]};
+		const auto isLess {currentNode.getElement() < element};
+		
+		if (!isLess && !(element < currentNode.getElement())) {
+			return currentIndex;
+		}
+		
+		currentIndex = currentNode.getChild(isLess);
+	}
+	
+	return NULL_INDEX;
+}
+
+template<ElementTypeWithLessThanOperator ElementType>
+std::uint32_t ArenaAVLTree<ElementType>::getMinimumNode(std::uint32_t index) const noexcept {
+	if (index == NULL_INDEX) {
+		return NULL_INDEX;
+	}
+	
+	while (nodes[index].getLeftChild() != NULL_INDEX) {
+		index = nodes[index].getLeftChild();
+	}
+	
+	return index;
+}
+
+template<ElementTypeWithLessThanOperator ElementType>
+std::uint32_t ArenaAVLTree<ElementType>::getMaximumNode(std::uint32_t index) const noexcept {
+	if (index == NULL_INDEX) {
+		return NULL_INDEX;
+	}
+	
+	while (nodes[index].getRightChild() != NULL_INDEX) {
+		index = nodes[index].getRightChild();
+	}
+	
+	return index;
+}
+
+template<ElementTypeWithLessThanOperator ElementType>
+int ArenaAVLTree<ElementType>::getHeight(const std::uint32_t index) const noexcept {
+	return index == NULL_INDEX ? -1 : nodes[index].getHeight();
+}
+
+template<ElementTypeWithLessThanOperator ElementType>
+int ArenaAVLTree<ElementType>::getBalanceFactor(const std::uint32_t index) const noexcept {
+	if (index == NULL_INDEX) {
+		return 0;
+	}
+	
+	return getHeight(nodes[index].getLeftChild()) - getHeight(nodes[index].getRightChild());
+}
+
+template<ElementTypeWithLessThanOperator ElementType>
+std::uint32_t ArenaAVLTree<ElementType>::rebalance(const std::uint32_t index) noexcept {
+	updateHeight(index);
+	const auto balanceFactor {getBalanceFactor(index)};
+	
+	if (balanceFactor > 1) {
+		if (const auto leftChild {nodes[index].getLeftChild()}; getBalanceFactor(leftChild) < 0) {
+			nodes[index].setLeftChild(rotateLeft(leftChild));
+		}
+		
+		return rotateRight(index);
+	}
+	
+	if (balanceFactor < -1) {
+		if (const auto rightChild {nodes[index].getRightChild()}; getBalanceFactor(rightChild) > 0) {
+			nodes[index].setRightChild(rotateRight(rightChild));
+		}
+		
+		return rotateLeft(index);
+	}
+	
+	return index;
+}
+
+template<ElementTypeWithLessThanOperator ElementType>
+std::uint32_t ArenaAVLTree<ElementType>::rotateLeft(const std::uint32_t index) noexcept {
+	const auto newParent {nodes[index].getRightChild()};
+	nodes[index].setRightChild(nodes[newParent].getLeftChild());
+	nodes[newParent].setLeftChild(index);
+	
+	updateHeight(index);
+	updateHeight(newParent);
+	
+	return newParent;
+}
+
+template<ElementTypeWithLessThanOperator ElementType>
+std::uint32_t ArenaAVLTree<ElementType>::rotateRight(const std::uint32_t index) noexcept {
+	const auto newParent {nodes[index].getLeftChild()};
+	nodes[index].setLeftChild(nodes[newParent].getRightChild());
+	nodes[newParent].setRightChild(index);
+	
+	updateHeight(index);
+	updateHeight(newParent);
+	
+	return newParent;
+}
+
+template<ElementTypeWithLessThanOperator ElementType>
+void ArenaAVLTree<ElementType>::updateHeight(const std::uint32_t index) noexcept {
+	auto& node {nodes[index]};
+	node.setHeight(1 + std::max(getHeight(node.getLeftChild()), getHeight(node.getRightChild())));
+}
+}
\ No newline at end of file
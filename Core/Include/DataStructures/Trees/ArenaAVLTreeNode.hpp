@@ -0,0 +1,184 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <utility>
+
+namespace Core::DataStructures::Trees {
+/**
+ * @brief A node for arena avl trees that refers to its children by their 32-bit indices in the arena of the tree.
+ * @details The node holds no pointers, so for a 4-byte element it occupies 16 bytes instead of the 48 bytes of a
+ * separately allocated parent linked node, and it stays valid when the arena is reallocated or copied as a whole.
+ * @class ArenaAVLTreeNode
+ * @tparam ElementType The type of the elements stored in the arena avl tree.
+ */
+template<typename ElementType>
+class ArenaAVLTreeNode final {
+public:
+	/**
+	 * @brief The index that stands for a missing child.
+	 */
+	static constexpr std::uint32_t NULL_INDEX {std::numeric_limits<std::uint32_t>::max()};
+	
+	/**
+	 * @brief Instantiates a new leaf node with the given element using copy semantics.
+	 * @param element The element to store in the node.
+	 */
+	explicit ArenaAVLTreeNode(const ElementType& element) noexcept;
+	
+	/**
+	 * @brief Instantiates a new leaf node with the given element using move semantics.
+	 * @param element The element to store in the node.
+	 */
+	explicit ArenaAVLTreeNode(ElementType&& element) noexcept;
+	
+	/**
+	 * @brief Instantiates a new node by copying the given node.
+	 * @param other The node to copy.
+	 */
+	ArenaAVLTreeNode(const ArenaAVLTreeNode<ElementType>& other) noexcept = default;
+	
+	/**
+	 * @brief Instantiates a new node by moving the given node.
+	 * @param other The node to move.
+	 */
+	ArenaAVLTreeNode(ArenaAVLTreeNode<ElementType>&& other) noexcept = default;
+	
+	/**
+	 * @brief Destroys the node.
+	 */
+	~ArenaAVLTreeNode() noexcept = default;
+
+public:
+	/**
+	 * @brief Assigns the given node to this node using copy semantics.
+	 * @param other The node to copy.
+	 * @return A reference to this node.
+	 */
+	ArenaAVLTreeNode<ElementType>& operator=(const ArenaAVLTreeNode<ElementType>& other) noexcept = default;
+	
+	/**
+	 * @brief Assigns the given node to this node using move semantics.
+	 * @param other The node to move.
+	 * @return A reference to this node.
+	 */
+	ArenaAVLTreeNode<ElementType>& operator=(ArenaAVLTreeNode<ElementType>&& other) noexcept = default;
+
+public:
+	/**
+	 * @brief Gets a reference to the element stored in the node.
+	 * @return A reference to the element stored in the node.
+	 */
+	ElementType& getElement() noexcept;
+	
+	/**
+	 * @brief Gets a const reference to the element stored in the node.
+	 * @return A const reference to the element stored in the node.
+	 */
+	const ElementType& getElement() const noexcept;
+	
+	/**
+	 * @brief Gets the index of the left child of the node.
+	 * @return The index of the left child of the node, or NULL_INDEX if the node has no left child.
+	 */
+	std::uint32_t getLeftChild() const noexcept;
+	
+	/**
+	 * @brief Sets the index of the left child of the node.
+	 * @param leftChild The index of the new left child, or NULL_INDEX to remove the left child.
+	 */
+	void setLeftChild(const std::uint32_t leftChild) noexcept;
+	
+	/**
+	 * @brief Gets the index of the right child of the node.
+	 * @return The index of the right child of the node, or NULL_INDEX if the node has no right child.
+	 */
+	std::uint32_t getRightChild() const noexcept;
+	
+	/**
+	 * @brief Sets the index of the right child of the node.
+	 * @param rightChild The index of the new right child, or NULL_INDEX to remove the right child.
+	 */
+	void setRightChild(const std::uint32_t rightChild) noexcept;
+	
+	/**
+	 * @brief Gets the index of the left or right child of the node without branching on the given side.
+	 * @param isRight True to get the right child, false to get the left child.
+	 * @return The index of the child on the given side, or NULL_INDEX if the node has no child there.
+	 */
+	std::uint32_t getChild(const bool isRight) const noexcept;
+	
+	/**
+	 * @brief Gets the height of the subtree rooted at the node.
+	 * @return The height of the subtree rooted at the node, which is 0 for a leaf.
+	 */
+	int getHeight() const noexcept;
+	
+	/**
+	 * @brief Sets the height of the subtree rooted at the node.
+	 * @param height The new height, which must fit in 8 bits as any avl tree with fewer than 2^32 nodes does.
+	 */
+	void setHeight(const int height) noexcept;
+
+private:
+	ElementType element;
+	std::array<std::uint32_t, 2> children {NULL_INDEX, NULL_INDEX};
+	std::int8_t height {0};
+};
+
+template<typename ElementType>
+ArenaAVLTreeNode<ElementType>::ArenaAVLTreeNode(const ElementType& element) noexcept : element {element} {
+	
+}
+
+template<typename ElementType>
+ArenaAVLTreeNode<ElementType>::ArenaAVLTreeNode(ElementType&& element) noexcept : element {std::move(element)} {
+	
+}
+
+template<typename ElementType>
+ElementType& ArenaAVLTreeNode<ElementType>::getElement() noexcept {
+	return element;
+}
+
+template<typename ElementType>
+const ElementType& ArenaAVLTreeNode<ElementType>::getElement() const noexcept {
+	return element;
+}
+
+template<typename ElementType>
+std::uint32_t ArenaAVLTreeNode<ElementType>::getLeftChild() const noexcept {
+	return children[0];
+}
+
+template<typename ElementType>
+void ArenaAVLTreeNode<ElementType>::setLeftChild(const std::uint32_t leftChild) noexcept {
+	children[0] = leftChild;
+}
+
+template<typename ElementType>
+std::uint32_t ArenaAVLTreeNode<ElementType>::getRightChild() const noexcept {
+	return children[1];
+}
+
+template<typename ElementType>
+void ArenaAVLTreeNode<ElementType>::setRightChild(const std::uint32_t rightChild) noexcept {
+	children[1] = rightChild;
+}
+
+template<typename ElementType>
+std::uint32_t ArenaAVLTreeNode<ElementType>::getChild(const bool isRight) const noexcept {
+	return children[isRight];
+}
+
+template<typename ElementType>
+int ArenaAVLTreeNode<ElementType>::getHeight() const noexcept {
+	return height;
+}
+
+template<typename ElementType>
+void ArenaAVLTreeNode<ElementType>::setHeight(const int height) noexcept {
+	this->height = static_cast<std::int8_t>(height);
+}
+}
\ No newline at end of file
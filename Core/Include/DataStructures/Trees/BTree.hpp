@@ -0,0 +1,1120 @@
+#pragma once
+
+#include <algorithm>
+#include <concepts>
+#include <functional>
+#include <optional>
+#include <ranges>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "DataStructures/Trees/Iterators/BTreeConstForwardIterator.hpp"
+#include "BTreeNode.hpp"
+#include "BinarySearchTreeConcepts.hpp"
+
+namespace Core::DataStructures::Trees {
+/**
+ * @brief A B+ tree that maps ordered keys to values and whose nodes are sized to a configurable number of bytes.
+ * @details Every node stores its keys in one contiguous array, so a lookup reads one node per level of a tree that is
+ * only log_B(n) levels high, where B is the number of keys that fit in a node, instead of one node per level of a
+ * binary tree that is log_2(n) levels high. All key-value pairs live in the leaves, which are linked in key order, so
+ * iteration and range scans walk consecutive leaves without revisiting inner nodes. Every node other than the root is
+ * kept at least half full by splitting nodes on insertion and by borrowing from or merging with a sibling on removal.
+ * @class BTree
+ * @tparam KeyType: The type of the keys.
+ * @tparam ValueType: The type of the values.
+ * @tparam NodeBytes: The number of bytes a node is sized to, from which the number of keys per node is derived.
+ */
+template<ElementTypeWithLessThanOperator KeyType, std::semiregular ValueType, std::size_t NodeBytes = 256>
+requires std::semiregular<KeyType> && (NodeBytes >= 64)
+class BTree final {
+public:
+	/**
+	 * @brief The maximum number of key-value pairs in a leaf node.
+	 */
+	static constexpr std::size_t LEAF_CAPACITY {std::max<std::size_t>(
+			4, (NodeBytes - sizeof(BTreeNode) - 2 * sizeof(void*)) / (sizeof(KeyType) + sizeof(ValueType)))};
+	
+	/**
+	 * @brief The maximum number of keys in an inner node.
+	 */
+	static constexpr std::size_t INNER_CAPACITY {std::max<std::size_t>(
+			4, (NodeBytes - sizeof(BTreeNode) - sizeof(void*)) / (sizeof(KeyType) + sizeof(void*)))};
+	
+	/**
+	 * @brief Instantiates a new empty B+ tree.
+	 */
+	BTree() noexcept = default;
+	
+	/**
+	 * @brief Instantiates a new B+ tree by bulk loading the given key-value pairs in O(n) time.
+	 * @details The leaves are filled completely from left to right, which builds a tree with the fewest nodes and
+	 * levels the pairs fit in.
+	 * @tparam Range: The type of the range of key-value pairs.
+	 * @param sortedPairs: The key-value pairs to load, sorted by key in strictly ascending order.
+	 * @throws std::invalid_argument: Thrown if the keys are not in strictly ascending order.
+	 */
+	template<std::ranges::input_range Range>
+	requires std::convertible_to<std::ranges::range_reference_t<Range>, std::pair<KeyType, ValueType>>
+	explicit BTree(const Range& sortedPairs);
+	
+	/**
+	 * @brief Instantiates a new B+ tree by copying the given B+ tree.
+	 * @details The copy is bulk loaded, so it is packed as tightly as a bulk loaded B+ tree.
+	 * @param other: The B+ tree to copy.
+	 */
+	BTree(const BTree& other);
+	
+	/**
+	 * @brief Instantiates a new B+ tree by moving the given B+ tree.
+	 * @param other: The B+ tree to move.
+	 */
+	BTree(BTree&& other) noexcept;
+	
+	/**
+	 * @brief Destroys the B+ tree.
+	 */
+	~BTree() noexcept;
+
+public:
+	/**
+	 * @brief Assigns the given B+ tree to this B+ tree using copy semantics.
+	 * @param other: The B+ tree to copy.
+	 * @return A reference to this B+ tree.
+	 */
+	BTree& operator=(const BTree& other);
+	
+	/**
+	 * @brief Assigns the given B+ tree to this B+ tree using move semantics.
+	 * @param other: The B+ tree to move.
+	 * @return A reference to this B+ tree.
+	 */
+	BTree& operator=(BTree&& other) noexcept;
+	
+	/**
+	 * @brief Compares two B+ trees.
+	 * @details Two B+ trees are equal if they hold the same key-value pairs, regardless of how their nodes are filled.
+	 * @param other: The other B+ tree to compare with.
+	 * @return True if the two B+ trees are equal, false otherwise.
+	 */
+	bool operator==(const BTree& other) const noexcept requires std::equality_comparable<ValueType>;
+
+public:
+	using value_type = std::pair<KeyType, ValueType>;
+	using ConstForwardIterator = Iterators::BTreeConstForwardIterator<KeyType, ValueType, LEAF_CAPACITY>;
+	
+	/**
+	 * @brief Gets a const forward iterator to the key-value pair with the smallest key in the B+ tree.
+	 * @return A const forward iterator to the key-value pair with the smallest key in the B+ tree.
+	 */
+	ConstForwardIterator cbegin() const noexcept;
+	
+	/**
+	 * @brief Gets a const forward iterator to the key-value pair after the one with the largest key in the B+ tree.
+	 * @return A const forward iterator to the key-value pair after the one with the largest key in the B+ tree.
+	 */
+	ConstForwardIterator cend() const noexcept;
+
+public:
+	/**
+	 * @brief Inserts the given key-value pair into the B+ tree using copy semantics.
+	 * @details If the key is already in the B+ tree its value is replaced.
+	 * @param key: The key to insert.
+	 * @param value: The value to insert.
+	 * @throws std::bad_alloc: Thrown if a node has to be split and memory allocation fails.
+	 */
+	void insert(const KeyType& key, const ValueType& value);
+	
+	/**
+	 * @brief Inserts the given key-value pair into the B+ tree using move semantics.
+	 * @details If the key is already in the B+ tree its value is replaced.
+	 * @param key: The key to insert.
+	 * @param value: The value to insert.
+	 * @throws std::bad_alloc: Thrown if a node has to be split and memory allocation fails.
+	 */
+	void insert(const KeyType& key, ValueType&& value);
+	
+	/**
+	 * @brief Removes the given key from the B+ tree.
+	 * @param key: The key to remove.
+	 * @return The value of the key that was removed, or std::nullopt if the key was not found in the B+ tree.
+	 */
+	std::optional<ValueType> removeFirst(const KeyType& key) noexcept;
+	
+	/**
+	 * @brief Removes the key-value pair with the smallest key from the B+ tree.
+	 * @return The key-value pair that was removed, or std::nullopt if the B+ tree is empty.
+	 */
+	std::optional<std::pair<KeyType, ValueType>> removeMinimum() noexcept;
+	
+	/**
+	 * @brief Removes the key-value pair with the largest key from the B+ tree.
+	 * @return The key-value pair that was removed, or std::nullopt if the B+ tree is empty.
+	 */
+	std::optional<std::pair<KeyType, ValueType>> removeMaximum() noexcept;
+	
+	/**
+	 * @brief Removes all key-value pairs from the B+ tree resulting in an empty B+ tree.
+	 * @return A vector containing all key-value pairs that were removed from the B+ tree in ascending key order.
+	 */
+	std::vector<std::pair<KeyType, ValueType>> removeAll();
+	
+	/**
+	 * @brief Finds the value of the given key in the B+ tree.
+	 * @param key: The key to find.
+	 * @return The value of the given key, or std::nullopt if the key was not found in the B+ tree.
+	 */
+	std::optional<ValueType> findFirst(const KeyType& key) const noexcept;
+	
+	/**
+	 * @brief Finds the key-value pair with the smallest key in the B+ tree in O(1) time.
+	 * @return The key-value pair with the smallest key, or std::nullopt if the B+ tree is empty.
+	 */
+	std::optional<std::pair<KeyType, ValueType>> findMinimum() const noexcept;
+	
+	/**
+	 * @brief Finds the key-value pair with the largest key in the B+ tree in O(1) time.
+	 * @return The key-value pair with the largest key, or std::nullopt if the B+ tree is empty.
+	 */
+	std::optional<std::pair<KeyType, ValueType>> findMaximum() const noexcept;
+	
+	/**
+	 * @brief Applies the given function to every key-value pair whose key neither comes before the lower key nor after
+	 * the upper key, in ascending key order.
+	 * @param lower: The first key of the range.
+	 * @param upper: The last key of the range.
+	 * @param function: The function to apply to each key-value pair in the range.
+	 */
+	void forEachInRange(const KeyType& lower,
+	                    const KeyType& upper,
+	                    const std::function<void(const KeyType&, const ValueType&)>& function) const;
+	
+	/**
+	 * @brief Checks if the B+ tree contains the given key.
+	 * @param key: The key to check.
+	 * @return True if the B+ tree contains the given key, false otherwise.
+	 */
+	bool contains(const KeyType& key) const noexcept;
+	
+	/**
+	 * @brief Checks if the B+ tree is empty.
+	 * @return True if the B+ tree is empty, false otherwise.
+	 */
+	bool isEmpty() const noexcept;
+	
+	/**
+	 * @brief Gets the number of key-value pairs in the B+ tree.
+	 * @return The number of key-value pairs in the B+ tree.
+	 */
+	std::size_t getNodeCount() const noexcept;
+	
+	/**
+	 * @brief Gets the number of levels of the B+ tree, including the leaf level.
+	 * @return The number of levels of the B+ tree, or 0 if the B+ tree is empty.
+	 */
+	std::size_t getLevelCount() const noexcept;
+	
+	/**
+	 * @brief Gets the number of bytes occupied by the nodes of the B+ tree, not counting allocator overhead.
+	 * @return The number of bytes occupied by the nodes of the B+ tree.
+	 */
+	std::size_t getMemoryUsage() const noexcept;
+
+private:
+	using InnerNode = BTreeInnerNode<KeyType, INNER_CAPACITY>;
+	using LeafNode = BTreeLeafNode<KeyType, ValueType, LEAF_CAPACITY>;
+	
+	/**
+	 * @brief The minimum number of key-value pairs in a leaf node other than the root.
+	 */
+	static constexpr std::size_t MINIMUM_LEAF_COUNT {LEAF_CAPACITY / 2};
+	
+	/**
+	 * @brief The minimum number of keys in an inner node other than the root.
+	 */
+	static constexpr std::size_t MINIMUM_INNER_COUNT {(INNER_CAPACITY - 1) / 2};
+	
+	/**
+	 * @brief The result of splitting a node.
+	 */
+	struct Split final {
+		/**
+		 * @brief The key that separates the split node from the new node, to be inserted into the parent node.
+		 */
+		KeyType separator;
+		
+		/**
+		 * @brief The new node holding the upper half of the keys of the split node.
+		 */
+		BTreeNode* rightNode;
+	};
+	
+	/**
+	 * @brief Inserts the given key-value pair into the B+ tree.
+	 * @tparam Value: The type of the value, which is forwarded into the leaf.
+	 * @param key: The key to insert.
+	 * @param value: The value to insert.
+	 */
+	template<typename Value>
+	void insertPair(const KeyType& key, Value&& value);
+	
+	/**
+	 * @brief Inserts the given key-value pair into the subtree rooted at the given node recursively.
+	 * @tparam Value: The type of the value, which is forwarded into the leaf.
+	 * @param node: The root of the subtree.
+	 * @param key: The key to insert.
+	 * @param value: The value to insert.
+	 * @return The split of the given node if it had to be split, or std::nullopt otherwise.
+	 */
+	template<typename Value>
+	std::optional<Split> insertIntoSubtree(BTreeNode* node, const KeyType& key, Value&& value);
+	
+	/**
+	 * @brief Moves the upper half of the key-value pairs of the given full leaf node into a new leaf node.
+	 * @param leaf: The leaf node to split.
+	 * @return The new leaf node, which is linked after the given leaf node.
+	 */
+	LeafNode* splitLeaf(LeafNode* leaf);
+	
+	/**
+	 * @brief Moves the upper half of the keys and children of the given full inner node into a new inner node.
+	 * @param node: The inner node to split.
+	 * @return The split of the given inner node, whose separator is the middle key that was removed from it.
+	 */
+	Split splitInner(InnerNode* node);
+	
+	/**
+	 * @brief Removes the given key from the subtree rooted at the given node recursively.
+	 * @param node: The root of the subtree.
+	 * @param key: The key to remove.
+	 * @return The value of the key that was removed, or std::nullopt if the key was not found.
+	 */
+	std::optional<ValueType> removeFromSubtree(BTreeNode* node, const KeyType& key) noexcept;
+	
+	/**
+	 * @brief Refills the underfull leaf node at the given index of the given parent node by borrowing a key-value pair
+	 * from a sibling, or merges it with a sibling if neither can spare one.
+	 * @param parent: The parent node.
+	 * @param index: The index of the underfull leaf node in the parent node.
+	 */
+	void rebalanceLeaf(InnerNode* parent, const std::size_t index) noexcept;
+	
+	/**
+	 * @brief Refills the underfull inner node at the given index of the given parent node by rotating a key through
+	 * the parent node from a sibling, or merges it with a sibling if neither can spare one.
+	 * @param parent: The parent node.
+	 * @param index: The index of the underfull inner node in the parent node.
+	 */
+	void rebalanceInner(InnerNode* parent, const std::size_t index) noexcept;
+	
+	/**
+	 * @brief Removes the key at the given index and the child after it from the given inner node.
+	 * @param node: The inner node.
+	 * @param index: The index of the key to remove.
+	 */
+	static void removeFromInner(InnerNode* node, const std::size_t index) noexcept;
+	
+	/**
+	 * @brief Bulk loads the key-value pairs between the given iterator and sentinel into this empty B+ tree.
+	 * @tparam Iterator: The type of the iterator.
+	 * @tparam Sentinel: The type of the sentinel.
+	 * @param iterator: An iterator to the first key-value pair.
+	 * @param sentinel: The sentinel after the last key-value pair.
+	 * @throws std::invalid_argument: Thrown if the keys are not in strictly ascending order.
+	 */
+	template<typename Iterator, typename Sentinel>
+	void bulkLoad(Iterator iterator, Sentinel sentinel);
+	
+	/**
+	 * @brief Finds the leaf node that the given key belongs in. The B+ tree must not be empty.
+	 * @param key: The key to find.
+	 * @return The leaf node that the given key belongs in.
+	 */
+	const LeafNode* findLeaf(const KeyType& key) const noexcept;
+	
+	/**
+	 * @brief Gets the index of the first of the given keys that does not come before the given key.
+	 * @param keys: The sorted keys of a node.
+	 * @param count: The number of keys in use.
+	 * @param key: The key to search for.
+	 * @return The index of the first key that does not come before the given key, or count if there is none.
+	 */
+	static std::size_t getLowerBoundIndex(const std::array<KeyType, LEAF_CAPACITY>& keys,
+	                                      const std::size_t count,
+	                                      const KeyType& key) noexcept;
+	
+	/**
+	 * @brief Gets the index of the child of the given inner node whose subtree the given key belongs in.
+	 * @param node: The inner node.
+	 * @param key: The key to search for.
+	 * @return The index of the child.
+	 */
+	static std::size_t getChildIndex(const InnerNode* node, const KeyType& key) noexcept;
+	
+	/**
+	 * @brief Deletes the subtree rooted at the given node.
+	 * @param node: The root of the subtree.
+	 */
+	static void deleteSubtree(BTreeNode* node) noexcept;
+	
+	/**
+	 * @brief Deletes all nodes of the B+ tree and resets it to an empty B+ tree.
+	 */
+	void clear() noexcept;
+
+private:
+	BTreeNode* rootNode {nullptr};
+	LeafNode* firstLeaf {nullptr};
+	LeafNode* lastLeaf {nullptr};
+	std::size_t size {0};
+	std::size_t levelCount {0};
+	std::size_t leafCount {0};
+	std::size_t innerCount {0};
+};
+
+template<ElementTypeWithLessThanOperator KeyType, std::semiregular ValueType, std::size_t NodeBytes>
+requires std::semiregular<KeyType> && (NodeBytes >= 64)
+template<std::ranges::input_range Range>
+requires std::convertible_to<std::ranges::range_reference_t<Range>, std::pair<KeyType, ValueType>>
+BTree<KeyType, ValueType, NodeBytes>::BTree(const Range& sortedPairs) {
+	bulkLoad(std::ranges::begin(sortedPairs), std::ranges::end(sortedPairs));
+}
+
+template<ElementTypeWithLessThanOperator KeyType, std::semiregular ValueType, std::size_t NodeBytes>
+requires std::semiregular<KeyType> && (NodeBytes >= 64)
+BTree<KeyType, ValueType, NodeBytes>::BTree(const BTree& other) {
+	bulkLoad(other.cbegin(), other.cend());
+}
+
+template<ElementTypeWithLessThanOperator KeyType, std::semiregular ValueType, std::size_t NodeBytes>
+requires std::semiregular<KeyType> && (NodeBytes >= 64)
+BTree<KeyType, ValueType, NodeBytes>::BTree(BTree&& other) noexcept :
+		rootNode {std::exchange(other.rootNode, nullptr)},
+		firstLeaf {std::exchange(other.firstLeaf, nullptr)},
+		lastLeaf {std::exchange(other.lastLeaf, nullptr)},
+		size {std::exchange(other.size, 0)},
+		levelCount {std::exchange(other.levelCount, 0)},
+		leafCount {std::exchange(other.leafCount, 0)},
+		innerCount {std::exchange(other.innerCount, 0)} {
+	
+}
+
+template<ElementTypeWithLessThanOperator KeyType, std::semiregular ValueType, std::size_t NodeBytes>
+requires std::semiregular<KeyType> && (NodeBytes >= 64)
+BTree<KeyType, ValueType, NodeBytes>::~BTree() noexcept {
+	clear();
+}
+
+template<ElementTypeWithLessThanOperator KeyType, std::semiregular ValueType, std::size_t NodeBytes>
+requires std::semiregular<KeyType> && (NodeBytes >= 64)
+BTree<KeyType, ValueType, NodeBytes>& BTree<KeyType, ValueType, NodeBytes>::operator=(const BTree& other) {
+	if (this != &other) {
+		BTree copy {other};
+		*this = std::move(copy);
+	}
+	
+	return *this;
+}
+
+template<ElementTypeWithLessThanOperator KeyType, std::semiregular ValueType, std::size_t NodeBytes>
+requires std::semiregular<KeyType> && (NodeBytes >= 64)
+BTree<KeyType, ValueType, NodeBytes>& BTree<KeyType, ValueType, NodeBytes>::operator=(BTree&& other) noexcept {
+	if (this != &other) {
+		clear();
+		rootNode = std::exchange(other.rootNode, nullptr);
+		firstLeaf = std::exchange(other.firstLeaf, nullptr);
+		lastLeaf = std::exchange(other.lastLeaf, nullptr);
+		size = std::exchange(other.size, 0);
+		levelCount = std::exchange(other.levelCount, 0);
+		leafCount = std::exchange(other.leafCount, 0);
+		innerCount = std::exchange(other.innerCount, 0);
+	}
+	
+	return *this;
+}
+
+template<ElementTypeWithLessThanOperator KeyType, std::semiregular ValueType, std::size_t NodeBytes>
+requires std::semiregular<KeyType> && (NodeBytes >= 64)
+bool BTree<KeyType, ValueType, NodeBytes>::operator==(const BTree& other) const noexcept
+requires std::equality_comparable<ValueType> {
+	if (size != other.size) {
+		return false;
+	}
+	
+	for (auto iterator {cbegin()}, otherIterator {other.cbegin()}; iterator != cend(); ++iterator, ++otherIterator) {
+		const auto [key, value] {*iterator};
+		const auto [otherKey, otherValue] {*otherIterator};
+		
+		if (key < otherKey || otherKey < key || !(value == otherValue)) {
+			return false;
+		}
+	}
+	
+	return true;
+}
+
+template<ElementTypeWithLessThanOperator KeyType, std::semiregular ValueType, std::size_t NodeBytes>
+requires std::semiregular<KeyType> && (NodeBytes >= 64)
+BTree<KeyType, ValueType, NodeBytes>::ConstForwardIterator BTree<KeyType, ValueType, NodeBytes>::cbegin() const noexcept {
+	return ConstForwardIterator {firstLeaf, 0};
+}
+
+template<ElementTypeWithLessThanOperator KeyType, std::semiregular ValueType, std::size_t NodeBytes>
+requires std::semiregular<KeyType> && (NodeBytes >= 64)
+BTree<KeyType, ValueType, NodeBytes>::ConstForwardIterator BTree<KeyType, ValueType, NodeBytes>::cend() const noexcept {
+	return ConstForwardIterator {nullptr, 0};
+}
+
+template<ElementTypeWithLessThanOperator KeyType, std::semiregular ValueType, std::size_t NodeBytes>
+requires std::semiregular<KeyType> && (NodeBytes >= 64)
+void BTree<KeyType, ValueType, NodeBytes>::insert(const KeyType& key, const ValueType& value) {
+	insertPair(key, value);
+}
+
+template<ElementTypeWithLessThanOperator KeyType, std::semiregular ValueType, std::size_t NodeBytes>
+requires std::semiregular<KeyType> && (NodeBytes >= 64)
+void BTree<KeyType, ValueType, NodeBytes>::insert(const KeyType& key, ValueType&& value) {
+	insertPair(key, std::move(value));
+}
+
+template<ElementTypeWithLessThanOperator KeyType, std::semiregular ValueType, std::size_t NodeBytes>
+requires std::semiregular<KeyType> && (NodeBytes >= 64)
+std::optional<ValueType> BTree<KeyType, ValueType, NodeBytes>::removeFirst(const KeyType& key) noexcept {
+	if (rootNode == nullptr) {
+		return std::nullopt;
+	}
+	
+	auto removedValue {removeFromSubtree(rootNode, key)};
+	
+	if (rootNode->count == 0) {
+		if (rootNode->isLeaf) {
+			delete static_cast<LeafNode*>(rootNode);
+			rootNode = nullptr;
+			firstLeaf = nullptr;
+			lastLeaf = nullptr;
+			--leafCount;
+		} else {
+			auto* oldRootNode {static_cast<InnerNode*>(rootNode)};
+			rootNode = oldRootNode->children[0];
+			delete oldRootNode;
+			--innerCount;
+		}
+		
+		--levelCount;
+	}
+	
+	return removedValue;
+}
+
+template<ElementTypeWithLessThanOperator KeyType, std::semiregular ValueType, std::size_t NodeBytes>
+requires std::semiregular<KeyType> && (NodeBytes >= 64)
+std::optional<std::pair<KeyType, ValueType>> BTree<KeyType, ValueType, NodeBytes>::removeMinimum() noexcept {
+	if (firstLeaf == nullptr) {
+		return std::nullopt;
+	}
+	
+	auto key {firstLeaf->keys[0]};
+	auto value {removeFirst(key)};
+	return std::make_pair(std::move(key), std::move(*value));
+}
+
+template<ElementTypeWithLessThanOperator KeyType, std::semiregular ValueType, std::size_t NodeBytes>
+requires std::semiregular<KeyType> && (NodeBytes >= 64)
+std::optional<std::pair<KeyType, ValueType>> BTree<KeyType, ValueType, NodeBytes>::removeMaximum() noexcept {
+	if (lastLeaf == nullptr) {
+		return std::nullopt;
+	}
+	
+	auto key {lastLeaf->keys[lastLeaf->count - 1]};
+	auto value {removeFirst(key)};
+	return std::make_pair(std::move(key), std::move(*value));
+}
+
+template<ElementTypeWithLessThanOperator KeyType, std::semiregular ValueType, std::size_t NodeBytes>
+requires std::semiregular<KeyType> && (NodeBytes >= 64)
+std::vector<std::pair<KeyType, ValueType>> BTree<KeyType, ValueType, NodeBytes>::removeAll() {
+	std::vector<std::pair<KeyType, ValueType>> pairs {};
+	pairs.reserve(size);
+	
+	for (auto* leaf {firstLeaf}; leaf != nullptr; leaf = leaf->next) {
+		for (std::size_t index {0}; index < leaf->count; ++index) {
+			pairs.emplace_back(std::move(leaf->keys[index]), std::move(leaf->values[index]));
+		}
+	}
+	
+	clear();
+	return pairs;
+}
+
+template<ElementTypeWithLessThanOperator KeyType, std::semiregular ValueType, std::size_t NodeBytes>
+requires std::semiregular<KeyType> && (NodeBytes >= 64)
+std::optional<ValueType> BTree<KeyType, ValueType, NodeBytes>::findFirst(const KeyType& key) const noexcept {
+	if (rootNode == nullptr) {
+		return std::nullopt;
+	}
+	
+	const auto* leaf {findLeaf(key)};
+	const auto index {getLowerBoundIndex(leaf->keys, leaf->count, key)};
+	
+	if (index == leaf->count || key < leaf->keys[index]) {
+		return std::nullopt;
+	}
+	
+	return leaf->values[index];
+}
+
+template<ElementTypeWithLessThanOperator KeyType, std::semiregular ValueType, std::size_t NodeBytes>
+requires std::semiregular<KeyType> && (NodeBytes >= 64)
+std::optional<std::pair<KeyType, ValueType>> BTree<KeyType, ValueType, NodeBytes>::findMinimum() const noexcept {
+	if (firstLeaf == nullptr) {
+		return std::nullopt;
+	}
+	
+	return std::make_pair(firstLeaf->keys[0], firstLeaf->values[0]);
+}
+
+template<ElementTypeWithLessThanOperator KeyType, std::semiregular ValueType, std::size_t NodeBytes>
+requires std::semiregular<KeyType> && (NodeBytes >= 64)
+std::optional<std::pair<KeyType, ValueType>> BTree<KeyType, ValueType, NodeBytes>::findMaximum() const noexcept {
+	if (lastLeaf == nullptr) {
+		return std::nullopt;
+	}
+	
+	return std::make_pair(lastLeaf->keys[lastLeaf->count - 1], lastLeaf->values[lastLeaf->count - 1]);
+}
+
+template<ElementTypeWithLessThanOperator KeyType, std::semiregular ValueType, std::size_t NodeBytes>
+requires std::semiregular<KeyType> && (NodeBytes >= 64)
+void BTree<KeyType, ValueType, NodeBytes>::forEachInRange(const KeyType& lower,
+                                                          const KeyType& upper,
+                                                          const std::function<void(const KeyType&, const ValueType&)>& function) const {
+	if (rootNode == nullptr || upper < lower) {
+		return;
+	}
+	
+	const auto* leaf {findLeaf(lower)};
+	auto index {getLowerBoundIndex(leaf->keys, leaf->count, lower)};
+	
+	for (; leaf != nullptr; leaf = leaf->next, index = 0) {
+		for (; index < leaf->count; ++index) {
+			if (upper < leaf->keys[index]) {
+				return;
+			}
+			
+			function(leaf->keys[index], leaf->values[index]);
+		}
+	}
+}
+
+template<ElementTypeWithLessThanOperator KeyType, std::semiregular ValueType, std::size_t NodeBytes>
+requires std::semiregular<KeyType> && (NodeBytes >= 64)
+bool BTree<KeyType, ValueType, NodeBytes>::contains(const KeyType& key) const noexcept {
+	if (rootNode == nullptr) {
+		return false;
+	}
+	
+	const auto* leaf {findLeaf(key)};
+	const auto index {getLowerBoundIndex(leaf->keys, leaf->count, key)};
+	return index < leaf->count && !(key < leaf->keys[index]);
+}
+
+template<ElementTypeWithLessThanOperator KeyType, std::semiregular ValueType, std::size_t NodeBytes>
+requires std::semiregular<KeyType> && (NodeBytes >= 64)
+bool BTree<KeyType, ValueType, NodeBytes>::isEmpty() const noexcept {
+	return size == 0;
+}
+
+template<ElementTypeWithLessThanOperator KeyType, std::semiregular ValueType, std::size_t NodeBytes>
+requires std::semiregular<KeyType> && (NodeBytes >= 64)
+std::size_t BTree<KeyType, ValueType, NodeBytes>::getNodeCount() const noexcept {
+	return size;
+}
+
+template<ElementTypeWithLessThanOperator KeyType, std::semiregular ValueType, std::size_t NodeBytes>
+requires std::semiregular<KeyType> && (NodeBytes >= 64)
+std::size_t BTree<KeyType, ValueType, NodeBytes>::getLevelCount() const noexcept {
+	return levelCount;
+}
+
+template<ElementTypeWithLessThanOperator KeyType, std::semiregular ValueType, std::size_t NodeBytes>
+requires std::semiregular<KeyType> && (NodeBytes >= 64)
+std::size_t BTree<KeyType, ValueType, NodeBytes>::getMemoryUsage() const noexcept {
+	return leafCount * sizeof(LeafNode) + innerCount * sizeof(InnerNode);
+}
+
+template<ElementTypeWithLessThanOperator KeyType, std::semiregular ValueType, std::size_t NodeBytes>
+requires std::semiregular<KeyType> && (NodeBytes >= 64)
+template<typename Value>
+void BTree<KeyType, ValueType, NodeBytes>::insertPair(const KeyType& key, Value&& value) {
+	if (rootNode == nullptr) {
+		auto* leaf {new LeafNode {}};
+		rootNode = leaf;
+		firstLeaf = leaf;
+		lastLeaf = leaf;
+		++leafCount;
+		levelCount = 1;
+	}
+	
+	auto split {insertIntoSubtree(rootNode, key, std::forward<Value>(value))};
+	if (!split.has_value()) {
+		return;
+	}
+	
+	auto* newRootNode {new InnerNode {}};
+	newRootNode->keys[0] = std::move(split->separator);
+	newRootNode->children[0] = rootNode;
+	newRootNode->children[1] = split->rightNode;
+	newRootNode->count = 1;
+	rootNode = newRootNode;
+	++innerCount;
+	++levelCount;
+}
+
+template<ElementTypeWithLessThanOperator KeyType, std::semiregular ValueType, std::size_t NodeBytes>
+requires std::semiregular<KeyType> && (NodeBytes >= 64)
+template<typename Value>
+std::optional<typename BTree<KeyType, ValueType, NodeBytes>::Split> BTree<KeyType, ValueType, NodeBytes>::insertIntoSubtree(
+		BTreeNode* node, const KeyType& key, Value&& value) {
+	if (node->isLeaf) {
+		auto* leaf {static_cast<LeafNode*>(node)};
+		auto index {getLowerBoundIndex(leaf->keys, leaf->count, key)};
+		
+		if (index < leaf->count && !(key < leaf->keys[index])) {
+			leaf->values[index] = std::forward<Value>(value);
+			return std::nullopt;
+		}
+		
+		std::optional<Split> split {};
+		if (leaf->count == LEAF_CAPACITY) {
+			auto* rightLeaf {splitLeaf(leaf)};
+			split = Split {rightLeaf->keys[0], rightLeaf};
+			
+			if (index > leaf->count) {
+				index -= leaf->count;
+				leaf = rightLeaf;
+			}
+		}
+		
+		std::move_backward(leaf->keys.begin() + index,
+		                   leaf->keys.begin() + leaf->count,
+		                   leaf->keys.begin() + leaf->count + 1);
+		std::move_backward(leaf->values.begin() + index,
+		                   leaf->values.begin() + leaf->count,
+		                   leaf->values.begin() + leaf->count + 1);
+		leaf->keys[index] = key;
+		leaf->values[index] = std::forward<Value>(value);
+		++leaf->count;
+		++size;
+		return split;
+	}
+	
+	auto* inner {static_cast<InnerNode*>(node)};
+	auto index {getChildIndex(inner, key)};
+	auto childSplit {insertIntoSubtree(inner->children[index], key, std::forward<Value>(value))};
+	
+	if (!childSplit.has_value()) {
+		return std::nullopt;
+	}
+	
+	std::optional<Split> split {};
+	if (inner->count == INNER_CAPACITY) {
+		split = splitInner(inner);
+		
+		if (index > inner->count) {
+			index -= inner->count + 1;
+			inner = static_cast<InnerNode*>(split->rightNode);
+		}
+	}
+	
+	std::move_backward(inner->keys.begin() + index,
+	                   inner->keys.begin() + inner->count,
+	                   inner->keys.begin() + inner->count + 1);
+	std::copy_backward(inner->children.begin() + index + 1,
+	                   inner->children.begin() + inner->count + 1,
+	                   inner->children.begin() + inner->count + 2);
+	inner->keys[index] = std::move(childSplit->separator);
+	inner->children[index + 1] = childSplit->rightNode;
+	++inner->count;
+	return split;
+}
+
+template<ElementTypeWithLessThanOperator KeyType, std::semiregular ValueType, std::size_t NodeBytes>
+requires std::semiregular<KeyType> && (NodeBytes >= 64)
+BTree<KeyType, ValueType, NodeBytes>::LeafNode* BTree<KeyType, ValueType, NodeBytes>::splitLeaf(LeafNode* leaf) {
+	auto* rightLeaf {new LeafNode {}};
+	const auto leftCount {leaf->count / 2};
+	
+	std::move(leaf->keys.begin() + leftCount, leaf->keys.begin() + leaf->count, rightLeaf->keys.begin());
+	std::move(leaf->values.begin() + leftCount, leaf->values.begin() + leaf->count, rightLeaf->values.begin());
+	rightLeaf->count = leaf->count - leftCount;
+	leaf->count = leftCount;
+	
+	rightLeaf->previous = leaf;
+	rightLeaf->next = leaf->next;
+	if (leaf->next != nullptr) {
+		leaf->next->previous = rightLeaf;
+	} else {
+		lastLeaf = rightLeaf;
+	}
+	
+	leaf->next = rightLeaf;
+	++leafCount;
+	return rightLeaf;
+}
+
+template<ElementTypeWithLessThanOperator KeyType, std::semiregular ValueType, std::size_t NodeBytes>
+requires std::semiregular<KeyType> && (NodeBytes >= 64)
+BTree<KeyType, ValueType, NodeBytes>::Split BTree<KeyType, ValueType, NodeBytes>::splitInner(InnerNode* node) {
+	auto* rightNode {new InnerNode {}};
+	const auto middle {node->count / 2};
+	
+	std::move(node->keys.begin() + middle + 1, node->keys.begin() + node->count, rightNode->keys.begin());
+	std::copy(node->children.begin() + middle + 1,
+	          node->children.begin() + node->count + 1,
+	          rightNode->children.begin());
+	rightNode->count = node->count - middle - 1;
+	node->count = middle;
+	++innerCount;
+	
+	return Split {std::move(node->keys[middle]), rightNode};
+}
+
+template<ElementTypeWithLessThanOperator KeyType, std::semiregular ValueType, std::size_t NodeBytes>
+requires std::semiregular<KeyType> && (NodeBytes >= 64)
+std::optional<ValueType> BTree<KeyType, ValueType, NodeBytes>::removeFromSubtree(BTreeNode* node,
+                                                                                   const KeyType& key) noexcept {
+	if (node->isLeaf) {
+		auto* leaf {static_cast<LeafNode*>(node)};
+		const auto index {getLowerBoundIndex(leaf->keys, leaf->count, key)};
+		
+		if (index == leaf->count || key < leaf->keys[index]) {
+			return std::nullopt;
+		}
+		
+		auto removedValue {std::move(leaf->values[index])};
+		std::move(leaf->keys.begin() + index + 1, leaf->keys.begin() + leaf->count, leaf->keys.begin() + index);
+		std::move(leaf->values.begin() + index + 1, leaf->values.begin() + leaf->count, leaf->values.begin() + index);
+		--leaf->count;
+		--size;
+		return removedValue;
+	}
+	
+	auto* inner {static_cast<InnerNode*>(node)};
+	const auto index {getChildIndex(inner, key)};
+	auto* child {inner->children[index]};
+	auto removedValue {removeFromSubtree(child, key)};
+	
+	if (!removedValue.has_value()) {
+		return std::nullopt;
+	}
+	
+	if (child->isLeaf && child->count < MINIMUM_LEAF_COUNT) {
+		rebalanceLeaf(inner, index);
+	} else if (!child->isLeaf && child->count < MINIMUM_INNER_COUNT) {
+		rebalanceInner(inner, index);
+	}
+	
+	return removedValue;
+}
+
+template<ElementTypeWithLessThanOperator KeyType, std::semiregular ValueType, std::size_t NodeBytes>
+requires std::semiregular<KeyType> && (NodeBytes >= 64)
+void BTree<KeyType, ValueType, NodeBytes>::rebalanceLeaf(InnerNode* parent, const std::size_t index) noexcept {
+	auto* leaf {static_cast<LeafNode*>(parent->children[index])};
+	
+	if (index > 0) {
+		auto* leftLeaf {static_cast<LeafNode*>(parent->children[index - 1])};
+		
+		if (leftLeaf->count > MINIMUM_LEAF_COUNT) {
+			std::move_backward(leaf->keys.begin(),
+			                   leaf->keys.begin() + leaf->count,
+			                   leaf->keys.begin() + leaf->count + 1);
+			std::move_backward(leaf->values.begin(),
+			                   leaf->values.begin() + leaf->count,
+			                   leaf->values.begin() + leaf->count + 1);
+			--leftLeaf->count;
+			leaf->keys[0] = std::move(leftLeaf->keys[leftLeaf->count]);
+			leaf->values[0] = std::move(leftLeaf->values[leftLeaf->count]);
+			++leaf->count;
+			parent->keys[index - 1] = leaf->keys[0];
+			return;
+		}
+	}
+	
+	if (index < parent->count) {
+		auto* rightLeaf {static_cast<LeafNode*>(parent->children[index + 1])};
+		
+		if (rightLeaf->count > MINIMUM_LEAF_COUNT) {
+			leaf->keys[leaf->count] = std::move(rightLeaf->keys[0]);
+			leaf->values[leaf->count] = std::move(rightLeaf->values[0]);
+			++leaf->count;
+			std::move(rightLeaf->keys.begin() + 1, rightLeaf->keys.begin() + rightLeaf->count, rightLeaf->keys.begin());
+			std::move(rightLeaf->values.begin() + 1,
+			          rightLeaf->values.begin() + rightLeaf->count,
+			          rightLeaf->values.begin());
+			--rightLeaf->count;
+			parent->keys[index] = rightLeaf->keys[0];
+			return;
+		}
+	}
+	
+	const auto leftIndex {index > 0 ? index - 1 : index};
+	auto* leftLeaf {static_cast<LeafNode*>(parent->children[leftIndex])};
+	auto* rightLeaf {static_cast<LeafNode*>(parent->children[leftIndex + 1])};
+	
+	std::move(rightLeaf->keys.begin(),
+	          rightLeaf->keys.begin() + rightLeaf->count,
+	          leftLeaf->keys.begin() + leftLeaf->count);
+	std::move(rightLeaf->values.begin(),
+	          rightLeaf->values.begin() + rightLeaf->count,
+	          leftLeaf->values.begin() + leftLeaf->count);
+	leftLeaf->count += rightLeaf->count;
+	
+	leftLeaf->next = rightLeaf->next;
+	if (rightLeaf->next != nullptr) {
+		rightLeaf->next->previous = leftLeaf;
+	} else {
+		lastLeaf = leftLeaf;
+	}
+	
+	delete rightLeaf;
+	--leafCount;
+	removeFromInner(parent, leftIndex);
+}
+
+template<ElementTypeWithLessThanOperator KeyType, std::semiregular ValueType, std::size_t NodeBytes>
+requires std::semiregular<KeyType> && (NodeBytes >= 64)
+void BTree<KeyType, ValueType, NodeBytes>::rebalanceInner(InnerNode* parent, const std::size_t index) noexcept {
+	auto* node {static_cast<InnerNode*>(parent->children[index])};
+	
+	if (index > 0) {
+		auto* leftNode {static_cast<InnerNode*>(parent->children[index - 1])};
+		
+		if (leftNode->count > MINIMUM_INNER_COUNT) {
+			std::move_backward(node->keys.begin(),
+			                   node->keys.begin() + node->count,
+			                   node->keys.begin() + node->count + 1);
+			std::copy_backward(node->children.begin(),
+			                   node->children.begin() + node->count + 1,
+			                   node->children.begin() + node->count + 2);
+			node->keys[0] = std::move(parent->keys[index - 1]);
+			node->children[0] = leftNode->children[leftNode->count];
+			++node->count;
+			--leftNode->count;
+			parent->keys[index - 1] = std::move(leftNode->keys[leftNode->count]);
+			return;
+		}
+	}
+	
+	if (index < parent->count) {
+		auto* rightNode {static_cast<InnerNode*>(parent->children[index + 1])};
+		
+		if (rightNode->count > MINIMUM_INNER_COUNT) {
+			node->keys[node->count] = std::move(parent->keys[index]);
+			node->children[node->count + 1] = rightNode->children[0];
+			++node->count;
+			parent->keys[index] = std::move(rightNode->keys[0]);
+			std::move(rightNode->keys.begin() + 1, rightNode->keys.begin() + rightNode->count, rightNode->keys.begin());
+			std::copy(rightNode->children.begin() + 1,
+			          rightNode->children.begin() + rightNode->count + 1,
+			          rightNode->children.begin());
+			--rightNode->count;
+			return;
+		}
+	}
+	
+	const auto leftIndex {index > 0 ? index - 1 : index};
+	auto* leftNode {static_cast<InnerNode*>(parent->children[leftIndex])};
+	auto* rightNode {static_cast<InnerNode*>(parent->children[leftIndex + 1])};
+	
+	leftNode->keys[leftNode->count] = std::move(parent->keys[leftIndex]);
+	std::move(rightNode->keys.begin(),
+	          rightNode->keys.begin() + rightNode->count,
+	          leftNode->keys.begin() + leftNode->count + 1);
+	std::copy(rightNode->children.begin(),
+	          rightNode->children.begin() + rightNode->count + 1,
+	          leftNode->children.begin() + leftNode->count + 1);
+	leftNode->count += rightNode->count + 1;
+	
+	delete rightNode;
+	--innerCount;
+	removeFromInner(parent, leftIndex);
+}
+
+template<ElementTypeWithLessThanOperator KeyType, std::semiregular ValueType, std::size_t NodeBytes>
+requires std::semiregular<KeyType> && (NodeBytes >= 64)
+void BTree<KeyType, ValueType, NodeBytes>::removeFromInner(InnerNode* node, const std::size_t index) noexcept {
+	std::move(node->keys.begin() + index + 1, node->keys.begin() + node->count, node->keys.begin() + index);
+	std::copy(node->children.begin() + index + 2,
+	          node->children.begin() + node->count + 1,
+	          node->children.begin() + index + 1);
+	--node->count;
+}
+
+template<ElementTypeWithLessThanOperator KeyType, std::semiregular ValueType, std::size_t NodeBytes>
+requires std::semiregular<KeyType> && (NodeBytes >= 64)
+template<typename Iterator, typename Sentinel>
+void BTree<KeyType, ValueType, NodeBytes>::bulkLoad(Iterator iterator, Sentinel sentinel) {
+	std::vector<BTreeNode*> nodes {};
+	std::vector<KeyType> minimumKeys {};
+	
+	try {
+		for (; iterator != sentinel; ++iterator) {
+			const auto& [key, value] {*iterator};
+			
+			if (lastLeaf != nullptr && !(lastLeaf->keys[lastLeaf->count - 1] < key)) {
+				throw std::invalid_argument {"The keys must be sorted in strictly ascending order."};
+			}
+			
+			if (lastLeaf == nullptr || lastLeaf->count == LEAF_CAPACITY) {
+				auto* leaf {new LeafNode {}};
+				leaf->previous = lastLeaf;
+				if (lastLeaf != nullptr) {
+					lastLeaf->next = leaf;
+				} else {
+					firstLeaf = leaf;
+				}
+				
+				lastLeaf = leaf;
+				++leafCount;
+				nodes.push_back(leaf);
+				minimumKeys.push_back(key);
+			}
+			
+			lastLeaf->keys[lastLeaf->count] = key;
+			lastLeaf->values[lastLeaf->count] = value;
+			++lastLeaf->count;
+			++size;
+		}
+	} catch (...) {
+		for (auto* leaf {firstLeaf}; leaf != nullptr;) {
+			delete std::exchange(leaf, leaf->next);
+		}
+		
+		firstLeaf = nullptr;
+		lastLeaf = nullptr;
+		size = 0;
+		leafCount = 0;
+		throw;
+	}
+	
+	if (nodes.empty()) {
+		return;
+	}
+	
+	if (nodes.size() > 1 && lastLeaf->count < MINIMUM_LEAF_COUNT) {
+		auto* previousLeaf {lastLeaf->previous};
+		const auto movedCount {(previousLeaf->count + lastLeaf->count) / 2 - lastLeaf->count};
+		
+		std::move_backward(lastLeaf->keys.begin(),
+		                   lastLeaf->keys.begin() + lastLeaf->count,
+		                   lastLeaf->keys.begin() + lastLeaf->count + movedCount);
+		std::move_backward(lastLeaf->values.begin(),
+		                   lastLeaf->values.begin() + lastLeaf->count,
+		                   lastLeaf->values.begin() + lastLeaf->count + movedCount);
+		std::move(previousLeaf->keys.begin() + previousLeaf->count - movedCount,
+		          previousLeaf->keys.begin() + previousLeaf->count,
+		          lastLeaf->keys.begin());
+		std::move(previousLeaf->values.begin() + previousLeaf->count - movedCount,
+		          previousLeaf->values.begin() + previousLeaf->count,
+		          lastLeaf->values.begin());
+		previousLeaf->count -= movedCount;
+		lastLeaf->count += movedCount;
+		minimumKeys.back() = lastLeaf->keys[0];
+	}
+	
+	levelCount = 1;
+	while (nodes.size() > 1) {
+		const auto parentCount {(nodes.size() + INNER_CAPACITY) / (INNER_CAPACITY + 1)};
+		std::vector<BTreeNode*> parentNodes {};
+		std::vector<KeyType> parentMinimumKeys {};
+		parentNodes.reserve(parentCount);
+		parentMinimumKeys.reserve(parentCount);
+		
+		std::size_t offset {0};
+		for (std::size_t parentIndex {0}; parentIndex < parentCount; ++parentIndex) {
+			const auto childCount {nodes.size() / parentCount + (parentIndex < nodes.size() % parentCount ? 1 : 0)};
+			auto* parent {new InnerNode {}};
+			++innerCount;
+			
+			for (std::size_t childIndex {0}; childIndex < childCount; ++childIndex) {
+				parent->children[childIndex] = nodes[offset + childIndex];
+				if (childIndex > 0) {
+					parent->keys[childIndex - 1] = minimumKeys[offset + childIndex];
+				}
+			}
+			
+			parent->count = static_cast<std::uint32_t>(childCount - 1);
+			parentNodes.push_back(parent);
+			parentMinimumKeys.push_back(minimumKeys[offset]);
+			offset += childCount;
+		}
+		
+		nodes = std::move(parentNodes);
+		minimumKeys = std::move(parentMinimumKeys);
+		++levelCount;
+	}
+	
+	rootNode = nodes.front();
+}
+
+template<ElementTypeWithLessThanOperator KeyType, std::semiregular ValueType, std::size_t NodeBytes>
+requires std::semiregular<KeyType> && (NodeBytes >= 64)
+const BTree<KeyType, ValueType, NodeBytes>::LeafNode* BTree<KeyType, ValueType, NodeBytes>::findLeaf(const KeyType& key) const noexcept {
+	const auto* node {rootNode};
+	for (auto level {levelCount}; level > 1; --level) {
+		const auto* inner {static_cast<const InnerNode*>(node)};
+		node = inner->children[getChildIndex(inner, key)];
+	}
+	
+	return static_cast<const LeafNode*>(node);
+}
+
+template<ElementTypeWithLessThanOperator KeyType, std::semiregular ValueType, std::size_t NodeBytes>
+requires std::semiregular<KeyType> && (NodeBytes >= 64)
+std::size_t BTree<KeyType, ValueType, NodeBytes>::getLowerBoundIndex(const std::array<KeyType, LEAF_CAPACITY>& keys,
+                                                                     const std::size_t count,
+                                                                     const KeyType& key) noexcept {
+	return static_cast<std::size_t>(std::lower_bound(keys.begin(), keys.begin() + count, key) - keys.begin());
+}
+
+template<ElementTypeWithLessThanOperator KeyType, std::semiregular ValueType, std::size_t NodeBytes>
+requires std::semiregular<KeyType> && (NodeBytes >= 64)
+std::size_t BTree<KeyType, ValueType, NodeBytes>::getChildIndex(const InnerNode* node, const KeyType& key) noexcept {
+	const auto keys {node->keys.begin()};
+	return static_cast<std::size_t>(std::upper_bound(keys, keys + node->count, key) - keys);
+}
+
+template<ElementTypeWithLessThanOperator KeyType, std::semiregular ValueType, std::size_t NodeBytes>
+requires std::semiregular<KeyType> && (NodeBytes >= 64)
+void BTree<KeyType, ValueType, NodeBytes>::deleteSubtree(BTreeNode* node) noexcept {
+	if (node->isLeaf) {
+		delete static_cast<LeafNode*>(node);
+		return;
+	}
+	
+	auto* inner {static_cast<InnerNode*>(node)};
+	for (std::size_t index {0}; index <= inner->count; ++index) {
+		deleteSubtree(inner->children[index]);
+	}
+	
+	delete inner;
+}
+
+template<ElementTypeWithLessThanOperator KeyType, std::semiregular ValueType, std::size_t NodeBytes>
+requires std::semiregular<KeyType> && (NodeBytes >= 64)
+void BTree<KeyType, ValueType, NodeBytes>::clear() noexcept {
+	if (rootNode != nullptr) {
+		deleteSubtree(rootNode);
+	}
+	
+	rootNode = nullptr;
+	firstLeaf = nullptr;
+	lastLeaf = nullptr;
+	size = 0;
+	levelCount = 0;
+	leafCount = 0;
+	innerCount = 0;
+}
+}
\ No newline at end of file
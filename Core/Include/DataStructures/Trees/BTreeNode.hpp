@@ -0,0 +1,97 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace Core::DataStructures::Trees {
+/**
+ * @brief The header shared by the inner and leaf nodes of a B+ tree.
+ * @struct BTreeNode
+ */
+struct BTreeNode {
+	/**
+	 * @brief Instantiates a new B+ tree node with no keys.
+	 * @param isLeaf: True if the node is a leaf node, false if it is an inner node.
+	 */
+	explicit BTreeNode(const bool isLeaf) noexcept : isLeaf {isLeaf} {
+		
+	}
+	
+	/**
+	 * @brief The number of keys stored in the node.
+	 */
+	std::uint32_t count {0};
+	
+	/**
+	 * @brief True if the node is a leaf node, false if it is an inner node.
+	 */
+	bool isLeaf;
+};
+
+/**
+ * @brief An inner node of a B+ tree.
+ * @details The keys of the child at index i + 1 do not come before the key at index i, and the keys of the child at
+ * index i come before it, so a node with n keys routes to n + 1 children.
+ * @struct BTreeInnerNode
+ * @tparam KeyType: The type of the keys.
+ * @tparam Capacity: The maximum number of keys in the node.
+ */
+template<typename KeyType, std::size_t Capacity>
+struct BTreeInnerNode final : BTreeNode {
+	/**
+	 * @brief Instantiates a new B+ tree inner node with no keys.
+	 */
+	BTreeInnerNode() : BTreeNode {false} {
+		
+	}
+	
+	/**
+	 * @brief The separator keys of the node, of which only the first count are used.
+	 */
+	std::array<KeyType, Capacity> keys {};
+	
+	/**
+	 * @brief The children of the node, of which only the first count + 1 are used.
+	 */
+	std::array<BTreeNode*, Capacity + 1> children {};
+};
+
+/**
+ * @brief A leaf node of a B+ tree, linked to the leaves before and after it in key order.
+ * @details The keys and values are stored in separate arrays so a search within the leaf only reads keys.
+ * @struct BTreeLeafNode
+ * @tparam KeyType: The type of the keys.
+ * @tparam ValueType: The type of the values.
+ * @tparam Capacity: The maximum number of key-value pairs in the node.
+ */
+template<typename KeyType, typename ValueType, std::size_t Capacity>
+struct BTreeLeafNode final : BTreeNode {
+	/**
+	 * @brief Instantiates a new B+ tree leaf node with no keys.
+	 */
+	BTreeLeafNode() : BTreeNode {true} {
+		
+	}
+	
+	/**
+	 * @brief The keys of the node in ascending order, of which only the first count are used.
+	 */
+	std::array<KeyType, Capacity> keys {};
+	
+	/**
+	 * @brief The values of the node, each stored at the index of its key.
+	 */
+	std::array<ValueType, Capacity> values {};
+	
+	/**
+	 * @brief The leaf before this leaf in key order, or nullptr if this is the first leaf.
+	 */
+	BTreeLeafNode* previous {nullptr};
+	
+	/**
+	 * @brief The leaf after this leaf in key order, or nullptr if this is the last leaf.
+	 */
+	BTreeLeafNode* next {nullptr};
+};
+}
\ No newline at end of file
@@ -2,9 +2,9 @@
 
 #include <functional>
 #include <optional>
+#include <utility>
 #include <vector>
 
-#include "DataStructures/Trees/BinaryTreeNode.hpp"
 #include "DataStructures/Trees/Iterators/BinaryTreeConstInOrderIterator.hpp"
 #include "DataStructures/Trees/Iterators/BinaryTreeConstLevelOrderIterator.hpp"
 #include "DataStructures/Trees/Iterators/BinaryTreeConstPostOrderIterator.hpp"
@@ -14,11 +14,16 @@
 #include "DataStructures/Trees/Iterators/BinaryTreeLevelOrderIterator.hpp"
 #include "DataStructures/Trees/Iterators/BinaryTreePostOrderIterator.hpp"
 #include "DataStructures/Trees/Iterators/BinaryTreePreOrderIterator.hpp"
+#include "DataStructures/Trees/Iterators/ParentLinkedBinaryTreeConstInOrderIterator.hpp"
+#include "DataStructures/Trees/Iterators/ParentLinkedBinaryTreeInOrderIterator.hpp"
+#include "DataStructures/Trees/ParentLinkedBinaryTreeNode.hpp"
 #include "BinarySearchTreeConcepts.hpp"
 
 namespace Core::DataStructures::Trees {
 /**
  * @brief A binary search tree.
+ * @details The nodes link to their parents, so in-order iterators are a single node pointer that stays valid while
+ * other elements are inserted or removed.
  * @class BinarySearchTree
  * @tparam ElementType: The type of the elements stored in the binary search tree.
  */
@@ -32,6 +37,7 @@ public:
 	
 	/**
 	 * @brief Instantiates a new binary search tree by copying the given binary search tree.
+	 * @details The nodes are cloned directly, so the copy has the same shape as the original and takes O(n) time.
 	 * @param other: The binary search tree to copy.
 	 */
 	BinarySearchTree(const BinarySearchTree<ElementType>& other);
@@ -73,14 +79,14 @@ public:
 
 public:
 	using value_type = ElementType;
-	using ConstInOrderIterator = Iterators::BinaryTreeConstInOrderIterator<ElementType>;
-	using ConstLevelOrderIterator = Iterators::BinaryTreeConstLevelOrderIterator<ElementType>;
-	using ConstPostOrderIterator = Iterators::BinaryTreeConstPostOrderIterator<ElementType>;
-	using ConstPreOrderIterator = Iterators::BinaryTreeConstPreOrderIterator<ElementType>;
-	using InOrderIterator = Iterators::BinaryTreeInOrderIterator<ElementType>;
-	using LevelOrderIterator = Iterators::BinaryTreeLevelOrderIterator<ElementType>;
-	using PostOrderIterator = Iterators::BinaryTreePostOrderIterator<ElementType>;
-	using PreOrderIterator = Iterators::BinaryTreePreOrderIterator<ElementType>;
+	using ConstInOrderIterator = Iterators::ParentLinkedBinaryTreeConstInOrderIterator<ElementType>;
+	using ConstLevelOrderIterator = Iterators::BinaryTreeConstLevelOrderIterator<ElementType, ParentLinkedBinaryTreeNode<ElementType>>;
+	using ConstPostOrderIterator = Iterators::BinaryTreeConstPostOrderIterator<ElementType, ParentLinkedBinaryTreeNode<ElementType>>;
+	using ConstPreOrderIterator = Iterators::BinaryTreeConstPreOrderIterator<ElementType, ParentLinkedBinaryTreeNode<ElementType>>;
+	using InOrderIterator = Iterators::ParentLinkedBinaryTreeInOrderIterator<ElementType>;
+	using LevelOrderIterator = Iterators::BinaryTreeLevelOrderIterator<ElementType, ParentLinkedBinaryTreeNode<ElementType>>;
+	using PostOrderIterator = Iterators::BinaryTreePostOrderIterator<ElementType, ParentLinkedBinaryTreeNode<ElementType>>;
+	using PreOrderIterator = Iterators::BinaryTreePreOrderIterator<ElementType, ParentLinkedBinaryTreeNode<ElementType>>;
 	
 	/**
 	 * @brief Gets a const in-order iterator to the first node in the binary search tree.
@@ -238,6 +244,75 @@ public:
 	 */
 	std::optional<ElementType> findMaximum() const noexcept;
 	
+	/**
+	 * @brief Finds the element at the given position in ascending order in O(log n) time for a balanced tree.
+	 * @details Each node knows the size of its subtree, so the search descends into the subtree that holds the position
+	 * instead of visiting the elements before it.
+	 * @param index: The zero-based position of the element, such that 0 selects the minimum element.
+	 * @return The element at the given position, or std::nullopt if the position is not less than the number of nodes.
+	 */
+	std::optional<ElementType> select(std::size_t index) const noexcept;
+	
+	/**
+	 * @brief Counts the elements in the binary search tree that are less than the given element in O(log n) time for a
+	 * balanced tree.
+	 * @param element: The element to rank.
+	 * @return The number of elements less than the given element, which is the position select returns it from if it is
+	 * in the binary search tree.
+	 */
+	std::size_t rank(const ElementType& element) const noexcept;
+	
+	/**
+	 * @brief Counts the elements in the binary search tree that are neither less than the given lower bound nor greater
+	 * than the given upper bound in O(log n) time for a balanced tree.
+	 * @param lowerBound: The smallest element to count.
+	 * @param upperBound: The largest element to count.
+	 * @return The number of elements in the closed range, or 0 if the upper bound is less than the lower bound.
+	 */
+	std::size_t countInRange(const ElementType& lowerBound, const ElementType& upperBound) const noexcept;
+	
+	/**
+	 * @brief Finds the first element in the binary search tree that is not less than the given element in O(log n)
+	 * time for a balanced tree.
+	 * @details Iterating from the lower bound of one element to the lower bound of another visits the half-open range
+	 * between them without visiting any element before it.
+	 * @param element: The element to search for.
+	 * @return A const in-order iterator to the first element not less than the given element, or the end iterator if
+	 * every element is less than it.
+	 */
+	ConstInOrderIterator lowerBound(const ElementType& element) const noexcept;
+	
+	/**
+	 * @brief Finds the first element in the binary search tree that is greater than the given element in O(log n)
+	 * time for a balanced tree.
+	 * @param element: The element to search for.
+	 * @return A const in-order iterator to the first element greater than the given element, or the end iterator if no
+	 * element is greater than it.
+	 */
+	ConstInOrderIterator upperBound(const ElementType& element) const noexcept;
+	
+	/**
+	 * @brief Finds the range of elements in the binary search tree that are equivalent to the given element.
+	 * @param element: The element to search for.
+	 * @return A pair of the lower bound and the upper bound of the given element, which are equal if the binary search
+	 * tree does not contain it.
+	 */
+	std::pair<ConstInOrderIterator, ConstInOrderIterator> equalRange(const ElementType& element) const noexcept;
+	
+	/**
+	 * @brief Applies the given function to every element that is neither less than the lower bound nor greater than the
+	 * upper bound, in ascending order.
+	 * @details The search descends to the lower bound and then follows the in-order successors until the upper bound is
+	 * passed, so subtrees outside the range are never entered and a call takes O(log n + k) time for k elements in the
+	 * range of a balanced tree.
+	 * @param lowerBound: The smallest element of the range.
+	 * @param upperBound: The largest element of the range.
+	 * @param function: The function to apply to each element in the range.
+	 */
+	void forEachInRange(const ElementType& lowerBound,
+	                    const ElementType& upperBound,
+	                    const std::function<void(const ElementType&)>& function) const;
+	
 	/**
 	 * @brief Traverses the binary search tree using the given function on each node in the binary search tree.
 	 * @tparam ConstIteratorType The type of const iterator to use to traverse the binary search tree.
@@ -246,7 +321,7 @@ public:
 	 * @param function The function to use to traverse the binary search tree.
 	 */
 	template<typename ConstIteratorType>
-	requires Iterators::AllowedConstIterator<ConstIteratorType, ElementType>
+	requires Iterators::AllowedConstIterator<ConstIteratorType, ElementType, ParentLinkedBinaryTreeNode<ElementType>>
 	void traverse(ConstIteratorType begin,
 	              ConstIteratorType end,
 	              const std::function<void(const ElementType&)>& function) const noexcept;
@@ -259,7 +334,7 @@ public:
 	 * @param function The function to use to traverse the binary search tree.
 	 */
 	template<typename IteratorType>
-	requires Iterators::AllowedIterator<IteratorType, ElementType>
+	requires Iterators::AllowedIterator<IteratorType, ElementType, ParentLinkedBinaryTreeNode<ElementType>>
 	void traverse(IteratorType begin, IteratorType end, const std::function<void(ElementType&)>& function) noexcept;
 	
 	/**
@@ -292,7 +367,7 @@ private:
 	 * @brief Inserts the given node into the binary search tree.
 	 * @param node: The node to insert.
 	 */
-	void insert(BinaryTreeNode<ElementType>* node);
+	void insert(ParentLinkedBinaryTreeNode<ElementType>* node);
 	
 	/**
 	 * @brief Removes the given leaf node from the binary search tree.
@@ -301,8 +376,8 @@ private:
 	 * @param parentNode: The parent node of the leaf node to remove.
 	 * @param isLeftChild: True if the leaf node to remove is a left child, false otherwise.
 	 */
-	void removeLeafNode(BinaryTreeNode<ElementType>* currentNode,
-	                    BinaryTreeNode<ElementType>* parentNode,
+	void removeLeafNode(ParentLinkedBinaryTreeNode<ElementType>* currentNode,
+	                    ParentLinkedBinaryTreeNode<ElementType>* parentNode,
 	                    const bool isLeftChild);
 	
 	/**
@@ -312,8 +387,8 @@ private:
 	 * @param parentNode: The parent node of the node to remove.
 	 * @param isLeftChild: True if the node to remove is a left child, false otherwise.
 	 */
-	void removeNodeWithOnlyLeftChild(BinaryTreeNode<ElementType>* currentNode,
-	                                 BinaryTreeNode<ElementType>* parentNode,
+	void removeNodeWithOnlyLeftChild(ParentLinkedBinaryTreeNode<ElementType>* currentNode,
+	                                 ParentLinkedBinaryTreeNode<ElementType>* parentNode,
 	                                 const bool isLeftChild);
 	/**
 	 * @brief Removes the given node from the binary search tree that has only a right child.
@@ -322,8 +397,8 @@ private:
 	 * @param parentNode: The parent node of the node to remove.
 	 * @param isLeftChild: True if the node to remove is a left child, false otherwise.
 	 */
-	void removeNodeWithOnlyRightChild(BinaryTreeNode<ElementType>* currentNode,
-	                                  BinaryTreeNode<ElementType>* parentNode,
+	void removeNodeWithOnlyRightChild(ParentLinkedBinaryTreeNode<ElementType>* currentNode,
+	                                  ParentLinkedBinaryTreeNode<ElementType>* parentNode,
 	                                  const bool isLeftChild);
 	
 	
@@ -333,32 +408,81 @@ private:
 	 * @param currentNode: The node to remove.
 	 * @param parentNode: The parent node of the node to remove.
 	 */
-	void removeNodeWithTwoChildren(BinaryTreeNode<ElementType>* currentNode, BinaryTreeNode<ElementType>* parentNode);
+	void removeNodeWithTwoChildren(ParentLinkedBinaryTreeNode<ElementType>* currentNode,
+	                               ParentLinkedBinaryTreeNode<ElementType>* parentNode);
 	
 	/**
-	 * @brief Removes all nodes from the binary search tree.
-	 * @param node: The node to remove.
+	 * @brief Removes all nodes of the subtree rooted at the given node in post-order, following the parent links
+	 * instead of recursing, so that degenerate binary search trees do not overflow the stack.
+	 * @param node: The root of the subtree to remove, whose parent must be nullptr.
 	 * @param elements: The vector to store the elements of the nodes that were removed.
 	 */
-	void removeAll(BinaryTreeNode<ElementType>* node, std::vector<ElementType>& elements);
+	void removeAll(ParentLinkedBinaryTreeNode<ElementType>* node, std::vector<ElementType>& elements);
+	
+	/**
+	 * @brief Clones the subtree rooted at the given node, including the cached heights and subtree sizes.
+	 * @details Both subtrees are walked in lockstep through their parent links instead of recursing.
+	 * @param node: The root of the subtree to clone, which may be nullptr.
+	 * @return The root of the cloned subtree, or nullptr if the given subtree is empty.
+	 */
+	static ParentLinkedBinaryTreeNode<ElementType>* copySubtree(const ParentLinkedBinaryTreeNode<ElementType>* node);
+	
+	/**
+	 * @brief Gets the node with the minimum element in the subtree rooted at the given node.
+	 * @param node: The root of the subtree.
+	 * @return The node with the minimum element, or nullptr if the subtree is empty.
+	 */
+	static ParentLinkedBinaryTreeNode<ElementType>* getMinimumNode(
+			ParentLinkedBinaryTreeNode<ElementType>* node) noexcept;
+	
+	/**
+	 * @brief Gets the first node in post-order of the subtree rooted at the given node, which is the leaf reached by
+	 * always descending to the left child if there is one and to the right child otherwise.
+	 * @param node: The root of the subtree, which may be nullptr.
+	 * @return The first node in post-order, or nullptr if the subtree is empty.
+	 */
+	static ParentLinkedBinaryTreeNode<ElementType>* getFirstPostOrderNode(
+			ParentLinkedBinaryTreeNode<ElementType>* node) noexcept;
+	
+	/**
+	 * @brief Updates the cached subtree size and height of the given node and of each of its ancestors.
+	 * @param node: The lowest node whose subtree changed, or nullptr if the root node was removed.
+	 */
+	static void updateAncestors(ParentLinkedBinaryTreeNode<ElementType>* node) noexcept;
 	
 	/**
-	 * @brief Gets the height of the given node.
-	 * @param node: The node to get the height of.
-	 * @return The height of the given node.
+	 * @brief Counts the elements that come before the given element, or that are not greater than it if inclusive.
+	 * @param element: The element to count up to.
+	 * @param isInclusive: True to also count the elements equivalent to the given element, false otherwise.
+	 * @return The number of elements before the given element.
 	 */
-	int getHeight(BinaryTreeNode<ElementType>* node) const noexcept;
+	std::size_t countPreceding(const ElementType& element, const bool isInclusive) const noexcept;
+	
+	/**
+	 * @brief Finds the first node whose element is not less than the given element, or greater than it if upper.
+	 * @param element: The element to search for.
+	 * @param isUpper: True to skip the elements equivalent to the given element, false otherwise.
+	 * @return The first node after the elements that precede the bound, or nullptr if there is no such node.
+	 */
+	const ParentLinkedBinaryTreeNode<ElementType>* findBound(const ElementType& element,
+	                                                         const bool isUpper) const noexcept;
+	
+	/**
+	 * @brief Gets the number of nodes in the subtree rooted at the given node.
+	 * @param node: The root of the subtree, which may be nullptr.
+	 * @return The number of nodes in the subtree, or 0 if the subtree is empty.
+	 */
+	static std::size_t getSubtreeSize(const ParentLinkedBinaryTreeNode<ElementType>* node) noexcept;
 
 private:
 	std::size_t nodeCount {0};
-	BinaryTreeNode<ElementType>* rootNode {nullptr};
+	ParentLinkedBinaryTreeNode<ElementType>* rootNode {nullptr};
 };
 
 template<ElementTypeWithLessThanOperator ElementType>
-BinarySearchTree<ElementType>::BinarySearchTree(const BinarySearchTree<ElementType>& other) {
-	for (auto iterator {other.cbeginInOrder()}; iterator != other.cendInOrder(); ++iterator) {
-		insert(*iterator);
-	}
+BinarySearchTree<ElementType>::BinarySearchTree(const BinarySearchTree<ElementType>& other) :
+		nodeCount {other.nodeCount}, rootNode {copySubtree(other.rootNode)} {
+	
 }
 
 template<ElementTypeWithLessThanOperator ElementType>
@@ -385,9 +509,8 @@ BinarySearchTree<ElementType>& BinarySearchTree<ElementType>::operator=(const Bi
 	
 	removeAll();
 	
-	for (auto iterator {other.cbeginInOrder()}; iterator != other.cendInOrder(); ++iterator) {
-		insert(*iterator);
-	}
+	rootNode = copySubtree(other.rootNode);
+	nodeCount = other.nodeCount;
 	
 	return *this;
 }
@@ -420,7 +543,7 @@ bool BinarySearchTree<ElementType>::operator==(const BinarySearchTree<ElementTyp
 
 template<ElementTypeWithLessThanOperator ElementType>
 BinarySearchTree<ElementType>::ConstInOrderIterator BinarySearchTree<ElementType>::cbeginInOrder() const noexcept {
-	return ConstInOrderIterator {rootNode};
+	return ConstInOrderIterator {getMinimumNode(rootNode)};
 }
 
 template<ElementTypeWithLessThanOperator ElementType>
@@ -460,7 +583,7 @@ BinarySearchTree<ElementType>::ConstPreOrderIterator BinarySearchTree<ElementTyp
 
 template<ElementTypeWithLessThanOperator ElementType>
 BinarySearchTree<ElementType>::InOrderIterator BinarySearchTree<ElementType>::beginInOrder() const noexcept {
-	return InOrderIterator {rootNode};
+	return InOrderIterator {getMinimumNode(rootNode)};
 }
 
 template<ElementTypeWithLessThanOperator ElementType>
@@ -500,13 +623,13 @@ BinarySearchTree<ElementType>::PreOrderIterator BinarySearchTree<ElementType>::e
 
 template<ElementTypeWithLessThanOperator ElementType>
 void BinarySearchTree<ElementType>::insert(const ElementType& element) {
-	auto* node {new BinaryTreeNode<ElementType> {element}};
+	auto* node {new ParentLinkedBinaryTreeNode<ElementType> {element}};
 	insert(node);
 }
 
 template<ElementTypeWithLessThanOperator ElementType>
 void BinarySearchTree<ElementType>::insert(ElementType&& element) {
-	auto* node {new BinaryTreeNode<ElementType> {std::move(element)}};
+	auto* node {new ParentLinkedBinaryTreeNode<ElementType> {std::move(element)}};
 	insert(node);
 }
 
@@ -516,8 +639,8 @@ std::optional<ElementType> BinarySearchTree<ElementType>::removeFirst(const Elem
 		return std::nullopt;
 	}
 	
-	BinaryTreeNode<ElementType>* currentNode {rootNode};
-	BinaryTreeNode<ElementType>* parentNode {nullptr};
+	ParentLinkedBinaryTreeNode<ElementType>* currentNode {rootNode};
+	ParentLinkedBinaryTreeNode<ElementType>* parentNode {nullptr};
 	auto isLeftChild {false};
 	
 	while (currentNode != nullptr && currentNode->getElement() != element) {
@@ -558,8 +681,8 @@ std::optional<ElementType> BinarySearchTree<ElementType>::removeMinimum() {
 		return std::nullopt;
 	}
 	
-	BinaryTreeNode<ElementType>* currentNode {rootNode};
-	BinaryTreeNode<ElementType>* parentNode {nullptr};
+	ParentLinkedBinaryTreeNode<ElementType>* currentNode {rootNode};
+	ParentLinkedBinaryTreeNode<ElementType>* parentNode {nullptr};
 	
 	while (currentNode->getLeftChild() != nullptr) {
 		parentNode = currentNode;
@@ -583,8 +706,8 @@ std::optional<ElementType> BinarySearchTree<ElementType>::removeMaximum() {
 		return std::nullopt;
 	}
 	
-	BinaryTreeNode<ElementType>* currentNode {rootNode};
-	BinaryTreeNode<ElementType>* parentNode {nullptr};
+	ParentLinkedBinaryTreeNode<ElementType>* currentNode {rootNode};
+	ParentLinkedBinaryTreeNode<ElementType>* parentNode {nullptr};
 	
 	while (currentNode->getRightChild() != nullptr) {
 		parentNode = currentNode;
@@ -667,9 +790,75 @@ std::optional<ElementType> BinarySearchTree<ElementType>::findMaximum() const no
 	return currentNode->getElement();
 }
 
+template<ElementTypeWithLessThanOperator ElementType>
+std::optional<ElementType> BinarySearchTree<ElementType>::select(std::size_t index) const noexcept {
+	if (index >= nodeCount) {
+		return std::nullopt;
+	}
+	
+	const auto* currentNode {rootNode};
+	
+	while (true) {
+		const auto leftSubtreeSize {getSubtreeSize(currentNode->getLeftChild())};
+		
+		if (index < leftSubtreeSize) {
+			currentNode = currentNode->getLeftChild();
+		} else if (index == leftSubtreeSize) {
+			return currentNode->getElement();
+		} else {
+			index -= leftSubtreeSize + 1;
+			currentNode = currentNode->getRightChild();
+		}
+	}
+}
+
+template<ElementTypeWithLessThanOperator ElementType>
+std::size_t BinarySearchTree<ElementType>::rank(const ElementType& element) const noexcept {
+	return countPreceding(element, false);
+}
+
+template<ElementTypeWithLessThanOperator ElementType>
+std::size_t BinarySearchTree<ElementType>::countInRange(const ElementType& lowerBound,
+                                                        const ElementType& upperBound) const noexcept {
+	if (upperBound < lowerBound) {
+		return 0;
+	}
+	
+	return countPreceding(upperBound, true) - countPreceding(lowerBound, false);
+}
+
+template<ElementTypeWithLessThanOperator ElementType>
+BinarySearchTree<ElementType>::ConstInOrderIterator BinarySearchTree<ElementType>::lowerBound(const ElementType& element) const noexcept {
+	return ConstInOrderIterator {findBound(element, false)};
+}
+
+template<ElementTypeWithLessThanOperator ElementType>
+BinarySearchTree<ElementType>::ConstInOrderIterator BinarySearchTree<ElementType>::upperBound(const ElementType& element) const noexcept {
+	return ConstInOrderIterator {findBound(element, true)};
+}
+
+template<ElementTypeWithLessThanOperator ElementType>
+std::pair<typename BinarySearchTree<ElementType>::ConstInOrderIterator, typename BinarySearchTree<ElementType>::ConstInOrderIterator>
+BinarySearchTree<ElementType>::equalRange(const ElementType& element) const noexcept {
+	return {lowerBound(element), upperBound(element)};
+}
+
+template<ElementTypeWithLessThanOperator ElementType>
+void BinarySearchTree<ElementType>::forEachInRange(const ElementType& lowerBound,
+                                                   const ElementType& upperBound,
+                                                   const std::function<void(const ElementType&)>& function) const {
+	for (auto iterator {this->lowerBound(lowerBound)}; iterator != cendInOrder(); ++iterator) {
+		if (upperBound < *iterator) {
+			return;
+		}
+		
+		function(*iterator);
+	}
+}
+
 template<ElementTypeWithLessThanOperator ElementType>
 template<typename ConstIteratorType>
-requires Iterators::AllowedConstIterator<ConstIteratorType, ElementType>
+requires Iterators::AllowedConstIterator<ConstIteratorType, ElementType, ParentLinkedBinaryTreeNode<ElementType>>
 void BinarySearchTree<ElementType>::traverse(ConstIteratorType begin,
                                              ConstIteratorType end,
                                              const std::function<void(const ElementType&)>& function) const noexcept {
@@ -678,7 +867,7 @@ void BinarySearchTree<ElementType>::traverse(ConstIteratorType begin,
 
 template<ElementTypeWithLessThanOperator ElementType>
 template<typename IteratorType>
-requires Iterators::AllowedIterator<IteratorType, ElementType>
+requires Iterators::AllowedIterator<IteratorType, ElementType, ParentLinkedBinaryTreeNode<ElementType>>
 void BinarySearchTree<ElementType>::traverse(IteratorType begin,
                                              IteratorType end,
                                              const std::function<void(ElementType&)>& function) noexcept {
@@ -702,11 +891,11 @@ std::size_t BinarySearchTree<ElementType>::getNodeCount() const noexcept {
 
 template<ElementTypeWithLessThanOperator ElementType>
 int BinarySearchTree<ElementType>::getHeight() const noexcept {
-	return getHeight(rootNode);
+	return rootNode == nullptr ? -1 : rootNode->getHeight();
 }
 
 template<ElementTypeWithLessThanOperator ElementType>
-void BinarySearchTree<ElementType>::insert(BinaryTreeNode<ElementType>* node) {
+void BinarySearchTree<ElementType>::insert(ParentLinkedBinaryTreeNode<ElementType>* node) {
 	if (rootNode == nullptr) {
 		rootNode = node;
 		++nodeCount;
@@ -714,8 +903,8 @@ void BinarySearchTree<ElementType>::insert(BinaryTreeNode<ElementType>* node) {
 	}
 	
 	const auto& nodeElement {node->getElement()};
-	BinaryTreeNode<ElementType>* currentNode {rootNode};
-	BinaryTreeNode<ElementType>* parentNode {nullptr};
+	ParentLinkedBinaryTreeNode<ElementType>* currentNode {rootNode};
+	ParentLinkedBinaryTreeNode<ElementType>* parentNode {nullptr};
 	
 	while (currentNode != nullptr) {
 		parentNode = currentNode;
@@ -734,12 +923,13 @@ void BinarySearchTree<ElementType>::insert(BinaryTreeNode<ElementType>* node) {
 		parentNode->setRightChild(node);
 	}
 	
+	updateAncestors(parentNode);
 	++nodeCount;
 }
 
 template<ElementTypeWithLessThanOperator ElementType>
-void BinarySearchTree<ElementType>::removeLeafNode(BinaryTreeNode<ElementType>* currentNode,
-                                                   BinaryTreeNode<ElementType>* parentNode,
+void BinarySearchTree<ElementType>::removeLeafNode(ParentLinkedBinaryTreeNode<ElementType>* currentNode,
+                                                   ParentLinkedBinaryTreeNode<ElementType>* parentNode,
                                                    const bool isLeftChild) {
 	if (parentNode == nullptr) {
 		rootNode = nullptr;
@@ -749,105 +939,211 @@ void BinarySearchTree<ElementType>::removeLeafNode(BinaryTreeNode<ElementType>*
 		parentNode->setRightChild(nullptr);
 	}
 	
+	updateAncestors(parentNode);
 	--nodeCount;
 	
 	delete currentNode;
 }
 
 template<ElementTypeWithLessThanOperator ElementType>
-void BinarySearchTree<ElementType>::removeNodeWithOnlyLeftChild(BinaryTreeNode<ElementType>* currentNode,
-                                                                BinaryTreeNode<ElementType>* parentNode,
+void BinarySearchTree<ElementType>::removeNodeWithOnlyLeftChild(ParentLinkedBinaryTreeNode<ElementType>* currentNode,
+                                                                ParentLinkedBinaryTreeNode<ElementType>* parentNode,
                                                                 const bool isLeftChild) {
 	if (parentNode == nullptr) {
 		rootNode = currentNode->getLeftChild();
+		rootNode->setParent(nullptr);
 	} else if (isLeftChild) {
 		parentNode->setLeftChild(currentNode->getLeftChild());
 	} else {
 		parentNode->setRightChild(currentNode->getLeftChild());
 	}
 	
+	updateAncestors(parentNode);
 	--nodeCount;
 	
 	delete currentNode;
 }
 
 template<ElementTypeWithLessThanOperator ElementType>
-void BinarySearchTree<ElementType>::removeNodeWithOnlyRightChild(BinaryTreeNode<ElementType>* currentNode,
-                                                                 BinaryTreeNode<ElementType>* parentNode,
+void BinarySearchTree<ElementType>::removeNodeWithOnlyRightChild(ParentLinkedBinaryTreeNode<ElementType>* currentNode,
+                                                                 ParentLinkedBinaryTreeNode<ElementType>* parentNode,
                                                                  const bool isLeftChild) {
 	if (parentNode == nullptr) {
 		rootNode = currentNode->getRightChild();
+		rootNode->setParent(nullptr);
 	} else if (isLeftChild) {
 		parentNode->setLeftChild(currentNode->getRightChild());
 	} else {
 		parentNode->setRightChild(currentNode->getRightChild());
 	}
 	
+	updateAncestors(parentNode);
 	--nodeCount;
 	
 	delete currentNode;
 }
 
 template<ElementTypeWithLessThanOperator ElementType>
-void BinarySearchTree<ElementType>::removeNodeWithTwoChildren(BinaryTreeNode<ElementType>* currentNode,
-                                                              BinaryTreeNode<ElementType>* parentNode) {
-	BinaryTreeNode<ElementType>* successorNode {currentNode->getRightChild()};
-	BinaryTreeNode<ElementType>* successorParentNode {currentNode};
-	
-	const auto isLeftChild {successorNode->getLeftChild() != nullptr};
+void BinarySearchTree<ElementType>::removeNodeWithTwoChildren(ParentLinkedBinaryTreeNode<ElementType>* currentNode,
+                                                              ParentLinkedBinaryTreeNode<ElementType>* parentNode) {
+	auto* successorNode {getMinimumNode(currentNode->getRightChild())};
+	auto* lowestChangedNode {successorNode};
 	
-	while (successorNode->getLeftChild() != nullptr) {
-		successorParentNode = successorNode;
-		successorNode = successorNode->getLeftChild();
+	if (auto* successorParentNode {successorNode->getParent()}; successorParentNode != currentNode) {
+		successorParentNode->setLeftChild(successorNode->getRightChild());
+		successorNode->setRightChild(currentNode->getRightChild());
+		lowestChangedNode = successorParentNode;
 	}
 	
-	auto* node {new BinaryTreeNode<ElementType> {successorNode->getElement()}};
-	
-	if (currentNode == rootNode) {
-		rootNode = node;
-	} else if (currentNode->getElement() < parentNode->getElement()) {
-		parentNode->setLeftChild(node);
-	} else {
-		parentNode->setRightChild(node);
-	}
+	successorNode->setLeftChild(currentNode->getLeftChild());
 	
-	if (isLeftChild) {
-		successorParentNode->setLeftChild(successorNode->getRightChild());
+	if (parentNode == nullptr) {
+		rootNode = successorNode;
+		rootNode->setParent(nullptr);
+	} else if (parentNode->getLeftChild() == currentNode) {
+		parentNode->setLeftChild(successorNode);
 	} else {
-		successorParentNode->setRightChild(successorNode->getRightChild());
+		parentNode->setRightChild(successorNode);
 	}
 	
-	node->setLeftChild(currentNode->getLeftChild());
-	node->setRightChild(currentNode->getRightChild());
-	
+	updateAncestors(lowestChangedNode);
 	--nodeCount;
 	
 	delete currentNode;
 }
 
 template<ElementTypeWithLessThanOperator ElementType>
-void BinarySearchTree<ElementType>::removeAll(BinaryTreeNode<ElementType>* node, std::vector<ElementType>& elements) {
+void BinarySearchTree<ElementType>::removeAll(ParentLinkedBinaryTreeNode<ElementType>* node,
+                                              std::vector<ElementType>& elements) {
+	node = getFirstPostOrderNode(node);
+	
+	while (node != nullptr) {
+		auto* parentNode {node->getParent()};
+		const auto isLeftChild {parentNode != nullptr && parentNode->getLeftChild() == node};
+		
+		elements.emplace_back(std::move(node->getElement()));
+		delete node;
+		
+		if (isLeftChild && parentNode->getRightChild() != nullptr) {
+			node = getFirstPostOrderNode(parentNode->getRightChild());
+		} else {
+			node = parentNode;
+		}
+	}
+}
+
+template<ElementTypeWithLessThanOperator ElementType>
+ParentLinkedBinaryTreeNode<ElementType>* BinarySearchTree<ElementType>::copySubtree(
+		const ParentLinkedBinaryTreeNode<ElementType>* node) {
 	if (node == nullptr) {
-		return;
+		return nullptr;
 	}
 	
-	removeAll(node->getLeftChild(), elements);
-	removeAll(node->getRightChild(), elements);
+	auto* copiedRootNode {new ParentLinkedBinaryTreeNode<ElementType> {node->getElement()}};
+	const auto* currentNode {node};
+	auto* copiedNode {copiedRootNode};
+	
+	while (true) {
+		const auto* leftChild {currentNode->getLeftChild()};
+		const auto* rightChild {currentNode->getRightChild()};
+		
+		if (leftChild != nullptr && copiedNode->getLeftChild() == nullptr) {
+			copiedNode->setLeftChild(new ParentLinkedBinaryTreeNode<ElementType> {leftChild->getElement()});
+			currentNode = leftChild;
+			copiedNode = copiedNode->getLeftChild();
+		} else if (rightChild != nullptr && copiedNode->getRightChild() == nullptr) {
+			copiedNode->setRightChild(new ParentLinkedBinaryTreeNode<ElementType> {rightChild->getElement()});
+			currentNode = rightChild;
+			copiedNode = copiedNode->getRightChild();
+		} else {
+			copiedNode->update();
+			if (currentNode == node) {
+				return copiedRootNode;
+			}
+			
+			currentNode = currentNode->getParent();
+			copiedNode = copiedNode->getParent();
+		}
+	}
+}
+
+template<ElementTypeWithLessThanOperator ElementType>
+ParentLinkedBinaryTreeNode<ElementType>* BinarySearchTree<ElementType>::getMinimumNode(
+		ParentLinkedBinaryTreeNode<ElementType>* node) noexcept {
+	if (node == nullptr) {
+		return nullptr;
+	}
 	
-	elements.emplace_back(node->getElement());
+	while (node->getLeftChild() != nullptr) {
+		node = node->getLeftChild();
+	}
 	
-	delete node;
+	return node;
 }
 
 template<ElementTypeWithLessThanOperator ElementType>
-int BinarySearchTree<ElementType>::getHeight(BinaryTreeNode<ElementType>* node) const noexcept {
+ParentLinkedBinaryTreeNode<ElementType>* BinarySearchTree<ElementType>::getFirstPostOrderNode(
+		ParentLinkedBinaryTreeNode<ElementType>* node) noexcept {
 	if (node == nullptr) {
-		return -1;
+		return nullptr;
+	}
+	
+	while (node->getLeftChild() != nullptr || node->getRightChild() != nullptr) {
+		node = node->getLeftChild() != nullptr ? node->getLeftChild() : node->getRightChild();
+	}
+	
+	return node;
+}
+
+template<ElementTypeWithLessThanOperator ElementType>
+void BinarySearchTree<ElementType>::updateAncestors(ParentLinkedBinaryTreeNode<ElementType>* node) noexcept {
+	while (node != nullptr) {
+		node->update();
+		node = node->getParent();
+	}
+}
+
+template<ElementTypeWithLessThanOperator ElementType>
+std::size_t BinarySearchTree<ElementType>::countPreceding(const ElementType& element, const bool isInclusive) const noexcept {
+	std::size_t count {0};
+	const auto* currentNode {rootNode};
+	
+	while (currentNode != nullptr) {
+		const auto& currentNodeElement {currentNode->getElement()};
+		
+		if (isInclusive ? element < currentNodeElement : !(currentNodeElement < element)) {
+			currentNode = currentNode->getLeftChild();
+		} else {
+			count += getSubtreeSize(currentNode->getLeftChild()) + 1;
+			currentNode = currentNode->getRightChild();
+		}
 	}
 	
-	const auto leftSubtreeHeight {getHeight(node->getLeftChild())};
-	const auto rightSubtreeHeight {getHeight(node->getRightChild())};
+	return count;
+}
+
+template<ElementTypeWithLessThanOperator ElementType>
+const ParentLinkedBinaryTreeNode<ElementType>* BinarySearchTree<ElementType>::findBound(const ElementType& element,
+                                                                                        const bool isUpper) const noexcept {
+	const ParentLinkedBinaryTreeNode<ElementType>* boundNode {nullptr};
+	const auto* currentNode {rootNode};
+	
+	while (currentNode != nullptr) {
+		const auto& currentNodeElement {currentNode->getElement()};
+		
+		if (isUpper ? element < currentNodeElement : !(currentNodeElement < element)) {
+			boundNode = currentNode;
+			currentNode = currentNode->getLeftChild();
+		} else {
+			currentNode = currentNode->getRightChild();
+		}
+	}
 	
-	return std::max(leftSubtreeHeight, rightSubtreeHeight) + 1;
+	return boundNode;
+}
+
+template<ElementTypeWithLessThanOperator ElementType>
+std::size_t BinarySearchTree<ElementType>::getSubtreeSize(const ParentLinkedBinaryTreeNode<ElementType>* node) noexcept {
+	return node == nullptr ? 0 : node->getSubtreeSize();
 }
 }
\ No newline at end of file
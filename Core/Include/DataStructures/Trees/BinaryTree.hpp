@@ -1,10 +1,12 @@
 #pragma once
 
+#include <algorithm>
+#include <bit>
 #include <functional>
 #include <optional>
+#include <utility>
 #include <vector>
 
-#include "DataStructures/Queues/SinglyLinkedListQueue.hpp"
 #include "DataStructures/Trees/BinaryTreeNode.hpp"
 #include "DataStructures/Trees/Iterators/BinaryTreeConstInOrderIterator.hpp"
 #include "DataStructures/Trees/Iterators/BinaryTreeConstLevelOrderIterator.hpp"
@@ -19,6 +21,12 @@
 namespace Core::DataStructures::Trees {
 /**
  * @brief A binary tree.
+ * @details Since the elements are inserted in level-order, the binary tree is always complete, so its nodes are stored
+ * contiguously in level-order and the children of the node at index i are at indices 2i + 1 and 2i + 2. The nodes keep
+ * their child links up to date for the iterators, which are relinked whenever the storage is reallocated. Unlike
+ * separately allocated nodes, the nodes move when the storage is reallocated, so any insertion may invalidate every
+ * iterator, pointer and reference into the binary tree, and any removal invalidates those to the removed node and to
+ * the last node in level-order.
  * @class BinaryTree
  * @tparam ElementType: The type of the elements in the binary tree.
  */
@@ -32,6 +40,7 @@ public:
 	
 	/**
 	 * @brief Instantiates a new binary tree by copying another binary tree.
+	 * @details The nodes are cloned directly, so the copy has the same shape as the original and takes O(n) time.
 	 * @param other: The binary tree to copy.
 	 */
 	BinaryTree(const BinaryTree<ElementType>& other);
@@ -45,7 +54,7 @@ public:
 	/**
 	 * @brief Destroys the binary tree.
 	 */
-	~BinaryTree() noexcept;
+	~BinaryTree() noexcept = default;
 
 public:
 	/**
@@ -180,22 +189,25 @@ public:
 public:
 	/**
 	 * @brief Inserts an element into the binary tree using copy semantics.
-	 * @details The elements are inserted in level-order.
+	 * @details The elements are inserted in level-order. If the storage is reallocated, every iterator, pointer and
+	 * reference into the binary tree is invalidated.
 	 * @param element: The element to insert.
 	 */
 	void insert(const ElementType& element);
 	
 	/**
 	 * @brief Inserts an element into the binary tree using move semantics.
-	 * @details The elements are inserted in level-order.
+	 * @details The elements are inserted in level-order. If the storage is reallocated, every iterator, pointer and
+	 * reference into the binary tree is invalidated.
 	 * @param element: The element to insert.
 	 */
 	void insert(ElementType&& element);
 	
 	/**
 	 * @brief Removes the first element in the binary tree that satisfies a predicate.
-	 * @details The elements are traversed in level-order and the removed element is replaced by the deepest node in the
-	 * binary tree.
+	 * @details The elements are traversed in level-order and the removed element is replaced by the element of the
+	 * deepest node in the binary tree, which is the last node in level-order and is removed instead. Iterators,
+	 * pointers and references to the removed node and to the last node in level-order are invalidated.
 	 * @param predicate: The predicate to satisfy.
 	 * @return The removed element if it exists, std::nullopt otherwise.
 	 */
@@ -281,111 +293,47 @@ public:
 	
 	/**
 	 * @brief Gets the height of the binary tree.
-	 * @details Since this binary tree implementation uses level-order insertion, the height of the binary tree can be
-	 * calculated by starting at the root and traversing the leftmost path until a leaf node is reached.
+	 * @details Since this binary tree implementation uses level-order insertion, the height of the binary tree is the
+	 * floor of the binary logarithm of its number of nodes.
 	 * @return The height of the binary tree.
 	 */
 	int getHeight() const noexcept;
 
 private:
 	/**
-	 * @brief Inserts a node into the binary tree in level-order.
-	 * @param node: The node to insert.
+	 * @brief Gets the root node, through which the iterators reach every other node by its child links.
+	 * @return The root node, or nullptr if the binary tree is empty.
 	 */
-	void insertLevelOrder(BinaryTreeNode<ElementType>* node);
+	BinaryTreeNode<ElementType>* getRootNode() const noexcept;
 	
 	/**
-	 * @brief Removes the given leaf node from the binary tree and replaces it with the deepest node in the binary tree.
-	 * @note This method frees the memory of the target node.
-	 * @param targetNode The leaf node to remove.
-	 * @param parentOfTargetNode The parent of the leaf node to remove.
-	 * @param deepestNode The deepest node in the binary tree.
-	 * @param parentOfDeepestNode The parent of the deepest node in the binary tree.
-	 * @param isLastNodeLeftChild True if the deepest node is the left child of its parent, false otherwise.
+	 * @brief Links the last node into its parent, or relinks every node if appending it reallocated the storage.
+	 * @param previousCapacity: The capacity of the storage before the last node was appended.
 	 */
-	void removeLeafNode(BinaryTreeNode<ElementType>* targetNode,
-	                    BinaryTreeNode<ElementType>* parentOfTargetNode,
-	                    BinaryTreeNode<ElementType>* deepestNode,
-	                    BinaryTreeNode<ElementType>* parentOfDeepestNode,
-	                    bool isLastNodeLeftChild);
+	void linkLastNode(const std::size_t previousCapacity) noexcept;
 	
 	/**
-	 * @brief Removes the given node that has only a left child from the binary tree and replaces it with the deepest
-	 * node in the binary tree.
-	 * @note This method frees the memory of the target node.
-	 * @param targetNode The node to remove.
-	 * @param parentOfTargetNode The parent of the node to remove.
-	 * @param deepestNode The deepest node in the binary tree.
-	 * @param parentOfDeepestNode The parent of the deepest node in the binary tree.
+	 * @brief Links every node to the nodes at the indices of its children.
 	 */
-	void removeNodeWithOnlyLeftChild(BinaryTreeNode<ElementType>* targetNode,
-	                                 BinaryTreeNode<ElementType>* parentOfTargetNode,
-	                                 BinaryTreeNode<ElementType>* deepestNode,
-	                                 BinaryTreeNode<ElementType>* parentOfDeepestNode);
+	void linkNodes() noexcept;
 	
 	/**
-	 * @brief Removes the given node that has only a right child from the binary tree and replaces it with the deepest
-	 * node in the binary tree.
-	 * @note This method frees the memory of the target node.
-	 * @param targetNode The node to remove.
-	 * @param parentOfTargetNode The parent of the node to remove.
-	 * @param deepestNode The deepest node in the binary tree.
-	 * @param parentOfDeepestNode The parent of the deepest node in the binary tree.
+	 * @brief Unlinks the last node from its parent and removes it.
 	 */
-	void removeNodeWithOnlyRightChild(BinaryTreeNode<ElementType>* targetNode,
-	                                  BinaryTreeNode<ElementType>* parentOfTargetNode,
-	                                  BinaryTreeNode<ElementType>* deepestNode,
-	                                  BinaryTreeNode<ElementType>* parentOfDeepestNode);
-	
-	/**
-	 * @brief Removes the given node that has two children from the binary tree and replaces it with the deepest node in
-	 * the binary tree.
-	 * @note This method frees the memory of the target node.
-	 * @param targetNode The node to remove.
-	 * @param parentOfTargetNode The parent of the node to remove.
-	 * @param deepestNode The deepest node in the binary tree.
-	 * @param parentOfDeepestNode The parent of the deepest node in the binary tree.
-	 * @param isLastNodeLeftChild True if the deepest node is the left child of its parent, false otherwise.
-	 */
-	void removeNodeWithTwoChildren(BinaryTreeNode<ElementType>* targetNode,
-	                               BinaryTreeNode<ElementType>* parentOfTargetNode,
-	                               BinaryTreeNode<ElementType>* deepestNode,
-	                               BinaryTreeNode<ElementType>* parentOfDeepestNode,
-	                               bool isLastNodeLeftChild);
-	
-	/**
-	 * @brief Removes all nodes in the binary tree in post-order.
-	 * @param node: The node to start removing from.
-	 * @param elements: The vector to store the removed elements in.
-	 */
-	void removeAll(BinaryTreeNode<ElementType>* node, std::vector<ElementType>& elements);
+	void removeLastNode() noexcept;
 
 private:
-	std::size_t nodeCount {0};
-	BinaryTreeNode<ElementType>* rootNode {nullptr};
+	std::vector<BinaryTreeNode<ElementType>> nodes {};
 };
 
 template<typename ElementType>
-BinaryTree<ElementType>::BinaryTree(const BinaryTree<ElementType>& other) {
-	for (auto iterator {other.cbeginLevelOrder()}; iterator != other.cendLevelOrder(); ++iterator) {
-		insert(*iterator);
-	}
+BinaryTree<ElementType>::BinaryTree(const BinaryTree<ElementType>& other) : nodes {other.nodes} {
+	linkNodes();
 }
 
 template<typename ElementType>
-BinaryTree<ElementType>::BinaryTree(BinaryTree<ElementType>&& other) noexcept {
-	removeAll();
-	
-	nodeCount = other.nodeCount;
-	rootNode = other.rootNode;
+BinaryTree<ElementType>::BinaryTree(BinaryTree<ElementType>&& other) noexcept : nodes {std::exchange(other.nodes, {})} {
 	
-	other.nodeCount = 0;
-	other.rootNode = nullptr;
-}
-
-template<typename ElementType>
-BinaryTree<ElementType>::~BinaryTree() noexcept {
-	removeAll();
 }
 
 template<typename ElementType>
@@ -394,11 +342,8 @@ BinaryTree<ElementType>& BinaryTree<ElementType>::operator=(const BinaryTree<Ele
 		return *this;
 	}
 	
-	removeAll();
-	
-	for (const auto& element : other) {
-		insert(element);
-	}
+	nodes = other.nodes;
+	linkNodes();
 	
 	return *this;
 }
@@ -409,29 +354,21 @@ BinaryTree<ElementType>& BinaryTree<ElementType>::operator=(BinaryTree<ElementTy
 		return *this;
 	}
 	
-	removeAll();
-	
-	nodeCount = other.nodeCount;
-	rootNode = other.rootNode;
-	
-	other.nodeCount = 0;
-	other.rootNode = nullptr;
+	nodes = std::exchange(other.nodes, {});
 	
 	return *this;
 }
 
 template<typename ElementType>
 bool BinaryTree<ElementType>::operator==(const BinaryTree<ElementType>& other) const noexcept {
-	if (nodeCount != other.nodeCount) {
-		return false;
-	}
-	
-	return std::equal(cbeginLevelOrder(), cendLevelOrder(), other.cbeginLevelOrder(), other.cendLevelOrder());
+	return std::ranges::equal(nodes, other.nodes, [](const auto& node, const auto& otherNode) {
+		return node.getElement() == otherNode.getElement();
+	});
 }
 
 template<typename ElementType>
 BinaryTree<ElementType>::ConstInOrderIterator BinaryTree<ElementType>::cbeginInOrder() const noexcept {
-	return ConstInOrderIterator(rootNode);
+	return ConstInOrderIterator(getRootNode());
 }
 
 template<typename ElementType>
@@ -441,7 +378,7 @@ BinaryTree<ElementType>::ConstInOrderIterator BinaryTree<ElementType>::cendInOrd
 
 template<typename ElementType>
 BinaryTree<ElementType>::ConstLevelOrderIterator BinaryTree<ElementType>::cbeginLevelOrder() const noexcept {
-	return ConstLevelOrderIterator(rootNode);
+	return ConstLevelOrderIterator(getRootNode());
 }
 
 template<typename ElementType>
@@ -451,7 +388,7 @@ BinaryTree<ElementType>::ConstLevelOrderIterator BinaryTree<ElementType>::cendLe
 
 template<typename ElementType>
 BinaryTree<ElementType>::ConstPostOrderIterator BinaryTree<ElementType>::cbeginPostOrder() const noexcept {
-	return ConstPostOrderIterator(rootNode);
+	return ConstPostOrderIterator(getRootNode());
 }
 
 template<typename ElementType>
@@ -461,7 +398,7 @@ BinaryTree<ElementType>::ConstPostOrderIterator BinaryTree<ElementType>::cendPos
 
 template<typename ElementType>
 BinaryTree<ElementType>::ConstPreOrderIterator BinaryTree<ElementType>::cbeginPreOrder() const noexcept {
-	return ConstPreOrderIterator(rootNode);
+	return ConstPreOrderIterator(getRootNode());
 }
 
 template<typename ElementType>
@@ -471,7 +408,7 @@ BinaryTree<ElementType>::ConstPreOrderIterator BinaryTree<ElementType>::cendPreO
 
 template<typename ElementType>
 BinaryTree<ElementType>::InOrderIterator BinaryTree<ElementType>::beginInOrder() const noexcept {
-	return InOrderIterator(rootNode);
+	return InOrderIterator(getRootNode());
 }
 
 template<typename ElementType>
@@ -481,7 +418,7 @@ BinaryTree<ElementType>::InOrderIterator BinaryTree<ElementType>::endInOrder() c
 
 template<typename ElementType>
 BinaryTree<ElementType>::LevelOrderIterator BinaryTree<ElementType>::beginLevelOrder() const noexcept {
-	return LevelOrderIterator(rootNode);
+	return LevelOrderIterator(getRootNode());
 }
 
 template<typename ElementType>
@@ -491,7 +428,7 @@ BinaryTree<ElementType>::LevelOrderIterator BinaryTree<ElementType>::endLevelOrd
 
 template<typename ElementType>
 BinaryTree<ElementType>::PostOrderIterator BinaryTree<ElementType>::beginPostOrder() const noexcept {
-	return PostOrderIterator(rootNode);
+	return PostOrderIterator(getRootNode());
 }
 
 template<typename ElementType>
@@ -501,7 +438,7 @@ BinaryTree<ElementType>::PostOrderIterator BinaryTree<ElementType>::endPostOrder
 
 template<typename ElementType>
 BinaryTree<ElementType>::PreOrderIterator BinaryTree<ElementType>::beginPreOrder() const noexcept {
-	return PreOrderIterator(rootNode);
+	return PreOrderIterator(getRootNode());
 }
 
 template<typename ElementType>
@@ -511,81 +448,35 @@ BinaryTree<ElementType>::PreOrderIterator BinaryTree<ElementType>::endPreOrder()
 
 template<typename ElementType>
 void BinaryTree<ElementType>::insert(const ElementType& element) {
-	auto* node {new BinaryTreeNode<ElementType>(element)};
-	insertLevelOrder(node);
+	const auto previousCapacity {nodes.capacity()};
+	nodes.emplace_back(element);
+	linkLastNode(previousCapacity);
 }
 
 template<typename ElementType>
 void BinaryTree<ElementType>::insert(ElementType&& element) {
-	auto* node {new BinaryTreeNode<ElementType>(std::move(element))};
-	insertLevelOrder(node);
+	const auto previousCapacity {nodes.capacity()};
+	nodes.emplace_back(std::move(element));
+	linkLastNode(previousCapacity);
 }
 
 template<typename ElementType>
 std::optional<ElementType> BinaryTree<ElementType>::removeFirst(const std::function<bool(const ElementType&)>& predicate) {
-	if (rootNode == nullptr) {
+	const auto targetNode {std::ranges::find_if(nodes, [&predicate](const auto& node) {
+		return predicate(node.getElement());
+	})};
+	
+	if (targetNode == nodes.end()) {
 		return std::nullopt;
 	}
 	
-	Queues::SinglyLinkedListQueue<BinaryTreeNode<ElementType>*> nodeQueue {};
-	nodeQueue.enqueue(rootNode);
-	
-	BinaryTreeNode<ElementType>* parentOfCurrentNode {nullptr};
-	BinaryTreeNode<ElementType>* targetNode {nullptr};
-	BinaryTreeNode<ElementType>* parentOfTargetNode {nullptr};
-	BinaryTreeNode<ElementType>* deepestNode {nullptr};
-	BinaryTreeNode<ElementType>* parentOfDeepestNode {nullptr};
-	auto isLastNodeLeftChild {false};
-	
-	while (!nodeQueue.isEmpty()) {
-		auto optionalNode {nodeQueue.dequeue()};
-		if (!optionalNode.has_value()) {
-			continue;
-		}
-		
-		auto* currentNode = optionalNode.value();
-		
-		if (predicate(currentNode->getElement())) {
-			targetNode = currentNode;
-			parentOfTargetNode = parentOfCurrentNode;
-		}
-		
-		if (auto leftChild {currentNode->getLeftChild()}; leftChild != nullptr) {
-			nodeQueue.enqueue(leftChild);
-			deepestNode = currentNode->getLeftChild();
-			parentOfDeepestNode = currentNode;
-			isLastNodeLeftChild = true;
-		}
-		
-		if (auto rightChild {currentNode->getRightChild()}; rightChild != nullptr) {
-			nodeQueue.enqueue(rightChild);
-			deepestNode = currentNode->getRightChild();
-			parentOfDeepestNode = currentNode;
-			isLastNodeLeftChild = false;
-		}
-		
-		parentOfCurrentNode = currentNode;
-	}
+	std::optional<ElementType> removedElement {std::move(targetNode->getElement())};
 	
-	if (targetNode == nullptr) {
-		return std::nullopt;
+	if (auto& deepestNode {nodes.back()}; &*targetNode != &deepestNode) {
+		targetNode->getElement() = std::move(deepestNode.getElement());
 	}
 	
-	const auto removedElement {targetNode->getElement()};
-	
-	if (targetNode->getLeftChild() == nullptr && targetNode->getRightChild() == nullptr) {
-		removeLeafNode(targetNode, parentOfTargetNode, deepestNode, parentOfDeepestNode, isLastNodeLeftChild);
-	} else if (targetNode->getRightChild() == nullptr) {
-		removeNodeWithOnlyLeftChild(targetNode, parentOfTargetNode, deepestNode, parentOfDeepestNode);
-	} else if (targetNode->getLeftChild() == nullptr) {
-		removeNodeWithOnlyRightChild(targetNode, parentOfTargetNode, deepestNode, parentOfDeepestNode);
-	} else {
-		removeNodeWithTwoChildren(targetNode,
-		                          parentOfTargetNode,
-		                          deepestNode,
-		                          parentOfDeepestNode,
-		                          isLastNodeLeftChild);
-	}
+	removeLastNode();
 	
 	return removedElement;
 }
@@ -593,9 +484,13 @@ std::optional<ElementType> BinaryTree<ElementType>::removeFirst(const std::funct
 template<typename ElementType>
 std::vector<ElementType> BinaryTree<ElementType>::removeAll() {
 	std::vector<ElementType> elements {};
-	removeAll(rootNode, elements);
-	rootNode = nullptr;
-	nodeCount = 0;
+	elements.reserve(nodes.size());
+	
+	for (auto iterator {beginPostOrder()}; iterator != endPostOrder(); ++iterator) {
+		elements.emplace_back(std::move(*iterator));
+	}
+	
+	nodes = std::vector<BinaryTreeNode<ElementType>> {};
 	
 	return elements;
 }
@@ -638,179 +533,66 @@ void BinaryTree<ElementType>::traverse(IteratorType begin,
 
 template<typename ElementType>
 bool BinaryTree<ElementType>::contains(const std::function<bool(const ElementType&)>& predicate) const noexcept {
-	return std::any_of(cbeginLevelOrder(), cendLevelOrder(), predicate);
+	return std::ranges::any_of(nodes, [&predicate](const auto& node) {
+		return predicate(node.getElement());
+	});
 }
 
 template<typename ElementType>
 bool BinaryTree<ElementType>::isEmpty() const noexcept {
-	return rootNode == nullptr && nodeCount == 0;
+	return nodes.empty();
 }
 
 template<typename ElementType>
 std::size_t BinaryTree<ElementType>::getNodeCount() const noexcept {
-	return nodeCount;
+	return nodes.size();
 }
 
 template<typename ElementType>
 int BinaryTree<ElementType>::getHeight() const noexcept {
-	auto height {-1};
-	
-	if (rootNode == nullptr) {
-		return height;
-	}
-	
-	auto* currentNode {rootNode};
-	while (currentNode != nullptr) {
-		++height;
-		currentNode = currentNode->getLeftChild();
-	}
-	
-	return height;
+	return static_cast<int>(std::bit_width(nodes.size())) - 1;
 }
 
 template<typename ElementType>
-void BinaryTree<ElementType>::insertLevelOrder(BinaryTreeNode<ElementType>* node) {
-	if (rootNode == nullptr) {
-		rootNode = node;
-		++nodeCount;
-		return;
-	}
-	
-	Queues::SinglyLinkedListQueue<BinaryTreeNode<ElementType>*> nodeQueue {};
-	nodeQueue.enqueue(rootNode);
-	
-	while (!nodeQueue.isEmpty()) {
-		const auto currentLevelNodeCount {nodeQueue.getSize()};
-		
-		for (std::size_t index {0}; index < currentLevelNodeCount; ++index) {
-			auto optionalNode {nodeQueue.dequeue()};
-			if (!optionalNode.has_value()) {
-				continue;
-			}
-			
-			auto* currentNode {optionalNode.value()};
-			
-			if (currentNode->getLeftChild() == nullptr) {
-				currentNode->setLeftChild(node);
-				++nodeCount;
-				return;
-			} else {
-				nodeQueue.enqueue(currentNode->getLeftChild());
-			}
-			
-			if (currentNode->getRightChild() == nullptr) {
-				currentNode->setRightChild(node);
-				++nodeCount;
-				return;
-			} else {
-				nodeQueue.enqueue(currentNode->getRightChild());
-			}
-		}
-	}
-}
-
-template<typename ElementType>
-void BinaryTree<ElementType>::removeLeafNode(BinaryTreeNode<ElementType>* targetNode,
-                                             BinaryTreeNode<ElementType>* parentOfTargetNode,
-                                             BinaryTreeNode<ElementType>* deepestNode,
-                                             BinaryTreeNode<ElementType>* parentOfDeepestNode,
-                                             bool isLastNodeLeftChild) {
-	if (targetNode == rootNode) {
-		rootNode = nullptr;
-	} else if (targetNode == deepestNode) {
-		if (isLastNodeLeftChild) {
-			parentOfDeepestNode->setLeftChild(nullptr);
-		} else {
-			parentOfDeepestNode->setRightChild(nullptr);
-		}
-	} else {
-		if (parentOfTargetNode->getLeftChild() == targetNode) {
-			parentOfTargetNode->setLeftChild(deepestNode);
-		} else {
-			parentOfTargetNode->setRightChild(deepestNode);
-		}
-	}
-	
-	--nodeCount;
-	
-	delete targetNode;
+BinaryTreeNode<ElementType>* BinaryTree<ElementType>::getRootNode() const noexcept {
+	return nodes.empty() ? nullptr : const_cast<BinaryTreeNode<ElementType>*>(nodes.data());
 }
 
 template<typename ElementType>
-void BinaryTree<ElementType>::removeNodeWithOnlyLeftChild(BinaryTreeNode<ElementType>* targetNode,
-                                                          BinaryTreeNode<ElementType>* parentOfTargetNode,
-                                                          BinaryTreeNode<ElementType>* deepestNode,
-                                                          BinaryTreeNode<ElementType>* parentOfDeepestNode) {
-	if (targetNode == deepestNode) {
-		parentOfDeepestNode->setLeftChild(nullptr);
-	} else if (targetNode == rootNode) {
-		rootNode = targetNode->getLeftChild();
-	} else {
-		parentOfTargetNode->setLeftChild(deepestNode);
+void BinaryTree<ElementType>::linkLastNode(const std::size_t previousCapacity) noexcept {
+	if (nodes.capacity() != previousCapacity) {
+		linkNodes();
+		return;
 	}
 	
-	--nodeCount;
-	
-	delete targetNode;
-}
-
-template<typename ElementType>
-void BinaryTree<ElementType>::removeNodeWithOnlyRightChild(BinaryTreeNode<ElementType>* targetNode,
-                                                           BinaryTreeNode<ElementType>* parentOfTargetNode,
-                                                           BinaryTreeNode<ElementType>* deepestNode,
-                                                           BinaryTreeNode<ElementType>* parentOfDeepestNode) {
-	if (targetNode == deepestNode) {
-		parentOfDeepestNode->setRightChild(nullptr);
-	} else if (targetNode == rootNode) {
-		rootNode = targetNode->getRightChild();
-	} else {
-		parentOfTargetNode->setRightChild(deepestNode);
+	if (const auto index {nodes.size() - 1}; index % 2 == 1) {
+		nodes[(index - 1) / 2].setLeftChild(&nodes[index]);
+	} else if (index > 0) {
+		nodes[(index - 1) / 2].setRightChild(&nodes[index]);
 	}
-	
-	--nodeCount;
-	
-	delete targetNode;
 }
 
 template<typename ElementType>
-void BinaryTree<ElementType>::removeNodeWithTwoChildren(BinaryTreeNode<ElementType>* targetNode,
-                                                        BinaryTreeNode<ElementType>* parentOfTargetNode,
-                                                        BinaryTreeNode<ElementType>* deepestNode,
-                                                        BinaryTreeNode<ElementType>* parentOfDeepestNode,
-                                                        bool isLastNodeLeftChild) {
-	if (isLastNodeLeftChild) {
-		parentOfDeepestNode->setLeftChild(nullptr);
-	} else {
-		parentOfDeepestNode->setRightChild(nullptr);
-	}
+void BinaryTree<ElementType>::linkNodes() noexcept {
+	const auto nodeCount {nodes.size()};
 	
-	deepestNode->setLeftChild(targetNode->getLeftChild());
-	deepestNode->setRightChild(targetNode->getRightChild());
-	
-	if (targetNode == rootNode) {
-		rootNode = deepestNode;
-	} else if (parentOfTargetNode->getLeftChild() == targetNode) {
-		parentOfTargetNode->setLeftChild(deepestNode);
-	} else {
-		parentOfTargetNode->setRightChild(deepestNode);
+	for (std::size_t index {0}; index < nodeCount; ++index) {
+		const auto leftChildIndex {2 * index + 1};
+		const auto rightChildIndex {2 * index + 2};
+		
+		nodes[index].setLeftChild(leftChildIndex < nodeCount ? &nodes[leftChildIndex] : nullptr);
+		nodes[index].setRightChild(rightChildIndex < nodeCount ? &nodes[rightChildIndex] : nullptr);
 	}
-	
-	--nodeCount;
-	
-	delete targetNode;
 }
 
 template<typename ElementType>
-void BinaryTree<ElementType>::removeAll(BinaryTreeNode<ElementType>* node, std::vector<ElementType>& elements) {
-	if (node == nullptr) {
-		return;
+void BinaryTree<ElementType>::removeLastNode() noexcept {
+	if (const auto index {nodes.size() - 1}; index % 2 == 1) {
+		nodes[(index - 1) / 2].setLeftChild(nullptr);
+	} else if (index > 0) {
+		nodes[(index - 1) / 2].setRightChild(nullptr);
 	}
 	
-	removeAll(node->getLeftChild(), elements);
-	removeAll(node->getRightChild(), elements);
-	
-	elements.emplace_back(node->getElement());
-	
-	delete node;
+	nodes.pop_back();
 }
 }
\ No newline at end of file
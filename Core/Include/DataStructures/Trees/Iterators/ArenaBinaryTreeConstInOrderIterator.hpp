@@ -0,0 +1,166 @@
+#pragma once
+
+#include <cassert>
+#include <cstdint>
+#include <iterator>
+
+#include "DataStructures/Trees/Iterators/BinaryTreeIteratorStack.hpp"
+
+namespace Core::DataStructures::Trees::Iterators {
+/**
+ * @brief A const in-order iterator for binary trees whose nodes are stored in an arena and refer to their children by
+ * index.
+ * @details The iterator resolves child indices against the first node of the arena, so it is invalidated by any
+ * insertion that reallocates the arena, just like an iterator into a std::vector.
+ * @class ArenaBinaryTreeConstInOrderIterator
+ * @tparam ElementType: The type of the elements stored in the binary tree.
+ * @tparam NodeType: The type of the nodes of the binary tree, which must define NULL_INDEX for a missing child.
+ */
+template<typename ElementType, typename NodeType>
+class ArenaBinaryTreeConstInOrderIterator final {
+public:
+	using iterator_category = std::forward_iterator_tag;
+	using difference_type = std::ptrdiff_t;
+	using value_type = ElementType;
+	using reference = const ElementType&;
+	using pointer = const ElementType*;
+	
+	/**
+	 * @brief Instantiates a new const in-order iterator for arena binary trees.
+	 * @param nodes: The first node of the arena, which may be nullptr if the arena is empty.
+	 * @param nodeIndex: The index of the node to iterate from, or NULL_INDEX for an iterator past the last node.
+	 */
+	ArenaBinaryTreeConstInOrderIterator(const NodeType* nodes, std::uint32_t nodeIndex) noexcept;
+	
+	/**
+	 * @brief Instantiates a new const in-order iterator for arena binary trees by copying the given const in-order
+	 * iterator for arena binary trees.
+	 * @param other The const in-order iterator for arena binary trees to copy.
+	 */
+	ArenaBinaryTreeConstInOrderIterator(const ArenaBinaryTreeConstInOrderIterator<ElementType, NodeType>& other) = default;
+	
+	/**
+	 * @brief Instantiates a new const in-order iterator for arena binary trees by moving the given const in-order
+	 * iterator for arena binary trees.
+	 * @param other The const in-order iterator for arena binary trees to move.
+	 */
+	ArenaBinaryTreeConstInOrderIterator(ArenaBinaryTreeConstInOrderIterator<ElementType, NodeType>&& other) noexcept = default;
+	
+	/**
+	 * @brief Destroys the const in-order iterator for arena binary trees.
+	 */
+	~ArenaBinaryTreeConstInOrderIterator() noexcept = default;
+
+public:
+	/**
+	 * @brief Assigns the given const in-order iterator for arena binary trees to this const in-order iterator for arena
+	 * binary trees using copy semantics.
+	 * @param other The const in-order iterator for arena binary trees to copy.
+	 * @return A reference to the const in-order iterator for arena binary trees.
+	 */
+	ArenaBinaryTreeConstInOrderIterator<ElementType, NodeType>& operator=(const ArenaBinaryTreeConstInOrderIterator<ElementType, NodeType>& other) = default;
+	
+	/**
+	 * @brief Assigns the given const in-order iterator for arena binary trees to this const in-order iterator for arena
+	 * binary trees using move semantics.
+	 * @param other The const in-order iterator for arena binary trees to move.
+	 * @return A reference to the const in-order iterator for arena binary trees.
+	 */
+	ArenaBinaryTreeConstInOrderIterator<ElementType, NodeType>& operator=(ArenaBinaryTreeConstInOrderIterator<ElementType, NodeType>&& other) noexcept = default;
+	
+	/**
+	 * @brief Compares two const in-order iterators for arena binary trees.
+	 * @details Two const in-order iterators for arena binary trees are equal if they point to the same node.
+	 * @param other: The other const in-order iterator for arena binary trees to compare with.
+	 * @return True if the two const in-order iterators for arena binary trees are equal, false otherwise.
+	 */
+	bool operator==(const ArenaBinaryTreeConstInOrderIterator<ElementType, NodeType>& other) const noexcept;
+	
+	/**
+	 * @brief Dereferences the const in-order iterator for arena binary trees.
+	 * @return A reference to the element stored in the node pointed to by the const in-order iterator for arena binary
+	 * trees.
+	 */
+	reference operator*() const noexcept;
+	
+	/**
+	 * @brief Dereferences the const in-order iterator for arena binary trees.
+	 * @return A pointer to the element stored in the node pointed to by the const in-order iterator for arena binary
+	 * trees.
+	 */
+	pointer operator->() const noexcept;
+	
+	/**
+	 * @brief Increments the const in-order iterator for arena binary trees.
+	 * @return A reference to the const in-order iterator for arena binary trees.
+	 */
+	ArenaBinaryTreeConstInOrderIterator<ElementType, NodeType>& operator++() noexcept;
+	
+	/**
+	 * @brief Increments the const in-order iterator for arena binary trees.
+	 * @return A copy of the const in-order iterator for arena binary trees before it was incremented.
+	 */
+	ArenaBinaryTreeConstInOrderIterator<ElementType, NodeType> operator++(int) noexcept;
+
+private:
+	/**
+	 * @brief Pushes the node at the given index and its chain of left children onto the node stack.
+	 * @param nodeIndex: The index of the first node to push, or NULL_INDEX to push nothing.
+	 */
+	void pushLeftPath(std::uint32_t nodeIndex) noexcept;
+
+private:
+	const NodeType* nodes;
+	BinaryTreeIteratorStack<const NodeType*> nodeStack {};
+};
+
+template<typename ElementType, typename NodeType>
+ArenaBinaryTreeConstInOrderIterator<ElementType, NodeType>::ArenaBinaryTreeConstInOrderIterator(const NodeType* nodes, std::uint32_t nodeIndex) noexcept :
+		nodes {nodes} {
+	pushLeftPath(nodeIndex);
+}
+
+template<typename ElementType, typename NodeType>
+bool ArenaBinaryTreeConstInOrderIterator<ElementType, NodeType>::operator==(const ArenaBinaryTreeConstInOrderIterator<ElementType, NodeType>& other) const noexcept {
+	return nodeStack.getTop() == other.nodeStack.getTop();
+}
+
+template<typename ElementType, typename NodeType>
+const ElementType& ArenaBinaryTreeConstInOrderIterator<ElementType, NodeType>::operator*() const noexcept {
+	assert(!nodeStack.isEmpty() && "Cannot dereference a null iterator.");
+	return nodeStack.getTop()->getElement();
+}
+
+template<typename ElementType, typename NodeType>
+const ElementType* ArenaBinaryTreeConstInOrderIterator<ElementType, NodeType>::operator->() const noexcept {
+	assert(!nodeStack.isEmpty() && "Cannot dereference a null iterator.");
+	return &nodeStack.getTop()->getElement();
+}
+
+template<typename ElementType, typename NodeType>
+ArenaBinaryTreeConstInOrderIterator<ElementType, NodeType>& ArenaBinaryTreeConstInOrderIterator<ElementType, NodeType>::operator++() noexcept {
+	assert(!nodeStack.isEmpty() && "Cannot increment a null iterator.");
+	
+	const auto rightChild {nodeStack.getTop()->getRightChild()};
+	nodeStack.pop();
+	
+	pushLeftPath(rightChild);
+	
+	return *this;
+}
+
+template<typename ElementType, typename NodeType>
+ArenaBinaryTreeConstInOrderIterator<ElementType, NodeType> ArenaBinaryTreeConstInOrderIterator<ElementType, NodeType>::operator++(int) noexcept {
+	const auto iterator {*this};
+	++(*this);
+	return iterator;
+}
+
+template<typename ElementType, typename NodeType>
+void ArenaBinaryTreeConstInOrderIterator<ElementType, NodeType>::pushLeftPath(std::uint32_t nodeIndex) noexcept {
+	while (nodeIndex != NodeType::NULL_INDEX) {
+		nodeStack.push(nodes + nodeIndex);
+		nodeIndex = nodes[nodeIndex].getLeftChild();
+	}
+}
+}
\ No newline at end of file
@@ -0,0 +1,139 @@
+#pragma once
+
+#include <cassert>
+#include <iterator>
+#include <utility>
+
+#include "DataStructures/Trees/BTreeNode.hpp"
+
+namespace Core::DataStructures::Trees::Iterators {
+/**
+ * @brief A const forward iterator that visits the key-value pairs of a B+ tree in ascending key order.
+ * @details The iterator walks the linked leaves of the tree and never visits an inner node.
+ * @class BTreeConstForwardIterator
+ * @tparam KeyType: The type of the keys.
+ * @tparam ValueType: The type of the values.
+ * @tparam LeafCapacity: The maximum number of key-value pairs in a leaf.
+ */
+template<typename KeyType, typename ValueType, std::size_t LeafCapacity>
+class BTreeConstForwardIterator final {
+public:
+	using iterator_category = std::forward_iterator_tag;
+	using difference_type = std::ptrdiff_t;
+	using value_type = std::pair<KeyType, ValueType>;
+	using reference = std::pair<const KeyType&, const ValueType&>;
+	
+	/**
+	 * @brief Instantiates a new B+ tree const forward iterator.
+	 * @param leaf: The leaf to iterate from, or nullptr for the end iterator.
+	 * @param index: The index of the key-value pair in the leaf to iterate from.
+	 */
+	explicit BTreeConstForwardIterator(const BTreeLeafNode<KeyType, ValueType, LeafCapacity>* leaf,
+	                                   const std::size_t index) noexcept;
+	
+	/**
+	 * @brief Instantiates a new B+ tree const forward iterator by copying the given B+ tree const forward iterator.
+	 * @param other: The B+ tree const forward iterator to copy.
+	 */
+	BTreeConstForwardIterator(const BTreeConstForwardIterator<KeyType, ValueType, LeafCapacity>& other) noexcept = default;
+	
+	/**
+	 * @brief Instantiates a new B+ tree const forward iterator by moving the given B+ tree const forward iterator.
+	 * @param other: The B+ tree const forward iterator to move.
+	 */
+	BTreeConstForwardIterator(BTreeConstForwardIterator<KeyType, ValueType, LeafCapacity>&& other) noexcept = default;
+	
+	/**
+	 * @brief Destroys the B+ tree const forward iterator.
+	 */
+	~BTreeConstForwardIterator() noexcept = default;
+
+public:
+	/**
+	 * @brief Assigns the given B+ tree const forward iterator to this B+ tree const forward iterator using copy
+	 * semantics.
+	 * @param other: The B+ tree const forward iterator to copy.
+	 * @return A reference to this B+ tree const forward iterator.
+	 */
+	BTreeConstForwardIterator<KeyType, ValueType, LeafCapacity>& operator=(
+			const BTreeConstForwardIterator<KeyType, ValueType, LeafCapacity>& other) noexcept = default;
+	
+	/**
+	 * @brief Assigns the given B+ tree const forward iterator to this B+ tree const forward iterator using move
+	 * semantics.
+	 * @param other: The B+ tree const forward iterator to move.
+	 * @return A reference to this B+ tree const forward iterator.
+	 */
+	BTreeConstForwardIterator<KeyType, ValueType, LeafCapacity>& operator=(
+			BTreeConstForwardIterator<KeyType, ValueType, LeafCapacity>&& other) noexcept = default;
+	
+	/**
+	 * @brief Compares two B+ tree const forward iterators.
+	 * @details Two B+ tree const forward iterators are equal if they point to the same key-value pair of the same leaf.
+	 * @param other: The other B+ tree const forward iterator to compare with.
+	 * @return True if the two B+ tree const forward iterators are equal, false otherwise.
+	 */
+	bool operator==(const BTreeConstForwardIterator<KeyType, ValueType, LeafCapacity>& other) const noexcept;
+	
+	/**
+	 * @brief Dereferences the B+ tree const forward iterator.
+	 * @return A pair of references to the key and value pointed to by the B+ tree const forward iterator.
+	 */
+	reference operator*() const noexcept;
+	
+	/**
+	 * @brief Increments the B+ tree const forward iterator.
+	 * @return A reference to the B+ tree const forward iterator.
+	 */
+	BTreeConstForwardIterator<KeyType, ValueType, LeafCapacity>& operator++() noexcept;
+	
+	/**
+	 * @brief Increments the B+ tree const forward iterator.
+	 * @return A copy of the B+ tree const forward iterator before it was incremented.
+	 */
+	BTreeConstForwardIterator<KeyType, ValueType, LeafCapacity> operator++(int) noexcept;
+
+private:
+	const BTreeLeafNode<KeyType, ValueType, LeafCapacity>* leaf;
+	std::size_t index;
+};
+
+template<typename KeyType, typename ValueType, std::size_t LeafCapacity>
+BTreeConstForwardIterator<KeyType, ValueType, LeafCapacity>::BTreeConstForwardIterator(
+		const BTreeLeafNode<KeyType, ValueType, LeafCapacity>* leaf, const std::size_t index) noexcept :
+		leaf {leaf}, index {index} {
+	
+}
+
+template<typename KeyType, typename ValueType, std::size_t LeafCapacity>
+bool BTreeConstForwardIterator<KeyType, ValueType, LeafCapacity>::operator==(
+		const BTreeConstForwardIterator<KeyType, ValueType, LeafCapacity>& other) const noexcept {
+	return leaf == other.leaf && index == other.index;
+}
+
+template<typename KeyType, typename ValueType, std::size_t LeafCapacity>
+std::pair<const KeyType&, const ValueType&> BTreeConstForwardIterator<KeyType, ValueType, LeafCapacity>::operator*() const noexcept {
+	assert(leaf != nullptr && "Cannot dereference a null iterator.");
+	return {leaf->keys[index], leaf->values[index]};
+}
+
+template<typename KeyType, typename ValueType, std::size_t LeafCapacity>
+BTreeConstForwardIterator<KeyType, ValueType, LeafCapacity>& BTreeConstForwardIterator<KeyType, ValueType, LeafCapacity>::operator++() noexcept {
+	assert(leaf != nullptr && "Cannot increment a null iterator.");
+	++index;
+	if (index == leaf->count) {
+		leaf = leaf->next;
+		index = 0;
+	}
+	
+	return *this;
+}
+
+template<typename KeyType, typename ValueType, std::size_t LeafCapacity>
+BTreeConstForwardIterator<KeyType, ValueType, LeafCapacity> BTreeConstForwardIterator<KeyType, ValueType, LeafCapacity>::operator++(int) noexcept {
+	assert(leaf != nullptr && "Cannot increment a null iterator.");
+	auto iterator {*this};
+	++(*this);
+	return iterator;
+}
+}
\ No newline at end of file
@@ -3,15 +3,16 @@
 #include <iterator>
 
 #include "DataStructures/Trees/BinaryTreeNode.hpp"
-#include "DataStructures/Stacks/SinglyLinkedListStack.hpp"
+#include "DataStructures/Trees/Iterators/BinaryTreeIteratorStack.hpp"
 
 namespace Core::DataStructures::Trees::Iterators {
 /**
  * @brief A const in-order iterator for binary trees.
  * @class BinaryTreeConstInOrderIterator
  * @tparam ElementType: The type of the elements stored in the binary tree.
+ * @tparam NodeType: The type of the nodes of the binary tree.
  */
-template<typename ElementType>
+template<typename ElementType, typename NodeType = BinaryTreeNode<ElementType>>
 class BinaryTreeConstInOrderIterator final {
 public:
 	using iterator_category = std::forward_iterator_tag;
@@ -24,21 +25,21 @@ public:
 	 * @brief Instantiates a new const in-order iterator for binary trees.
 	 * @param node: The node to iterate from.
 	 */
-	explicit BinaryTreeConstInOrderIterator(const BinaryTreeNode<ElementType>* node) noexcept;
+	explicit BinaryTreeConstInOrderIterator(const NodeType* node) noexcept;
 	
 	/**
 	 * @brief Instantiates a new const in-order iterator for binary trees by copying the given const in-order iterator
 	 * for binary trees.
 	 * @param other The const in-order iterator for binary trees to copy.
 	 */
-	BinaryTreeConstInOrderIterator(const BinaryTreeConstInOrderIterator<ElementType>& other) = default;
+	BinaryTreeConstInOrderIterator(const BinaryTreeConstInOrderIterator<ElementType, NodeType>& other) = default;
 	
 	/**
 	 * @brief Instantiates a new const in-order iterator for binary trees by moving the given const in-order iterator
 	 * for binary trees.
 	 * @param other The const in-order iterator for binary trees to move.
 	 */
-	BinaryTreeConstInOrderIterator(BinaryTreeConstInOrderIterator<ElementType>&& other) noexcept = default;
+	BinaryTreeConstInOrderIterator(BinaryTreeConstInOrderIterator<ElementType, NodeType>&& other) noexcept = default;
 	
 	/**
 	 * @brief Destroys the const in-order iterator for binary trees.
@@ -52,7 +53,7 @@ public:
 	 * @param other The const in-order iterator for binary trees to copy.
 	 * @return A reference to the const in-order iterator for binary trees.
 	 */
-	BinaryTreeConstInOrderIterator<ElementType>& operator=(const BinaryTreeConstInOrderIterator<ElementType>& other) = default;
+	BinaryTreeConstInOrderIterator<ElementType, NodeType>& operator=(const BinaryTreeConstInOrderIterator<ElementType, NodeType>& other) = default;
 	
 	/**
 	 * @brief Assigns the given const in-order iterator for binary trees to this const in-order iterator for binary
@@ -60,7 +61,7 @@ public:
 	 * @param other The const in-order iterator for binary trees to move.
 	 * @return A reference to the const in-order iterator for binary trees.
 	 */
-	BinaryTreeConstInOrderIterator<ElementType>& operator=(BinaryTreeConstInOrderIterator<ElementType>&& other) noexcept = default;
+	BinaryTreeConstInOrderIterator<ElementType, NodeType>& operator=(BinaryTreeConstInOrderIterator<ElementType, NodeType>&& other) noexcept = default;
 	
 	/**
 	 * @brief Compares two const in-order iterators for binary trees.
@@ -68,7 +69,7 @@ public:
 	 * @param other: The other const in-order iterator for binary trees to compare with.
 	 * @return True if the two const in-order iterators for binary trees are equal, false otherwise.
 	 */
-	bool operator==(const BinaryTreeConstInOrderIterator<ElementType>& other) const noexcept;
+	bool operator==(const BinaryTreeConstInOrderIterator<ElementType, NodeType>& other) const noexcept;
 
 	/**
 	 * @brief Dereferences the const in-order iterator for binary trees.
@@ -86,67 +87,60 @@ public:
 	 * @brief Increments the const in-order iterator for binary trees.
 	 * @return A reference to the const in-order iterator for binary trees.
 	 */
-	BinaryTreeConstInOrderIterator<ElementType>& operator++() noexcept;
+	BinaryTreeConstInOrderIterator<ElementType, NodeType>& operator++() noexcept;
 	
 	/**
 	 * @brief Increments the const in-order iterator for binary trees.
 	 * @return A copy of the const in-order iterator for binary trees before it was incremented.
 	 */
-	BinaryTreeConstInOrderIterator<ElementType> operator++(int) noexcept;
+	BinaryTreeConstInOrderIterator<ElementType, NodeType> operator++(int) noexcept;
 
 private:
-	Stacks::SinglyLinkedListStack<const BinaryTreeNode<ElementType>*> nodeStack {};
+	BinaryTreeIteratorStack<const NodeType*> nodeStack {};
 };
 
-template<typename ElementType>
-BinaryTreeConstInOrderIterator<ElementType>::BinaryTreeConstInOrderIterator(const BinaryTreeNode<ElementType>* node) noexcept {
+template<typename ElementType, typename NodeType>
+BinaryTreeConstInOrderIterator<ElementType, NodeType>::BinaryTreeConstInOrderIterator(const NodeType* node) noexcept {
 	while (node != nullptr) {
 		nodeStack.push(node);
 		node = node->getLeftChild();
 	}
 }
 
-template<typename ElementType>
-bool BinaryTreeConstInOrderIterator<ElementType>::operator==(const BinaryTreeConstInOrderIterator<ElementType>& other) const noexcept {
-	return nodeStack == other.nodeStack;
+template<typename ElementType, typename NodeType>
+bool BinaryTreeConstInOrderIterator<ElementType, NodeType>::operator==(const BinaryTreeConstInOrderIterator<ElementType, NodeType>& other) const noexcept {
+	return nodeStack.getTop() == other.nodeStack.getTop();
 }
 
-template<typename ElementType>
-const ElementType& BinaryTreeConstInOrderIterator<ElementType>::operator*() const noexcept {
+template<typename ElementType, typename NodeType>
+const ElementType& BinaryTreeConstInOrderIterator<ElementType, NodeType>::operator*() const noexcept {
 	assert(!nodeStack.isEmpty() && "Cannot dereference a null iterator.");
-	const auto* const node {*nodeStack.getTop()};
-	return node->getElement();
+	return nodeStack.getTop()->getElement();
 }
 
-template<typename ElementType>
-const ElementType* const BinaryTreeConstInOrderIterator<ElementType>::operator->() const noexcept {
+template<typename ElementType, typename NodeType>
+const ElementType* const BinaryTreeConstInOrderIterator<ElementType, NodeType>::operator->() const noexcept {
 	assert(!nodeStack.isEmpty() && "Cannot dereference a null iterator.");
-	return nodeStack.getTop();
+	return &nodeStack.getTop()->getElement();
 }
 
-template<typename ElementType>
-BinaryTreeConstInOrderIterator<ElementType>& BinaryTreeConstInOrderIterator<ElementType>::operator++() noexcept {
+template<typename ElementType, typename NodeType>
+BinaryTreeConstInOrderIterator<ElementType, NodeType>& BinaryTreeConstInOrderIterator<ElementType, NodeType>::operator++() noexcept {
 	assert(!nodeStack.isEmpty() && "Cannot increment a null iterator.");
 	
-	const auto optionalNode {nodeStack.pop()};
-	assert(optionalNode.has_value() && "Cannot increment a null iterator.");
+	auto* node {nodeStack.getTop()->getRightChild()};
+	nodeStack.pop();
 	
-	const auto& node {optionalNode.value()};
-	
-	if (auto* rightChild {node->getRightChild()}; rightChild != nullptr) {
-		auto currentNode {rightChild};
-		
-		while (currentNode != nullptr) {
-			nodeStack.push(currentNode);
-			currentNode = currentNode->getLeftChild();
-		}
+	while (node != nullptr) {
+		nodeStack.push(node);
+		node = node->getLeftChild();
 	}
 	
 	return *this;
 }
 
-template<typename ElementType>
-BinaryTreeConstInOrderIterator<ElementType> BinaryTreeConstInOrderIterator<ElementType>::operator++(int) noexcept {
+template<typename ElementType, typename NodeType>
+BinaryTreeConstInOrderIterator<ElementType, NodeType> BinaryTreeConstInOrderIterator<ElementType, NodeType>::operator++(int) noexcept {
 	const auto iterator {*this};
 	++(*this);
 	return iterator;
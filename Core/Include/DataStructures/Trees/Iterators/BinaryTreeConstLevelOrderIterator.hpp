@@ -3,15 +3,16 @@
 #include <iterator>
 
 #include "DataStructures/Trees/BinaryTreeNode.hpp"
-#include "DataStructures/Queues/SinglyLinkedListQueue.hpp"
+#include "DataStructures/Trees/Iterators/BinaryTreeIteratorQueue.hpp"
 
 namespace Core::DataStructures::Trees::Iterators {
 /**
  * @brief A const level-order iterator for binary trees.
  * @class BinaryTreeConstLevelOrderIterator
  * @tparam ElementType: The type of the elements stored in the binary tree.
+ * @tparam NodeType: The type of the nodes of the binary tree.
  */
-template<typename ElementType>
+template<typename ElementType, typename NodeType = BinaryTreeNode<ElementType>>
 class BinaryTreeConstLevelOrderIterator final {
 public:
 	using iterator_category = std::forward_iterator_tag;
@@ -24,21 +25,21 @@ public:
 	 * @brief Instantiates a new const level-order iterator for binary trees.
 	 * @param node: The node to iterate from.
 	 */
-	explicit BinaryTreeConstLevelOrderIterator(BinaryTreeNode<ElementType>* node) noexcept;
+	explicit BinaryTreeConstLevelOrderIterator(NodeType* node) noexcept;
 	
 	/**
 	 * @brief Instantiates a new const level-order iterator for binary trees by copying the given const level-order
 	 * iterator for binary trees.
 	 * @param other The const level-order iterator for binary trees to copy.
 	 */
-	BinaryTreeConstLevelOrderIterator(const BinaryTreeConstLevelOrderIterator<ElementType>& other) = default;
+	BinaryTreeConstLevelOrderIterator(const BinaryTreeConstLevelOrderIterator<ElementType, NodeType>& other) = default;
 	
 	/**
 	 * @brief Instantiates a new const level-order iterator for binary trees by moving the given const level-order
 	 * iterator for binary trees.
 	 * @param other The const level-order iterator for binary trees to move.
 	 */
-	BinaryTreeConstLevelOrderIterator(BinaryTreeConstLevelOrderIterator<ElementType>&& other) noexcept = default;
+	BinaryTreeConstLevelOrderIterator(BinaryTreeConstLevelOrderIterator<ElementType, NodeType>&& other) noexcept = default;
 	
 	/**
 	 * @brief Destroys the const level-order iterator for binary trees.
@@ -52,7 +53,7 @@ public:
 	 * @param other The const level-order iterator for binary trees to copy.
 	 * @return A reference to the const level-order iterator for binary trees.
 	 */
-	BinaryTreeConstLevelOrderIterator<ElementType>& operator=(const BinaryTreeConstLevelOrderIterator<ElementType>& other) = default;
+	BinaryTreeConstLevelOrderIterator<ElementType, NodeType>& operator=(const BinaryTreeConstLevelOrderIterator<ElementType, NodeType>& other) = default;
 	
 	/**
 	 * @brief Assigns the given const level-order iterator for binary trees to this const level-order iterator for
@@ -60,7 +61,7 @@ public:
 	 * @param other The const level-order iterator for binary trees to move.
 	 * @return A reference to the const level-order iterator for binary trees.
 	 */
-	BinaryTreeConstLevelOrderIterator<ElementType>& operator=(BinaryTreeConstLevelOrderIterator<ElementType>&& other) noexcept = default;
+	BinaryTreeConstLevelOrderIterator<ElementType, NodeType>& operator=(BinaryTreeConstLevelOrderIterator<ElementType, NodeType>&& other) noexcept = default;
 	
 	/**
 	 * @brief Compares two const level-order iterators for binary trees.
@@ -68,8 +69,8 @@ public:
 	 * @param other: The other const level-order iterator for binary trees to compare with.
 	 * @return True if the two const level-order iterators for binary trees are equal, false otherwise.
 	 */
-	bool operator==(const BinaryTreeConstLevelOrderIterator<ElementType>& other) const noexcept;
-
+	bool operator==(const BinaryTreeConstLevelOrderIterator<ElementType, NodeType>& other) const noexcept;
+	
 	/**
 	 * @brief Dereferences the const level-order iterator for binary trees.
 	 * @return A reference to the element stored in the node pointed to by the const level-order iterator for binary trees.
@@ -86,52 +87,51 @@ public:
 	 * @brief Increments the const level-order iterator for binary trees.
 	 * @return A reference to the const level-order iterator for binary trees.
 	 */
-	BinaryTreeConstLevelOrderIterator<ElementType>& operator++() noexcept;
+	BinaryTreeConstLevelOrderIterator<ElementType, NodeType>& operator++() noexcept;
 	
 	/**
 	 * @brief Increments the const level-order iterator for binary trees.
 	 * @return A copy of the const level-order iterator for binary trees before it was incremented.
 	 */
-	BinaryTreeConstLevelOrderIterator<ElementType> operator++(int) noexcept;
+	BinaryTreeConstLevelOrderIterator<ElementType, NodeType> operator++(int) noexcept;
 
 private:
-	Queues::SinglyLinkedListQueue<BinaryTreeNode<ElementType>*> nodeQueue {};
+	BinaryTreeIteratorQueue<NodeType*> nodeQueue {};
 };
 
-template<typename ElementType>
-BinaryTreeConstLevelOrderIterator<ElementType>::BinaryTreeConstLevelOrderIterator(BinaryTreeNode<ElementType>* node) noexcept {
+template<typename ElementType, typename NodeType>
+BinaryTreeConstLevelOrderIterator<ElementType, NodeType>::BinaryTreeConstLevelOrderIterator(NodeType* node) noexcept {
 	if (node != nullptr) {
 		nodeQueue.enqueue(node);
 	}
 }
 
-template<typename ElementType>
-bool BinaryTreeConstLevelOrderIterator<ElementType>::operator==(const BinaryTreeConstLevelOrderIterator<ElementType>& other) const noexcept {
-	return nodeQueue == other.nodeQueue;
+template<typename ElementType, typename NodeType>
+bool BinaryTreeConstLevelOrderIterator<ElementType, NodeType>::operator==(const BinaryTreeConstLevelOrderIterator<ElementType, NodeType>& other) const noexcept {
+	if (nodeQueue.isEmpty() || other.nodeQueue.isEmpty()) {
+		return nodeQueue.isEmpty() && other.nodeQueue.isEmpty();
+	}
+	
+	return nodeQueue.getFront() == other.nodeQueue.getFront();
 }
 
-template<typename ElementType>
-const ElementType& BinaryTreeConstLevelOrderIterator<ElementType>::operator*() const noexcept {
+template<typename ElementType, typename NodeType>
+const ElementType& BinaryTreeConstLevelOrderIterator<ElementType, NodeType>::operator*() const noexcept {
 	assert(!nodeQueue.isEmpty() && "Cannot dereference a null iterator.");
-	const auto* const node {nodeQueue.getFront()};
-	
-	return (*node)->getElement();
+	return nodeQueue.getFront()->getElement();
 }
 
-template<typename ElementType>
-const ElementType* const  BinaryTreeConstLevelOrderIterator<ElementType>::operator->() const noexcept {
+template<typename ElementType, typename NodeType>
+const ElementType* const BinaryTreeConstLevelOrderIterator<ElementType, NodeType>::operator->() const noexcept {
 	assert(!nodeQueue.isEmpty() && "Cannot dereference a null iterator.");
-	return nodeQueue.getFront();
+	return &nodeQueue.getFront()->getElement();
 }
 
-template<typename ElementType>
-BinaryTreeConstLevelOrderIterator<ElementType>& BinaryTreeConstLevelOrderIterator<ElementType>::operator++() noexcept {
+template<typename ElementType, typename NodeType>
+BinaryTreeConstLevelOrderIterator<ElementType, NodeType>& BinaryTreeConstLevelOrderIterator<ElementType, NodeType>::operator++() noexcept {
 	assert(!nodeQueue.isEmpty() && "Cannot increment a null iterator.");
 	
-	const auto optionalNode {nodeQueue.dequeue()};
-	assert(optionalNode.has_value() && "Queue should not be empty.");
-	
-	const auto& node {optionalNode.value()};
+	auto* const node {nodeQueue.dequeue()};
 	
 	if (node->getLeftChild() != nullptr) {
 		nodeQueue.enqueue(node->getLeftChild());
@@ -144,8 +144,8 @@ BinaryTreeConstLevelOrderIterator<ElementType>& BinaryTreeConstLevelOrderIterato
 	return *this;
 }
 
-template<typename ElementType>
-BinaryTreeConstLevelOrderIterator<ElementType> BinaryTreeConstLevelOrderIterator<ElementType>::operator++(int) noexcept {
+template<typename ElementType, typename NodeType>
+BinaryTreeConstLevelOrderIterator<ElementType, NodeType> BinaryTreeConstLevelOrderIterator<ElementType, NodeType>::operator++(int) noexcept {
 	auto iterator {*this};
 	++(*this);
 	return iterator;
@@ -3,15 +3,16 @@
 #include <iterator>
 
 #include "DataStructures/Trees/BinaryTreeNode.hpp"
-#include "DataStructures/Stacks/SinglyLinkedListStack.hpp"
+#include "DataStructures/Trees/Iterators/BinaryTreeIteratorStack.hpp"
 
 namespace Core::DataStructures::Trees::Iterators {
 /**
  * @brief A const post-order iterator for binary trees.
  * @class BinaryTreeConstPostOrderIterator
  * @tparam ElementType: The type of the elements stored in the binary tree.
+ * @tparam NodeType: The type of the nodes of the binary tree.
  */
-template<typename ElementType>
+template<typename ElementType, typename NodeType = BinaryTreeNode<ElementType>>
 class BinaryTreeConstPostOrderIterator final {
 public:
 	using iterator_category = std::forward_iterator_tag;
@@ -24,21 +25,21 @@ public:
 	 * @brief Instantiates a new const post-order iterator for binary trees.
 	 * @param node: The node to iterate from.
 	 */
-	explicit BinaryTreeConstPostOrderIterator(const BinaryTreeNode<ElementType>* node) noexcept;
+	explicit BinaryTreeConstPostOrderIterator(const NodeType* node) noexcept;
 	
 	/**
 	 * @brief Instantiates a new const post-order iterator for binary trees by copying the given const post-order
 	 * iterator for binary trees.
 	 * @param other The const post-order iterator for binary trees to copy.
 	 */
-	BinaryTreeConstPostOrderIterator(const BinaryTreeConstPostOrderIterator<ElementType>& other) = default;
+	BinaryTreeConstPostOrderIterator(const BinaryTreeConstPostOrderIterator<ElementType, NodeType>& other) = default;
 	
 	/**
 	 * @brief Instantiates a new const post-order iterator for binary trees by moving the given const post-order
 	 * iterator for binary trees.
 	 * @param other The const post-order iterator for binary trees to move.
 	 */
-	BinaryTreeConstPostOrderIterator(BinaryTreeConstPostOrderIterator<ElementType>&& other) noexcept = default;
+	BinaryTreeConstPostOrderIterator(BinaryTreeConstPostOrderIterator<ElementType, NodeType>&& other) noexcept = default;
 	
 	/**
 	 * @brief Destroys the const post-order iterator for binary trees.
@@ -52,7 +53,7 @@ public:
 	 * @param other The const post-order iterator for binary trees to copy.
 	 * @return A reference to the const post-order iterator for binary trees.
 	 */
-	BinaryTreeConstPostOrderIterator<ElementType>& operator=(const BinaryTreeConstPostOrderIterator<ElementType>& other) = default;
+	BinaryTreeConstPostOrderIterator<ElementType, NodeType>& operator=(const BinaryTreeConstPostOrderIterator<ElementType, NodeType>& other) = default;
 	
 	/**
 	 * @brief Assigns the given const post-order iterator for binary trees to this const post-order iterator for
@@ -60,7 +61,7 @@ public:
 	 * @param other The const post-order iterator for binary trees to move.
 	 * @return A reference to the const post-order iterator for binary trees.
 	 */
-	BinaryTreeConstPostOrderIterator<ElementType>& operator=(BinaryTreeConstPostOrderIterator<ElementType>&& other) noexcept = default;
+	BinaryTreeConstPostOrderIterator<ElementType, NodeType>& operator=(BinaryTreeConstPostOrderIterator<ElementType, NodeType>&& other) noexcept = default;
 	
 	/**
 	 * @brief Compares two const post-order iterators for binary trees.
@@ -68,7 +69,7 @@ public:
 	 * @param other: The other const post-order iterator for binary trees to compare with.
 	 * @return True if the two const post-order iterators for binary trees are equal, false otherwise.
 	 */
-	bool operator==(const BinaryTreeConstPostOrderIterator<ElementType>& other) const noexcept;
+	bool operator==(const BinaryTreeConstPostOrderIterator<ElementType, NodeType>& other) const noexcept;
 	
 	/**
 	 * @brief Dereferences the const post-order iterator for binary trees.
@@ -86,73 +87,74 @@ public:
 	 * @brief Increments the const post-order iterator for binary trees.
 	 * @return A reference to the const post-order iterator for binary trees.
 	 */
-	BinaryTreeConstPostOrderIterator<ElementType>& operator++() noexcept;
+	BinaryTreeConstPostOrderIterator<ElementType, NodeType>& operator++() noexcept;
 	
 	/**
 	 * @brief Increments the const post-order iterator for binary trees.
 	 * @return A copy of the const post-order iterator for binary trees before it was incremented.
 	 */
-	BinaryTreeConstPostOrderIterator<ElementType> operator++(int) noexcept;
+	BinaryTreeConstPostOrderIterator<ElementType, NodeType> operator++(int) noexcept;
 	
 private:
-	Stacks::SinglyLinkedListStack<const BinaryTreeNode<ElementType>*> nodeStack {};
+	/**
+	 * @brief Pushes the path from the given node down to the node of its subtree that comes first in post-order, which
+	 * is reached by descending to the left child whenever there is one and to the right child otherwise.
+	 * @param node: The root of the subtree, or nullptr to push nothing.
+	 */
+	void pushPathToFirstNode(const NodeType* node) noexcept;
+
+private:
+	BinaryTreeIteratorStack<const NodeType*> nodeStack {};
 };
 
-template<typename ElementType>
-BinaryTreeConstPostOrderIterator<ElementType>::BinaryTreeConstPostOrderIterator(const BinaryTreeNode<ElementType>* node) noexcept {
-	if (node == nullptr) {
-		return;
-	}
-	
-	auto stack {Stacks::SinglyLinkedListStack<const BinaryTreeNode<ElementType>*> {}};
-	stack.push(node);
-	
-	while (!stack.isEmpty()) {
-		const auto optionalNode {stack.pop()};
-		assert(optionalNode.has_value() && "Stack should not be empty.");
-		
-		const auto& node {optionalNode.value()};
-		nodeStack.push(node);
-		
-		if (node->getLeftChild() != nullptr) {
-			stack.push(node->getLeftChild());
-		}
-		
-		if (node->getRightChild() != nullptr) {
-			stack.push(node->getRightChild());
-		}
-	}
+template<typename ElementType, typename NodeType>
+BinaryTreeConstPostOrderIterator<ElementType, NodeType>::BinaryTreeConstPostOrderIterator(const NodeType* node) noexcept {
+	pushPathToFirstNode(node);
 }
 
-template<typename ElementType>
-bool BinaryTreeConstPostOrderIterator<ElementType>::operator==(const BinaryTreeConstPostOrderIterator<ElementType>& other) const noexcept {
-	return nodeStack == other.nodeStack;
+template<typename ElementType, typename NodeType>
+bool BinaryTreeConstPostOrderIterator<ElementType, NodeType>::operator==(const BinaryTreeConstPostOrderIterator<ElementType, NodeType>& other) const noexcept {
+	return nodeStack.getTop() == other.nodeStack.getTop();
 }
 
-template<typename ElementType>
-const ElementType& BinaryTreeConstPostOrderIterator<ElementType>::operator*() const noexcept {
+template<typename ElementType, typename NodeType>
+const ElementType& BinaryTreeConstPostOrderIterator<ElementType, NodeType>::operator*() const noexcept {
 	assert(!nodeStack.isEmpty() && "Cannot dereference a null iterator.");
-	const auto* const node {*nodeStack.getTop()};
-	return node->getElement();
+	return nodeStack.getTop()->getElement();
 }
 
-template<typename ElementType>
-const ElementType* const BinaryTreeConstPostOrderIterator<ElementType>::operator->() const noexcept {
+template<typename ElementType, typename NodeType>
+const ElementType* const BinaryTreeConstPostOrderIterator<ElementType, NodeType>::operator->() const noexcept {
 	assert(!nodeStack.isEmpty() && "Cannot dereference a null iterator.");
-	return nodeStack.getTop();
+	return &nodeStack.getTop()->getElement();
 }
 
-template<typename ElementType>
-BinaryTreeConstPostOrderIterator<ElementType>& BinaryTreeConstPostOrderIterator<ElementType>::operator++() noexcept {
+template<typename ElementType, typename NodeType>
+BinaryTreeConstPostOrderIterator<ElementType, NodeType>& BinaryTreeConstPostOrderIterator<ElementType, NodeType>::operator++() noexcept {
 	assert(!nodeStack.isEmpty() && "Cannot increment a null iterator.");
+	
+	auto* const node {nodeStack.getTop()};
 	nodeStack.pop();
+	
+	if (auto* const parent {nodeStack.getTop()}; parent != nullptr && parent->getLeftChild() == node) {
+		pushPathToFirstNode(parent->getRightChild());
+	}
+	
 	return *this;
 }
 
-template<typename ElementType>
-BinaryTreeConstPostOrderIterator<ElementType> BinaryTreeConstPostOrderIterator<ElementType>::operator++(int) noexcept {
+template<typename ElementType, typename NodeType>
+BinaryTreeConstPostOrderIterator<ElementType, NodeType> BinaryTreeConstPostOrderIterator<ElementType, NodeType>::operator++(int) noexcept {
 	auto iterator {*this};
 	++(*this);
 	return iterator;
 }
+
+template<typename ElementType, typename NodeType>
+void BinaryTreeConstPostOrderIterator<ElementType, NodeType>::pushPathToFirstNode(const NodeType* node) noexcept {
+	while (node != nullptr) {
+		nodeStack.push(node);
+		node = node->getLeftChild() != nullptr ? node->getLeftChild() : node->getRightChild();
+	}
+}
 }
\ No newline at end of file
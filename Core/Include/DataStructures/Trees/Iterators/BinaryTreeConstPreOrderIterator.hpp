@@ -3,15 +3,16 @@
 #include <iterator>
 
 #include "DataStructures/Trees/BinaryTreeNode.hpp"
-#include "DataStructures/Stacks/SinglyLinkedListStack.hpp"
+#include "DataStructures/Trees/Iterators/BinaryTreeIteratorStack.hpp"
 
 namespace Core::DataStructures::Trees::Iterators {
 /**
  * @brief A const pre-order iterator for binary trees.
  * @class BinaryTreeConstPreOrderIterator
  * @tparam ElementType: The type of the elements stored in the binary tree.
+ * @tparam NodeType: The type of the nodes of the binary tree.
  */
-template<typename ElementType>
+template<typename ElementType, typename NodeType = BinaryTreeNode<ElementType>>
 class BinaryTreeConstPreOrderIterator final {
 public:
 	using iterator_category = std::forward_iterator_tag;
@@ -24,21 +25,21 @@ public:
 	 * @brief Instantiates a new const pre-order iterator for binary trees.
 	 * @param node: The node to iterate from.
 	 */
-	explicit BinaryTreeConstPreOrderIterator(BinaryTreeNode<ElementType>* node) noexcept;
+	explicit BinaryTreeConstPreOrderIterator(const NodeType* node) noexcept;
 	
 	/**
 	 * @brief Instantiates a new const pre-order iterator for binary trees by copying the given const pre-order
 	 * iterator for binary trees.
 	 * @param other The const pre-order iterator for binary trees to copy.
 	 */
-	BinaryTreeConstPreOrderIterator(const BinaryTreeConstPreOrderIterator<ElementType>& other) = default;
+	BinaryTreeConstPreOrderIterator(const BinaryTreeConstPreOrderIterator<ElementType, NodeType>& other) = default;
 	
 	/**
 	 * @brief Instantiates a new const pre-order iterator for binary trees by moving the given const pre-order
 	 * iterator for binary trees.
 	 * @param other The const pre-order iterator for binary trees to move.
 	 */
-	BinaryTreeConstPreOrderIterator(BinaryTreeConstPreOrderIterator<ElementType>&& other) noexcept = default;
+	BinaryTreeConstPreOrderIterator(BinaryTreeConstPreOrderIterator<ElementType, NodeType>&& other) noexcept = default;
 	
 	/**
 	 * @brief Destroys the const pre-order iterator for binary trees.
@@ -52,7 +53,7 @@ public:
 	 * @param other The const pre-order iterator for binary trees to copy.
 	 * @return A reference to the const pre-order iterator for binary trees.
 	 */
-	BinaryTreeConstPreOrderIterator<ElementType>& operator=(const BinaryTreeConstPreOrderIterator<ElementType>& other) = default;
+	BinaryTreeConstPreOrderIterator<ElementType, NodeType>& operator=(const BinaryTreeConstPreOrderIterator<ElementType, NodeType>& other) = default;
 	
 	/**
 	 * @brief Assigns the given const pre-order iterator for binary trees to this const pre-order iterator for
@@ -60,7 +61,7 @@ public:
 	 * @param other The const pre-order iterator for binary trees to move.
 	 * @return A reference to the const pre-order iterator for binary trees.
 	 */
-	BinaryTreeConstPreOrderIterator<ElementType>& operator=(BinaryTreeConstPreOrderIterator<ElementType>&& other) noexcept = default;
+	BinaryTreeConstPreOrderIterator<ElementType, NodeType>& operator=(BinaryTreeConstPreOrderIterator<ElementType, NodeType>&& other) noexcept = default;
 	
 	/**
 	 * @brief Compares two const pre-order iterators for binary trees.
@@ -68,7 +69,7 @@ public:
 	 * @param other: The other const pre-order iterator for binary trees to compare with.
 	 * @return True if the two const pre-order iterators for binary trees are equal, false otherwise.
 	 */
-	bool operator==(const BinaryTreeConstPreOrderIterator<ElementType>& other) const noexcept;
+	bool operator==(const BinaryTreeConstPreOrderIterator<ElementType, NodeType>& other) const noexcept;
 
 	/**
 	 * @brief Dereferences the const pre-order iterator for binary trees.
@@ -86,51 +87,48 @@ public:
 	 * @brief Increments the const pre-order iterator for binary trees.
 	 * @return A reference to the const pre-order iterator for binary trees.
 	 */
-	BinaryTreeConstPreOrderIterator<ElementType>& operator++() noexcept;
+	BinaryTreeConstPreOrderIterator<ElementType, NodeType>& operator++() noexcept;
 	
 	/**
 	 * @brief Increments the const pre-order iterator for binary trees.
 	 * @return A copy of the const pre-order iterator for binary trees before it was incremented.
 	 */
-	BinaryTreeConstPreOrderIterator<ElementType> operator++(int) noexcept;
+	BinaryTreeConstPreOrderIterator<ElementType, NodeType> operator++(int) noexcept;
 
 private:
-	Stacks::SinglyLinkedListStack<BinaryTreeNode<ElementType>*> nodeStack {};
+	BinaryTreeIteratorStack<const NodeType*> nodeStack {};
 };
 
-template<typename ElementType>
-BinaryTreeConstPreOrderIterator<ElementType>::BinaryTreeConstPreOrderIterator(BinaryTreeNode<ElementType>* node) noexcept {
+template<typename ElementType, typename NodeType>
+BinaryTreeConstPreOrderIterator<ElementType, NodeType>::BinaryTreeConstPreOrderIterator(const NodeType* node) noexcept {
 	if (node != nullptr) {
 		nodeStack.push(node);
 	}
 }
 
-template<typename ElementType>
-bool BinaryTreeConstPreOrderIterator<ElementType>::operator==(const BinaryTreeConstPreOrderIterator<ElementType>& other) const noexcept {
-	return nodeStack == other.nodeStack;
+template<typename ElementType, typename NodeType>
+bool BinaryTreeConstPreOrderIterator<ElementType, NodeType>::operator==(const BinaryTreeConstPreOrderIterator<ElementType, NodeType>& other) const noexcept {
+	return nodeStack.getTop() == other.nodeStack.getTop();
 }
 
-template<typename ElementType>
-const ElementType& BinaryTreeConstPreOrderIterator<ElementType>::operator*() const noexcept {
+template<typename ElementType, typename NodeType>
+const ElementType& BinaryTreeConstPreOrderIterator<ElementType, NodeType>::operator*() const noexcept {
 	assert(!nodeStack.isEmpty() && "Cannot dereference a null iterator.");
-	const auto* const node {*nodeStack.getTop()};
-	return node->getElement();
+	return nodeStack.getTop()->getElement();
 }
 
-template<typename ElementType>
-const ElementType* const BinaryTreeConstPreOrderIterator<ElementType>::operator->() const noexcept {
+template<typename ElementType, typename NodeType>
+const ElementType* const BinaryTreeConstPreOrderIterator<ElementType, NodeType>::operator->() const noexcept {
 	assert(!nodeStack.isEmpty() && "Cannot dereference a null iterator.");
-	return nodeStack.getTop();
+	return &nodeStack.getTop()->getElement();
 }
 
-template<typename ElementType>
-BinaryTreeConstPreOrderIterator<ElementType>& BinaryTreeConstPreOrderIterator<ElementType>::operator++() noexcept {
+template<typename ElementType, typename NodeType>
+BinaryTreeConstPreOrderIterator<ElementType, NodeType>& BinaryTreeConstPreOrderIterator<ElementType, NodeType>::operator++() noexcept {
 	assert(!nodeStack.isEmpty() && "Cannot increment a null iterator.");
 	
-	const auto optionalNode {nodeStack.pop()};
-	assert(optionalNode.has_value() && "Cannot dereference a null iterator.");
-	
-	const auto& node {optionalNode.value()};
+	auto* const node {nodeStack.getTop()};
+	nodeStack.pop();
 	
 	if (node->getRightChild() != nullptr) {
 		nodeStack.push(node->getRightChild());
@@ -143,8 +141,8 @@ BinaryTreeConstPreOrderIterator<ElementType>& BinaryTreeConstPreOrderIterator<El
 	return *this;
 }
 
-template<typename ElementType>
-BinaryTreeConstPreOrderIterator<ElementType> BinaryTreeConstPreOrderIterator<ElementType>::operator++(int) noexcept {
+template<typename ElementType, typename NodeType>
+BinaryTreeConstPreOrderIterator<ElementType, NodeType> BinaryTreeConstPreOrderIterator<ElementType, NodeType>::operator++(int) noexcept {
 	auto iterator {*this};
 	++(*this);
 	return iterator;
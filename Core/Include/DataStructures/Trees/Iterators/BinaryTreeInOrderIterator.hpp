@@ -3,15 +3,16 @@
 #include <iterator>
 
 #include "DataStructures/Trees/BinaryTreeNode.hpp"
-#include "DataStructures/Stacks/SinglyLinkedListStack.hpp"
+#include "DataStructures/Trees/Iterators/BinaryTreeIteratorStack.hpp"
 
 namespace Core::DataStructures::Trees::Iterators {
 /**
  * @brief An in-order iterator for binary trees.
  * @class BinaryTreeInOrderIterator
  * @tparam ElementType: The type of the elements stored in the binary tree.
+ * @tparam NodeType: The type of the nodes of the binary tree.
  */
-template<typename ElementType>
+template<typename ElementType, typename NodeType = BinaryTreeNode<ElementType>>
 class BinaryTreeInOrderIterator final {
 public:
 	using iterator_category = std::forward_iterator_tag;
@@ -24,21 +25,21 @@ public:
 	 * @brief Instantiates a new in-order iterator for binary trees.
 	 * @param node: The node to iterate from.
 	 */
-	explicit BinaryTreeInOrderIterator(BinaryTreeNode<ElementType>* node) noexcept;
+	explicit BinaryTreeInOrderIterator(NodeType* node) noexcept;
 	
 	/**
 	 * @brief Instantiates a new in-order iterator for binary trees by copying the given in-order iterator for binary
 	 * trees.
 	 * @param other The in-order iterator for binary trees to copy.
 	 */
-	BinaryTreeInOrderIterator(const BinaryTreeInOrderIterator<ElementType>& other) = default;
+	BinaryTreeInOrderIterator(const BinaryTreeInOrderIterator<ElementType, NodeType>& other) = default;
 	
 	/**
 	 * @brief Instantiates a new in-order iterator for binary trees by moving the given in-order iterator for binary
 	 * trees.
 	 * @param other The in-order iterator for binary trees to move.
 	 */
-	BinaryTreeInOrderIterator(BinaryTreeInOrderIterator<ElementType>&& other) noexcept = default;
+	BinaryTreeInOrderIterator(BinaryTreeInOrderIterator<ElementType, NodeType>&& other) noexcept = default;
 	
 	/**
 	 * @brief Destroys the in-order iterator for binary trees.
@@ -52,7 +53,7 @@ public:
 	 * @param other The in-order iterator for binary trees to copy.
 	 * @return A reference to the in-order iterator for binary trees.
 	 */
-	BinaryTreeInOrderIterator<ElementType>& operator=(const BinaryTreeInOrderIterator<ElementType>& other) = default;
+	BinaryTreeInOrderIterator<ElementType, NodeType>& operator=(const BinaryTreeInOrderIterator<ElementType, NodeType>& other) = default;
 	
 	/**
 	 * @brief Assigns the given in-order iterator for binary trees to this in-order iterator for binary trees using
@@ -60,7 +61,7 @@ public:
 	 * @param other The in-order iterator for binary trees to move.
 	 * @return A reference to the in-order iterator for binary trees.
 	 */
-	BinaryTreeInOrderIterator<ElementType>& operator=(BinaryTreeInOrderIterator<ElementType>&& other) noexcept = default;
+	BinaryTreeInOrderIterator<ElementType, NodeType>& operator=(BinaryTreeInOrderIterator<ElementType, NodeType>&& other) noexcept = default;
 	
 	/**
 	 * @brief Compares two in-order iterators for binary trees.
@@ -68,7 +69,7 @@ public:
 	 * @param other: The other in-order iterator for binary trees to compare with.
 	 * @return True if the two in-order iterators for binary trees are equal, false otherwise.
 	 */
-	bool operator==(const BinaryTreeInOrderIterator<ElementType>& other) const noexcept;
+	bool operator==(const BinaryTreeInOrderIterator<ElementType, NodeType>& other) const noexcept;
 
 	/**
 	 * @brief Dereferences the in-order iterator for binary trees.
@@ -86,67 +87,60 @@ public:
 	 * @brief Increments the in-order iterator for binary trees.
 	 * @return A reference to the in-order iterator for binary trees.
 	 */
-	BinaryTreeInOrderIterator<ElementType>& operator++() noexcept;
+	BinaryTreeInOrderIterator<ElementType, NodeType>& operator++() noexcept;
 	
 	/**
 	 * @brief Increments the in-order iterator for binary trees.
 	 * @return A copy of the in-order iterator for binary trees before it was incremented.
 	 */
-	BinaryTreeInOrderIterator<ElementType> operator++(int) noexcept;
+	BinaryTreeInOrderIterator<ElementType, NodeType> operator++(int) noexcept;
 
 private:
-	Stacks::SinglyLinkedListStack<BinaryTreeNode<ElementType>*> nodeStack {};
+	BinaryTreeIteratorStack<NodeType*> nodeStack {};
 };
 
-template<typename ElementType>
-BinaryTreeInOrderIterator<ElementType>::BinaryTreeInOrderIterator(BinaryTreeNode<ElementType>* node) noexcept {
+template<typename ElementType, typename NodeType>
+BinaryTreeInOrderIterator<ElementType, NodeType>::BinaryTreeInOrderIterator(NodeType* node) noexcept {
 	while (node != nullptr) {
 		nodeStack.push(node);
 		node = node->getLeftChild();
 	}
 }
 
-template<typename ElementType>
-bool BinaryTreeInOrderIterator<ElementType>::operator==(const BinaryTreeInOrderIterator<ElementType>& other) const noexcept {
-	return nodeStack == other.nodeStack;
+template<typename ElementType, typename NodeType>
+bool BinaryTreeInOrderIterator<ElementType, NodeType>::operator==(const BinaryTreeInOrderIterator<ElementType, NodeType>& other) const noexcept {
+	return nodeStack.getTop() == other.nodeStack.getTop();
 }
 
-template<typename ElementType>
-ElementType& BinaryTreeInOrderIterator<ElementType>::operator*() const noexcept {
+template<typename ElementType, typename NodeType>
+ElementType& BinaryTreeInOrderIterator<ElementType, NodeType>::operator*() const noexcept {
 	assert(!nodeStack.isEmpty() && "Cannot dereference a null iterator.");
-	auto* const node {*nodeStack.getTop()};
-	return node->getElement();
+	return nodeStack.getTop()->getElement();
 }
 
-template<typename ElementType>
-ElementType* BinaryTreeInOrderIterator<ElementType>::operator->() const noexcept {
+template<typename ElementType, typename NodeType>
+ElementType* BinaryTreeInOrderIterator<ElementType, NodeType>::operator->() const noexcept {
 	assert(!nodeStack.isEmpty() && "Cannot dereference a null iterator.");
-	return nodeStack.getTop();
+	return &nodeStack.getTop()->getElement();
 }
 
-template<typename ElementType>
-BinaryTreeInOrderIterator<ElementType>& BinaryTreeInOrderIterator<ElementType>::operator++() noexcept {
+template<typename ElementType, typename NodeType>
+BinaryTreeInOrderIterator<ElementType, NodeType>& BinaryTreeInOrderIterator<ElementType, NodeType>::operator++() noexcept {
 	assert(!nodeStack.isEmpty() && "Cannot increment a null iterator.");
 	
-	const auto optionalNode {nodeStack.pop()};
-	assert(optionalNode.has_value() && "Cannot increment a null iterator.");
+	auto* node {nodeStack.getTop()->getRightChild()};
+	nodeStack.pop();
 	
-	const auto& node {optionalNode.value()};
-	
-	if (auto* rightChild {node->getRightChild()}; rightChild != nullptr) {
-		auto currentNode {rightChild};
-		
-		while (currentNode != nullptr) {
-			nodeStack.push(currentNode);
-			currentNode = currentNode->getLeftChild();
-		}
+	while (node != nullptr) {
+		nodeStack.push(node);
+		node = node->getLeftChild();
 	}
 	
 	return *this;
 }
 
-template<typename ElementType>
-BinaryTreeInOrderIterator<ElementType> BinaryTreeInOrderIterator<ElementType>::operator++(int) noexcept {
+template<typename ElementType, typename NodeType>
+BinaryTreeInOrderIterator<ElementType, NodeType> BinaryTreeInOrderIterator<ElementType, NodeType>::operator++(int) noexcept {
 	auto iterator {*this};
 	++(*this);
 	return iterator;
@@ -10,29 +10,35 @@
 #include "BinaryTreeLevelOrderIterator.hpp"
 #include "BinaryTreePostOrderIterator.hpp"
 #include "BinaryTreePreOrderIterator.hpp"
+#include "ParentLinkedBinaryTreeConstInOrderIterator.hpp"
+#include "ParentLinkedBinaryTreeInOrderIterator.hpp"
 
 namespace Core::DataStructures::Trees::Iterators {
 /**
  * @brief A concept that requires the type to be a const iterator for binary trees.
  * @tparam IteratorType: The type to check.
  * @tparam ElementType: The type of the elements stored in the binary tree.
+ * @tparam NodeType: The type of the nodes of the binary tree.
  */
-template<typename IteratorType, typename ElementType>
+template<typename IteratorType, typename ElementType, typename NodeType = BinaryTreeNode<ElementType>>
 concept AllowedConstIterator =
-	std::same_as<IteratorType, BinaryTreeConstInOrderIterator<ElementType>> ||
-	std::same_as<IteratorType, BinaryTreeConstLevelOrderIterator<ElementType>> ||
-	std::same_as<IteratorType, BinaryTreeConstPostOrderIterator<ElementType>> ||
-	std::same_as<IteratorType, BinaryTreeConstPreOrderIterator<ElementType>>;
+	std::same_as<IteratorType, BinaryTreeConstInOrderIterator<ElementType, NodeType>> ||
+	std::same_as<IteratorType, BinaryTreeConstLevelOrderIterator<ElementType, NodeType>> ||
+	std::same_as<IteratorType, BinaryTreeConstPostOrderIterator<ElementType, NodeType>> ||
+	std::same_as<IteratorType, BinaryTreeConstPreOrderIterator<ElementType, NodeType>> ||
+	std::same_as<IteratorType, ParentLinkedBinaryTreeConstInOrderIterator<ElementType, NodeType>>;
 
 /**
  * @brief A concept that requires the type to be an iterator for binary trees.
  * @tparam IteratorType: The type to check.
  * @tparam ElementType: The type of the elements stored in the binary tree.
+ * @tparam NodeType: The type of the nodes of the binary tree.
  */
-template<typename IteratorType, typename ElementType>
+template<typename IteratorType, typename ElementType, typename NodeType = BinaryTreeNode<ElementType>>
 concept AllowedIterator =
-	std::same_as<IteratorType, BinaryTreeInOrderIterator<ElementType>> ||
-	std::same_as<IteratorType, BinaryTreeLevelOrderIterator<ElementType>> ||
-	std::same_as<IteratorType, BinaryTreePostOrderIterator<ElementType>> ||
-	std::same_as<IteratorType, BinaryTreePreOrderIterator<ElementType>>;
+	std::same_as<IteratorType, BinaryTreeInOrderIterator<ElementType, NodeType>> ||
+	std::same_as<IteratorType, BinaryTreeLevelOrderIterator<ElementType, NodeType>> ||
+	std::same_as<IteratorType, BinaryTreePostOrderIterator<ElementType, NodeType>> ||
+	std::same_as<IteratorType, BinaryTreePreOrderIterator<ElementType, NodeType>> ||
+	std::same_as<IteratorType, ParentLinkedBinaryTreeInOrderIterator<ElementType, NodeType>>;
 }
\ No newline at end of file
@@ -0,0 +1,232 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cassert>
+#include <utility>
+#include <vector>
+
+namespace Core::DataStructures::Trees::Iterators {
+/**
+ * @brief A queue of node pointers for the level-order iterators of binary trees that stores its nodes inline until it
+ * outgrows its inline capacity.
+ * @details The nodes are kept in a ring buffer, so enqueuing and dequeuing never shift nodes. A level-order iterator
+ * holds at most the rest of one level and the children of its visited part, so small trees and the first levels of
+ * larger ones are traversed without touching the heap. Once the inline ring buffer is full, its nodes are moved into
+ * a std::vector ring buffer twice as large, which keeps doubling with the widest level and is never shrunk. The queue
+ * keeps a pointer to whichever ring buffer is in use, so copies and moves rebind it. The iterators construct and
+ * increment without throwing, so if growing fails to allocate memory inside one of them, std::terminate is called.
+ * @class BinaryTreeIteratorQueue
+ * @tparam NodePointer: The type of the node pointers stored in the queue.
+ * @tparam InlineCapacity: The number of node pointers stored inline, which must be a power of two.
+ */
+template<typename NodePointer, std::size_t InlineCapacity = 32>
+class BinaryTreeIteratorQueue final {
+	static_assert(std::has_single_bit(InlineCapacity), "The inline capacity must be a power of two.");
+
+public:
+	/**
+	 * @brief Instantiates a new binary tree iterator queue with no nodes.
+	 */
+	BinaryTreeIteratorQueue() noexcept = default;
+	
+	/**
+	 * @brief Instantiates a new binary tree iterator queue by copying the given binary tree iterator queue.
+	 * @param other: The binary tree iterator queue to copy.
+	 */
+	BinaryTreeIteratorQueue(const BinaryTreeIteratorQueue<NodePointer, InlineCapacity>& other);
+	
+	/**
+	 * @brief Instantiates a new binary tree iterator queue by moving the given binary tree iterator queue, which is
+	 * left empty.
+	 * @param other: The binary tree iterator queue to move.
+	 */
+	BinaryTreeIteratorQueue(BinaryTreeIteratorQueue<NodePointer, InlineCapacity>&& other) noexcept;
+	
+	/**
+	 * @brief Destroys the binary tree iterator queue.
+	 */
+	~BinaryTreeIteratorQueue() noexcept = default;
+
+public:
+	/**
+	 * @brief Assigns the given binary tree iterator queue to this binary tree iterator queue using copy semantics.
+	 * @param other: The binary tree iterator queue to copy.
+	 * @return A reference to this binary tree iterator queue.
+	 */
+	BinaryTreeIteratorQueue<NodePointer, InlineCapacity>& operator=(const BinaryTreeIteratorQueue<NodePointer, InlineCapacity>& other);
+	
+	/**
+	 * @brief Assigns the given binary tree iterator queue to this binary tree iterator queue using move semantics,
+	 * leaving the given binary tree iterator queue empty.
+	 * @param other: The binary tree iterator queue to move.
+	 * @return A reference to this binary tree iterator queue.
+	 */
+	BinaryTreeIteratorQueue<NodePointer, InlineCapacity>& operator=(BinaryTreeIteratorQueue<NodePointer, InlineCapacity>&& other) noexcept;
+
+public:
+	/**
+	 * @brief Inserts the given node at the back of the binary tree iterator queue.
+	 * @param node: The node to insert at the back of the binary tree iterator queue.
+	 * @throws std::bad_alloc: Thrown if the ring buffer is full and memory allocation fails, which terminates the
+	 * program when enqueued from a noexcept iterator constructor or increment.
+	 */
+	void enqueue(NodePointer node);
+	
+	/**
+	 * @brief Removes the node at the front of the binary tree iterator queue, which must not be empty.
+	 * @return The node that was removed from the front of the binary tree iterator queue.
+	 */
+	NodePointer dequeue() noexcept;
+	
+	/**
+	 * @brief Gets the node at the front of the binary tree iterator queue.
+	 * @return The node at the front of the binary tree iterator queue, or nullptr if the binary tree iterator queue is
+	 * empty.
+	 */
+	NodePointer getFront() const noexcept;
+	
+	/**
+	 * @brief Checks if the binary tree iterator queue is empty.
+	 * @return True if the binary tree iterator queue is empty, false otherwise.
+	 */
+	bool isEmpty() const noexcept;
+	
+	/**
+	 * @brief Gets the number of nodes in the binary tree iterator queue.
+	 * @return The number of nodes in the binary tree iterator queue.
+	 */
+	std::size_t getSize() const noexcept;
+
+private:
+	/**
+	 * @brief Moves the nodes into a spilled ring buffer twice as large as the current one, starting at its front.
+	 */
+	void grow();
+	
+	/**
+	 * @brief Points the queue at the spilled ring buffer if there is one, or at the inline ring buffer otherwise.
+	 */
+	void bindNodes() noexcept;
+
+private:
+	std::array<NodePointer, InlineCapacity> inlineNodes {};
+	std::vector<NodePointer> spilledNodes {};
+	NodePointer* nodes {inlineNodes.data()};
+	std::size_t capacity {InlineCapacity};
+	std::size_t front {0};
+	std::size_t size {0};
+};
+
+template<typename NodePointer, std::size_t InlineCapacity>
+BinaryTreeIteratorQueue<NodePointer, InlineCapacity>::BinaryTreeIteratorQueue(
+		const BinaryTreeIteratorQueue<NodePointer, InlineCapacity>& other) :
+		inlineNodes {other.inlineNodes},
+		spilledNodes {other.spilledNodes},
+		capacity {other.capacity},
+		front {other.front},
+		size {other.size} {
+	bindNodes();
+}
+
+template<typename NodePointer, std::size_t InlineCapacity>
+BinaryTreeIteratorQueue<NodePointer, InlineCapacity>::BinaryTreeIteratorQueue(
+		BinaryTreeIteratorQueue<NodePointer, InlineCapacity>&& other) noexcept :
+		inlineNodes {other.inlineNodes},
+		spilledNodes {std::exchange(other.spilledNodes, {})},
+		capacity {std::exchange(other.capacity, InlineCapacity)},
+		front {std::exchange(other.front, 0)},
+		size {std::exchange(other.size, 0)} {
+	bindNodes();
+	other.bindNodes();
+}
+
+template<typename NodePointer, std::size_t InlineCapacity>
+BinaryTreeIteratorQueue<NodePointer, InlineCapacity>& BinaryTreeIteratorQueue<NodePointer, InlineCapacity>::operator=(
+		const BinaryTreeIteratorQueue<NodePointer, InlineCapacity>& other) {
+	if (this == &other) {
+		return *this;
+	}
+	
+	inlineNodes = other.inlineNodes;
+	spilledNodes = other.spilledNodes;
+	capacity = other.capacity;
+	front = other.front;
+	size = other.size;
+	bindNodes();
+	
+	return *this;
+}
+
+template<typename NodePointer, std::size_t InlineCapacity>
+BinaryTreeIteratorQueue<NodePointer, InlineCapacity>& BinaryTreeIteratorQueue<NodePointer, InlineCapacity>::operator=(
+		BinaryTreeIteratorQueue<NodePointer, InlineCapacity>&& other) noexcept {
+	if (this == &other) {
+		return *this;
+	}
+	
+	inlineNodes = other.inlineNodes;
+	spilledNodes = std::exchange(other.spilledNodes, {});
+	capacity = std::exchange(other.capacity, InlineCapacity);
+	front = std::exchange(other.front, 0);
+	size = std::exchange(other.size, 0);
+	bindNodes();
+	other.bindNodes();
+	
+	return *this;
+}
+
+template<typename NodePointer, std::size_t InlineCapacity>
+void BinaryTreeIteratorQueue<NodePointer, InlineCapacity>::enqueue(NodePointer node) {
+	if (size == capacity) {
+		grow();
+	}
+	
+	nodes[(front + size) & (capacity - 1)] = node;
+	++size;
+}
+
+template<typename NodePointer, std::size_t InlineCapacity>
+NodePointer BinaryTreeIteratorQueue<NodePointer, InlineCapacity>::dequeue() noexcept {
+	assert(size > 0 && "Cannot dequeue an empty queue.");
+	
+	const auto node {nodes[front]};
+	front = (front + 1) & (capacity - 1);
+	--size;
+	
+	return node;
+}
+
+template<typename NodePointer, std::size_t InlineCapacity>
+NodePointer BinaryTreeIteratorQueue<NodePointer, InlineCapacity>::getFront() const noexcept {
+	return size == 0 ? nullptr : nodes[front];
+}
+
+template<typename NodePointer, std::size_t InlineCapacity>
+bool BinaryTreeIteratorQueue<NodePointer, InlineCapacity>::isEmpty() const noexcept {
+	return size == 0;
+}
+
+template<typename NodePointer, std::size_t InlineCapacity>
+std::size_t BinaryTreeIteratorQueue<NodePointer, InlineCapacity>::getSize() const noexcept {
+	return size;
+}
+
+template<typename NodePointer, std::size_t InlineCapacity>
+void BinaryTreeIteratorQueue<NodePointer, InlineCapacity>::grow() {
+	std::vector<NodePointer> grownNodes(2 * capacity);
+	const auto wrappedNodes {std::copy(nodes + front, nodes + capacity, grownNodes.begin())};
+	std::copy(nodes, nodes + front, wrappedNodes);
+	
+	spilledNodes = std::move(grownNodes);
+	capacity = spilledNodes.size();
+	front = 0;
+	bindNodes();
+}
+
+template<typename NodePointer, std::size_t InlineCapacity>
+void BinaryTreeIteratorQueue<NodePointer, InlineCapacity>::bindNodes() noexcept {
+	nodes = spilledNodes.empty() ? inlineNodes.data() : spilledNodes.data();
+}
+}
\ No newline at end of file
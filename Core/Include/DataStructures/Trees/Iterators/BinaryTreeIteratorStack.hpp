@@ -0,0 +1,160 @@
+#pragma once
+
+#include <array>
+#include <cassert>
+#include <utility>
+#include <vector>
+
+namespace Core::DataStructures::Trees::Iterators {
+/**
+ * @brief A stack of node pointers for the depth first iterators of binary trees that stores its bottom nodes inline.
+ * @details A depth first iterator only holds the nodes on the path from the root to its current node, and at most one
+ * pending sibling per level, so for any balanced tree small enough to fit in memory every push and pop stays within the
+ * inline array and never touches the heap. Nodes beyond the inline capacity, which only a degenerate tree such as a
+ * binary search tree built from sorted elements reaches, are spilled into a std::vector. The iterators construct and
+ * increment without throwing, so if spilling fails to allocate memory inside one of them, std::terminate is called.
+ * @class BinaryTreeIteratorStack
+ * @tparam NodePointer: The type of the node pointers stored in the stack.
+ * @tparam InlineCapacity: The number of node pointers stored inline.
+ */
+template<typename NodePointer, std::size_t InlineCapacity = 48>
+class BinaryTreeIteratorStack final {
+public:
+	/**
+	 * @brief Instantiates a new binary tree iterator stack with no nodes.
+	 */
+	BinaryTreeIteratorStack() noexcept = default;
+	
+	/**
+	 * @brief Instantiates a new binary tree iterator stack by copying the given binary tree iterator stack.
+	 * @param other: The binary tree iterator stack to copy.
+	 */
+	BinaryTreeIteratorStack(const BinaryTreeIteratorStack<NodePointer, InlineCapacity>& other) = default;
+	
+	/**
+	 * @brief Instantiates a new binary tree iterator stack by moving the given binary tree iterator stack.
+	 * @details The given binary tree iterator stack is left empty.
+	 * @param other: The binary tree iterator stack to move.
+	 */
+	BinaryTreeIteratorStack(BinaryTreeIteratorStack<NodePointer, InlineCapacity>&& other) noexcept;
+	
+	/**
+	 * @brief Destroys the binary tree iterator stack.
+	 */
+	~BinaryTreeIteratorStack() noexcept = default;
+
+public:
+	/**
+	 * @brief Assigns the given binary tree iterator stack to this binary tree iterator stack using copy semantics.
+	 * @param other: The binary tree iterator stack to copy.
+	 * @return A reference to this binary tree iterator stack.
+	 */
+	BinaryTreeIteratorStack<NodePointer, InlineCapacity>& operator=(const BinaryTreeIteratorStack<NodePointer, InlineCapacity>& other) = default;
+	
+	/**
+	 * @brief Assigns the given binary tree iterator stack to this binary tree iterator stack using move semantics.
+	 * @details The given binary tree iterator stack is left empty.
+	 * @param other: The binary tree iterator stack to move.
+	 * @return A reference to this binary tree iterator stack.
+	 */
+	BinaryTreeIteratorStack<NodePointer, InlineCapacity>& operator=(BinaryTreeIteratorStack<NodePointer, InlineCapacity>&& other) noexcept;
+
+public:
+	/**
+	 * @brief Inserts the given node at the top of the binary tree iterator stack.
+	 * @param node: The node to push onto the top of the binary tree iterator stack.
+	 * @throws std::bad_alloc: Thrown if the inline array is full and memory allocation fails, which terminates the
+	 * program when pushed from a noexcept iterator constructor or increment.
+	 */
+	void push(NodePointer node);
+	
+	/**
+	 * @brief Removes the node at the top of the binary tree iterator stack, which must not be empty.
+	 */
+	void pop() noexcept;
+	
+	/**
+	 * @brief Gets the node at the top of the binary tree iterator stack.
+	 * @return The node at the top of the binary tree iterator stack, or nullptr if the binary tree iterator stack is
+	 * empty.
+	 */
+	NodePointer getTop() const noexcept;
+	
+	/**
+	 * @brief Checks if the binary tree iterator stack is empty.
+	 * @return True if the binary tree iterator stack is empty, false otherwise.
+	 */
+	bool isEmpty() const noexcept;
+	
+	/**
+	 * @brief Gets the number of nodes in the binary tree iterator stack.
+	 * @return The number of nodes in the binary tree iterator stack.
+	 */
+	std::size_t getSize() const noexcept;
+
+private:
+	std::array<NodePointer, InlineCapacity> inlineNodes {};
+	std::vector<NodePointer> spilledNodes {};
+	std::size_t size {0};
+};
+
+template<typename NodePointer, std::size_t InlineCapacity>
+BinaryTreeIteratorStack<NodePointer, InlineCapacity>::BinaryTreeIteratorStack(BinaryTreeIteratorStack<NodePointer, InlineCapacity>&& other) noexcept :
+		inlineNodes {other.inlineNodes},
+		spilledNodes {std::move(other.spilledNodes)},
+		size {std::exchange(other.size, 0)} {
+	
+}
+
+template<typename NodePointer, std::size_t InlineCapacity>
+BinaryTreeIteratorStack<NodePointer, InlineCapacity>& BinaryTreeIteratorStack<NodePointer, InlineCapacity>::operator=(BinaryTreeIteratorStack<NodePointer, InlineCapacity>&& other) noexcept {
+	if (this != &other) {
+		inlineNodes = other.inlineNodes;
+		spilledNodes = std::move(other.spilledNodes);
+		other.spilledNodes.clear();
+		size = std::exchange(other.size, 0);
+	}
+	
+	return *this;
+}
+
+template<typename NodePointer, std::size_t InlineCapacity>
+void BinaryTreeIteratorStack<NodePointer, InlineCapacity>::push(NodePointer node) {
+	if (size < InlineCapacity) {
+		inlineNodes[size] = node;
+	} else {
+		spilledNodes.push_back(node);
+	}
+	
+	++size;
+}
+
+template<typename NodePointer, std::size_t InlineCapacity>
+void BinaryTreeIteratorStack<NodePointer, InlineCapacity>::pop() noexcept {
+	assert(size > 0 && "Cannot pop an empty stack.");
+	
+	--size;
+	if (size >= InlineCapacity) {
+		spilledNodes.pop_back();
+	}
+}
+
+template<typename NodePointer, std::size_t InlineCapacity>
+NodePointer BinaryTreeIteratorStack<NodePointer, InlineCapacity>::getTop() const noexcept {
+	if (size == 0) {
+		return nullptr;
+	}
+	
+	return size > InlineCapacity ? spilledNodes.back() : inlineNodes[size - 1];
+}
+
+template<typename NodePointer, std::size_t InlineCapacity>
+bool BinaryTreeIteratorStack<NodePointer, InlineCapacity>::isEmpty() const noexcept {
+	return size == 0;
+}
+
+template<typename NodePointer, std::size_t InlineCapacity>
+std::size_t BinaryTreeIteratorStack<NodePointer, InlineCapacity>::getSize() const noexcept {
+	return size;
+}
+}
\ No newline at end of file
@@ -3,15 +3,16 @@
 #include <iterator>
 
 #include "DataStructures/Trees/BinaryTreeNode.hpp"
-#include "DataStructures/Queues/SinglyLinkedListQueue.hpp"
+#include "DataStructures/Trees/Iterators/BinaryTreeIteratorQueue.hpp"
 
 namespace Core::DataStructures::Trees::Iterators {
 /**
  * @brief An iterator that traverses a binary tree in level order.
  * @class BinaryTreeLevelOrderIterator
  * @tparam ElementType: The type of the elements stored in the binary tree.
+ * @tparam NodeType: The type of the nodes of the binary tree.
  */
-template<typename ElementType>
+template<typename ElementType, typename NodeType = BinaryTreeNode<ElementType>>
 class BinaryTreeLevelOrderIterator final {
 public:
 	using iterator_category = std::forward_iterator_tag;
@@ -24,21 +25,21 @@ public:
 	 * @brief Instantiates a new level order iterator for binary trees.
 	 * @param node: The node to iterate from.
 	 */
-	explicit BinaryTreeLevelOrderIterator(BinaryTreeNode<ElementType>* node) noexcept;
+	explicit BinaryTreeLevelOrderIterator(NodeType* node) noexcept;
 	
 	/**
 	 * @brief Instantiates a new level order iterator for binary trees by copying the given level order iterator for
 	 * binary trees.
 	 * @param other The level order iterator for binary trees to copy.
 	 */
-	BinaryTreeLevelOrderIterator(const BinaryTreeLevelOrderIterator<ElementType>& other) = default;
+	BinaryTreeLevelOrderIterator(const BinaryTreeLevelOrderIterator<ElementType, NodeType>& other) = default;
 	
 	/**
 	 * @brief Instantiates a new level order iterator for binary trees by moving the given level order iterator for
 	 * binary trees.
 	 * @param other The level order iterator for binary trees to move.
 	 */
-	BinaryTreeLevelOrderIterator(BinaryTreeLevelOrderIterator<ElementType>&& other) noexcept = default;
+	BinaryTreeLevelOrderIterator(BinaryTreeLevelOrderIterator<ElementType, NodeType>&& other) noexcept = default;
 	
 	/**
 	 * @brief Destroys the level order iterator for binary trees.
@@ -52,7 +53,7 @@ public:
 	 * @param other The level order iterator for binary trees to copy.
 	 * @return A reference to the level order iterator for binary trees.
 	 */
-	BinaryTreeLevelOrderIterator<ElementType>& operator=(const BinaryTreeLevelOrderIterator<ElementType>& other) = default;
+	BinaryTreeLevelOrderIterator<ElementType, NodeType>& operator=(const BinaryTreeLevelOrderIterator<ElementType, NodeType>& other) = default;
 	
 	/**
 	 * @brief Assigns the given level order iterator for binary trees to this level order iterator for binary trees
@@ -60,7 +61,7 @@ public:
 	 * @param other The level order iterator for binary trees to move.
 	 * @return A reference to the level order iterator for binary trees.
 	 */
-	BinaryTreeLevelOrderIterator<ElementType>& operator=(BinaryTreeLevelOrderIterator<ElementType>&& other) noexcept = default;
+	BinaryTreeLevelOrderIterator<ElementType, NodeType>& operator=(BinaryTreeLevelOrderIterator<ElementType, NodeType>&& other) noexcept = default;
 	
 	/**
 	 * @brief Compares two level order iterators for binary trees.
@@ -68,8 +69,8 @@ public:
 	 * @param other: The other level order iterator for binary trees to compare with.
 	 * @return True if the two level order iterators for binary trees are equal, false otherwise.
 	 */
-	bool operator==(const BinaryTreeLevelOrderIterator<ElementType>& other) const noexcept;
-
+	bool operator==(const BinaryTreeLevelOrderIterator<ElementType, NodeType>& other) const noexcept;
+	
 	/**
 	 * @brief Dereferences the level order iterator for binary trees.
 	 * @return A reference to the element stored in the node pointed to by the level order iterator for binary trees.
@@ -86,52 +87,51 @@ public:
 	 * @brief Increments the level order iterator for binary trees.
 	 * @return A reference to the level order iterator for binary trees.
 	 */
-	BinaryTreeLevelOrderIterator<ElementType>& operator++() noexcept;
+	BinaryTreeLevelOrderIterator<ElementType, NodeType>& operator++() noexcept;
 	
 	/**
 	 * @brief Increments the level order iterator for binary trees.
 	 * @return A copy of the level order iterator for binary trees before it was incremented.
 	 */
-	BinaryTreeLevelOrderIterator<ElementType> operator++(int) noexcept;
+	BinaryTreeLevelOrderIterator<ElementType, NodeType> operator++(int) noexcept;
 
 private:
-	Queues::SinglyLinkedListQueue<BinaryTreeNode<ElementType>*> nodeQueue {};
+	BinaryTreeIteratorQueue<NodeType*> nodeQueue {};
 };
 
-template<typename ElementType>
-BinaryTreeLevelOrderIterator<ElementType>::BinaryTreeLevelOrderIterator(BinaryTreeNode<ElementType>* node) noexcept {
+template<typename ElementType, typename NodeType>
+BinaryTreeLevelOrderIterator<ElementType, NodeType>::BinaryTreeLevelOrderIterator(NodeType* node) noexcept {
 	if (node != nullptr) {
 		nodeQueue.enqueue(node);
 	}
 }
 
-template<typename ElementType>
-bool BinaryTreeLevelOrderIterator<ElementType>::operator==(const BinaryTreeLevelOrderIterator<ElementType>& other) const noexcept {
-	return nodeQueue == other.nodeQueue;
+template<typename ElementType, typename NodeType>
+bool BinaryTreeLevelOrderIterator<ElementType, NodeType>::operator==(const BinaryTreeLevelOrderIterator<ElementType, NodeType>& other) const noexcept {
+	if (nodeQueue.isEmpty() || other.nodeQueue.isEmpty()) {
+		return nodeQueue.isEmpty() && other.nodeQueue.isEmpty();
+	}
+	
+	return nodeQueue.getFront() == other.nodeQueue.getFront();
 }
 
-template<typename ElementType>
-ElementType& BinaryTreeLevelOrderIterator<ElementType>::operator*() const noexcept {
+template<typename ElementType, typename NodeType>
+ElementType& BinaryTreeLevelOrderIterator<ElementType, NodeType>::operator*() const noexcept {
 	assert(!nodeQueue.isEmpty() && "Cannot dereference a null iterator.");
-	const auto* const node {nodeQueue.getFront()};
-	
-	return (*node)->getElement();
+	return nodeQueue.getFront()->getElement();
 }
 
-template<typename ElementType>
-ElementType* BinaryTreeLevelOrderIterator<ElementType>::operator->() const noexcept {
+template<typename ElementType, typename NodeType>
+ElementType* BinaryTreeLevelOrderIterator<ElementType, NodeType>::operator->() const noexcept {
 	assert(!nodeQueue.isEmpty() && "Cannot dereference a null iterator.");
-	return nodeQueue.getFront();
+	return &nodeQueue.getFront()->getElement();
 }
 
-template<typename ElementType>
-BinaryTreeLevelOrderIterator<ElementType>& BinaryTreeLevelOrderIterator<ElementType>::operator++() noexcept {
+template<typename ElementType, typename NodeType>
+BinaryTreeLevelOrderIterator<ElementType, NodeType>& BinaryTreeLevelOrderIterator<ElementType, NodeType>::operator++() noexcept {
 	assert(!nodeQueue.isEmpty() && "Cannot increment a null iterator.");
 	
-	const auto optionalNode {nodeQueue.dequeue()};
-	assert(optionalNode.has_value() && "Queue should not be empty.");
-	
-	const auto& node {optionalNode.value()};
+	auto* const node {nodeQueue.dequeue()};
 	
 	if (node->getLeftChild() != nullptr) {
 		nodeQueue.enqueue(node->getLeftChild());
@@ -144,8 +144,8 @@ BinaryTreeLevelOrderIterator<ElementType>& BinaryTreeLevelOrderIterator<ElementT
 	return *this;
 }
 
-template<typename ElementType>
-BinaryTreeLevelOrderIterator<ElementType> BinaryTreeLevelOrderIterator<ElementType>::operator++(int) noexcept {
+template<typename ElementType, typename NodeType>
+BinaryTreeLevelOrderIterator<ElementType, NodeType> BinaryTreeLevelOrderIterator<ElementType, NodeType>::operator++(int) noexcept {
 	auto iterator {*this};
 	++(*this);
 	return iterator;
@@ -3,15 +3,16 @@
 #include <iterator>
 
 #include "DataStructures/Trees/BinaryTreeNode.hpp"
-#include "DataStructures/Stacks/SinglyLinkedListStack.hpp"
+#include "DataStructures/Trees/Iterators/BinaryTreeIteratorStack.hpp"
 
 namespace Core::DataStructures::Trees::Iterators {
 /**
  * @brief A post-order iterator for binary trees.
  * @class BinaryTreePostOrderIterator
  * @tparam ElementType: The type of the elements stored in the binary tree.
+ * @tparam NodeType: The type of the nodes of the binary tree.
  */
-template<typename ElementType>
+template<typename ElementType, typename NodeType = BinaryTreeNode<ElementType>>
 class BinaryTreePostOrderIterator final {
 public:
 	using iterator_category = std::forward_iterator_tag;
@@ -24,21 +25,21 @@ public:
 	 * @brief Instantiates a new post-order iterator for binary trees.
 	 * @param node: The node to iterate from.
 	 */
-	explicit BinaryTreePostOrderIterator(BinaryTreeNode<ElementType>* node) noexcept;
+	explicit BinaryTreePostOrderIterator(NodeType* node) noexcept;
 	
 	/**
 	 * @brief Instantiates a new post-order iterator for binary trees by copying the given post-order iterator for binary
 	 * trees.
 	 * @param other The post-order iterator for binary trees to copy.
 	 */
-	BinaryTreePostOrderIterator(const BinaryTreePostOrderIterator<ElementType>& other) = default;
+	BinaryTreePostOrderIterator(const BinaryTreePostOrderIterator<ElementType, NodeType>& other) = default;
 	
 	/**
 	 * @brief Instantiates a new post-order iterator for binary trees by moving the given post-order iterator for binary
 	 * trees.
 	 * @param other The post-order iterator for binary trees to move.
 	 */
-	BinaryTreePostOrderIterator(BinaryTreePostOrderIterator<ElementType>&& other) noexcept = default;
+	BinaryTreePostOrderIterator(BinaryTreePostOrderIterator<ElementType, NodeType>&& other) noexcept = default;
 	
 	/**
 	 * @brief Destroys the post-order iterator for binary trees.
@@ -52,7 +53,7 @@ public:
 	 * @param other The post-order iterator for binary trees to copy.
 	 * @return A reference to the post-order iterator for binary trees.
 	 */
-	BinaryTreePostOrderIterator<ElementType>& operator=(const BinaryTreePostOrderIterator<ElementType>& other) = default;
+	BinaryTreePostOrderIterator<ElementType, NodeType>& operator=(const BinaryTreePostOrderIterator<ElementType, NodeType>& other) = default;
 	
 	/**
 	 * @brief Assigns the given post-order iterator for binary trees to this post-order iterator for binary trees using
@@ -60,7 +61,7 @@ public:
 	 * @param other The post-order iterator for binary trees to move.
 	 * @return A reference to the post-order iterator for binary trees.
 	 */
-	BinaryTreePostOrderIterator<ElementType>& operator=(BinaryTreePostOrderIterator<ElementType>&& other) noexcept = default;
+	BinaryTreePostOrderIterator<ElementType, NodeType>& operator=(BinaryTreePostOrderIterator<ElementType, NodeType>&& other) noexcept = default;
 	
 	/**
 	 * @brief Compares two post-order iterators for binary trees.
@@ -68,7 +69,7 @@ public:
 	 * @param other: The other post-order iterator for binary trees to compare with.
 	 * @return True if the two post-order iterators for binary trees are equal, false otherwise.
 	 */
-	bool operator==(const BinaryTreePostOrderIterator<ElementType>& other) const noexcept;
+	bool operator==(const BinaryTreePostOrderIterator<ElementType, NodeType>& other) const noexcept;
 
 	/**
 	 * @brief Dereferences the post-order iterator for binary trees.
@@ -86,73 +87,74 @@ public:
 	 * @brief Increments the post-order iterator for binary trees.
 	 * @return A reference to the post-order iterator for binary trees.
 	 */
-	BinaryTreePostOrderIterator<ElementType>& operator++() noexcept;
+	BinaryTreePostOrderIterator<ElementType, NodeType>& operator++() noexcept;
 	
 	/**
 	 * @brief Increments the post-order iterator for binary trees.
 	 * @return A copy of the post-order iterator for binary trees before it was incremented.
 	 */
-	BinaryTreePostOrderIterator<ElementType> operator++(int) noexcept;
+	BinaryTreePostOrderIterator<ElementType, NodeType> operator++(int) noexcept;
 
 private:
-	Stacks::SinglyLinkedListStack<BinaryTreeNode<ElementType>*> nodeStack {};
+	/**
+	 * @brief Pushes the path from the given node down to the node of its subtree that comes first in post-order, which
+	 * is reached by descending to the left child whenever there is one and to the right child otherwise.
+	 * @param node: The root of the subtree, or nullptr to push nothing.
+	 */
+	void pushPathToFirstNode(NodeType* node) noexcept;
+
+private:
+	BinaryTreeIteratorStack<NodeType*> nodeStack {};
 };
 
-template<typename ElementType>
-BinaryTreePostOrderIterator<ElementType>::BinaryTreePostOrderIterator(BinaryTreeNode<ElementType>* node) noexcept {
-	if (node == nullptr) {
-		return;
-	}
-	
-	auto stack {Stacks::SinglyLinkedListStack<BinaryTreeNode<ElementType>*> {}};
-	stack.push(node);
-	
-	while (!stack.isEmpty()) {
-		const auto optionalNode {stack.pop()};
-		assert(optionalNode.has_value() && "Stack should not be empty.");
-		
-		const auto& node {optionalNode.value()};
-		nodeStack.push(node);
-		
-		if (node->getLeftChild() != nullptr) {
-			stack.push(node->getLeftChild());
-		}
-		
-		if (node->getRightChild() != nullptr) {
-			stack.push(node->getRightChild());
-		}
-	}
+template<typename ElementType, typename NodeType>
+BinaryTreePostOrderIterator<ElementType, NodeType>::BinaryTreePostOrderIterator(NodeType* node) noexcept {
+	pushPathToFirstNode(node);
 }
 
-template<typename ElementType>
-bool BinaryTreePostOrderIterator<ElementType>::operator==(const BinaryTreePostOrderIterator<ElementType>& other) const noexcept {
-	return nodeStack == other.nodeStack;
+template<typename ElementType, typename NodeType>
+bool BinaryTreePostOrderIterator<ElementType, NodeType>::operator==(const BinaryTreePostOrderIterator<ElementType, NodeType>& other) const noexcept {
+	return nodeStack.getTop() == other.nodeStack.getTop();
 }
 
-template<typename ElementType>
-ElementType& BinaryTreePostOrderIterator<ElementType>::operator*() const noexcept {
+template<typename ElementType, typename NodeType>
+ElementType& BinaryTreePostOrderIterator<ElementType, NodeType>::operator*() const noexcept {
 	assert(!nodeStack.isEmpty() && "Cannot dereference a null iterator.");
-	auto* const node {*nodeStack.getTop()};
-	return node->getElement();
+	return nodeStack.getTop()->getElement();
 }
 
-template<typename ElementType>
-ElementType* BinaryTreePostOrderIterator<ElementType>::operator->() const noexcept {
+template<typename ElementType, typename NodeType>
+ElementType* BinaryTreePostOrderIterator<ElementType, NodeType>::operator->() const noexcept {
 	assert(!nodeStack.isEmpty() && "Cannot dereference a null iterator.");
-	return nodeStack.getTop();
+	return &nodeStack.getTop()->getElement();
 }
 
-template<typename ElementType>
-BinaryTreePostOrderIterator<ElementType>& BinaryTreePostOrderIterator<ElementType>::operator++() noexcept {
+template<typename ElementType, typename NodeType>
+BinaryTreePostOrderIterator<ElementType, NodeType>& BinaryTreePostOrderIterator<ElementType, NodeType>::operator++() noexcept {
 	assert(!nodeStack.isEmpty() && "Cannot increment a null iterator.");
+	
+	auto* const node {nodeStack.getTop()};
 	nodeStack.pop();
+	
+	if (auto* const parent {nodeStack.getTop()}; parent != nullptr && parent->getLeftChild() == node) {
+		pushPathToFirstNode(parent->getRightChild());
+	}
+	
 	return *this;
 }
 
-template<typename ElementType>
-BinaryTreePostOrderIterator<ElementType> BinaryTreePostOrderIterator<ElementType>::operator++(int) noexcept {
+template<typename ElementType, typename NodeType>
+BinaryTreePostOrderIterator<ElementType, NodeType> BinaryTreePostOrderIterator<ElementType, NodeType>::operator++(int) noexcept {
 	auto iterator {*this};
 	++(*this);
 	return iterator;
 }
+
+template<typename ElementType, typename NodeType>
+void BinaryTreePostOrderIterator<ElementType, NodeType>::pushPathToFirstNode(NodeType* node) noexcept {
+	while (node != nullptr) {
+		nodeStack.push(node);
+		node = node->getLeftChild() != nullptr ? node->getLeftChild() : node->getRightChild();
+	}
+}
 }
\ No newline at end of file
@@ -3,15 +3,16 @@
 #include <iterator>
 
 #include "DataStructures/Trees/BinaryTreeNode.hpp"
-#include "DataStructures/Stacks/SinglyLinkedListStack.hpp"
+#include "DataStructures/Trees/Iterators/BinaryTreeIteratorStack.hpp"
 
 namespace Core::DataStructures::Trees::Iterators {
 /**
  * @brief A pre-order iterator for binary trees.
  * @class BinaryTreePreOrderIterator
  * @tparam ElementType: The type of the elements stored in the binary tree.
+ * @tparam NodeType: The type of the nodes of the binary tree.
  */
-template<typename ElementType>
+template<typename ElementType, typename NodeType = BinaryTreeNode<ElementType>>
 class BinaryTreePreOrderIterator final {
 public:
 	using iterator_category = std::forward_iterator_tag;
@@ -24,21 +25,21 @@ public:
 	 * @brief Instantiates a new pre-order iterator for binary trees.
 	 * @param node: The node to iterate from.
 	 */
-	explicit BinaryTreePreOrderIterator(BinaryTreeNode<ElementType>* node) noexcept;
+	explicit BinaryTreePreOrderIterator(NodeType* node) noexcept;
 	
 	/**
 	 * @brief Instantiates a new pre-order iterator for binary trees by copying the given pre-order iterator for binary
 	 * trees.
 	 * @param other The pre-order iterator for binary trees to copy.
 	 */
-	BinaryTreePreOrderIterator(const BinaryTreePreOrderIterator<ElementType>& other) = default;
+	BinaryTreePreOrderIterator(const BinaryTreePreOrderIterator<ElementType, NodeType>& other) = default;
 	
 	/**
 	 * @brief Instantiates a new pre-order iterator for binary trees by moving the given pre-order iterator for binary
 	 * trees.
 	 * @param other The pre-order iterator for binary trees to move.
 	 */
-	BinaryTreePreOrderIterator(BinaryTreePreOrderIterator<ElementType>&& other) noexcept = default;
+	BinaryTreePreOrderIterator(BinaryTreePreOrderIterator<ElementType, NodeType>&& other) noexcept = default;
 	
 	/**
 	 * @brief Destroys the pre-order iterator for binary trees.
@@ -52,7 +53,7 @@ public:
 	 * @param other The pre-order iterator for binary trees to copy.
 	 * @return A reference to the pre-order iterator for binary trees.
 	 */
-	BinaryTreePreOrderIterator<ElementType>& operator=(const BinaryTreePreOrderIterator<ElementType>& other) = default;
+	BinaryTreePreOrderIterator<ElementType, NodeType>& operator=(const BinaryTreePreOrderIterator<ElementType, NodeType>& other) = default;
 	
 	/**
 	 * @brief Assigns the given pre-order iterator for binary trees to this pre-order iterator for binary trees using
@@ -60,7 +61,7 @@ public:
 	 * @param other The pre-order iterator for binary trees to move.
 	 * @return A reference to the pre-order iterator for binary trees.
 	 */
-	BinaryTreePreOrderIterator<ElementType>& operator=(BinaryTreePreOrderIterator<ElementType>&& other) noexcept = default;
+	BinaryTreePreOrderIterator<ElementType, NodeType>& operator=(BinaryTreePreOrderIterator<ElementType, NodeType>&& other) noexcept = default;
 	
 	/**
 	 * @brief Compares two pre-order iterators for binary trees.
@@ -68,7 +69,7 @@ public:
 	 * @param other: The other pre-order iterator for binary trees to compare with.
 	 * @return True if the two pre-order iterators for binary trees are equal, false otherwise.
 	 */
-	bool operator==(const BinaryTreePreOrderIterator<ElementType>& other) const noexcept;
+	bool operator==(const BinaryTreePreOrderIterator<ElementType, NodeType>& other) const noexcept;
 
 	/**
 	 * @brief Dereferences the pre-order iterator for binary trees.
@@ -86,51 +87,48 @@ public:
 	 * @brief Increments the pre-order iterator for binary trees.
 	 * @return A reference to the pre-order iterator for binary trees.
 	 */
-	BinaryTreePreOrderIterator<ElementType>& operator++() noexcept;
+	BinaryTreePreOrderIterator<ElementType, NodeType>& operator++() noexcept;
 	
 	/**
 	 * @brief Increments the pre-order iterator for binary trees.
 	 * @return A copy of the pre-order iterator for binary trees before it was incremented.
 	 */
-	BinaryTreePreOrderIterator<ElementType> operator++(int) noexcept;
+	BinaryTreePreOrderIterator<ElementType, NodeType> operator++(int) noexcept;
 
 private:
-	Stacks::SinglyLinkedListStack<BinaryTreeNode<ElementType>*> nodeStack {};
+	BinaryTreeIteratorStack<NodeType*> nodeStack {};
 };
 
-template<typename ElementType>
-BinaryTreePreOrderIterator<ElementType>::BinaryTreePreOrderIterator(BinaryTreeNode<ElementType>* node) noexcept {
+template<typename ElementType, typename NodeType>
+BinaryTreePreOrderIterator<ElementType, NodeType>::BinaryTreePreOrderIterator(NodeType* node) noexcept {
 	if (node != nullptr) {
 		nodeStack.push(node);
 	}
 }
 
-template<typename ElementType>
-bool BinaryTreePreOrderIterator<ElementType>::operator==(const BinaryTreePreOrderIterator<ElementType>& other) const noexcept {
-	return nodeStack == other.nodeStack;
+template<typename ElementType, typename NodeType>
+bool BinaryTreePreOrderIterator<ElementType, NodeType>::operator==(const BinaryTreePreOrderIterator<ElementType, NodeType>& other) const noexcept {
+	return nodeStack.getTop() == other.nodeStack.getTop();
 }
 
-template<typename ElementType>
-ElementType& BinaryTreePreOrderIterator<ElementType>::operator*() const noexcept {
+template<typename ElementType, typename NodeType>
+ElementType& BinaryTreePreOrderIterator<ElementType, NodeType>::operator*() const noexcept {
 	assert(!nodeStack.isEmpty() && "Cannot dereference a null iterator.");
-	auto* const node {*nodeStack.getTop()};
-	return node->getElement();
+	return nodeStack.getTop()->getElement();
 }
 
-template<typename ElementType>
-ElementType* BinaryTreePreOrderIterator<ElementType>::operator->() const noexcept {
+template<typename ElementType, typename NodeType>
+ElementType* BinaryTreePreOrderIterator<ElementType, NodeType>::operator->() const noexcept {
 	assert(!nodeStack.isEmpty() && "Cannot dereference a null iterator.");
-	return nodeStack.getTop();
+	return &nodeStack.getTop()->getElement();
 }
 
-template<typename ElementType>
-BinaryTreePreOrderIterator<ElementType>& BinaryTreePreOrderIterator<ElementType>::operator++() noexcept {
+template<typename ElementType, typename NodeType>
+BinaryTreePreOrderIterator<ElementType, NodeType>& BinaryTreePreOrderIterator<ElementType, NodeType>::operator++() noexcept {
 	assert(!nodeStack.isEmpty() && "Cannot increment a null iterator.");
 	
-	const auto optionalNode {nodeStack.pop()};
-	assert(optionalNode.has_value() && "Cannot increment a null iterator.");
-	
-	const auto& node {optionalNode.value()};
+	auto* const node {nodeStack.getTop()};
+	nodeStack.pop();
 	
 	if (node->getRightChild() != nullptr) {
 		nodeStack.push(node->getRightChild());
@@ -143,8 +141,8 @@ BinaryTreePreOrderIterator<ElementType>& BinaryTreePreOrderIterator<ElementType>
 	return *this;
 }
 
-template<typename ElementType>
-BinaryTreePreOrderIterator<ElementType> BinaryTreePreOrderIterator<ElementType>::operator++(int) noexcept {
+template<typename ElementType, typename NodeType>
+BinaryTreePreOrderIterator<ElementType, NodeType> BinaryTreePreOrderIterator<ElementType, NodeType>::operator++(int) noexcept {
 	auto iterator {*this};
 	++(*this);
 	return iterator;
@@ -0,0 +1,161 @@
+#pragma once
+
+#include <cassert>
+#include <iterator>
+
+#include "DataStructures/Trees/ParentLinkedBinaryTreeNode.hpp"
+
+namespace Core::DataStructures::Trees::Iterators {
+/**
+ * @brief A const in-order iterator for binary trees whose nodes link to their parents.
+ * @details The iterator is a single node pointer. The next node is the leftmost node of the right subtree, or else the
+ * first ancestor reached from a left subtree, so incrementing takes amortized O(1) time without any stack, copying the
+ * iterator is as cheap as copying a pointer, and the iterator stays valid while other nodes are inserted or removed.
+ * @class ParentLinkedBinaryTreeConstInOrderIterator
+ * @tparam ElementType: The type of the elements stored in the binary tree.
+ * @tparam NodeType: The type of the nodes of the binary tree, which must link to their parents.
+ */
+template<typename ElementType, typename NodeType = ParentLinkedBinaryTreeNode<ElementType>>
+class ParentLinkedBinaryTreeConstInOrderIterator final {
+public:
+	using iterator_category = std::forward_iterator_tag;
+	using difference_type = std::ptrdiff_t;
+	using value_type = ElementType;
+	using reference = const ElementType&;
+	using pointer = const ElementType*;
+	
+	/**
+	 * @brief Instantiates a new const in-order iterator for parent linked binary trees.
+	 * @param node: The node to point to, or nullptr for an iterator past the last node.
+	 */
+	explicit ParentLinkedBinaryTreeConstInOrderIterator(const NodeType* node) noexcept;
+	
+	/**
+	 * @brief Instantiates a new const in-order iterator for parent linked binary trees by copying the given const
+	 * in-order iterator for parent linked binary trees.
+	 * @param other The const in-order iterator for parent linked binary trees to copy.
+	 */
+	ParentLinkedBinaryTreeConstInOrderIterator(const ParentLinkedBinaryTreeConstInOrderIterator<ElementType, NodeType>& other) noexcept = default;
+	
+	/**
+	 * @brief Instantiates a new const in-order iterator for parent linked binary trees by moving the given const
+	 * in-order iterator for parent linked binary trees.
+	 * @param other The const in-order iterator for parent linked binary trees to move.
+	 */
+	ParentLinkedBinaryTreeConstInOrderIterator(ParentLinkedBinaryTreeConstInOrderIterator<ElementType, NodeType>&& other) noexcept = default;
+	
+	/**
+	 * @brief Destroys the const in-order iterator for parent linked binary trees.
+	 */
+	~ParentLinkedBinaryTreeConstInOrderIterator() noexcept = default;
+
+public:
+	/**
+	 * @brief Assigns the given const in-order iterator for parent linked binary trees to this const in-order iterator
+	 * for parent linked binary trees using copy semantics.
+	 * @param other The const in-order iterator for parent linked binary trees to copy.
+	 * @return A reference to the const in-order iterator for parent linked binary trees.
+	 */
+	ParentLinkedBinaryTreeConstInOrderIterator<ElementType, NodeType>& operator=(const ParentLinkedBinaryTreeConstInOrderIterator<ElementType, NodeType>& other) noexcept = default;
+	
+	/**
+	 * @brief Assigns the given const in-order iterator for parent linked binary trees to this const in-order iterator
+	 * for parent linked binary trees using move semantics.
+	 * @param other The const in-order iterator for parent linked binary trees to move.
+	 * @return A reference to the const in-order iterator for parent linked binary trees.
+	 */
+	ParentLinkedBinaryTreeConstInOrderIterator<ElementType, NodeType>& operator=(ParentLinkedBinaryTreeConstInOrderIterator<ElementType, NodeType>&& other) noexcept = default;
+	
+	/**
+	 * @brief Compares two const in-order iterators for parent linked binary trees.
+	 * @details Two const in-order iterators for parent linked binary trees are equal if they point to the same node.
+	 * @param other: The other const in-order iterator for parent linked binary trees to compare with.
+	 * @return True if the two const in-order iterators for parent linked binary trees are equal, false otherwise.
+	 */
+	bool operator==(const ParentLinkedBinaryTreeConstInOrderIterator<ElementType, NodeType>& other) const noexcept;
+	
+	/**
+	 * @brief Dereferences the const in-order iterator for parent linked binary trees.
+	 * @return A reference to the element stored in the node pointed to by the const in-order iterator for parent linked
+	 * binary trees.
+	 */
+	reference operator*() const noexcept;
+	
+	/**
+	 * @brief Dereferences the const in-order iterator for parent linked binary trees.
+	 * @return A pointer to the element stored in the node pointed to by the const in-order iterator for parent linked
+	 * binary trees.
+	 */
+	pointer operator->() const noexcept;
+	
+	/**
+	 * @brief Increments the const in-order iterator for parent linked binary trees.
+	 * @return A reference to the const in-order iterator for parent linked binary trees.
+	 */
+	ParentLinkedBinaryTreeConstInOrderIterator<ElementType, NodeType>& operator++() noexcept;
+	
+	/**
+	 * @brief Increments the const in-order iterator for parent linked binary trees.
+	 * @return A copy of the const in-order iterator for parent linked binary trees before it was incremented.
+	 */
+	ParentLinkedBinaryTreeConstInOrderIterator<ElementType, NodeType> operator++(int) noexcept;
+
+private:
+	const NodeType* node;
+};
+
+template<typename ElementType, typename NodeType>
+ParentLinkedBinaryTreeConstInOrderIterator<ElementType, NodeType>::ParentLinkedBinaryTreeConstInOrderIterator(const NodeType* node) noexcept
+		: node {node} {
+	
+}
+
+template<typename ElementType, typename NodeType>
+bool ParentLinkedBinaryTreeConstInOrderIterator<ElementType, NodeType>::operator==(const ParentLinkedBinaryTreeConstInOrderIterator<ElementType, NodeType>& other) const noexcept {
+	return node == other.node;
+}
+
+template<typename ElementType, typename NodeType>
+const ElementType& ParentLinkedBinaryTreeConstInOrderIterator<ElementType, NodeType>::operator*() const noexcept {
+	assert(node != nullptr && "Cannot dereference a null iterator.");
+	return node->getElement();
+}
+
+template<typename ElementType, typename NodeType>
+const ElementType* ParentLinkedBinaryTreeConstInOrderIterator<ElementType, NodeType>::operator->() const noexcept {
+	assert(node != nullptr && "Cannot dereference a null iterator.");
+	return &node->getElement();
+}
+
+template<typename ElementType, typename NodeType>
+ParentLinkedBinaryTreeConstInOrderIterator<ElementType, NodeType>& ParentLinkedBinaryTreeConstInOrderIterator<ElementType, NodeType>::operator++() noexcept {
+	assert(node != nullptr && "Cannot increment a null iterator.");
+	
+	if (node->getRightChild() != nullptr) {
+		node = node->getRightChild();
+		
+		while (node->getLeftChild() != nullptr) {
+			node = node->getLeftChild();
+		}
+		
+		return *this;
+	}
+	
+	const auto* childNode {node};
+	node = node->getParent();
+	
+	while (node != nullptr && node->getRightChild() == childNode) {
+		childNode = node;
+		node = node->getParent();
+	}
+	
+	return *this;
+}
+
+template<typename ElementType, typename NodeType>
+ParentLinkedBinaryTreeConstInOrderIterator<ElementType, NodeType> ParentLinkedBinaryTreeConstInOrderIterator<ElementType, NodeType>::operator++(int) noexcept {
+	auto iterator {*this};
+	++(*this);
+	return iterator;
+}
+}
\ No newline at end of file
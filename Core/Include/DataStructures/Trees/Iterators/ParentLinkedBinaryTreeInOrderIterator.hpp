@@ -0,0 +1,161 @@
+#pragma once
+
+#include <cassert>
+#include <iterator>
+
+#include "DataStructures/Trees/ParentLinkedBinaryTreeNode.hpp"
+
+namespace Core::DataStructures::Trees::Iterators {
+/**
+ * @brief An in-order iterator for binary trees whose nodes link to their parents.
+ * @details The iterator is a single node pointer. The next node is the leftmost node of the right subtree, or else the
+ * first ancestor reached from a left subtree, so incrementing takes amortized O(1) time without any stack, copying the
+ * iterator is as cheap as copying a pointer, and the iterator stays valid while other nodes are inserted or removed.
+ * @class ParentLinkedBinaryTreeInOrderIterator
+ * @tparam ElementType: The type of the elements stored in the binary tree.
+ * @tparam NodeType: The type of the nodes of the binary tree, which must link to their parents.
+ */
+template<typename ElementType, typename NodeType = ParentLinkedBinaryTreeNode<ElementType>>
+class ParentLinkedBinaryTreeInOrderIterator final {
+public:
+	using iterator_category = std::forward_iterator_tag;
+	using difference_type = std::ptrdiff_t;
+	using value_type = ElementType;
+	using reference = ElementType&;
+	using pointer = ElementType*;
+	
+	/**
+	 * @brief Instantiates a new in-order iterator for parent linked binary trees.
+	 * @param node: The node to point to, or nullptr for an iterator past the last node.
+	 */
+	explicit ParentLinkedBinaryTreeInOrderIterator(NodeType* node) noexcept;
+	
+	/**
+	 * @brief Instantiates a new in-order iterator for parent linked binary trees by copying the given in-order iterator
+	 * for parent linked binary trees.
+	 * @param other The in-order iterator for parent linked binary trees to copy.
+	 */
+	ParentLinkedBinaryTreeInOrderIterator(const ParentLinkedBinaryTreeInOrderIterator<ElementType, NodeType>& other) noexcept = default;
+	
+	/**
+	 * @brief Instantiates a new in-order iterator for parent linked binary trees by moving the given in-order iterator
+	 * for parent linked binary trees.
+	 * @param other The in-order iterator for parent linked binary trees to move.
+	 */
+	ParentLinkedBinaryTreeInOrderIterator(ParentLinkedBinaryTreeInOrderIterator<ElementType, NodeType>&& other) noexcept = default;
+	
+	/**
+	 * @brief Destroys the in-order iterator for parent linked binary trees.
+	 */
+	~ParentLinkedBinaryTreeInOrderIterator() noexcept = default;
+
+public:
+	/**
+	 * @brief Assigns the given in-order iterator for parent linked binary trees to this in-order iterator for parent
+	 * linked binary trees using copy semantics.
+	 * @param other The in-order iterator for parent linked binary trees to copy.
+	 * @return A reference to the in-order iterator for parent linked binary trees.
+	 */
+	ParentLinkedBinaryTreeInOrderIterator<ElementType, NodeType>& operator=(const ParentLinkedBinaryTreeInOrderIterator<ElementType, NodeType>& other) noexcept = default;
+	
+	/**
+	 * @brief Assigns the given in-order iterator for parent linked binary trees to this in-order iterator for parent
+	 * linked binary trees using move semantics.
+	 * @param other The in-order iterator for parent linked binary trees to move.
+	 * @return A reference to the in-order iterator for parent linked binary trees.
+	 */
+	ParentLinkedBinaryTreeInOrderIterator<ElementType, NodeType>& operator=(ParentLinkedBinaryTreeInOrderIterator<ElementType, NodeType>&& other) noexcept = default;
+	
+	/**
+	 * @brief Compares two in-order iterators for parent linked binary trees.
+	 * @details Two in-order iterators for parent linked binary trees are equal if they point to the same node.
+	 * @param other: The other in-order iterator for parent linked binary trees to compare with.
+	 * @return True if the two in-order iterators for parent linked binary trees are equal, false otherwise.
+	 */
+	bool operator==(const ParentLinkedBinaryTreeInOrderIterator<ElementType, NodeType>& other) const noexcept;
+	
+	/**
+	 * @brief Dereferences the in-order iterator for parent linked binary trees.
+	 * @return A reference to the element stored in the node pointed to by the in-order iterator for parent linked
+	 * binary trees.
+	 */
+	reference operator*() const noexcept;
+	
+	/**
+	 * @brief Dereferences the in-order iterator for parent linked binary trees.
+	 * @return A pointer to the element stored in the node pointed to by the in-order iterator for parent linked binary
+	 * trees.
+	 */
+	pointer operator->() const noexcept;
+	
+	/**
+	 * @brief Increments the in-order iterator for parent linked binary trees.
+	 * @return A reference to the in-order iterator for parent linked binary trees.
+	 */
+	ParentLinkedBinaryTreeInOrderIterator<ElementType, NodeType>& operator++() noexcept;
+	
+	/**
+	 * @brief Increments the in-order iterator for parent linked binary trees.
+	 * @return A copy of the in-order iterator for parent linked binary trees before it was incremented.
+	 */
+	ParentLinkedBinaryTreeInOrderIterator<ElementType, NodeType> operator++(int) noexcept;
+
+private:
+	NodeType* node;
+};
+
+template<typename ElementType, typename NodeType>
+ParentLinkedBinaryTreeInOrderIterator<ElementType, NodeType>::ParentLinkedBinaryTreeInOrderIterator(NodeType* node) noexcept
+		: node {node} {
+	
+}
+
+template<typename ElementType, typename NodeType>
+bool ParentLinkedBinaryTreeInOrderIterator<ElementType, NodeType>::operator==(const ParentLinkedBinaryTreeInOrderIterator<ElementType, NodeType>& other) const noexcept {
+	return node == other.node;
+}
+
+template<typename ElementType, typename NodeType>
+ElementType& ParentLinkedBinaryTreeInOrderIterator<ElementType, NodeType>::operator*() const noexcept {
+	assert(node != nullptr && "Cannot dereference a null iterator.");
+	return node->getElement();
+}
+
+template<typename ElementType, typename NodeType>
+ElementType* ParentLinkedBinaryTreeInOrderIterator<ElementType, NodeType>::operator->() const noexcept {
+	assert(node != nullptr && "Cannot dereference a null iterator.");
+	return &node->getElement();
+}
+
+template<typename ElementType, typename NodeType>
+ParentLinkedBinaryTreeInOrderIterator<ElementType, NodeType>& ParentLinkedBinaryTreeInOrderIterator<ElementType, NodeType>::operator++() noexcept {
+	assert(node != nullptr && "Cannot increment a null iterator.");
+	
+	if (node->getRightChild() != nullptr) {
+		node = node->getRightChild();
+		
+		while (node->getLeftChild() != nullptr) {
+			node = node->getLeftChild();
+		}
+		
+		return *this;
+	}
+	
+	auto* childNode {node};
+	node = node->getParent();
+	
+	while (node != nullptr && node->getRightChild() == childNode) {
+		childNode = node;
+		node = node->getParent();
+	}
+	
+	return *this;
+}
+
+template<typename ElementType, typename NodeType>
+ParentLinkedBinaryTreeInOrderIterator<ElementType, NodeType> ParentLinkedBinaryTreeInOrderIterator<ElementType, NodeType>::operator++(int) noexcept {
+	auto iterator {*this};
+	++(*this);
+	return iterator;
+}
+}
\ No newline at end of file
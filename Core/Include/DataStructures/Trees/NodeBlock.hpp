@@ -0,0 +1,145 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <utility>
+
+namespace Core::DataStructures::Trees {
+/**
+ * @brief A single contiguous allocation holding a fixed number of tree nodes.
+ * @details Every slot must be constructed once before any node is destroyed. The memory is released as soon as the last
+ * node is destroyed rather than when the block itself is destroyed, so trees that exchange nodes through splits and
+ * joins can share a block without keeping it alive, and nodes may be destroyed concurrently from several threads.
+ * @class NodeBlock
+ * @tparam NodeType The type of the nodes stored in the block.
+ */
+template<typename NodeType>
+class NodeBlock final {
+public:
+	/**
+	 * @brief Instantiates a new node block with uninitialized storage for the given number of nodes.
+	 * @param size The number of nodes in the block, which must not be 0.
+	 */
+	explicit NodeBlock(const std::size_t size);
+	
+	/**
+	 * @brief Deleted copy constructor.
+	 */
+	NodeBlock(const NodeBlock& other) = delete;
+	
+	/**
+	 * @brief Deleted move constructor.
+	 */
+	NodeBlock(NodeBlock&& other) noexcept = delete;
+	
+	/**
+	 * @brief Destroys the node block, releasing its memory if it still holds any nodes.
+	 */
+	~NodeBlock() noexcept;
+
+public:
+	/**
+	 * @brief Deleted copy assignment operator.
+	 */
+	NodeBlock& operator=(const NodeBlock& other) = delete;
+	
+	/**
+	 * @brief Deleted move assignment operator.
+	 */
+	NodeBlock& operator=(NodeBlock&& other) noexcept = delete;
+
+public:
+	/**
+	 * @brief Constructs a node in the slot at the given index.
+	 * @tparam Arguments The types of the arguments to construct the node with.
+	 * @param index The index of the slot, which must not hold a node yet.
+	 * @param arguments The arguments to construct the node with.
+	 * @return A pointer to the constructed node.
+	 */
+	template<typename... Arguments>
+	NodeType* construct(const std::size_t index, Arguments&&... arguments);
+	
+	/**
+	 * @brief Checks if the given node is stored in this node block.
+	 * @param node The node to check.
+	 * @return True if the node is stored in this node block, false otherwise.
+	 */
+	bool contains(const NodeType* node) const noexcept;
+	
+	/**
+	 * @brief Gets the address of the first slot of the node block.
+	 * @details The address stays the same after the memory of the node block is released, so it can order node blocks.
+	 * @return The address of the first slot of the node block.
+	 */
+	const NodeType* getAddress() const noexcept;
+	
+	/**
+	 * @brief Destroys the given node, and releases the memory of the node block if it was the last node.
+	 * @param node The node to destroy, which must be stored in this node block.
+	 */
+	void destroy(NodeType* node) noexcept;
+	
+	/**
+	 * @brief Checks if every node in the node block has been destroyed.
+	 * @return True if the node block holds no nodes, false otherwise.
+	 */
+	bool isEmpty() const noexcept;
+
+private:
+	const std::size_t size;
+	std::atomic<NodeType*> nodes;
+	const NodeType* const address;
+	std::atomic<std::size_t> liveNodeCount;
+};
+
+template<typename NodeType>
+NodeBlock<NodeType>::NodeBlock(const std::size_t size) :
+		size {size}, nodes {std::allocator<NodeType> {}.allocate(size)}, address {nodes.load()}, liveNodeCount {size} {
+	
+}
+
+template<typename NodeType>
+NodeBlock<NodeType>::~NodeBlock() noexcept {
+	if (auto* blockNodes {nodes.load()}; blockNodes != nullptr) {
+		std::allocator<NodeType> {}.deallocate(blockNodes, size);
+	}
+}
+
+template<typename NodeType>
+template<typename... Arguments>
+NodeType* NodeBlock<NodeType>::construct(const std::size_t index, Arguments&&... arguments) {
+	return std::construct_at(nodes.load(std::memory_order_relaxed) + index, std::forward<Arguments>(arguments)...);
+}
+
+template<typename NodeType>
+bool NodeBlock<NodeType>::contains(const NodeType* node) const noexcept {
+	const auto* blockNodes {nodes.load(std::memory_order_acquire)};
+	if (blockNodes == nullptr) {
+		return false;
+	}
+	
+	const std::less<const NodeType*> isBefore {};
+	return !isBefore(node, blockNodes) && isBefore(node, blockNodes + size);
+}
+
+template<typename NodeType>
+const NodeType* NodeBlock<NodeType>::getAddress() const noexcept {
+	return address;
+}
+
+template<typename NodeType>
+void NodeBlock<NodeType>::destroy(NodeType* node) noexcept {
+	std::destroy_at(node);
+	
+	if (liveNodeCount.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+		std::allocator<NodeType> {}.deallocate(nodes.exchange(nullptr, std::memory_order_acq_rel), size);
+	}
+}
+
+template<typename NodeType>
+bool NodeBlock<NodeType>::isEmpty() const noexcept {
+	return liveNodeCount.load(std::memory_order_acquire) == 0;
+}
+}
\ No newline at end of file
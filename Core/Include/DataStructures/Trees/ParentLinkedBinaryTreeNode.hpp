@@ -0,0 +1,308 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <utility>
+
+namespace Core::DataStructures::Trees {
+/**
+ * @brief A node for binary trees that also links to its parent.
+ * @details The parent link lets the in-order successor and predecessor of a node be found from the node alone, so
+ * iterators over trees of these nodes need no stack. Setting a child also sets the parent of that child to this node,
+ * which keeps the links consistent through insertions, removals and rotations as long as the root of the tree has its
+ * parent cleared. The node also caches the size and height of its subtree, which the trees refresh bottom-up after
+ * changing children, so order statistics and balance factors never walk the subtree.
+ * @class ParentLinkedBinaryTreeNode
+ * @tparam ElementType The type of the elements stored in the binary tree.
+ */
+template<typename ElementType>
+class ParentLinkedBinaryTreeNode final {
+public:
+	/**
+	 * @brief Instantiates a new binary tree node with the given element using copy semantics.
+	 * @param element The element to store in the node.
+	 */
+	explicit ParentLinkedBinaryTreeNode(const ElementType& element) noexcept;
+	
+	/**
+	 * @brief Instantiates a new binary tree node with the given element using move semantics.
+	 * @param element The element to store in the node.
+	 */
+	explicit ParentLinkedBinaryTreeNode(ElementType&& element) noexcept;
+	
+	/**
+	 * @brief Instantiates a new binary tree node by copying the given node.
+	 * @param other The node to copy.
+	 */
+	ParentLinkedBinaryTreeNode(const ParentLinkedBinaryTreeNode<ElementType>& other) noexcept = default;
+	
+	/**
+	 * @brief Instantiates a new binary tree node by moving the given node.
+	 * @param other The node to move.
+	 */
+	ParentLinkedBinaryTreeNode(ParentLinkedBinaryTreeNode<ElementType>&& other) noexcept = default;
+	
+	/**
+	 * @brief Destroys the node.
+	 */
+	~ParentLinkedBinaryTreeNode() noexcept = default;
+
+public:
+	/**
+	 * @brief Assigns the given node to this node using copy semantics.
+	 * @param other The node to copy.
+	 * @return A reference to this node.
+	 */
+	ParentLinkedBinaryTreeNode<ElementType>& operator=(const ParentLinkedBinaryTreeNode<ElementType>& other) noexcept = default;
+	
+	/**
+	 * @brief Assigns the given node to this node using move semantics.
+	 * @param other The node to move.
+	 * @return A reference to this node.
+	 */
+	ParentLinkedBinaryTreeNode<ElementType>& operator=(ParentLinkedBinaryTreeNode<ElementType>&& other) noexcept = default;
+	
+	/**
+	 * @brief Checks if this node is equal to the given node.
+	 * @details Two nodes are considered equal if their elements and children are equal.
+	 * @param other The node to compare with.
+	 * @return True if the two nodes are equal, false otherwise.
+	 */
+	bool operator==(const ParentLinkedBinaryTreeNode<ElementType>& other) const noexcept;
+
+public:
+	/**
+	 * @brief Gets a reference to the element stored in the node.
+	 * @return A reference to the element stored in the node.
+	 */
+	ElementType& getElement() noexcept;
+	
+	/**
+	 * @brief Gets a const reference to the element stored in the node.
+	 * @return A const reference to the element stored in the node.
+	 */
+	const ElementType& getElement() const noexcept;
+	
+	/**
+	 * @brief Gets a pointer to the left child of the node.
+	 * @return A pointer to the left child of the node.
+	 */
+	ParentLinkedBinaryTreeNode<ElementType>* getLeftChild() noexcept;
+	
+	/**
+	 * @brief Gets a const pointer to the left child of the node.
+	 * @return A const pointer to the left child of the node.
+	 */
+	const ParentLinkedBinaryTreeNode<ElementType>* getLeftChild() const noexcept;
+	
+	/**
+	 * @brief Sets the left child of the node and links the child back to this node.
+	 * @param leftChild A pointer to the left child of the node.
+	 */
+	void setLeftChild(ParentLinkedBinaryTreeNode<ElementType>* leftChild) noexcept;
+	
+	/**
+	 * @brief Gets a pointer to the right child of the node.
+	 * @return A pointer to the right child of the node.
+	 */
+	ParentLinkedBinaryTreeNode<ElementType>* getRightChild() noexcept;
+	
+	/**
+	 * @brief Gets a const pointer to the right child of the node.
+	 * @return A const pointer to the right child of the node.
+	 */
+	const ParentLinkedBinaryTreeNode<ElementType>* getRightChild() const noexcept;
+	
+	/**
+	 * @brief Sets the right child of the node and links the child back to this node.
+	 * @param rightChild A pointer to the right child of the node.
+	 */
+	void setRightChild(ParentLinkedBinaryTreeNode<ElementType>* rightChild) noexcept;
+	
+	/**
+	 * @brief Gets a pointer to the parent of the node.
+	 * @return A pointer to the parent of the node, or nullptr if the node is a root.
+	 */
+	ParentLinkedBinaryTreeNode<ElementType>* getParent() noexcept;
+	
+	/**
+	 * @brief Gets a const pointer to the parent of the node.
+	 * @return A const pointer to the parent of the node, or nullptr if the node is a root.
+	 */
+	const ParentLinkedBinaryTreeNode<ElementType>* getParent() const noexcept;
+	
+	/**
+	 * @brief Sets the parent of the node without changing the children of the parent.
+	 * @param parent A pointer to the parent of the node.
+	 */
+	void setParent(ParentLinkedBinaryTreeNode<ElementType>* parent) noexcept;
+	
+	/**
+	 * @brief Gets the number of nodes in the subtree rooted at the node, including the node.
+	 * @return The number of nodes in the subtree rooted at the node.
+	 */
+	std::size_t getSubtreeSize() const noexcept;
+	
+	/**
+	 * @brief Gets the height of the subtree rooted at the node, which is 0 for a node without children.
+	 * @return The height of the subtree rooted at the node.
+	 */
+	int getHeight() const noexcept;
+	
+	/**
+	 * @brief Recomputes the size and height of the subtree rooted at the node from those of its children.
+	 * @details The children must already be up to date, so nodes are updated from the lowest changed node upwards.
+	 */
+	void update() noexcept;
+
+private:
+	/**
+	 * @brief Checks if the given children are equal.
+	 * @details Two children are considered equal if they are both nullptr or if they are both not nullptr and their
+	 * elements and children are equal.
+	 * @param leftChild The left child of the node.
+	 * @param rightChild The right child of the node.
+	 * @return True if the children are equal, false otherwise.
+	 */
+	static bool areChildrenEqual(const ParentLinkedBinaryTreeNode<ElementType>* leftChild,
+	                             const ParentLinkedBinaryTreeNode<ElementType>* rightChild) noexcept;
+
+private:
+	ElementType element;
+	int height {0};
+	ParentLinkedBinaryTreeNode<ElementType>* leftChild {nullptr};
+	ParentLinkedBinaryTreeNode<ElementType>* rightChild {nullptr};
+	ParentLinkedBinaryTreeNode<ElementType>* parent {nullptr};
+	std::size_t subtreeSize {1};
+};
+
+template<typename ElementType>
+ParentLinkedBinaryTreeNode<ElementType>::ParentLinkedBinaryTreeNode(const ElementType& element) noexcept : element {element} {
+	
+}
+
+template<typename ElementType>
+ParentLinkedBinaryTreeNode<ElementType>::ParentLinkedBinaryTreeNode(ElementType&& element) noexcept : element {std::move(element)} {
+	
+}
+
+template<typename ElementType>
+bool ParentLinkedBinaryTreeNode<ElementType>::operator==(const ParentLinkedBinaryTreeNode<ElementType>& other) const noexcept {
+	if (element != other.element) {
+		return false;
+	}
+	
+	return ParentLinkedBinaryTreeNode<ElementType>::areChildrenEqual(leftChild, other.leftChild) &&
+	       ParentLinkedBinaryTreeNode<ElementType>::areChildrenEqual(rightChild, other.rightChild);
+}
+
+template<typename ElementType>
+ElementType& ParentLinkedBinaryTreeNode<ElementType>::getElement() noexcept {
+	return element;
+}
+
+template<typename ElementType>
+const ElementType& ParentLinkedBinaryTreeNode<ElementType>::getElement() const noexcept {
+	return element;
+}
+
+template<typename ElementType>
+ParentLinkedBinaryTreeNode<ElementType>* ParentLinkedBinaryTreeNode<ElementType>::getLeftChild() noexcept {
+	return leftChild;
+}
+
+template<typename ElementType>
+const ParentLinkedBinaryTreeNode<ElementType>* ParentLinkedBinaryTreeNode<ElementType>::getLeftChild() const noexcept {
+	return leftChild;
+}
+
+template<typename ElementType>
+void ParentLinkedBinaryTreeNode<ElementType>::setLeftChild(ParentLinkedBinaryTreeNode<ElementType>* leftChild) noexcept {
+	this->leftChild = leftChild;
+	
+	if (leftChild != nullptr) {
+		leftChild->parent = this;
+	}
+}
+
+template<typename ElementType>
+ParentLinkedBinaryTreeNode<ElementType>* ParentLinkedBinaryTreeNode<ElementType>::getRightChild() noexcept {
+	return rightChild;
+}
+
+template<typename ElementType>
+const ParentLinkedBinaryTreeNode<ElementType>* ParentLinkedBinaryTreeNode<ElementType>::getRightChild() const noexcept {
+	return rightChild;
+}
+
+template<typename ElementType>
+void ParentLinkedBinaryTreeNode<ElementType>::setRightChild(ParentLinkedBinaryTreeNode<ElementType>* rightChild) noexcept {
+	this->rightChild = rightChild;
+	
+	if (rightChild != nullptr) {
+		rightChild->parent = this;
+	}
+}
+
+template<typename ElementType>
+ParentLinkedBinaryTreeNode<ElementType>* ParentLinkedBinaryTreeNode<ElementType>::getParent() noexcept {
+	return parent;
+}
+
+template<typename ElementType>
+const ParentLinkedBinaryTreeNode<ElementType>* ParentLinkedBinaryTreeNode<ElementType>::getParent() const noexcept {
+	return parent;
+}
+
+template<typename ElementType>
+void ParentLinkedBinaryTreeNode<ElementType>::setParent(ParentLinkedBinaryTreeNode<ElementType>* parent) noexcept {
+	this->parent = parent;
+}
+
+template<typename ElementType>
+std::size_t ParentLinkedBinaryTreeNode<ElementType>::getSubtreeSize() const noexcept {
+	return subtreeSize;
+}
+
+template<typename ElementType>
+int ParentLinkedBinaryTreeNode<ElementType>::getHeight() const noexcept {
+	return height;
+}
+
+template<typename ElementType>
+void ParentLinkedBinaryTreeNode<ElementType>::update() noexcept {
+	subtreeSize = 1;
+	auto childHeight {-1};
+	
+	if (leftChild != nullptr) {
+		subtreeSize += leftChild->subtreeSize;
+		childHeight = leftChild->height;
+	}
+	
+	if (rightChild != nullptr) {
+		subtreeSize += rightChild->subtreeSize;
+		childHeight = std::max(childHeight, rightChild->height);
+	}
+	
+	height = childHeight + 1;
+}
+
+template<typename ElementType>
+bool ParentLinkedBinaryTreeNode<ElementType>::areChildrenEqual(const ParentLinkedBinaryTreeNode<ElementType>* leftChild,
+                                                         const ParentLinkedBinaryTreeNode<ElementType>* rightChild) noexcept {
+	if (leftChild == nullptr && rightChild == nullptr) {
+		return true;
+	}
+	
+	if (leftChild == nullptr || rightChild == nullptr) {
+		return false;
+	}
+	
+	if (leftChild->element != rightChild->element) {
+		return false;
+	}
+	
+	return areChildrenEqual(leftChild->leftChild, rightChild->leftChild) &&
+	       areChildrenEqual(leftChild->rightChild, rightChild->rightChild);
+}
+}
\ No newline at end of file
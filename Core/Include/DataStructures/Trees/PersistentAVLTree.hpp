@@ -0,0 +1,712 @@
+#pragma once
+
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <utility>
+
+#include "DataStructures/Trees/Iterators/BinaryTreeConstInOrderIterator.hpp"
+#include "DataStructures/Trees/Iterators/BinaryTreeConstLevelOrderIterator.hpp"
+#include "DataStructures/Trees/Iterators/BinaryTreeConstPostOrderIterator.hpp"
+#include "DataStructures/Trees/Iterators/BinaryTreeConstPreOrderIterator.hpp"
+#include "DataStructures/Trees/Iterators/BinaryTreeIteratorConcepts.hpp"
+#include "DataStructures/Trees/PersistentAVLTreeNode.hpp"
+#include "BinarySearchTreeConcepts.hpp"
+
+namespace Core::DataStructures::Trees {
+/**
+ * @brief A persistent avl tree whose versions are immutable values that share their unchanged nodes.
+ * @details An insertion or removal leaves the avl tree untouched and returns a new version that copies only the
+ * O(log n) nodes on the search path and shares every other node with the version it was made from. Nodes are owned
+ * through reference counts and freed when the last version that reaches them is destroyed, so copying a version is a
+ * single reference count increment, and a reader holding a version sees a consistent snapshot without any locks while a
+ * writer keeps producing new versions. Publishing the latest version to other threads is left to the caller, for
+ * instance through a std::atomic<std::shared_ptr<const PersistentAVLTree>>.
+ * @class PersistentAVLTree
+ * @tparam ElementType The type of the elements stored in the persistent avl tree.
+ */
+template<ElementTypeWithLessThanOperator ElementType>
+class PersistentAVLTree final {
+public:
+	/**
+	 * @brief Instantiates a new persistent avl tree with no nodes.
+	 */
+	PersistentAVLTree() noexcept = default;
+	
+	/**
+	 * @brief Instantiates a new persistent avl tree that shares every node of the given persistent avl tree in O(1)
+	 * time.
+	 * @param other The persistent avl tree to copy.
+	 */
+	PersistentAVLTree(const PersistentAVLTree& other) noexcept = default;
+	
+	/**
+	 * @brief Instantiates a new persistent avl tree by moving the given persistent avl tree.
+	 * @param other The persistent avl tree to move.
+	 */
+	PersistentAVLTree(PersistentAVLTree&& other) noexcept = default;
+	
+	/**
+	 * @brief Destroys the persistent avl tree, freeing the nodes that no other version shares.
+	 */
+	~PersistentAVLTree() noexcept = default;
+
+public:
+	/**
+	 * @brief Assigns the given persistent avl tree to this persistent avl tree using copy semantics in O(1) time.
+	 * @param other The persistent avl tree to copy.
+	 * @return A reference to this persistent avl tree.
+	 */
+	PersistentAVLTree<ElementType>& operator=(const PersistentAVLTree& other) noexcept = default;
+	
+	/**
+	 * @brief Assigns the given persistent avl tree to this persistent avl tree using move semantics.
+	 * @param other The persistent avl tree to move.
+	 * @return A reference to this persistent avl tree.
+	 */
+	PersistentAVLTree<ElementType>& operator=(PersistentAVLTree&& other) noexcept = default;
+	
+	/**
+	 * @brief Checks if the given persistent avl tree is equal to this persistent avl tree.
+	 * @details Two persistent avl trees are equal if they have the same number of nodes, the node contain the same
+	 * elements, and the nodes are in the same order.
+	 * @param other The persistent avl tree to check.
+	 * @return True if the given persistent avl tree is equal to this persistent avl tree, false otherwise.
+	 */
+	bool operator==(const PersistentAVLTree& other) const noexcept;
+
+public:
+	using value_type = ElementType;
+	using ConstInOrderIterator = Iterators::BinaryTreeConstInOrderIterator<ElementType, const PersistentAVLTreeNode<ElementType>>;
+	using ConstLevelOrderIterator = Iterators::BinaryTreeConstLevelOrderIterator<ElementType, const PersistentAVLTreeNode<ElementType>>;
+	using ConstPostOrderIterator = Iterators::BinaryTreeConstPostOrderIterator<ElementType, const PersistentAVLTreeNode<ElementType>>;
+	using ConstPreOrderIterator = Iterators::BinaryTreeConstPreOrderIterator<ElementType, const PersistentAVLTreeNode<ElementType>>;
+	
+	/**
+	 * @brief Gets a const in-order iterator to the first node in the persistent avl tree.
+	 * @return A const in-order iterator to the first node in the persistent avl tree.
+	 */
+	ConstInOrderIterator cbeginInOrder() const noexcept;
+	
+	/**
+	 * @brief Gets a const in-order iterator to the node after the last node in the persistent avl tree.
+	 * @return A const in-order iterator to the node after the last node in the persistent avl tree.
+	 */
+	ConstInOrderIterator cendInOrder() const noexcept;
+	
+	/**
+	 * @brief Gets a const level-order iterator to the first node in the persistent avl tree.
+	 * @return A const level-order iterator to the first node in the persistent avl tree.
+	 */
+	ConstLevelOrderIterator cbeginLevelOrder() const noexcept;
+	
+	/**
+	 * @brief Gets a const level-order iterator to the node after the last node in the persistent avl tree.
+	 * @return A const level-order iterator to the node after the last node in the persistent avl tree.
+	 */
+	ConstLevelOrderIterator cendLevelOrder() const noexcept;
+	
+	/**
+	 * @brief Gets a const post-order iterator to the first node in the persistent avl tree.
+	 * @return A const post-order iterator to the first node in the persistent avl tree.
+	 */
+	ConstPostOrderIterator cbeginPostOrder() const noexcept;
+	
+	/**
+	 * @brief Gets a const post-order iterator to the node after the last node in the persistent avl tree.
+	 * @return A const post-order iterator to the node after the last node in the persistent avl tree.
+	 */
+	ConstPostOrderIterator cendPostOrder() const noexcept;
+	
+	/**
+	 * @brief Gets a const pre-order iterator to the first node in the persistent avl tree.
+	 * @return A const pre-order iterator to the first node in the persistent avl tree.
+	 */
+	ConstPreOrderIterator cbeginPreOrder() const noexcept;
+	
+	/**
+	 * @brief Gets a const pre-order iterator to the node after the last node in the persistent avl tree.
+	 * @return A const pre-order iterator to the node after the last node in the persistent avl tree.
+	 */
+	ConstPreOrderIterator cendPreOrder() const noexcept;
+
+public:
+	/**
+	 * @brief Makes a new version of the persistent avl tree with the given element inserted using copy semantics.
+	 * @param element The element to insert.
+	 * @return The new version, which shares every node off the search path with this persistent avl tree.
+	 */
+	[[nodiscard]] PersistentAVLTree<ElementType> insert(const ElementType& element) const;
+	
+	/**
+	 * @brief Makes a new version of the persistent avl tree with the given element inserted using move semantics.
+	 * @param element The element to insert.
+	 * @return The new version, which shares every node off the search path with this persistent avl tree.
+	 */
+	[[nodiscard]] PersistentAVLTree<ElementType> insert(ElementType&& element) const;
+	
+	/**
+	 * @brief Makes a new version of the persistent avl tree without the first occurrence of the given element.
+	 * @param element The element to remove.
+	 * @return The new version, or a version sharing every node with this persistent avl tree if the element is not
+	 * found.
+	 */
+	[[nodiscard]] PersistentAVLTree<ElementType> removeFirst(const ElementType& element) const;
+	
+	/**
+	 * @brief Makes a new version of the persistent avl tree without its minimum element.
+	 * @return The new version, which is empty if this persistent avl tree is empty.
+	 */
+	[[nodiscard]] PersistentAVLTree<ElementType> removeMinimum() const;
+	
+	/**
+	 * @brief Makes a new version of the persistent avl tree without its maximum element.
+	 * @return The new version, which is empty if this persistent avl tree is empty.
+	 */
+	[[nodiscard]] PersistentAVLTree<ElementType> removeMaximum() const;
+	
+	/**
+	 * @brief Finds the first occurrence of the given element in the persistent avl tree.
+	 * @param element The element to find.
+	 * @return The first occurrence of the given element in the persistent avl tree, or std::nullopt if the element is
+	 * not found.
+	 */
+	std::optional<ElementType> findFirst(const ElementType& element) const noexcept;
+	
+	/**
+	 * @brief Finds the minimum element in the persistent avl tree.
+	 * @return The minimum element in the persistent avl tree, or std::nullopt if the persistent avl tree is empty.
+	 */
+	std::optional<ElementType> findMinimum() const noexcept;
+	
+	/**
+	 * @brief Finds the maximum element in the persistent avl tree.
+	 * @return The maximum element in the persistent avl tree, or std::nullopt if the persistent avl tree is empty.
+	 */
+	std::optional<ElementType> findMaximum() const noexcept;
+	
+	/**
+	 * @brief Finds the element at the given position in ascending order in O(log n) time.
+	 * @param index The zero-based position of the element, such that 0 selects the minimum element.
+	 * @return The element at the given position, or std::nullopt if the position is not less than the number of nodes.
+	 */
+	std::optional<ElementType> select(std::size_t index) const noexcept;
+	
+	/**
+	 * @brief Counts the elements in the persistent avl tree that are less than the given element in O(log n) time.
+	 * @param element The element to rank.
+	 * @return The number of elements less than the given element.
+	 */
+	std::size_t rank(const ElementType& element) const noexcept;
+	
+	/**
+	 * @brief Traverses the persistent avl tree using the given function on each node in the persistent avl tree.
+	 * @tparam ConstIteratorType The type of const iterator to use to traverse the persistent avl tree.
+	 * @param begin A const iterator to the first node in the persistent avl tree.
+	 * @param end A const iterator to the node after the last node in the persistent avl tree.
+	 * @param function The function to use to traverse the persistent avl tree.
+	 */
+	template<typename ConstIteratorType>
+	requires Iterators::AllowedConstIterator<ConstIteratorType, ElementType, const PersistentAVLTreeNode<ElementType>>
+	void traverse(ConstIteratorType begin,
+	              ConstIteratorType end,
+	              const std::function<void(const ElementType&)>& function) const noexcept;
+	
+	/**
+	 * @brief Checks if the persistent avl tree contains the given element.
+	 * @param element The element to check.
+	 * @return True if the persistent avl tree contains the given element, false otherwise.
+	 */
+	bool contains(const ElementType& element) const noexcept;
+	
+	/**
+	 * @brief Checks if the persistent avl tree is empty.
+	 * @return True if the persistent avl tree is empty, false otherwise.
+	 */
+	bool isEmpty() const noexcept;
+	
+	/**
+	 * @brief Gets the number of nodes in the persistent avl tree.
+	 * @return The number of nodes in the persistent avl tree.
+	 */
+	std::size_t getNodeCount() const noexcept;
+	
+	/**
+	 * @brief Gets the height of the persistent avl tree.
+	 * @return The height of the persistent avl tree, or -1 if the persistent avl tree is empty.
+	 */
+	int getHeight() const noexcept;
+
+private:
+	using NodePointer = std::shared_ptr<const PersistentAVLTreeNode<ElementType>>;
+	
+	/**
+	 * @brief Instantiates a new persistent avl tree with the given root node.
+	 * @param rootNode The root node of the persistent avl tree, which may be nullptr.
+	 */
+	explicit PersistentAVLTree(NodePointer rootNode) noexcept;
+	
+	/**
+	 * @brief Inserts the given element into a copy of the search path of the subtree rooted at the given node.
+	 * @param node The root of the subtree, which may be nullptr.
+	 * @param element The element to insert.
+	 * @return The root of the new subtree.
+	 */
+	static NodePointer insert(const NodePointer& node, ElementType&& element);
+	
+	/**
+	 * @brief Removes the first occurrence of the given element from a copy of the search path of the subtree rooted at
+	 * the given node.
+	 * @param node The root of the subtree, which may be nullptr.
+	 * @param element The element to remove.
+	 * @param isRemoved Set to true if the element was found, and left unchanged otherwise.
+	 * @return The root of the new subtree, or the given node if the element was not found.
+	 */
+	static NodePointer removeFirst(const NodePointer& node, const ElementType& element, bool& isRemoved);
+	
+	/**
+	 * @brief Removes the minimum element from a copy of the leftmost path of the subtree rooted at the given node.
+	 * @param node The root of the subtree, which must not be nullptr.
+	 * @param minimumNode Set to the node with the minimum element, which the given subtree keeps alive.
+	 * @return The root of the new subtree.
+	 */
+	static NodePointer removeMinimum(const NodePointer& node, const PersistentAVLTreeNode<ElementType>*& minimumNode);
+	
+	/**
+	 * @brief Removes the maximum element from a copy of the rightmost path of the subtree rooted at the given node.
+	 * @param node The root of the subtree, which must not be nullptr.
+	 * @return The root of the new subtree.
+	 */
+	static NodePointer removeMaximum(const NodePointer& node);
+	
+	/**
+	 * @brief Makes a new node with the given element and children, rotating by making new nodes if the heights of the
+	 * children differ by 2.
+	 * @param element The element of the new node.
+	 * @param leftChild The left child of the new node, which may be nullptr.
+	 * @param rightChild The right child of the new node, which may be nullptr.
+	 * @return The root of the balanced subtree.
+	 */
+	static NodePointer makeBalancedNode(const ElementType& element, NodePointer leftChild, NodePointer rightChild);
+	
+	/**
+	 * @brief Makes a new node with the given element and children without balancing.
+	 * @param element The element of the new node.
+	 * @param leftChild The left child of the new node, which may be nullptr.
+	 * @param rightChild The right child of the new node, which may be nullptr.
+	 * @return The new node.
+	 */
+	static NodePointer makeNode(const ElementType& element, NodePointer leftChild, NodePointer rightChild);
+	
+	/**
+	 * @brief Finds the first node on the search path whose element is equivalent to the given element.
+	 * @param element The element to find.
+	 * @return The node with the given element, or nullptr if the element is not found.
+	 */
+	const PersistentAVLTreeNode<ElementType>* findNode(const ElementType& element) const noexcept;
+	
+	/**
+	 * @brief Gets the node with the minimum element in the subtree rooted at the given node.
+	 * @param node The root of the subtree.
+	 * @return The node with the minimum element, or nullptr if the subtree is empty.
+	 */
+	static const PersistentAVLTreeNode<ElementType>* getMinimumNode(
+			const PersistentAVLTreeNode<ElementType>* node) noexcept;
+	
+	/**
+	 * @brief Gets the node with the maximum element in the subtree rooted at the given node.
+	 * @param node The root of the subtree.
+	 * @return The node with the maximum element, or nullptr if the subtree is empty.
+	 */
+	static const PersistentAVLTreeNode<ElementType>* getMaximumNode(
+			const PersistentAVLTreeNode<ElementType>* node) noexcept;
+	
+	/**
+	 * @brief Gets the height of the given node.
+	 * @param node The node to get the height of, which may be nullptr.
+	 * @return The height of the given node, or -1 if the node is nullptr.
+	 */
+	static int getHeight(const PersistentAVLTreeNode<ElementType>* node) noexcept;
+	
+	/**
+	 * @brief Gets the number of nodes in the subtree rooted at the given node.
+	 * @param node The root of the subtree, which may be nullptr.
+	 * @return The number of nodes in the subtree, or 0 if the node is nullptr.
+	 */
+	static std::size_t getSubtreeSize(const PersistentAVLTreeNode<ElementType>* node) noexcept;
+
+private:
+	NodePointer rootNode {};
+};
+
+template<ElementTypeWithLessThanOperator ElementType>
+PersistentAVLTree<ElementType>::PersistentAVLTree(NodePointer rootNode) noexcept : rootNode {std::move(rootNode)} {
+	
+}
+
+template<ElementTypeWithLessThanOperator ElementType>
+bool PersistentAVLTree<ElementType>::operator==(const PersistentAVLTree& other) const noexcept {
+	if (getNodeCount() != other.getNodeCount()) {
+		return false;
+	}
+	
+	return std::equal(cbeginInOrder(), cendInOrder(), other.cbeginInOrder(), other.cendInOrder());
+}
+
+template<ElementTypeWithLessThanOperator ElementType>
+PersistentAVLTree<ElementType>::ConstInOrderIterator PersistentAVLTree<ElementType>::cbeginInOrder() const noexcept {
+	return ConstInOrderIterator {rootNode.get()};
+}
+
+template<ElementTypeWithLessThanOperator ElementType>
+PersistentAVLTree<ElementType>::ConstInOrderIterator PersistentAVLTree<ElementType>::cendInOrder() const noexcept {
+	return ConstInOrderIterator {nullptr};
+}
+
+template<ElementTypeWithLessThanOperator ElementType>
+PersistentAVLTree<ElementType>::ConstLevelOrderIterator PersistentAVLTree<ElementType>::cbeginLevelOrder() const noexcept {
+	return ConstLevelOrderIterator {rootNode.get()};
+}
+
+template<ElementTypeWithLessThanOperator ElementType>
+PersistentAVLTree<ElementType>::ConstLevelOrderIterator PersistentAVLTree<ElementType>::cendLevelOrder() const noexcept {
+	return ConstLevelOrderIterator {nullptr};
+}
+
+template<ElementTypeWithLessThanOperator ElementType>
+PersistentAVLTree<ElementType>::ConstPostOrderIterator PersistentAVLTree<ElementType>::cbeginPostOrder() const noexcept {
+	return ConstPostOrderIterator {rootNode.get()};
+}
+
+template<ElementTypeWithLessThanOperator ElementType>
+PersistentAVLTree<ElementType>::ConstPostOrderIterator PersistentAVLTree<ElementType>::cendPostOrder() const noexcept {
+	return ConstPostOrderIterator {nullptr};
+}
+
+template<ElementTypeWithLessThanOperator ElementType>
+PersistentAVLTree<ElementType>::ConstPreOrderIterator PersistentAVLTree<ElementType>::cbeginPreOrder() const noexcept {
+	return ConstPreOrderIterator {rootNode.get()};
+}
+
+template<ElementTypeWithLessThanOperator ElementType>
+PersistentAVLTree<ElementType>::ConstPreOrderIterator PersistentAVLTree<ElementType>::cendPreOrder() const noexcept {
+	return ConstPreOrderIterator {nullptr};
+}
+
+template<ElementTypeWithLessThanOperator ElementType>
+PersistentAVLTree<ElementType> PersistentAVLTree<ElementType>::insert(const ElementType& element) const {
+	return PersistentAVLTree<ElementType> {insert(rootNode, ElementType {element})};
+}
+
+template<ElementTypeWithLessThanOperator ElementType>
+PersistentAVLTree<ElementType> PersistentAVLTree<ElementType>::insert(ElementType&& element) const {
+	return PersistentAVLTree<ElementType> {insert(rootNode, std::move(element))};
+}
+
+template<ElementTypeWithLessThanOperator ElementType>
+PersistentAVLTree<ElementType> PersistentAVLTree<ElementType>::removeFirst(const ElementType& element) const {
+	auto isRemoved {false};
+	return PersistentAVLTree<ElementType> {removeFirst(rootNode, element, isRemoved)};
+}
+
+template<ElementTypeWithLessThanOperator ElementType>
+PersistentAVLTree<ElementType> PersistentAVLTree<ElementType>::removeMinimum() const {
+	if (rootNode == nullptr) {
+		return *this;
+	}
+	
+	const PersistentAVLTreeNode<ElementType>* minimumNode {nullptr};
+	return PersistentAVLTree<ElementType> {removeMinimum(rootNode, minimumNode)};
+}
+
+template<ElementTypeWithLessThanOperator ElementType>
+PersistentAVLTree<ElementType> PersistentAVLTree<ElementType>::removeMaximum() const {
+	if (rootNode == nullptr) {
+		return *this;
+	}
+	
+	return PersistentAVLTree<ElementType> {removeMaximum(rootNode)};
+}
+
+template<ElementTypeWithLessThanOperator ElementType>
+std::optional<ElementType> PersistentAVLTree<ElementType>::findFirst(const ElementType& element) const noexcept {
+	const auto* node {findNode(element)};
+	if (node == nullptr) {
+		return std::nullopt;
+	}
+	
+	return node->getElement();
+}
+
+template<ElementTypeWithLessThanOperator ElementType>
+std::optional<ElementType> PersistentAVLTree<ElementType>::findMinimum() const noexcept {
+	const auto* node {getMinimumNode(rootNode.get())};
+	if (node == nullptr) {
+		return std::nullopt;
+	}
+	
+	return node->getElement();
+}
+
+template<ElementTypeWithLessThanOperator ElementType>
+std::optional<ElementType> PersistentAVLTree<ElementType>::findMaximum() const noexcept {
+	const auto* node {getMaximumNode(rootNode.get())};
+	if (node == nullptr) {
+		return std::nullopt;
+	}
+	
+	return node->getElement();
+}
+
+template<ElementTypeWithLessThanOperator ElementType>
+std::optional<ElementType> PersistentAVLTree<ElementType>::select(std::size_t index) const noexcept {
+	if (index >= getNodeCount()) {
+		return std::nullopt;
+	}
+	
+	const auto* currentNode {rootNode.get()};
+	
+	while (true) {
+		const auto leftSubtreeSize {getSubtreeSize(currentNode->getLeftChild())};
+		
+		if (index < leftSubtreeSize) {
+			currentNode = currentNode->getLeftChild();
+		} else if (index == leftSubtreeSize) {
+			return currentNode->getElement();
+		} else {
+			index -= leftSubtreeSize + 1;
+			currentNode = currentNode->getRightChild();
+		}
+	}
+}
+
+template<ElementTypeWithLessThanOperator ElementType>
+std::size_t PersistentAVLTree<ElementType>::rank(const ElementType& element) const noexcept {
+	std::size_t count {0};
+	const auto* currentNode {rootNode.get()};
+	
+	while (currentNode != nullptr) {
+		if (currentNode->getElement() < element) {
+			count += getSubtreeSize(currentNode->getLeftChild()) + 1;
+			currentNode = currentNode->getRightChild();
+		} else {
+			currentNode = currentNode->getLeftChild();
+		}
+	}
+	
+	return count;
+}
+
+template<ElementTypeWithLessThanOperator ElementType>
+template<typename ConstIteratorType>
+requires Iterators::AllowedConstIterator<ConstIteratorType, ElementType, const PersistentAVLTreeNode<ElementType>>
+void PersistentAVLTree<ElementType>::traverse(ConstIteratorType begin,
+                                              ConstIteratorType end,
+                                              const std::function<void(const ElementType&)>& function) const noexcept {
+	std::for_each(begin, end, function);
+}
+
+template<ElementTypeWithLessThanOperator ElementType>
+bool PersistentAVLTree<ElementType>::contains(const ElementType& element) const noexcept {
+	return findNode(element) != nullptr;
+}
+
+template<ElementTypeWithLessThanOperator ElementType>
+bool PersistentAVLTree<ElementType>::isEmpty() const noexcept {
+	return rootNode == nullptr;
+}
+
+template<ElementTypeWithLessThanOperator ElementType>
+std::size_t PersistentAVLTree<ElementType>::getNodeCount() const noexcept {
+	return getSubtreeSize(rootNode.get());
+}
+
+template<ElementTypeWithLessThanOperator ElementType>
+int PersistentAVLTree<ElementType>::getHeight() const noexcept {
+	return getHeight(rootNode.get());
+}
+
+template<ElementTypeWithLessThanOperator ElementType>
+PersistentAVLTree<ElementType>::NodePointer PersistentAVLTree<ElementType>::insert(const NodePointer& node,
+                                                                                   ElementType&& element) {
+	if (node == nullptr) {
+		return std::make_shared<const PersistentAVLTreeNode<ElementType>>(std::move(element), nullptr, nullptr);
+	}
+	
+	if (element < node->getElement()) {
+		return makeBalancedNode(node->getElement(),
+		                        insert(node->getSharedLeftChild(), std::move(element)),
+		                        node->getSharedRightChild());
+	}
+	
+	return makeBalancedNode(node->getElement(),
+	                        node->getSharedLeftChild(),
+	                        insert(node->getSharedRightChild(), std::move(element)));
+}
+
+template<ElementTypeWithLessThanOperator ElementType>
+PersistentAVLTree<ElementType>::NodePointer PersistentAVLTree<ElementType>::removeFirst(const NodePointer& node,
+                                                                                        const ElementType& element,
+                                                                                        bool& isRemoved) {
+	if (node == nullptr) {
+		return nullptr;
+	}
+	
+	if (element < node->getElement()) {
+		auto leftChild {removeFirst(node->getSharedLeftChild(), element, isRemoved)};
+		if (!isRemoved) {
+			return node;
+		}
+		
+		return makeBalancedNode(node->getElement(), std::move(leftChild), node->getSharedRightChild());
+	}
+	
+	if (node->getElement() < element) {
+		auto rightChild {removeFirst(node->getSharedRightChild(), element, isRemoved)};
+		if (!isRemoved) {
+			return node;
+		}
+		
+		return makeBalancedNode(node->getElement(), node->getSharedLeftChild(), std::move(rightChild));
+	}
+	
+	isRemoved = true;
+	
+	if (node->getLeftChild() == nullptr) {
+		return node->getSharedRightChild();
+	}
+	
+	if (node->getRightChild() == nullptr) {
+		return node->getSharedLeftChild();
+	}
+	
+	const PersistentAVLTreeNode<ElementType>* inOrderSuccessor {nullptr};
+	auto rightChild {removeMinimum(node->getSharedRightChild(), inOrderSuccessor)};
+	
+	return makeBalancedNode(inOrderSuccessor->getElement(), node->getSharedLeftChild(), std::move(rightChild));
+}
+
+template<ElementTypeWithLessThanOperator ElementType>
+PersistentAVLTree<ElementType>::NodePointer PersistentAVLTree<ElementType>::removeMinimum(
+		const NodePointer& node, const PersistentAVLTreeNode<ElementType>*& minimumNode) {
+	if (node->getLeftChild() == nullptr) {
+		minimumNode = node.get();
+		return node->getSharedRightChild();
+	}
+	
+	return makeBalancedNode(node->getElement(),
+	                        removeMinimum(node->getSharedLeftChild(), minimumNode),
+	                        node->getSharedRightChild());
+}
+
+template<ElementTypeWithLessThanOperator ElementType>
+PersistentAVLTree<ElementType>::NodePointer PersistentAVLTree<ElementType>::removeMaximum(const NodePointer& node) {
+	if (node->getRightChild() == nullptr) {
+		return node->getSharedLeftChild();
+	}
+	
+	return makeBalancedNode(node->getElement(), node->getSharedLeftChild(), removeMaximum(node->getSharedRightChild()));
+}
+
+template<ElementTypeWithLessThanOperator ElementType>
+PersistentAVLTree<ElementType>::NodePointer PersistentAVLTree<ElementType>::makeBalancedNode(const ElementType& element,
+                                                                                             NodePointer leftChild,
+                                                                                             NodePointer rightChild) {
+	if (getHeight(leftChild.get()) > getHeight(rightChild.get()) + 1) {
+		if (getHeight(leftChild->getLeftChild()) >= getHeight(leftChild->getRightChild())) {
+			return makeNode(leftChild->getElement(),
+			                leftChild->getSharedLeftChild(),
+			                makeNode(element, leftChild->getSharedRightChild(), std::move(rightChild)));
+		}
+		
+		const auto* leftRightChild {leftChild->getRightChild()};
+		return makeNode(leftRightChild->getElement(),
+		                makeNode(leftChild->getElement(),
+		                         leftChild->getSharedLeftChild(),
+		                         leftRightChild->getSharedLeftChild()),
+		                makeNode(element, leftRightChild->getSharedRightChild(), std::move(rightChild)));
+	}
+	
+	if (getHeight(rightChild.get()) > getHeight(leftChild.get()) + 1) {
+		if (getHeight(rightChild->getRightChild()) >= getHeight(rightChild->getLeftChild())) {
+			return makeNode(rightChild->getElement(),
+			                makeNode(element, std::move(leftChild), rightChild->getSharedLeftChild()),
+			                rightChild->getSharedRightChild());
+		}
+		
+		const auto* rightLeftChild {rightChild->getLeftChild()};
+		return makeNode(rightLeftChild->getElement(),
+		                makeNode(element, std::move(leftChild), rightLeftChild->getSharedLeftChild()),
+		                makeNode(rightChild->getElement(),
+		                         rightLeftChild->getSharedRightChild(),
+		                         rightChild->getSharedRightChild()));
+	}
+	
+	return makeNode(element, std::move(leftChild), std::move(rightChild));
+}
+
+template<ElementTypeWithLessThanOperator ElementType>
+PersistentAVLTree<ElementType>::NodePointer PersistentAVLTree<ElementType>::makeNode(const ElementType& element,
+                                                                                     NodePointer leftChild,
+                                                                                     NodePointer rightChild) {
+	return std::make_shared<const PersistentAVLTreeNode<ElementType>>(
+			element, std::move(leftChild), std::move(rightChild));
+}
+
+template<ElementTypeWithLessThanOperator ElementType>
+const PersistentAVLTreeNode<ElementType>* PersistentAVLTree<ElementType>::findNode(
+		const ElementType& element) const noexcept {
+	const auto* currentNode {rootNode.get()};
+	
+	while (currentNode != nullptr) {
+		if (element < currentNode->getElement()) {
+			currentNode = currentNode->getLeftChild();
+		} else if (currentNode->getElement() < element) {
+			currentNode = currentNode->getRightChild();
+		} else {
+			return currentNode;
+		}
+	}
+	
+	return nullptr;
+}
+
+template<ElementTypeWithLessThanOperator ElementType>
+const PersistentAVLTreeNode<ElementType>* PersistentAVLTree<ElementType>::getMinimumNode(
+		const PersistentAVLTreeNode<ElementType>* node) noexcept {
+	if (node == nullptr) {
+		return nullptr;
+	}
+	
+	while (node->getLeftChild() != nullptr) {
+		node = node->getLeftChild();
+	}
+	
+	return node;
+}
+
+template<ElementTypeWithLessThanOperator ElementType>
+const PersistentAVLTreeNode<ElementType>* PersistentAVLTree<ElementType>::getMaximumNode(
+		const PersistentAVLTreeNode<ElementType>* node) noexcept {
+	if (node == nullptr) {
+		return nullptr;
+	}
+	
+	while (node->getRightChild() != nullptr) {
+		node = node->getRightChild();
+	}
+	
+	return node;
+}
+
+template<ElementTypeWithLessThanOperator ElementType>
+int PersistentAVLTree<ElementType>::getHeight(const PersistentAVLTreeNode<ElementType>* node) noexcept {
+	return node == nullptr ? -1 : node->getHeight();
+}
+
+template<ElementTypeWithLessThanOperator ElementType>
+std::size_t PersistentAVLTree<ElementType>::getSubtreeSize(const PersistentAVLTreeNode<ElementType>* node) noexcept {
+	return node == nullptr ? 0 : node->getSubtreeSize();
+}
+}
\ No newline at end of file
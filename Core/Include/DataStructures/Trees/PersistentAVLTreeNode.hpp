@@ -0,0 +1,175 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <utility>
+
+namespace Core::DataStructures::Trees {
+/**
+ * @brief An immutable node for persistent avl trees that shares ownership of its children.
+ * @details A node never changes after construction, so any number of persistent avl trees and threads can share it
+ * without synchronization, and it is freed once the last tree or node that refers to it lets go. The height and the
+ * subtree size are computed from the children on construction.
+ * @class PersistentAVLTreeNode
+ * @tparam ElementType The type of the elements stored in the persistent avl tree.
+ */
+template<typename ElementType>
+class PersistentAVLTreeNode final {
+public:
+	/**
+	 * @brief Instantiates a new node with the given element and children using copy semantics.
+	 * @param element The element to store in the node.
+	 * @param leftChild The left child of the node, which may be nullptr.
+	 * @param rightChild The right child of the node, which may be nullptr.
+	 */
+	PersistentAVLTreeNode(const ElementType& element,
+	                      std::shared_ptr<const PersistentAVLTreeNode<ElementType>> leftChild,
+	                      std::shared_ptr<const PersistentAVLTreeNode<ElementType>> rightChild) noexcept;
+	
+	/**
+	 * @brief Instantiates a new node with the given element and children using move semantics.
+	 * @param element The element to store in the node.
+	 * @param leftChild The left child of the node, which may be nullptr.
+	 * @param rightChild The right child of the node, which may be nullptr.
+	 */
+	PersistentAVLTreeNode(ElementType&& element,
+	                      std::shared_ptr<const PersistentAVLTreeNode<ElementType>> leftChild,
+	                      std::shared_ptr<const PersistentAVLTreeNode<ElementType>> rightChild) noexcept;
+	
+	/**
+	 * @brief Deleted copy constructor.
+	 */
+	PersistentAVLTreeNode(const PersistentAVLTreeNode<ElementType>& other) = delete;
+	
+	/**
+	 * @brief Deleted move constructor.
+	 */
+	PersistentAVLTreeNode(PersistentAVLTreeNode<ElementType>&& other) noexcept = delete;
+	
+	/**
+	 * @brief Destroys the node.
+	 */
+	~PersistentAVLTreeNode() noexcept = default;
+
+public:
+	/**
+	 * @brief Deleted copy assignment operator.
+	 */
+	PersistentAVLTreeNode<ElementType>& operator=(const PersistentAVLTreeNode<ElementType>& other) = delete;
+	
+	/**
+	 * @brief Deleted move assignment operator.
+	 */
+	PersistentAVLTreeNode<ElementType>& operator=(PersistentAVLTreeNode<ElementType>&& other) noexcept = delete;
+
+public:
+	/**
+	 * @brief Gets a const reference to the element stored in the node.
+	 * @return A const reference to the element stored in the node.
+	 */
+	const ElementType& getElement() const noexcept;
+	
+	/**
+	 * @brief Gets a const pointer to the left child of the node.
+	 * @return A const pointer to the left child of the node.
+	 */
+	const PersistentAVLTreeNode<ElementType>* getLeftChild() const noexcept;
+	
+	/**
+	 * @brief Gets the shared left child of the node.
+	 * @return The shared left child of the node.
+	 */
+	const std::shared_ptr<const PersistentAVLTreeNode<ElementType>>& getSharedLeftChild() const noexcept;
+	
+	/**
+	 * @brief Gets a const pointer to the right child of the node.
+	 * @return A const pointer to the right child of the node.
+	 */
+	const PersistentAVLTreeNode<ElementType>* getRightChild() const noexcept;
+	
+	/**
+	 * @brief Gets the shared right child of the node.
+	 * @return The shared right child of the node.
+	 */
+	const std::shared_ptr<const PersistentAVLTreeNode<ElementType>>& getSharedRightChild() const noexcept;
+	
+	/**
+	 * @brief Gets the height of the subtree rooted at the node.
+	 * @return The height of the subtree rooted at the node, which is 0 for a leaf.
+	 */
+	int getHeight() const noexcept;
+	
+	/**
+	 * @brief Gets the number of nodes in the subtree rooted at the node.
+	 * @return The number of nodes in the subtree rooted at the node, including the node itself.
+	 */
+	std::size_t getSubtreeSize() const noexcept;
+
+private:
+	ElementType element;
+	std::shared_ptr<const PersistentAVLTreeNode<ElementType>> leftChild;
+	std::shared_ptr<const PersistentAVLTreeNode<ElementType>> rightChild;
+	int height;
+	std::size_t subtreeSize;
+};
+
+template<typename ElementType>
+PersistentAVLTreeNode<ElementType>::PersistentAVLTreeNode(
+		const ElementType& element,
+		std::shared_ptr<const PersistentAVLTreeNode<ElementType>> leftChild,
+		std::shared_ptr<const PersistentAVLTreeNode<ElementType>> rightChild) noexcept :
+		PersistentAVLTreeNode {ElementType {element}, std::move(leftChild), std::move(rightChild)} {
+	
+}
+
+template<typename ElementType>
+PersistentAVLTreeNode<ElementType>::PersistentAVLTreeNode(
+		ElementType&& element,
+		std::shared_ptr<const PersistentAVLTreeNode<ElementType>> leftChild,
+		std::shared_ptr<const PersistentAVLTreeNode<ElementType>> rightChild) noexcept :
+		element {std::move(element)},
+		leftChild {std::move(leftChild)},
+		rightChild {std::move(rightChild)},
+		height {1 + std::max(this->leftChild == nullptr ? -1 : this->leftChild->height,
+		                     this->rightChild == nullptr ? -1 : this->rightChild->height)},
+		subtreeSize {1 + (this->leftChild == nullptr ? 0 : this->leftChild->subtreeSize) +
+		             (this->rightChild == nullptr ? 0 : this->rightChild->subtreeSize)} {
+	
+}
+
+template<typename ElementType>
+const ElementType& PersistentAVLTreeNode<ElementType>::getElement() const noexcept {
+	return element;
+}
+
+template<typename ElementType>
+const PersistentAVLTreeNode<ElementType>* PersistentAVLTreeNode<ElementType>::getLeftChild() const noexcept {
+	return leftChild.get();
+}
+
+template<typename ElementType>
+const std::shared_ptr<const PersistentAVLTreeNode<ElementType>>& PersistentAVLTreeNode<ElementType>::getSharedLeftChild() const noexcept {
+	return leftChild;
+}
+
+template<typename ElementType>
+const PersistentAVLTreeNode<ElementType>* PersistentAVLTreeNode<ElementType>::getRightChild() const noexcept {
+	return rightChild.get();
+}
+
+template<typename ElementType>
+const std::shared_ptr<const PersistentAVLTreeNode<ElementType>>& PersistentAVLTreeNode<ElementType>::getSharedRightChild() const noexcept {
+	return rightChild;
+}
+
+template<typename ElementType>
+int PersistentAVLTreeNode<ElementType>::getHeight() const noexcept {
+	return height;
+}
+
+template<typename ElementType>
+std::size_t PersistentAVLTreeNode<ElementType>::getSubtreeSize() const noexcept {
+	return subtreeSize;
+}
+}
\ No newline at end of file
@@ -0,0 +1,971 @@
+#pragma once
+
+#include <algorithm>
+#include <functional>
+#include <optional>
+#include <vector>
+
+#include "DataStructures/Trees/Iterators/BinaryTreeConstInOrderIterator.hpp"
+#include "DataStructures/Trees/Iterators/BinaryTreeConstLevelOrderIterator.hpp"
+#include "DataStructures/Trees/Iterators/BinaryTreeConstPostOrderIterator.hpp"
+#include "DataStructures/Trees/Iterators/BinaryTreeConstPreOrderIterator.hpp"
+#include "DataStructures/Trees/Iterators/BinaryTreeInOrderIterator.hpp"
+#include "DataStructures/Trees/Iterators/BinaryTreeIteratorConcepts.hpp"
+#include "DataStructures/Trees/Iterators/BinaryTreeLevelOrderIterator.hpp"
+#include "DataStructures/Trees/Iterators/BinaryTreePostOrderIterator.hpp"
+#include "DataStructures/Trees/Iterators/BinaryTreePreOrderIterator.hpp"
+#include "DataStructures/Trees/Iterators/ParentLinkedBinaryTreeConstInOrderIterator.hpp"
+#include "DataStructures/Trees/Iterators/ParentLinkedBinaryTreeInOrderIterator.hpp"
+#include "DataStructures/Trees/RedBlackTreeNode.hpp"
+#include "BinarySearchTreeConcepts.hpp"
+
+namespace Core::DataStructures::Trees {
+/**
+ * @brief A red-black tree.
+ * @details Every node is red or black, no red node has a red child and every path from a node down to a missing child
+ * passes the same number of black nodes, which keeps the height below 2 * log2(n + 1). Compared to an avl tree, an
+ * insertion takes at most 2 rotations and a removal at most 3, and no height is stored, so mixed insertions and
+ * removals restructure less at the cost of slightly deeper searches. The color is stored in the lowest bit of the
+ * parent link, so a node is no larger than a node of an avl tree, and the parent links let insertions and removals run
+ * iteratively and in-order iterators be a single node pointer.
+ * @class RedBlackTree
+ * @tparam ElementType The type of the elements stored in the red-black tree.
+ */
+template<ElementTypeWithLessThanOperator ElementType>
+class RedBlackTree final {
+public:
+	/**
+	 * @brief Instantiates a new red-black tree with no nodes.
+	 */
+	RedBlackTree() noexcept = default;
+	
+	/**
+	 * @brief Instantiates a new red-black tree by copying the given red-black tree.
+	 * @param other The red-black tree to copy.
+	 */
+	RedBlackTree(const RedBlackTree& other);
+	
+	/**
+	 * @brief Instantiates a new red-black tree by moving the given red-black tree.
+	 * @param other The red-black tree to move.
+	 */
+	RedBlackTree(RedBlackTree&& other) noexcept;
+	
+	/**
+	 * @brief Destroys the red-black tree.
+	 */
+	~RedBlackTree() noexcept;
+
+public:
+	/**
+	 * @brief Assigns the given red-black tree to this red-black tree using copy semantics.
+	 * @param other The red-black tree to copy.
+	 * @return A reference to this red-black tree.
+	 */
+	RedBlackTree<ElementType>& operator=(const RedBlackTree& other);
+	
+	/**
+	 * @brief Assigns the given red-black tree to this red-black tree using move semantics.
+	 * @param other The red-black tree to move.
+	 * @return A reference to this red-black tree.
+	 */
+	RedBlackTree<ElementType>& operator=(RedBlackTree&& other) noexcept;
+	
+	/**
+	 * @brief Checks if the given red-black tree is equal to this red-black tree.
+	 * @details Two red-black trees are equal if they have the same number of nodes, the node contain the same elements,
+	 * and the nodes are in the same order.
+	 * @param other The red-black tree to check.
+	 * @return True if the given red-black tree is equal to this red-black tree, false otherwise.
+	 */
+	bool operator==(const RedBlackTree& other) const noexcept;
+
+public:
+	using value_type = ElementType;
+	using ConstInOrderIterator = Iterators::ParentLinkedBinaryTreeConstInOrderIterator<ElementType, RedBlackTreeNode<ElementType>>;
+	using ConstLevelOrderIterator = Iterators::BinaryTreeConstLevelOrderIterator<ElementType, RedBlackTreeNode<ElementType>>;
+	using ConstPostOrderIterator = Iterators::BinaryTreeConstPostOrderIterator<ElementType, RedBlackTreeNode<ElementType>>;
+	using ConstPreOrderIterator = Iterators::BinaryTreeConstPreOrderIterator<ElementType, RedBlackTreeNode<ElementType>>;
+	using InOrderIterator = Iterators::ParentLinkedBinaryTreeInOrderIterator<ElementType, RedBlackTreeNode<ElementType>>;
+	using LevelOrderIterator = Iterators::BinaryTreeLevelOrderIterator<ElementType, RedBlackTreeNode<ElementType>>;
+	using PostOrderIterator = Iterators::BinaryTreePostOrderIterator<ElementType, RedBlackTreeNode<ElementType>>;
+	using PreOrderIterator = Iterators::BinaryTreePreOrderIterator<ElementType, RedBlackTreeNode<ElementType>>;
+	
+	/**
+	 * @brief Gets a const in-order iterator to the first node in the red-black tree.
+	 * @return A const in-order iterator to the first node in the red-black tree.
+	 */
+	ConstInOrderIterator cbeginInOrder() const noexcept;
+	
+	/**
+	 * @brief Gets a const in-order iterator to the node after the last node in the red-black tree.
+	 * @return A const in-order iterator to the node after the last node in the red-black tree.
+	 */
+	ConstInOrderIterator cendInOrder() const noexcept;
+	
+	/**
+	 * @brief Gets a const level-order iterator to the first node in the red-black tree.
+	 * @return A const level-order iterator to the first node in the red-black tree.
+	 */
+	ConstLevelOrderIterator cbeginLevelOrder() const noexcept;
+	
+	/**
+	 * @brief Gets a const level-order iterator to the node after the last node in the red-black tree.
+	 * @return A const level-order iterator to the node after the last node in the red-black tree.
+	 */
+	ConstLevelOrderIterator cendLevelOrder() const noexcept;
+	
+	/**
+	 * @brief Gets a const post-order iterator to the first node in the red-black tree.
+	 * @return A const post-order iterator to the first node in the red-black tree.
+	 */
+	ConstPostOrderIterator cbeginPostOrder() const noexcept;
+	
+	/**
+	 * @brief Gets a const post-order iterator to the node after the last node in the red-black tree.
+	 * @return A const post-order iterator to the node after the last node in the red-black tree.
+	 */
+	ConstPostOrderIterator cendPostOrder() const noexcept;
+	
+	/**
+	 * @brief Gets a const pre-order iterator to the first node in the red-black tree.
+	 * @return A const pre-order iterator to the first node in the red-black tree.
+	 */
+	ConstPreOrderIterator cbeginPreOrder() const noexcept;
+	
+	/**
+	 * @brief Gets a const pre-order iterator to the node after the last node in the red-black tree.
+	 * @return A const pre-order iterator to the node after the last node in the red-black tree.
+	 */
+	ConstPreOrderIterator cendPreOrder() const noexcept;
+	
+	/**
+	 * @brief Gets an in-order iterator to the first node in the red-black tree.
+	 * @return An in-order iterator to the first node in the red-black tree.
+	 */
+	InOrderIterator beginInOrder() noexcept;
+	
+	/**
+	 * @brief Gets an in-order iterator to the node after the last node in the red-black tree.
+	 * @return An in-order iterator to the node after the last node in the red-black tree.
+	 */
+	InOrderIterator endInOrder() noexcept;
+	
+	/**
+	 * @brief Gets a level-order iterator to the first node in the red-black tree.
+	 * @return A level-order iterator to the first node in the red-black tree.
+	 */
+	LevelOrderIterator beginLevelOrder() noexcept;
+	
+	/**
+	 * @brief Gets a level-order iterator to the node after the last node in the red-black tree.
+	 * @return A level-order iterator to the node after the last node in the red-black tree.
+	 */
+	LevelOrderIterator endLevelOrder() noexcept;
+	
+	/**
+	 * @brief Gets a post-order iterator to the first node in the red-black tree.
+	 * @return A post-order iterator to the first node in the red-black tree.
+	 */
+	PostOrderIterator beginPostOrder() noexcept;
+	
+	/**
+	 * @brief Gets a post-order iterator to the node after the last node in the red-black tree.
+	 * @return A post-order iterator to the node after the last node in the red-black tree.
+	 */
+	PostOrderIterator endPostOrder() noexcept;
+	
+	/**
+	 * @brief Gets a pre-order iterator to the first node in the red-black tree.
+	 * @return A pre-order iterator to the first node in the red-black tree.
+	 */
+	PreOrderIterator beginPreOrder() noexcept;
+	
+	/**
+	 * @brief Gets a pre-order iterator to the node after the last node in the red-black tree.
+	 * @return A pre-order iterator to the node after the last node in the red-black tree.
+	 */
+	PreOrderIterator endPreOrder() noexcept;
+
+public:
+	/**
+	 * @brief Inserts the given element into the red-black tree using copy semantics.
+	 * @param element The element to insert.
+	 */
+	void insert(const ElementType& element) noexcept;
+	
+	/**
+	 * @brief Inserts the given element into the red-black tree using move semantics.
+	 * @param element The element to insert.
+	 */
+	void insert(ElementType&& element) noexcept;
+	
+	/**
+	 * @brief Removes the first occurrence of the given element from the red-black tree.
+	 * @param element The element to remove.
+	 * @return The element that was removed from the red-black tree, or std::nullopt if the red-black tree is empty or
+	 * the given element was not found in the red-black tree.
+	 */
+	std::optional<ElementType> removeFirst(const ElementType& element);
+	
+	/**
+	 * @brief Removes the minimum element from the red-black tree.
+	 * @return The minimum element from the red-black tree, or std::nullopt if the red-black tree is empty.
+	 */
+	std::optional<ElementType> removeMinimum();
+	
+	/**
+	 * @brief Removes the maximum element from the red-black tree.
+	 * @return The maximum element from the red-black tree, or std::nullopt if the red-black tree is empty.
+	 */
+	std::optional<ElementType> removeMaximum();
+	
+	/**
+	 * @brief Removes all elements from the red-black tree resulting in an empty red-black tree.
+	 * @return A vector containing all elements that were removed from the red-black tree.
+	 */
+	std::vector<ElementType> removeAll();
+	
+	/**
+	 * @brief Finds the first occurrence of the given element in the red-black tree.
+	 * @param element The element to find.
+	 * @return The first occurrence of the given element in the red-black tree, or std::nullopt if the red-black tree is
+	 * empty or the given element was not found in the red-black tree.
+	 */
+	std::optional<ElementType> findFirst(const ElementType& element) const noexcept;
+	
+	/**
+	 * @brief Finds the minimum element in the red-black tree.
+	 * @return The minimum element in the red-black tree, or std::nullopt if the red-black tree is empty.
+	 */
+	std::optional<ElementType> findMinimum() const noexcept;
+	
+	/**
+	 * @brief Finds the maximum element in the red-black tree.
+	 * @return The maximum element in the red-black tree, or std::nullopt if the red-black tree is empty.
+	 */
+	std::optional<ElementType> findMaximum() const noexcept;
+	
+	/**
+	 * @brief Traverses the red-black tree using the given function on each node in the red-black tree.
+	 * @tparam ConstIteratorType The type of const iterator to use to traverse the red-black tree.
+	 * @param begin A const iterator to the first node in the red-black tree.
+	 * @param end A const iterator to the node after the last node in the red-black tree.
+	 * @param function The function to use to traverse the red-black tree.
+	 */
+	template<typename ConstIteratorType>
+	requires Iterators::AllowedConstIterator<ConstIteratorType, ElementType, RedBlackTreeNode<ElementType>>
+	void traverse(ConstIteratorType begin,
+	              ConstIteratorType end,
+	              const std::function<void(const ElementType&)>& function) const noexcept;
+	
+	/**
+	 * @brief Traverses the red-black tree using the given function on each node in the red-black tree.
+	 * @tparam IteratorType The type of iterator to use to traverse the red-black tree.
+	 * @param begin An iterator to the first node in the red-black tree.
+	 * @param end An iterator to the node after the last node in the red-black tree.
+	 * @param function The function to use to traverse the red-black tree.
+	 */
+	template<typename IteratorType>
+	requires Iterators::AllowedIterator<IteratorType, ElementType, RedBlackTreeNode<ElementType>>
+	void traverse(IteratorType begin,
+	              IteratorType end,
+	              const std::function<void(ElementType&)>& function) const noexcept;
+	
+	/**
+	 * @brief Checks if the red-black tree contains the given element.
+	 * @param element The element to check.
+	 * @return True if the red-black tree contains the given element, false otherwise.
+	 */
+	bool contains(const ElementType& element) const noexcept;
+	
+	/**
+	 * @brief Checks if the red-black tree is empty.
+	 * @return True if the red-black tree is empty, false otherwise.
+	 */
+	bool isEmpty() const noexcept;
+	
+	/**
+	 * @brief Gets the number of nodes in the red-black tree.
+	 * @return The number of nodes in the red-black tree.
+	 */
+	std::size_t getNodeCount() const noexcept;
+	
+	/**
+	 * @brief Gets the height of the red-black tree.
+	 * @return The height of the red-black tree.
+	 */
+	int getHeight() const noexcept;
+
+private:
+	/**
+	 * @brief Links the given new node below the last node on its search path and restores the red-black properties.
+	 * @param newNode The red node to insert.
+	 */
+	void insert(RedBlackTreeNode<ElementType>* newNode) noexcept;
+	
+	/**
+	 * @brief Unlinks and frees the given node and restores the red-black properties.
+	 * @details A node with two children is replaced by its in-order successor, which takes over its color, so only the
+	 * successor is relinked and the element is never copied between nodes.
+	 * @param node The node to remove.
+	 * @return The element of the removed node.
+	 */
+	ElementType remove(RedBlackTreeNode<ElementType>* node);
+	
+	/**
+	 * @brief Finds the first node on the search path whose element is equivalent to the given element.
+	 * @param element The element to find.
+	 * @return The node holding the element, or nullptr if the red-black tree does not contain the element.
+	 */
+	RedBlackTreeNode<ElementType>* findNode(const ElementType& element) const noexcept;
+	
+	/**
+	 * @brief Recolors and rotates the ancestors of the given red node until no red node has a red parent.
+	 * @param node The red node that was inserted.
+	 */
+	void rebalanceAfterInsertion(RedBlackTreeNode<ElementType>* node) noexcept;
+	
+	/**
+	 * @brief Recolors and rotates around the given node until every path passes the same number of black nodes again.
+	 * @param node The node that took the place of a removed black node, which may be nullptr.
+	 * @param parent The parent of the node that took the place of the removed black node.
+	 */
+	void rebalanceAfterRemoval(RedBlackTreeNode<ElementType>* node, RedBlackTreeNode<ElementType>* parent) noexcept;
+	
+	/**
+	 * @brief Replaces the given child of the given parent, or the root node if there is no parent, with another node.
+	 * @param parent The parent of the child to replace, or nullptr if the child is the root node.
+	 * @param child The child to replace.
+	 * @param replacement The node to put in place of the child, which may be nullptr.
+	 */
+	void replaceChild(RedBlackTreeNode<ElementType>* parent,
+	                  const RedBlackTreeNode<ElementType>* child,
+	                  RedBlackTreeNode<ElementType>* replacement) noexcept;
+	
+	/**
+	 * @brief Rotates the given node left in place.
+	 * @param node The node to rotate left, which must have a right child.
+	 */
+	void rotateLeft(RedBlackTreeNode<ElementType>* node) noexcept;
+	
+	/**
+	 * @brief Rotates the given node right in place.
+	 * @param node The node to rotate right, which must have a left child.
+	 */
+	void rotateRight(RedBlackTreeNode<ElementType>* node) noexcept;
+	
+	/**
+	 * @brief Gets the node with the minimum element in the subtree rooted at the given node.
+	 * @param node The root of the subtree.
+	 * @return The node with the minimum element, or nullptr if the subtree is empty.
+	 */
+	static RedBlackTreeNode<ElementType>* getMinimumNode(RedBlackTreeNode<ElementType>* node) noexcept;
+	
+	/**
+	 * @brief Gets the node with the maximum element in the subtree rooted at the given node.
+	 * @param node The root of the subtree.
+	 * @return The node with the maximum element, or nullptr if the subtree is empty.
+	 */
+	static RedBlackTreeNode<ElementType>* getMaximumNode(RedBlackTreeNode<ElementType>* node) noexcept;
+	
+	/**
+	 * @brief Checks if the given node is red, treating a missing node as black.
+	 * @param node The node to check.
+	 * @return True if the node is not nullptr and red, false otherwise.
+	 */
+	static bool isRed(const RedBlackTreeNode<ElementType>* node) noexcept;
+	
+	/**
+	 * @brief Clones the subtree rooted at the given node, keeping the shape and the color of every node.
+	 * @details The height of a red-black tree is logarithmic, so the recursion stays shallow, and no node is compared
+	 * or rotated, so the subtree is cloned in linear time.
+	 * @param node The root of the subtree to clone, which may be nullptr.
+	 * @return The root of the cloned subtree, which has no parent, or nullptr if the given subtree is empty.
+	 */
+	static RedBlackTreeNode<ElementType>* copySubtree(const RedBlackTreeNode<ElementType>* node);
+	
+	/**
+	 * @brief Removes all elements from the red-black tree recursively.
+	 * @param node The node to start removing from.
+	 * @param elements The elements that were removed from the red-black tree.
+	 */
+	void removeAll(RedBlackTreeNode<ElementType>* node, std::vector<ElementType>& elements);
+	
+	/**
+	 * @brief Gets the height of the given node recursively.
+	 * @param node The node to get the height of.
+	 * @return The height of the given node.
+	 */
+	int getHeight(const RedBlackTreeNode<ElementType>* const node) const noexcept;
+
+private:
+	std::size_t nodeCount {0};
+	RedBlackTreeNode<ElementType>* rootNode {nullptr};
+};
+
+template<ElementTypeWithLessThanOperator ElementType>
+RedBlackTree<ElementType>::RedBlackTree(const RedBlackTree<ElementType>& other) {
+	nodeCount = other.nodeCount;
+	rootNode = copySubtree(other.rootNode);
+}
+
+template<ElementTypeWithLessThanOperator ElementType>
+RedBlackTree<ElementType>::RedBlackTree(RedBlackTree<ElementType>&& other) noexcept {
+	removeAll();
+	
+	nodeCount = other.nodeCount;
+	rootNode = other.rootNode;
+	
+	other.nodeCount = 0;
+	other.rootNode = nullptr;
+}
+
+template<ElementTypeWithLessThanOperator ElementType>
+RedBlackTree<ElementType>::~RedBlackTree() noexcept {
+	removeAll();
+}
+
+template<ElementTypeWithLessThanOperator ElementType>
+RedBlackTree<ElementType>& RedBlackTree<ElementType>::operator=(const RedBlackTree& other) {
+	if (this == &other) {
+		return *this;
+	}
+	
+	removeAll();
+	
+	nodeCount = other.nodeCount;
+	rootNode = copySubtree(other.rootNode);
+	
+	return *this;
+}
+
+template<ElementTypeWithLessThanOperator ElementType>
+RedBlackTree<ElementType>& RedBlackTree<ElementType>::operator=(RedBlackTree&& other) noexcept {
+	if (this == &other) {
+		return *this;
+	}
+	
+	removeAll();
+	
+	nodeCount = other.nodeCount;
+	rootNode = other.rootNode;
+	
+	other.nodeCount = 0;
+	other.rootNode = nullptr;
+	
+	return *this;
+}
+
+template<ElementTypeWithLessThanOperator ElementType>
+bool RedBlackTree<ElementType>::operator==(const RedBlackTree& other) const noexcept {
+	if (nodeCount != other.nodeCount) {
+		return false;
+	}
+	
+	return std::equal(cbeginInOrder(), cendInOrder(), other.cbeginInOrder(), other.cendInOrder());
+}
+
+template<ElementTypeWithLessThanOperator ElementType>
+RedBlackTree<ElementType>::ConstInOrderIterator RedBlackTree<ElementType>::cbeginInOrder() const noexcept {
+	return ConstInOrderIterator {getMinimumNode(rootNode)};
+}
+
+template<ElementTypeWithLessThanOperator ElementType>
+RedBlackTree<ElementType>::ConstInOrderIterator RedBlackTree<ElementType>::cendInOrder() const noexcept {
+	return ConstInOrderIterator {nullptr};
+}
+
+template<ElementTypeWithLessThanOperator ElementType>
+RedBlackTree<ElementType>::ConstLevelOrderIterator RedBlackTree<ElementType>::cbeginLevelOrder() const noexcept {
+	return ConstLevelOrderIterator {rootNode};
+}
+
+template<ElementTypeWithLessThanOperator ElementType>
+RedBlackTree<ElementType>::ConstLevelOrderIterator RedBlackTree<ElementType>::cendLevelOrder() const noexcept {
+	return ConstLevelOrderIterator {nullptr};
+}
+
+template<ElementTypeWithLessThanOperator ElementType>
+RedBlackTree<ElementType>::ConstPostOrderIterator RedBlackTree<ElementType>::cbeginPostOrder() const noexcept {
+	return ConstPostOrderIterator {rootNode};
+}
+
+template<ElementTypeWithLessThanOperator ElementType>
+RedBlackTree<ElementType>::ConstPostOrderIterator RedBlackTree<ElementType>::cendPostOrder() const noexcept {
+	return ConstPostOrderIterator {nullptr};
+}
+
+template<ElementTypeWithLessThanOperator ElementType>
+RedBlackTree<ElementType>::ConstPreOrderIterator RedBlackTree<ElementType>::cbeginPreOrder() const noexcept {
+	return ConstPreOrderIterator {rootNode};
+}
+
+template<ElementTypeWithLessThanOperator ElementType>
+RedBlackTree<ElementType>::ConstPreOrderIterator RedBlackTree<ElementType>::cendPreOrder() const noexcept {
+	return ConstPreOrderIterator {nullptr};
+}
+
+template<ElementTypeWithLessThanOperator ElementType>
+RedBlackTree<ElementType>::InOrderIterator RedBlackTree<ElementType>::beginInOrder() noexcept {
+	return InOrderIterator {getMinimumNode(rootNode)};
+}
+
+template<ElementTypeWithLessThanOperator ElementType>
+RedBlackTree<ElementType>::InOrderIterator RedBlackTree<ElementType>::endInOrder() noexcept {
+	return InOrderIterator {nullptr};
+}
+
+template<ElementTypeWithLessThanOperator ElementType>
+RedBlackTree<ElementType>::LevelOrderIterator RedBlackTree<ElementType>::beginLevelOrder() noexcept {
+	return LevelOrderIterator {rootNode};
+}
+
+template<ElementTypeWithLessThanOperator ElementType>
+RedBlackTree<ElementType>::LevelOrderIterator RedBlackTree<ElementType>::endLevelOrder() noexcept {
+	return LevelOrderIterator {nullptr};
+}
+
+template<ElementTypeWithLessThanOperator ElementType>
+RedBlackTree<ElementType>::PostOrderIterator RedBlackTree<ElementType>::beginPostOrder() noexcept {
+	return PostOrderIterator {rootNode};
+}
+
+template<ElementTypeWithLessThanOperator ElementType>
+RedBlackTree<ElementType>::PostOrderIterator RedBlackTree<ElementType>::endPostOrder() noexcept {
+	return PostOrderIterator {nullptr};
+}
+
+template<ElementTypeWithLessThanOperator ElementType>
+RedBlackTree<ElementType>::PreOrderIterator RedBlackTree<ElementType>::beginPreOrder() noexcept {
+	return PreOrderIterator {rootNode};
+}
+
+template<ElementTypeWithLessThanOperator ElementType>
+RedBlackTree<ElementType>::PreOrderIterator RedBlackTree<ElementType>::endPreOrder() noexcept {
+	return PreOrderIterator {nullptr};
+}
+
+template<ElementTypeWithLessThanOperator ElementType>
+void RedBlackTree<ElementType>::insert(const ElementType& element) noexcept {
+	insert(new RedBlackTreeNode<ElementType> {element});
+}
+
+template<ElementTypeWithLessThanOperator ElementType>
+void RedBlackTree<ElementType>::insert(ElementType&& element) noexcept {
+	insert(new RedBlackTreeNode<ElementType> {std::move(element)});
+}
+
+template<ElementTypeWithLessThanOperator ElementType>
+std::optional<ElementType> RedBlackTree<ElementType>::removeFirst(const ElementType& element) {
+	auto* node {findNode(element)};
+	if (node == nullptr) {
+		return std::nullopt;
+	}
+	
+	return remove(node);
+}
+
+template<ElementTypeWithLessThanOperator ElementType>
+std::optional<ElementType> RedBlackTree<ElementType>::removeMinimum() {
+	if (rootNode == nullptr) {
+		return std::nullopt;
+	}
+	
+	return remove(getMinimumNode(rootNode));
+}
+
+template<ElementTypeWithLessThanOperator ElementType>
+std::optional<ElementType> RedBlackTree<ElementType>::removeMaximum() {
+	if (rootNode == nullptr) {
+		return std::nullopt;
+	}
+	
+	return remove(getMaximumNode(rootNode));
+}
+
+template<ElementTypeWithLessThanOperator ElementType>
+std::vector<ElementType> RedBlackTree<ElementType>::removeAll() {
+	std::vector<ElementType> elements {};
+	removeAll(rootNode, elements);
+	rootNode = nullptr;
+	nodeCount = 0;
+	
+	return elements;
+}
+
+template<ElementTypeWithLessThanOperator ElementType>
+std::optional<ElementType> RedBlackTree<ElementType>::findFirst(const ElementType& element) const noexcept {
+	const auto* node {findNode(element)};
+	if (node == nullptr) {
+		return std::nullopt;
+	}
+	
+	return node->getElement();
+}
+
+template<ElementTypeWithLessThanOperator ElementType>
+std::optional<ElementType> RedBlackTree<ElementType>::findMinimum() const noexcept {
+	if (rootNode == nullptr) {
+		return std::nullopt;
+	}
+	
+	return getMinimumNode(rootNode)->getElement();
+}
+
+template<ElementTypeWithLessThanOperator ElementType>
+std::optional<ElementType> RedBlackTree<ElementType>::findMaximum() const noexcept {
+	if (rootNode == nullptr) {
+		return std::nullopt;
+	}
+	
+	return getMaximumNode(rootNode)->getElement();
+}
+
+template<ElementTypeWithLessThanOperator ElementType>
+template<typename ConstIteratorType>
+requires Iterators::AllowedConstIterator<ConstIteratorType, ElementType, RedBlackTreeNode<ElementType>>
+void RedBlackTree<ElementType>::traverse(ConstIteratorType begin,
+                                         ConstIteratorType end,
+                                         const std::function<void(const ElementType&)>& function) const noexcept {
+	std::for_each(begin, end, function);
+}
+
+template<ElementTypeWithLessThanOperator ElementType>
+template<typename IteratorType>
+requires Iterators::AllowedIterator<IteratorType, ElementType, RedBlackTreeNode<ElementType>>
+void RedBlackTree<ElementType>::traverse(IteratorType begin,
+                                         IteratorType end,
+                                         const std::function<void(ElementType&)>& function) const noexcept {
+	std::for_each(begin, end, function);
+}
+
+template<ElementTypeWithLessThanOperator ElementType>
+bool RedBlackTree<ElementType>::contains(const ElementType& element) const noexcept {
+	return findFirst(element).has_value();
+}
+
+template<ElementTypeWithLessThanOperator ElementType>
+bool RedBlackTree<ElementType>::isEmpty() const noexcept {
+	return rootNode == nullptr && nodeCount == 0;
+}
+
+template<ElementTypeWithLessThanOperator ElementType>
+std::size_t RedBlackTree<ElementType>::getNodeCount() const noexcept {
+	return nodeCount;
+}
+
+template<ElementTypeWithLessThanOperator ElementType>
+int RedBlackTree<ElementType>::getHeight() const noexcept {
+	return getHeight(rootNode);
+}
+
+template<ElementTypeWithLessThanOperator ElementType>
+void RedBlackTree<ElementType>::insert(RedBlackTreeNode<ElementType>* newNode) noexcept {
+	RedBlackTreeNode<ElementType>* parent {nullptr};
+	auto* currentNode {rootNode};
+	
+	while (currentNode != nullptr) {
+		parent = currentNode;
+		
+		if (newNode->getElement() < currentNode->getElement()) {
+			currentNode = currentNode->getLeftChild();
+		} else {
+			currentNode = currentNode->getRightChild();
+		}
+	}
+	
+	if (parent == nullptr) {
+		rootNode = newNode;
+	} else if (newNode->getElement() < parent->getElement()) {
+		parent->setLeftChild(newNode);
+	} else {
+		parent->setRightChild(newNode);
+	}
+	
+	++nodeCount;
+	rebalanceAfterInsertion(newNode);
+}
+
+template<ElementTypeWithLessThanOperator ElementType>
+ElementType RedBlackTree<ElementType>::remove(RedBlackTreeNode<ElementType>* node) {
+	auto element {std::move(node->getElement())};
+	auto wasBlackRemoved {!node->isRed()};
+	RedBlackTreeNode<ElementType>* childNode {nullptr};
+	RedBlackTreeNode<ElementType>* childParent {nullptr};
+	
+	if (node->getLeftChild() == nullptr || node->getRightChild() == nullptr) {
+		childNode = node->getLeftChild() != nullptr ? node->getLeftChild() : node->getRightChild();
+		childParent = node->getParent();
+		replaceChild(childParent, node, childNode);
+	} else {
+		auto* inOrderSuccessor {getMinimumNode(node->getRightChild())};
+		wasBlackRemoved = !inOrderSuccessor->isRed();
+		childNode = inOrderSuccessor->getRightChild();
+		
+		if (inOrderSuccessor->getParent() == node) {
+			childParent = inOrderSuccessor;
+		} else {
+			childParent = inOrderSuccessor->getParent();
+			childParent->setLeftChild(childNode);
+			inOrderSuccessor->setRightChild(node->getRightChild());
+		}
+		
+		replaceChild(node->getParent(), node, inOrderSuccessor);
+		inOrderSuccessor->setLeftChild(node->getLeftChild());
+		inOrderSuccessor->setRed(node->isRed());
+	}
+	
+	delete node;
+	--nodeCount;
+	
+	if (wasBlackRemoved) {
+		rebalanceAfterRemoval(childNode, childParent);
+	}
+	
+	return element;
+}
+
+template<ElementTypeWithLessThanOperator ElementType>
+RedBlackTreeNode<ElementType>* RedBlackTree<ElementType>::findNode(const ElementType& element) const noexcept {
+	auto* currentNode {rootNode};
+	
+	while (currentNode != nullptr) {
+		if (element < currentNode->getElement()) {
+			currentNode = currentNode->getLeftChild();
+		} else if (currentNode->getElement() < element) {
+			currentNode = currentNode->getRightChild();
+		} else {
+			return currentNode;
+		}
+	}
+	
+	return nullptr;
+}
+
+template<ElementTypeWithLessThanOperator ElementType>
+void RedBlackTree<ElementType>::rebalanceAfterInsertion(RedBlackTreeNode<ElementType>* node) noexcept {
+	while (true) {
+		auto* parent {node->getParent()};
+		if (parent == nullptr) {
+			node->setRed(false);
+			return;
+		}
+		
+		if (!parent->isRed()) {
+			return;
+		}
+		
+		auto* grandparent {parent->getParent()};
+		if (grandparent == nullptr) {
+			parent->setRed(false);
+			return;
+		}
+		
+		const auto isParentLeftChild {parent == grandparent->getLeftChild()};
+		auto* uncle {isParentLeftChild ? grandparent->getRightChild() : grandparent->getLeftChild()};
+		
+		if (isRed(uncle)) {
+			parent->setRed(false);
+			uncle->setRed(false);
+			grandparent->setRed(true);
+			node = grandparent;
+			continue;
+		}
+		
+		if (isParentLeftChild) {
+			if (node == parent->getRightChild()) {
+				rotateLeft(parent);
+				parent = node;
+			}
+			
+			rotateRight(grandparent);
+		} else {
+			if (node == parent->getLeftChild()) {
+				rotateRight(parent);
+				parent = node;
+			}
+			
+			rotateLeft(grandparent);
+		}
+		
+		parent->setRed(false);
+		grandparent->setRed(true);
+		return;
+	}
+}
+
+template<ElementTypeWithLessThanOperator ElementType>
+void RedBlackTree<ElementType>::rebalanceAfterRemoval(RedBlackTreeNode<ElementType>* node,
+                                                      RedBlackTreeNode<ElementType>* parent) noexcept {
+	while (node != rootNode && !isRed(node)) {
+		if (node == parent->getLeftChild()) {
+			auto* sibling {parent->getRightChild()};
+			
+			if (sibling->isRed()) {
+				sibling->setRed(false);
+				parent->setRed(true);
+				rotateLeft(parent);
+				sibling = parent->getRightChild();
+			}
+			
+			if (!isRed(sibling->getLeftChild()) && !isRed(sibling->getRightChild())) {
+				sibling->setRed(true);
+				node = parent;
+				parent = node->getParent();
+				continue;
+			}
+			
+			if (!isRed(sibling->getRightChild())) {
+				sibling->getLeftChild()->setRed(false);
+				sibling->setRed(true);
+				rotateRight(sibling);
+				sibling = parent->getRightChild();
+			}
+			
+			sibling->setRed(parent->isRed());
+			parent->setRed(false);
+			sibling->getRightChild()->setRed(false);
+			rotateLeft(parent);
+		} else {
+			auto* sibling {parent->getLeftChild()};
+			
+			if (sibling->isRed()) {
+				sibling->setRed(false);
+				parent->setRed(true);
+				rotateRight(parent);
+				sibling = parent->getLeftChild();
+			}
+			
+			if (!isRed(sibling->getLeftChild()) && !isRed(sibling->getRightChild())) {
+				sibling->setRed(true);
+				node = parent;
+				parent = node->getParent();
+				continue;
+			}
+			
+			if (!isRed(sibling->getLeftChild())) {
+				sibling->getRightChild()->setRed(false);
+				sibling->setRed(true);
+				rotateLeft(sibling);
+				sibling = parent->getLeftChild();
+			}
+			
+			sibling->setRed(parent->isRed());
+			parent->setRed(false);
+			sibling->getLeftChild()->setRed(false);
+			rotateRight(parent);
+		}
+		
+		node = rootNode;
+	}
+	
+	if (node != nullptr) {
+		node->setRed(false);
+	}
+}
+
+template<ElementTypeWithLessThanOperator ElementType>
+void RedBlackTree<ElementType>::replaceChild(RedBlackTreeNode<ElementType>* parent,
+                                             const RedBlackTreeNode<ElementType>* child,
+                                             RedBlackTreeNode<ElementType>* replacement) noexcept {
+	if (parent == nullptr) {
+		rootNode = replacement;
+		
+		if (replacement != nullptr) {
+			replacement->setParent(nullptr);
+		}
+	} else if (parent->getLeftChild() == child) {
+		parent->setLeftChild(replacement);
+	} else {
+		parent->setRightChild(replacement);
+	}
+}
+
+template<ElementTypeWithLessThanOperator ElementType>
+void RedBlackTree<ElementType>::rotateLeft(RedBlackTreeNode<ElementType>* node) noexcept {
+	auto* newParent {node->getRightChild()};
+	replaceChild(node->getParent(), node, newParent);
+	node->setRightChild(newParent->getLeftChild());
+	newParent->setLeftChild(node);
+}
+
+template<ElementTypeWithLessThanOperator ElementType>
+void RedBlackTree<ElementType>::rotateRight(RedBlackTreeNode<ElementType>* node) noexcept {
+	auto* newParent {node->getLeftChild()};
+	replaceChild(node->getParent(), node, newParent);
+	node->setLeftChild(newParent->getRightChild());
+	newParent->setRightChild(node);
+}
+
+template<ElementTypeWithLessThanOperator ElementType>
+RedBlackTreeNode<ElementType>* RedBlackTree<ElementType>::getMinimumNode(RedBlackTreeNode<ElementType>* node) noexcept {
+	if (node == nullptr) {
+		return nullptr;
+	}
+	
+	while (node->getLeftChild() != nullptr) {
+		node = node->getLeftChild();
+	}
+	
+	return node;
+}
+
+template<ElementTypeWithLessThanOperator ElementType>
+RedBlackTreeNode<ElementType>* RedBlackTree<ElementType>::getMaximumNode(RedBlackTreeNode<ElementType>* node) noexcept {
+	if (node == nullptr) {
+		return nullptr;
+	}
+	
+	while (node->getRightChild() != nullptr) {
+		node = node->getRightChild();
+	}
+	
+	return node;
+}
+
+template<ElementTypeWithLessThanOperator ElementType>
+bool RedBlackTree<ElementType>::isRed(const RedBlackTreeNode<ElementType>* node) noexcept {
+	return node != nullptr && node->isRed();
+}
+
+template<ElementTypeWithLessThanOperator ElementType>
+RedBlackTreeNode<ElementType>* RedBlackTree<ElementType>::copySubtree(const RedBlackTreeNode<ElementType>* node) {
+	if (node == nullptr) {
+		return nullptr;
+	}
+	
+	auto* copiedNode {new RedBlackTreeNode<ElementType> {node->getElement()}};
+	copiedNode->setRed(node->isRed());
+	copiedNode->setLeftChild(copySubtree(node->getLeftChild()));
+	copiedNode->setRightChild(copySubtree(node->getRightChild()));
+	
+	return copiedNode;
+}
+
+template<ElementTypeWithLessThanOperator ElementType>
+void RedBlackTree<ElementType>::removeAll(RedBlackTreeNode<ElementType>* node, std::vector<ElementType>& elements) {
+	if (node == nullptr) {
+		return;
+	}
+	
+	removeAll(node->getLeftChild(), elements);
+	removeAll(node->getRightChild(), elements);
+	
+	elements.emplace_back(std::move(node->getElement()));
+	
+	delete node;
+}
+
+template<ElementTypeWithLessThanOperator ElementType>
+int RedBlackTree<ElementType>::getHeight(const RedBlackTreeNode<ElementType>* const node) const noexcept {
+	if (node == nullptr) {
+		return -1;
+	}
+	
+	const auto leftSubtreeHeight {getHeight(node->getLeftChild())};
+	const auto rightSubtreeHeight {getHeight(node->getRightChild())};
+	
+	return std::max(leftSubtreeHeight, rightSubtreeHeight) + 1;
+}
+}
\ No newline at end of file
@@ -0,0 +1,282 @@
+#pragma once
+
+#include <cstdint>
+#include <utility>
+
+namespace Core::DataStructures::Trees {
+/**
+ * @brief A node for red-black trees that links to its parent and stores its color in the parent link.
+ * @details Nodes are aligned to at least the alignment of a pointer, so the lowest bit of the address of the parent is
+ * always 0 and is used to store whether the node is red, so the node holds no more than an element and three links,
+ * and the in-order iterators for parent linked binary trees walk it as well. Setting a child also sets the parent of that
+ * child to this node without changing the color of the child, and new nodes are red.
+ * @class RedBlackTreeNode
+ * @tparam ElementType The type of the elements stored in the red-black tree.
+ */
+template<typename ElementType>
+class RedBlackTreeNode final {
+public:
+	/**
+	 * @brief Instantiates a new red node with the given element using copy semantics.
+	 * @param element The element to store in the node.
+	 */
+	explicit RedBlackTreeNode(const ElementType& element) noexcept;
+	
+	/**
+	 * @brief Instantiates a new red node with the given element using move semantics.
+	 * @param element The element to store in the node.
+	 */
+	explicit RedBlackTreeNode(ElementType&& element) noexcept;
+	
+	/**
+	 * @brief Instantiates a new red-black tree node by copying the given node.
+	 * @param other The node to copy.
+	 */
+	RedBlackTreeNode(const RedBlackTreeNode<ElementType>& other) noexcept = default;
+	
+	/**
+	 * @brief Instantiates a new red-black tree node by moving the given node.
+	 * @param other The node to move.
+	 */
+	RedBlackTreeNode(RedBlackTreeNode<ElementType>&& other) noexcept = default;
+	
+	/**
+	 * @brief Destroys the node.
+	 */
+	~RedBlackTreeNode() noexcept = default;
+
+public:
+	/**
+	 * @brief Assigns the given node to this node using copy semantics.
+	 * @param other The node to copy.
+	 * @return A reference to this node.
+	 */
+	RedBlackTreeNode<ElementType>& operator=(const RedBlackTreeNode<ElementType>& other) noexcept = default;
+	
+	/**
+	 * @brief Assigns the given node to this node using move semantics.
+	 * @param other The node to move.
+	 * @return A reference to this node.
+	 */
+	RedBlackTreeNode<ElementType>& operator=(RedBlackTreeNode<ElementType>&& other) noexcept = default;
+	
+	/**
+	 * @brief Checks if this node is equal to the given node.
+	 * @details Two nodes are considered equal if their elements and children are equal.
+	 * @param other The node to compare with.
+	 * @return True if the two nodes are equal, false otherwise.
+	 */
+	bool operator==(const RedBlackTreeNode<ElementType>& other) const noexcept;
+
+public:
+	/**
+	 * @brief Gets a reference to the element stored in the node.
+	 * @return A reference to the element stored in the node.
+	 */
+	ElementType& getElement() noexcept;
+	
+	/**
+	 * @brief Gets a const reference to the element stored in the node.
+	 * @return A const reference to the element stored in the node.
+	 */
+	const ElementType& getElement() const noexcept;
+	
+	/**
+	 * @brief Gets a pointer to the left child of the node.
+	 * @return A pointer to the left child of the node.
+	 */
+	RedBlackTreeNode<ElementType>* getLeftChild() noexcept;
+	
+	/**
+	 * @brief Gets a const pointer to the left child of the node.
+	 * @return A const pointer to the left child of the node.
+	 */
+	const RedBlackTreeNode<ElementType>* getLeftChild() const noexcept;
+	
+	/**
+	 * @brief Sets the left child of the node and links the child back to this node.
+	 * @param leftChild A pointer to the left child of the node.
+	 */
+	void setLeftChild(RedBlackTreeNode<ElementType>* leftChild) noexcept;
+	
+	/**
+	 * @brief Gets a pointer to the right child of the node.
+	 * @return A pointer to the right child of the node.
+	 */
+	RedBlackTreeNode<ElementType>* getRightChild() noexcept;
+	
+	/**
+	 * @brief Gets a const pointer to the right child of the node.
+	 * @return A const pointer to the right child of the node.
+	 */
+	const RedBlackTreeNode<ElementType>* getRightChild() const noexcept;
+	
+	/**
+	 * @brief Sets the right child of the node and links the child back to this node.
+	 * @param rightChild A pointer to the right child of the node.
+	 */
+	void setRightChild(RedBlackTreeNode<ElementType>* rightChild) noexcept;
+	
+	/**
+	 * @brief Gets a pointer to the parent of the node.
+	 * @return A pointer to the parent of the node, or nullptr if the node is a root.
+	 */
+	RedBlackTreeNode<ElementType>* getParent() noexcept;
+	
+	/**
+	 * @brief Gets a const pointer to the parent of the node.
+	 * @return A const pointer to the parent of the node, or nullptr if the node is a root.
+	 */
+	const RedBlackTreeNode<ElementType>* getParent() const noexcept;
+	
+	/**
+	 * @brief Sets the parent of the node without changing the children of the parent or the color of the node.
+	 * @param parent A pointer to the parent of the node.
+	 */
+	void setParent(RedBlackTreeNode<ElementType>* parent) noexcept;
+	
+	/**
+	 * @brief Checks if the node is red.
+	 * @return True if the node is red, false if it is black.
+	 */
+	bool isRed() const noexcept;
+	
+	/**
+	 * @brief Sets the color of the node without changing its parent.
+	 * @param isRed True to color the node red, false to color it black.
+	 */
+	void setRed(const bool isRed) noexcept;
+
+private:
+	/**
+	 * @brief Checks if the given children are equal.
+	 * @details Two children are considered equal if they are both nullptr or if they are both not nullptr and their
+	 * elements and children are equal.
+	 * @param leftChild The left child of the node.
+	 * @param rightChild The right child of the node.
+	 * @return True if the children are equal, false otherwise.
+	 */
+	static bool areChildrenEqual(const RedBlackTreeNode<ElementType>* leftChild,
+	                             const RedBlackTreeNode<ElementType>* rightChild) noexcept;
+
+private:
+	static constexpr std::uintptr_t RED_BIT {1};
+	
+	ElementType element;
+	RedBlackTreeNode<ElementType>* leftChild {nullptr};
+	RedBlackTreeNode<ElementType>* rightChild {nullptr};
+	std::uintptr_t parentAndColor {RED_BIT};
+};
+
+template<typename ElementType>
+RedBlackTreeNode<ElementType>::RedBlackTreeNode(const ElementType& element) noexcept : element {element} {
+	
+}
+
+template<typename ElementType>
+RedBlackTreeNode<ElementType>::RedBlackTreeNode(ElementType&& element) noexcept : element {std::move(element)} {
+	
+}
+
+template<typename ElementType>
+bool RedBlackTreeNode<ElementType>::operator==(const RedBlackTreeNode<ElementType>& other) const noexcept {
+	if (element != other.element) {
+		return false;
+	}
+	
+	return RedBlackTreeNode<ElementType>::areChildrenEqual(leftChild, other.leftChild) &&
+	       RedBlackTreeNode<ElementType>::areChildrenEqual(rightChild, other.rightChild);
+}
+
+template<typename ElementType>
+ElementType& RedBlackTreeNode<ElementType>::getElement() noexcept {
+	return element;
+}
+
+template<typename ElementType>
+const ElementType& RedBlackTreeNode<ElementType>::getElement() const noexcept {
+	return element;
+}
+
+template<typename ElementType>
+RedBlackTreeNode<ElementType>* RedBlackTreeNode<ElementType>::getLeftChild() noexcept {
+	return leftChild;
+}
+
+template<typename ElementType>
+const RedBlackTreeNode<ElementType>* RedBlackTreeNode<ElementType>::getLeftChild() const noexcept {
+	return leftChild;
+}
+
+template<typename ElementType>
+void RedBlackTreeNode<ElementType>::setLeftChild(RedBlackTreeNode<ElementType>* leftChild) noexcept {
+	this->leftChild = leftChild;
+	
+	if (leftChild != nullptr) {
+		leftChild->setParent(this);
+	}
+}
+
+template<typename ElementType>
+RedBlackTreeNode<ElementType>* RedBlackTreeNode<ElementType>::getRightChild() noexcept {
+	return rightChild;
+}
+
+template<typename ElementType>
+const RedBlackTreeNode<ElementType>* RedBlackTreeNode<ElementType>::getRightChild() const noexcept {
+	return rightChild;
+}
+
+template<typename ElementType>
+void RedBlackTreeNode<ElementType>::setRightChild(RedBlackTreeNode<ElementType>* rightChild) noexcept {
+	this->rightChild = rightChild;
+	
+	if (rightChild != nullptr) {
+		rightChild->setParent(this);
+	}
+}
+
+template<typename ElementType>
+RedBlackTreeNode<ElementType>* RedBlackTreeNode<ElementType>::getParent() noexcept {
+	return reinterpret_cast<RedBlackTreeNode<ElementType>*>(parentAndColor & ~RED_BIT);
+}
+
+template<typename ElementType>
+const RedBlackTreeNode<ElementType>* RedBlackTreeNode<ElementType>::getParent() const noexcept {
+	return reinterpret_cast<const RedBlackTreeNode<ElementType>*>(parentAndColor & ~RED_BIT);
+}
+
+template<typename ElementType>
+void RedBlackTreeNode<ElementType>::setParent(RedBlackTreeNode<ElementType>* parent) noexcept {
+	parentAndColor = reinterpret_cast<std::uintptr_t>(parent) | (parentAndColor & RED_BIT);
+}
+
+template<typename ElementType>
+bool RedBlackTreeNode<ElementType>::isRed() const noexcept {
+	return (parentAndColor & RED_BIT) != 0;
+}
+
+template<typename ElementType>
+void RedBlackTreeNode<ElementType>::setRed(const bool isRed) noexcept {
+	parentAndColor = (parentAndColor & ~RED_BIT) | (isRed ? RED_BIT : 0);
+}
+
+template<typename ElementType>
+bool RedBlackTreeNode<ElementType>::areChildrenEqual(const RedBlackTreeNode<ElementType>* leftChild,
+                                                     const RedBlackTreeNode<ElementType>* rightChild) noexcept {
+	if (leftChild == nullptr && rightChild == nullptr) {
+		return true;
+	}
+	
+	if (leftChild == nullptr || rightChild == nullptr) {
+		return false;
+	}
+	
+	if (leftChild->element != rightChild->element) {
+		return false;
+	}
+	
+	return areChildrenEqual(leftChild->leftChild, rightChild->leftChild) &&
+	       areChildrenEqual(leftChild->rightChild, rightChild->rightChild);
+}
+}
\ No newline at end of file
@@ -0,0 +1,143 @@
+#include <gmock/gmock.h>
+
+#include <array>
+#include <filesystem>
+#include <fstream>
+#include <list>
+#include <memory_resource>
+#include <numeric>
+#include <span>
+#include <string>
+#include <system_error>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+#include "Algorithms/ContiguousRangeConcept.hpp"
+#include "Algorithms/Searching/BinarySearcher.hpp"
+#include "Algorithms/Searching/BinarySearchPredicate.hpp"
+#include "Algorithms/Searching/LinearSearcher.hpp"
+#include "Algorithms/Sorting/MergeSorter.hpp"
+#include "Algorithms/Sorting/QuickSorter.hpp"
+#include "Algorithms/Sorting/TimSorter.hpp"
+
+namespace Core::Algorithms::Test {
+static_assert(ContiguousRangeConcept<std::array<int, 10>>);
+static_assert(ContiguousRangeConcept<std::vector<int>>);
+static_assert(ContiguousRangeConcept<std::pmr::vector<int>>);
+static_assert(ContiguousRangeConcept<std::span<int>>);
+static_assert(ContiguousRangeConcept<std::span<int, 4>>);
+static_assert(!ContiguousRangeConcept<std::list<int>>);
+
+TEST(ContiguousRangeConceptTest, GivenSpanOverSubRangeOfVector_WhenSort_ThenOnlySubRangeIsSorted) {
+	std::vector<int> data {9, 8, 7, 6, 5, 4, 3, 2, 1, 0};
+	std::span<int> subRange {data.begin() + 2, 5};
+	auto quickSorter {Sorting::QuickSorter<std::span<int>>(subRange)};
+	quickSorter.sort(std::less<int> {});
+	
+	EXPECT_THAT(data, testing::ElementsAre(9, 8, 3, 4, 5, 6, 7, 2, 1, 0));
+}
+
+TEST(ContiguousRangeConceptTest, GivenFixedExtentSpanOverArray_WhenSort_ThenArrayIsSortedInPlace) {
+	std::array<int, 6> data {4, 2, 6, 1, 5, 3};
+	std::span<int, 6> span {data};
+	auto timSorter {Sorting::TimSorter<std::span<int, 6>>(span)};
+	timSorter.sort(std::greater<int> {});
+	
+	EXPECT_THAT(data, testing::ElementsAre(6, 5, 4, 3, 2, 1));
+}
+
+TEST(ContiguousRangeConceptTest, GivenPolymorphicAllocatorVector_WhenSort_ThenVectorIsSorted) {
+	std::array<std::byte, 1024> buffer {};
+	std::pmr::monotonic_buffer_resource resource {buffer.data(), buffer.size()};
+	std::pmr::vector<int> data {{5, 3, 1, 4, 2}, &resource};
+	auto mergeSorter {Sorting::MergeSorter<std::pmr::vector<int>>(data)};
+	mergeSorter.sort(std::less<int> {});
+	
+	EXPECT_THAT(data, testing::ElementsAre(1, 2, 3, 4, 5));
+}
+
+TEST(ContiguousRangeConceptTest, GivenSpanOverSortedSubRange_WhenSearch_ThenOnlySubRangeIsSearched) {
+	std::vector<int> data {1, 6, 23, 29, 34, 45, 73, 88, 99, 100};
+	std::span<int> subRange {data.begin() + 3, 4};
+	const auto binarySearcher {Searching::BinarySearcher<std::span<int>>(subRange)};
+	const auto linearSearcher {Searching::LinearSearcher<std::span<int>>(subRange)};
+	
+	EXPECT_THAT(binarySearcher.search(Searching::BinarySearchPredicate<int> {45}), testing::IsTrue());
+	EXPECT_THAT(binarySearcher.search(Searching::BinarySearchPredicate<int> {88}), testing::IsFalse());
+	EXPECT_THAT(linearSearcher.search([](const int element) {
+		return element == 73;
+	}), testing::IsTrue());
+	EXPECT_THAT(linearSearcher.search([](const int element) {
+		return element == 1;
+	}), testing::IsFalse());
+}
+
+#if defined(__unix__) || defined(__APPLE__)
+class TemporaryFile final {
+public:
+	TemporaryFile() : path {std::filesystem::temp_directory_path() /
+	                        ("ContiguousRangeConceptTest-" + std::to_string(getpid()) + ".bin")} {
+		
+	}
+	
+	TemporaryFile(const TemporaryFile& other) = delete;
+	
+	~TemporaryFile() noexcept {
+		std::error_code errorCode {};
+		std::filesystem::remove(path, errorCode);
+	}
+	
+	TemporaryFile& operator=(const TemporaryFile& other) = delete;
+	
+	const std::filesystem::path& getPath() const noexcept {
+		return path;
+	}
+
+private:
+	std::filesystem::path path;
+};
+
+TEST(ContiguousRangeConceptTest, GivenSpanOverMemoryMappedFileRegion_WhenSort_ThenRegionIsSortedInFile) {
+	const TemporaryFile temporaryFile {};
+	const auto& path {temporaryFile.getPath()};
+	std::vector<int> integers(4096);
+	std::iota(integers.rbegin(), integers.rend(), 0);
+	
+	{
+		std::ofstream stream {path, std::ios::binary | std::ios::trunc};
+		stream.write(reinterpret_cast<const char*>(integers.data()),
+		             static_cast<std::streamsize>(integers.size() * sizeof(int)));
+	}
+	
+	const auto fileDescriptor {open(path.c_str(), O_RDWR)};
+	ASSERT_THAT(fileDescriptor, testing::Ge(0));
+	
+	const auto mappedSize {integers.size() * sizeof(int)};
+	auto* const mapping {mmap(nullptr, mappedSize, PROT_READ | PROT_WRITE, MAP_SHARED, fileDescriptor, 0)};
+	ASSERT_THAT(mapping, testing::Ne(MAP_FAILED));
+	
+	std::span<int> region {static_cast<int*>(mapping) + 1024, 2048};
+	auto timSorter {Sorting::TimSorter<std::span<int>>(region)};
+	timSorter.sort(std::less<int> {});
+	
+	msync(mapping, mappedSize, MS_SYNC);
+	munmap(mapping, mappedSize);
+	close(fileDescriptor);
+	
+	std::vector<int> fileIntegers(integers.size());
+	{
+		std::ifstream stream {path, std::ios::binary};
+		stream.read(reinterpret_cast<char*>(fileIntegers.data()),
+		            static_cast<std::streamsize>(fileIntegers.size() * sizeof(int)));
+	}
+	
+	std::sort(integers.begin() + 1024, integers.begin() + 3072);
+	EXPECT_THAT(fileIntegers, testing::ContainerEq(integers));
+}
+#endif
+}
\ No newline at end of file
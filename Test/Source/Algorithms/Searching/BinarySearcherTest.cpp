@@ -1,5 +1,9 @@
 #include <gmock/gmock.h>
 
+#include <algorithm>
+#include <random>
+#include <vector>
+
 #include "Algorithms/Searching/BinarySearcher.hpp"
 #include "Algorithms/Searching/BinarySearchPredicate.hpp"
 #include "SortedIntegerData.hpp"
@@ -41,4 +45,130 @@ TEST(BinarySearcherTest, GivenSortedStringArray_WhenSearchForNonExistingElement_
 	
 	EXPECT_THAT(result, testing::IsFalse());
 }
+
+TEST(BinarySearcherTest, GivenSortedIntegerArray_WhenLowerBoundForExistingElement_ThenReturnsIndexOfElement) {
+	std::array<int, 10> sortedData {sortedIntegers};
+	const auto binarySearcher {BinarySearcher<std::array<int, 10>>(sortedData)};
+	
+	EXPECT_THAT(binarySearcher.lowerBound(1), testing::Eq(0));
+	EXPECT_THAT(binarySearcher.lowerBound(73), testing::Eq(6));
+	EXPECT_THAT(binarySearcher.lowerBound(100), testing::Eq(9));
+}
+
+TEST(BinarySearcherTest, GivenSortedIntegerArray_WhenLowerBoundForNonExistingElement_ThenReturnsIndexOfNextElement) {
+	std::array<int, 10> sortedData {sortedIntegers};
+	const auto binarySearcher {BinarySearcher<std::array<int, 10>>(sortedData)};
+	
+	EXPECT_THAT(binarySearcher.lowerBound(0), testing::Eq(0));
+	EXPECT_THAT(binarySearcher.lowerBound(50), testing::Eq(6));
+	EXPECT_THAT(binarySearcher.lowerBound(101), testing::Eq(10));
+}
+
+TEST(BinarySearcherTest, GivenEmptyVector_WhenLowerBound_ThenReturnsZero) {
+	std::vector<int> sortedData {};
+	const auto binarySearcher {BinarySearcher<std::vector<int>>(sortedData)};
+	
+	EXPECT_THAT(binarySearcher.lowerBound(10), testing::Eq(0));
+}
+
+TEST(BinarySearcherTest, GivenDuplicateElements_WhenLowerBound_ThenReturnsIndexOfFirstDuplicate) {
+	std::vector<int> sortedData {1, 2, 2, 2, 2, 3, 3, 4};
+	const auto binarySearcher {BinarySearcher<std::vector<int>>(sortedData)};
+	
+	EXPECT_THAT(binarySearcher.lowerBound(2), testing::Eq(1));
+	EXPECT_THAT(binarySearcher.lowerBound(3), testing::Eq(5));
+}
+
+TEST(BinarySearcherTest, GivenDescendingStringVector_WhenLowerBoundWithGreater_ThenReturnsIndexOfElement) {
+	std::vector<std::string> sortedData {sortedStrings.rbegin(), sortedStrings.rend()};
+	const auto binarySearcher {BinarySearcher<std::vector<std::string>>(sortedData)};
+	
+	EXPECT_THAT(binarySearcher.lowerBound("Strawberry", std::greater<> {}), testing::Eq(0));
+	EXPECT_THAT(binarySearcher.lowerBound("Pineapple", std::greater<> {}), testing::Eq(1));
+}
+
+TEST(BinarySearcherTest, GivenIndexRange_WhenLowerBound_ThenOnlyRangeIsSearched) {
+	std::array<int, 10> sortedData {sortedIntegers};
+	const auto binarySearcher {BinarySearcher<std::array<int, 10>>(sortedData)};
+	
+	EXPECT_THAT(binarySearcher.lowerBound(1, 3, 7), testing::Eq(3));
+	EXPECT_THAT(binarySearcher.lowerBound(40, 3, 7), testing::Eq(5));
+	EXPECT_THAT(binarySearcher.lowerBound(99, 3, 7), testing::Eq(7));
+	EXPECT_THAT(binarySearcher.lowerBound(99, 3, 100), testing::Eq(8));
+	EXPECT_THAT(binarySearcher.lowerBound(99, 5, 5), testing::Eq(5));
+}
+
+TEST(BinarySearcherTest, GivenRandomSortedVectorsOfEverySize_WhenLowerBound_ThenMatchesStandardLowerBound) {
+	std::mt19937 generator {42};
+	std::uniform_int_distribution<int> distribution {0, 200};
+	
+	for (std::size_t size {0}; size <= 130; ++size) {
+		std::vector<int> sortedData(size);
+		std::ranges::generate(sortedData, [&generator, &distribution]() {
+			return distribution(generator);
+		});
+		std::ranges::sort(sortedData);
+		const auto binarySearcher {BinarySearcher<std::vector<int>>(sortedData)};
+		
+		for (auto target {-1}; target <= 201; ++target) {
+			const auto expectedIndex {std::ranges::lower_bound(sortedData, target) - sortedData.begin()};
+			ASSERT_THAT(binarySearcher.lowerBound(target), testing::Eq(static_cast<std::size_t>(expectedIndex)));
+		}
+	}
+}
+
+TEST(BinarySearcherTest, GivenSortedIntegerArray_WhenBatchLowerBound_ThenReturnsIndicesInOrderOfTargets) {
+	std::array<int, 10> sortedData {sortedIntegers};
+	const auto binarySearcher {BinarySearcher<std::array<int, 10>>(sortedData)};
+	const std::vector<int> targets {73, 0, 101, 50, 1, 100};
+	
+	EXPECT_THAT(binarySearcher.batchLowerBound(targets), testing::ElementsAre(6, 0, 10, 6, 0, 9));
+	EXPECT_THAT(binarySearcher.batchLowerBound<4>(targets), testing::ElementsAre(6, 0, 10, 6, 0, 9));
+	EXPECT_THAT(binarySearcher.sortedBatchLowerBound(targets), testing::ElementsAre(6, 0, 10, 6, 0, 9));
+}
+
+TEST(BinarySearcherTest, GivenEmptyVector_WhenBatchLowerBound_ThenReturnsZeroForEveryTarget) {
+	std::vector<int> sortedData {};
+	const auto binarySearcher {BinarySearcher<std::vector<int>>(sortedData)};
+	const std::vector<int> targets {3, 1, 2};
+	
+	EXPECT_THAT(binarySearcher.batchLowerBound(targets), testing::ElementsAre(0, 0, 0));
+	EXPECT_THAT(binarySearcher.sortedBatchLowerBound(targets), testing::ElementsAre(0, 0, 0));
+	EXPECT_THAT(binarySearcher.batchLowerBound(std::span<const int> {}), testing::IsEmpty());
+}
+
+TEST(BinarySearcherTest, GivenRandomTargets_WhenBatchLowerBound_ThenMatchesStandardLowerBound) {
+	std::mt19937 generator {42};
+	std::uniform_int_distribution<int> distribution {0, 2000};
+	
+	for (const std::size_t size : {1, 2, 7, 64, 1000}) {
+		std::vector<int> sortedData(size);
+		std::ranges::generate(sortedData, [&generator, &distribution]() {
+			return distribution(generator);
+		});
+		std::ranges::sort(sortedData);
+		const auto binarySearcher {BinarySearcher<std::vector<int>>(sortedData)};
+		
+		std::vector<int> targets(1000);
+		std::ranges::generate(targets, [&generator]() {
+			return std::uniform_int_distribution<int> {-1, 2001}(generator);
+		});
+		
+		std::vector<std::size_t> expectedIndices {};
+		for (const auto target : targets) {
+			expectedIndices.push_back(static_cast<std::size_t>(std::ranges::lower_bound(sortedData, target) - sortedData.begin()));
+		}
+		
+		EXPECT_THAT(binarySearcher.batchLowerBound<7>(targets), testing::ContainerEq(expectedIndices));
+		EXPECT_THAT(binarySearcher.sortedBatchLowerBound(targets), testing::ContainerEq(expectedIndices));
+	}
+}
+
+TEST(BinarySearcherTest, GivenDescendingStringVector_WhenSortedBatchLowerBoundWithGreater_ThenReturnsIndicesOfElements) {
+	std::vector<std::string> sortedData {sortedStrings.rbegin(), sortedStrings.rend()};
+	const auto binarySearcher {BinarySearcher<std::vector<std::string>>(sortedData)};
+	const std::vector<std::string> targets {"Pineapple", "Strawberry", "!", " "};
+	
+	EXPECT_THAT(binarySearcher.sortedBatchLowerBound(targets, std::greater<> {}), testing::ElementsAre(1, 0, 9, 10));
+}
 }
\ No newline at end of file
@@ -0,0 +1,92 @@
+#include <gmock/gmock.h>
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include "Algorithms/Searching/BinarySearchPredicate.hpp"
+#include "Algorithms/Searching/ExponentialSearcher.hpp"
+#include "SortedIntegerData.hpp"
+#include "SortedStringData.hpp"
+
+namespace Core::Algorithms::Searching::Test {
+TEST(ExponentialSearcherTest, GivenSortedIntegerArray_WhenSearchForExistingElements_ThenReturnsTrue) {
+	std::array<int, 10> sortedData {sortedIntegers};
+	const auto exponentialSearcher {ExponentialSearcher<std::array<int, 10>>(sortedData)};
+	
+	for (const auto element : sortedData) {
+		EXPECT_THAT(exponentialSearcher.search(BinarySearchPredicate<int> {element}), testing::IsTrue());
+	}
+}
+
+TEST(ExponentialSearcherTest, GivenSortedIntegerArray_WhenSearchForNonExistingElement_ThenReturnsFalse) {
+	std::array<int, 10> sortedData {sortedIntegers};
+	const auto exponentialSearcher {ExponentialSearcher<std::array<int, 10>>(sortedData)};
+	
+	EXPECT_THAT(exponentialSearcher.search(BinarySearchPredicate<int> {0}), testing::IsFalse());
+	EXPECT_THAT(exponentialSearcher.search(BinarySearchPredicate<int> {50}), testing::IsFalse());
+	EXPECT_THAT(exponentialSearcher.search(BinarySearchPredicate<int> {101}), testing::IsFalse());
+}
+
+TEST(ExponentialSearcherTest, GivenSortedStringArray_WhenSearchForExistingElement_ThenReturnsTrue) {
+	std::array<std::string, 10> sortedData {sortedStrings};
+	const auto exponentialSearcher {ExponentialSearcher<std::array<std::string, 10>>(sortedData)};
+	
+	EXPECT_THAT(exponentialSearcher.search(BinarySearchPredicate<std::string> {"Peach"}), testing::IsTrue());
+	EXPECT_THAT(exponentialSearcher.lowerBound("Pineapple"), testing::Eq(9));
+}
+
+TEST(ExponentialSearcherTest, GivenSortedIntegerArray_WhenLowerBound_ThenReturnsIndexOfFirstElementNotBeforeTarget) {
+	std::array<int, 10> sortedData {sortedIntegers};
+	const auto exponentialSearcher {ExponentialSearcher<std::array<int, 10>>(sortedData)};
+	
+	EXPECT_THAT(exponentialSearcher.lowerBound(0), testing::Eq(0));
+	EXPECT_THAT(exponentialSearcher.lowerBound(73), testing::Eq(6));
+	EXPECT_THAT(exponentialSearcher.lowerBound(74), testing::Eq(7));
+	EXPECT_THAT(exponentialSearcher.lowerBound(101), testing::Eq(10));
+}
+
+TEST(ExponentialSearcherTest, GivenHintOnEitherSideOfTarget_WhenHintedLowerBound_ThenReturnsIndexOfFirstElementNotBeforeTarget) {
+	std::array<int, 10> sortedData {sortedIntegers};
+	const auto exponentialSearcher {ExponentialSearcher<std::array<int, 10>>(sortedData)};
+	
+	EXPECT_THAT(exponentialSearcher.hintedLowerBound(45, 0), testing::Eq(5));
+	EXPECT_THAT(exponentialSearcher.hintedLowerBound(45, 9), testing::Eq(5));
+	EXPECT_THAT(exponentialSearcher.hintedLowerBound(45, 5), testing::Eq(5));
+	EXPECT_THAT(exponentialSearcher.hintedLowerBound(0, 100), testing::Eq(0));
+	EXPECT_THAT(exponentialSearcher.hintedLowerBound(101, 3), testing::Eq(10));
+}
+
+TEST(ExponentialSearcherTest, GivenDescendingVector_WhenHintedLowerBoundWithGreater_ThenReturnsIndexOfElement) {
+	std::vector<int> sortedData {9, 7, 5, 3, 1};
+	const auto exponentialSearcher {ExponentialSearcher<std::vector<int>>(sortedData)};
+	
+	EXPECT_THAT(exponentialSearcher.hintedLowerBound(6, 4, std::greater<> {}), testing::Eq(2));
+	EXPECT_THAT(exponentialSearcher.lowerBound(0, std::greater<> {}), testing::Eq(5));
+}
+
+TEST(ExponentialSearcherTest, GivenRandomSortedVectorsOfEverySize_WhenHintedLowerBound_ThenMatchesStandardLowerBound) {
+	std::mt19937 generator {42};
+	std::uniform_int_distribution<int> distribution {0, 100};
+	
+	for (std::size_t size {0}; size <= 70; ++size) {
+		std::vector<int> sortedData(size);
+		std::ranges::generate(sortedData, [&generator, &distribution]() {
+			return distribution(generator);
+		});
+		std::ranges::sort(sortedData);
+		const auto exponentialSearcher {ExponentialSearcher<std::vector<int>>(sortedData)};
+		
+		for (auto target {-1}; target <= 101; ++target) {
+			const auto expectedIndex {static_cast<std::size_t>(std::ranges::lower_bound(sortedData, target) - sortedData.begin())};
+			ASSERT_THAT(exponentialSearcher.lowerBound(target), testing::Eq(expectedIndex));
+			ASSERT_THAT(exponentialSearcher.search(BinarySearchPredicate<int> {target}),
+			            testing::Eq(std::ranges::binary_search(sortedData, target)));
+			
+			for (std::size_t hint {0}; hint <= size + 1; ++hint) {
+				ASSERT_THAT(exponentialSearcher.hintedLowerBound(target, hint), testing::Eq(expectedIndex));
+			}
+		}
+	}
+}
+}
\ No newline at end of file
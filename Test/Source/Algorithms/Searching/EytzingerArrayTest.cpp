@@ -0,0 +1,94 @@
+#include <gmock/gmock.h>
+
+#include <algorithm>
+#include <functional>
+#include <numeric>
+#include <vector>
+
+#include "Algorithms/Searching/BinarySearchPredicate.hpp"
+#include "Algorithms/Searching/EytzingerArray.hpp"
+#include "SortedIntegerData.hpp"
+#include "SortedStringData.hpp"
+
+namespace Core::Algorithms::Searching::Test {
+TEST(EytzingerArrayTest, GivenEmptyVector_WhenLowerBound_ThenReturnsNullopt) {
+	const std::vector<int> sortedData {};
+	const EytzingerArray<int> eytzingerArray {sortedData};
+	
+	EXPECT_THAT(eytzingerArray.isEmpty(), testing::IsTrue());
+	EXPECT_THAT(eytzingerArray.lowerBound(1), testing::Eq(std::nullopt));
+	EXPECT_THAT(eytzingerArray.search(BinarySearchPredicate<int> {1}), testing::IsFalse());
+}
+
+TEST(EytzingerArrayTest, GivenSortedIntegerArray_WhenSearchForExistingElement_ThenReturnsTrue) {
+	const std::array<int, 10> sortedData {sortedIntegers};
+	const EytzingerArray<int> eytzingerArray {sortedData};
+	
+	for (const auto element : sortedData) {
+		EXPECT_THAT(eytzingerArray.search(BinarySearchPredicate<int> {element}), testing::IsTrue());
+	}
+}
+
+TEST(EytzingerArrayTest, GivenSortedIntegerArray_WhenSearchForNonExistingElement_ThenReturnsFalse) {
+	const std::array<int, 10> sortedData {sortedIntegers};
+	const EytzingerArray<int> eytzingerArray {sortedData};
+	
+	EXPECT_THAT(eytzingerArray.search(BinarySearchPredicate<int> {0}), testing::IsFalse());
+	EXPECT_THAT(eytzingerArray.search(BinarySearchPredicate<int> {50}), testing::IsFalse());
+	EXPECT_THAT(eytzingerArray.search(BinarySearchPredicate<int> {101}), testing::IsFalse());
+}
+
+TEST(EytzingerArrayTest, GivenSortedIntegerArray_WhenLowerBound_ThenReturnsFirstElementNotBeforeTarget) {
+	const std::array<int, 10> sortedData {sortedIntegers};
+	const EytzingerArray<int> eytzingerArray {sortedData};
+	
+	EXPECT_THAT(eytzingerArray.getSize(), testing::Eq(10));
+	EXPECT_THAT(eytzingerArray.lowerBound(0), testing::Optional(1));
+	EXPECT_THAT(eytzingerArray.lowerBound(73), testing::Optional(73));
+	EXPECT_THAT(eytzingerArray.lowerBound(74), testing::Optional(88));
+	EXPECT_THAT(eytzingerArray.lowerBound(100), testing::Optional(100));
+	EXPECT_THAT(eytzingerArray.lowerBound(101), testing::Eq(std::nullopt));
+}
+
+TEST(EytzingerArrayTest, GivenSortedStringArray_WhenLowerBound_ThenReturnsFirstElementNotBeforeTarget) {
+	const std::array<std::string, 10> sortedData {sortedStrings};
+	const EytzingerArray<std::string> eytzingerArray {sortedData};
+	
+	EXPECT_THAT(eytzingerArray.lowerBound("Peach"), testing::Optional(std::string {"Peach"}));
+	EXPECT_THAT(eytzingerArray.lowerBound("Pineapple"), testing::Optional(std::string {"Strawberry"}));
+	EXPECT_THAT(eytzingerArray.lowerBound("Zucchini"), testing::Eq(std::nullopt));
+	EXPECT_THAT(eytzingerArray.search(BinarySearchPredicate<std::string> {"Melon"}), testing::IsTrue());
+}
+
+TEST(EytzingerArrayTest, GivenDescendingVector_WhenLowerBoundWithGreater_ThenReturnsFirstElementNotAfterTarget) {
+	const std::vector<int> sortedData {9, 7, 5, 3, 1};
+	const EytzingerArray<int, std::greater<int>> eytzingerArray {sortedData};
+	
+	EXPECT_THAT(eytzingerArray.lowerBound(10), testing::Optional(9));
+	EXPECT_THAT(eytzingerArray.lowerBound(6), testing::Optional(5));
+	EXPECT_THAT(eytzingerArray.lowerBound(1), testing::Optional(1));
+	EXPECT_THAT(eytzingerArray.lowerBound(0), testing::Eq(std::nullopt));
+}
+
+TEST(EytzingerArrayTest, GivenVectorsOfEverySize_WhenLowerBound_ThenMatchesStandardLowerBound) {
+	for (std::size_t size {1}; size <= 130; ++size) {
+		std::vector<int> sortedData(size);
+		std::iota(sortedData.begin(), sortedData.end(), 0);
+		std::ranges::transform(sortedData, sortedData.begin(), [](const auto element) {
+			return 2 * (element / 3);
+		});
+		
+		const EytzingerArray<int> eytzingerArray {sortedData};
+		for (auto target {-1}; target <= sortedData.back() + 1; ++target) {
+			const auto expected {std::ranges::lower_bound(sortedData, target)};
+			const auto result {eytzingerArray.lowerBound(target)};
+			
+			if (expected == sortedData.end()) {
+				EXPECT_THAT(result, testing::Eq(std::nullopt));
+			} else {
+				EXPECT_THAT(result, testing::Optional(*expected));
+			}
+		}
+	}
+}
+}
\ No newline at end of file
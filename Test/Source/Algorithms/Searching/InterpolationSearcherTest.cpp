@@ -0,0 +1,77 @@
+#include <gmock/gmock.h>
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include "Algorithms/Searching/BinarySearchPredicate.hpp"
+#include "Algorithms/Searching/InterpolationSearcher.hpp"
+#include "SortedIntegerData.hpp"
+
+namespace Core::Algorithms::Searching::Test {
+TEST(InterpolationSearcherTest, GivenSortedIntegerArray_WhenSearchForExistingElement_ThenReturnsTrue) {
+	std::array<int, 10> sortedData {sortedIntegers};
+	BinarySearchPredicate<int> predicate {73};
+	const auto interpolationSearcher {InterpolationSearcher<std::array<int, 10>>(sortedData)};
+	
+	EXPECT_THAT(interpolationSearcher.search(predicate), testing::IsTrue());
+}
+
+TEST(InterpolationSearcherTest, GivenSortedIntegerArray_WhenSearchForNonExistingElement_ThenReturnsFalse) {
+	std::array<int, 10> sortedData {sortedIntegers};
+	BinarySearchPredicate<int> predicate {101};
+	const auto interpolationSearcher {InterpolationSearcher<std::array<int, 10>>(sortedData)};
+	
+	EXPECT_THAT(interpolationSearcher.search(predicate), testing::IsFalse());
+}
+
+TEST(InterpolationSearcherTest, GivenSortedIntegerArray_WhenLowerBound_ThenReturnsIndexOfFirstElementNotLessThanTarget) {
+	std::array<int, 10> sortedData {sortedIntegers};
+	const auto interpolationSearcher {InterpolationSearcher<std::array<int, 10>>(sortedData)};
+	
+	EXPECT_THAT(interpolationSearcher.lowerBound(0), testing::Eq(0));
+	EXPECT_THAT(interpolationSearcher.lowerBound(73), testing::Eq(6));
+	EXPECT_THAT(interpolationSearcher.lowerBound(74), testing::Eq(7));
+	EXPECT_THAT(interpolationSearcher.lowerBound(101), testing::Eq(10));
+}
+
+TEST(InterpolationSearcherTest, GivenEmptyVector_WhenLowerBound_ThenReturnsZero) {
+	std::vector<int> sortedData {};
+	const auto interpolationSearcher {InterpolationSearcher<std::vector<int>>(sortedData)};
+	
+	EXPECT_THAT(interpolationSearcher.lowerBound(10), testing::Eq(0));
+}
+
+TEST(InterpolationSearcherTest, GivenUniformAndSkewedVectors_WhenLowerBound_ThenMatchesStandardLowerBound) {
+	std::mt19937 generator {42};
+	std::uniform_real_distribution<double> distribution {0.0, 1.0};
+	
+	for (const auto exponent : {1.0, 4.0, 16.0}) {
+		std::vector<long long> sortedData(5000);
+		std::ranges::generate(sortedData, [&generator, &distribution, exponent]() {
+			return static_cast<long long>(std::pow(distribution(generator), exponent) * 1e12);
+		});
+		std::ranges::sort(sortedData);
+		const auto interpolationSearcher {InterpolationSearcher<std::vector<long long>>(sortedData)};
+		
+		for (std::size_t index {0}; index < sortedData.size(); index += 7) {
+			for (const auto target : {sortedData[index] - 1, sortedData[index], sortedData[index] + 1}) {
+				const auto expectedIndex {std::ranges::lower_bound(sortedData, target) - sortedData.begin()};
+				ASSERT_THAT(interpolationSearcher.lowerBound(target), testing::Eq(static_cast<std::size_t>(expectedIndex)));
+			}
+		}
+	}
+}
+
+TEST(InterpolationSearcherTest, GivenFloatingPointVectorWithDuplicates_WhenLowerBound_ThenReturnsIndexOfFirstDuplicate) {
+	std::vector<double> sortedData(100, 0.5);
+	sortedData.front() = 0.0;
+	sortedData.back() = 1.0;
+	const auto interpolationSearcher {InterpolationSearcher<std::vector<double>>(sortedData)};
+	
+	EXPECT_THAT(interpolationSearcher.lowerBound(0.5), testing::Eq(1));
+	EXPECT_THAT(interpolationSearcher.lowerBound(0.75), testing::Eq(99));
+	EXPECT_THAT(interpolationSearcher.lowerBound(-1.0), testing::Eq(0));
+}
+}
\ No newline at end of file
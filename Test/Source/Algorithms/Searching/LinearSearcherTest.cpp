@@ -1,5 +1,9 @@
 #include <gmock/gmock.h>
 
+#include <cstdint>
+#include <limits>
+#include <vector>
+
 #include "Algorithms/Searching/LinearSearcher.hpp"
 #include "SortedIntegerData.hpp"
 #include "SortedStringData.hpp"
@@ -44,4 +48,104 @@ TEST(LinearSearcherTest, GivenSortedStringArray_WhenSearchForNonExistingElement_
 	
 	EXPECT_THAT(result, testing::IsFalse());
 }
+
+TEST(LinearSearcherTest, GivenSortedIntegerArray_WhenFind_ThenReturnsIndexOfFirstMatch) {
+	std::array<int, 10> sortedData {sortedIntegers};
+	const auto linearSearcher {LinearSearcher<std::array<int, 10>>(sortedData)};
+	
+	EXPECT_THAT(linearSearcher.find(73), testing::Optional(6));
+	EXPECT_THAT(linearSearcher.find(101), testing::Eq(std::nullopt));
+}
+
+TEST(LinearSearcherTest, GivenSortedStringArray_WhenFind_ThenReturnsIndexOfFirstMatch) {
+	std::array<std::string, 10> sortedData {sortedStrings};
+	const auto linearSearcher {LinearSearcher<std::array<std::string, 10>>(sortedData)};
+	
+	EXPECT_THAT(linearSearcher.find("Peach"), testing::Optional(7));
+	EXPECT_THAT(linearSearcher.count("Peach"), testing::Eq(1));
+	EXPECT_THAT(linearSearcher.findAll("Pineapple"), testing::IsEmpty());
+}
+
+TEST(LinearSearcherTest, GivenVectorWithRepeatedElements_WhenCountAndFindAll_ThenReturnsEveryMatch) {
+	std::vector<std::int16_t> data(100, 0);
+	data[3] = 7;
+	data[17] = 7;
+	data[18] = 7;
+	data[99] = 7;
+	const auto linearSearcher {LinearSearcher<std::vector<std::int16_t>>(data)};
+	
+	EXPECT_THAT(linearSearcher.find(7), testing::Optional(3));
+	EXPECT_THAT(linearSearcher.count(7), testing::Eq(4));
+	EXPECT_THAT(linearSearcher.findAll(7), testing::ElementsAre(3, 17, 18, 99));
+	EXPECT_THAT(linearSearcher.count(0), testing::Eq(96));
+}
+
+TEST(LinearSearcherTest, GivenFloatingPointVector_WhenFind_ThenComparesByValue) {
+	std::vector<double> data(40, 1.5);
+	data[33] = -0.0;
+	const auto linearSearcher {LinearSearcher<std::vector<double>>(data)};
+	
+	EXPECT_THAT(linearSearcher.find(0.0), testing::Optional(33));
+	EXPECT_THAT(linearSearcher.count(1.5), testing::Eq(39));
+	EXPECT_THAT(linearSearcher.find(std::numeric_limits<double>::quiet_NaN()), testing::Eq(std::nullopt));
+}
+
+TEST(LinearSearcherTest, GivenLargeVector_WhenParallelScan_ThenMatchesSequentialScan) {
+	std::vector<std::int32_t> data(1 << 20);
+	for (std::size_t index {0}; index < data.size(); ++index) {
+		data[index] = static_cast<std::int32_t>(index % 1000);
+	}
+	
+	const auto linearSearcher {LinearSearcher<std::vector<std::int32_t>>(data)};
+	
+	EXPECT_THAT(linearSearcher.parallelFind(999, 4), testing::Optional(999));
+	EXPECT_THAT(linearSearcher.parallelFind(1000, 4), testing::Eq(std::nullopt));
+	EXPECT_THAT(linearSearcher.parallelCount(7, 4), testing::Eq(linearSearcher.count(7)));
+	EXPECT_THAT(linearSearcher.parallelFindAll(7, 4), testing::ContainerEq(linearSearcher.findAll(7)));
+	EXPECT_THAT(linearSearcher.parallelCount(7, 0), testing::Eq(linearSearcher.count(7)));
+}
+
+TEST(LinearSearcherTest, GivenScalarAndVectorizedLinearSearchers_WhenScan_ThenBothReturnSameMatches) {
+	std::vector<std::int8_t> bytes(1000);
+	std::vector<double> doubles(1000);
+	for (std::size_t index {0}; index < bytes.size(); ++index) {
+		bytes[index] = static_cast<std::int8_t>(index % 37);
+		doubles[index] = static_cast<double>(index % 37) / 2;
+	}
+	
+	const auto byteSearcher {LinearSearcher<std::vector<std::int8_t>>(bytes)};
+	const auto scalarByteSearcher {LinearSearcher<std::vector<std::int8_t>, false>(bytes)};
+	const auto doubleSearcher {LinearSearcher<std::vector<double>>(doubles)};
+	const auto scalarDoubleSearcher {LinearSearcher<std::vector<double>, false>(doubles)};
+	
+	for (std::int8_t target {-1}; target <= 37; ++target) {
+		const auto doubleTarget {static_cast<double>(target) / 2};
+		
+		EXPECT_THAT(scalarByteSearcher.find(target), testing::Eq(byteSearcher.find(target)));
+		EXPECT_THAT(scalarByteSearcher.count(target), testing::Eq(byteSearcher.count(target)));
+		EXPECT_THAT(scalarByteSearcher.findAll(target), testing::ContainerEq(byteSearcher.findAll(target)));
+		EXPECT_THAT(scalarDoubleSearcher.find(doubleTarget), testing::Eq(doubleSearcher.find(doubleTarget)));
+		EXPECT_THAT(scalarDoubleSearcher.count(doubleTarget), testing::Eq(doubleSearcher.count(doubleTarget)));
+		EXPECT_THAT(scalarDoubleSearcher.findAll(doubleTarget),
+		            testing::ContainerEq(doubleSearcher.findAll(doubleTarget)));
+	}
+	
+	EXPECT_THAT(scalarByteSearcher.count(36), testing::Eq(27));
+	EXPECT_THAT(scalarDoubleSearcher.find(18.0), testing::Optional(36));
+}
+
+TEST(LinearSearcherTest, GivenLargeVector_WhenScalarParallelScan_ThenMatchesSequentialScan) {
+	std::vector<std::int32_t> data(1 << 20);
+	for (std::size_t index {0}; index < data.size(); ++index) {
+		data[index] = static_cast<std::int32_t>(index % 1000);
+	}
+	
+	const auto linearSearcher {LinearSearcher<std::vector<std::int32_t>>(data)};
+	const auto scalarLinearSearcher {LinearSearcher<std::vector<std::int32_t>, false>(data)};
+	
+	EXPECT_THAT(scalarLinearSearcher.parallelFind(999, 4), testing::Optional(999));
+	EXPECT_THAT(scalarLinearSearcher.parallelFind(1000, 4), testing::Eq(std::nullopt));
+	EXPECT_THAT(scalarLinearSearcher.parallelCount(7, 4), testing::Eq(linearSearcher.count(7)));
+	EXPECT_THAT(scalarLinearSearcher.parallelFindAll(7, 4), testing::ContainerEq(linearSearcher.findAll(7)));
+}
 }
\ No newline at end of file
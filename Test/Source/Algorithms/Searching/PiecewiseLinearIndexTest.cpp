@@ -0,0 +1,100 @@
+#include <gmock/gmock.h>
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+#include "Algorithms/Searching/PiecewiseLinearIndex.hpp"
+#include "SortedIntegerData.hpp"
+
+namespace Core::Algorithms::Searching::Test {
+TEST(PiecewiseLinearIndexTest, GivenZeroEpsilon_WhenConstructed_ThenThrowsInvalidArgument) {
+	std::vector<int> sortedData {1, 2, 3};
+	
+	EXPECT_THROW(PiecewiseLinearIndex<std::vector<int>>(sortedData, 0), std::invalid_argument);
+}
+
+TEST(PiecewiseLinearIndexTest, GivenEmptyVector_WhenLowerBound_ThenReturnsZero) {
+	std::vector<int> sortedData {};
+	const PiecewiseLinearIndex<std::vector<int>> piecewiseLinearIndex {sortedData};
+	
+	EXPECT_THAT(piecewiseLinearIndex.getSegmentCount(), testing::Eq(0));
+	EXPECT_THAT(piecewiseLinearIndex.lowerBound(10), testing::Eq(0));
+}
+
+TEST(PiecewiseLinearIndexTest, GivenSortedIntegerArray_WhenLowerBound_ThenReturnsIndexOfFirstKeyNotLessThanTarget) {
+	std::array<int, 10> sortedData {sortedIntegers};
+	const PiecewiseLinearIndex<std::array<int, 10>> piecewiseLinearIndex {sortedData, 1};
+	
+	EXPECT_THAT(piecewiseLinearIndex.getEpsilon(), testing::Eq(1));
+	EXPECT_THAT(piecewiseLinearIndex.lowerBound(0), testing::Eq(0));
+	EXPECT_THAT(piecewiseLinearIndex.lowerBound(73), testing::Eq(6));
+	EXPECT_THAT(piecewiseLinearIndex.lowerBound(74), testing::Eq(7));
+	EXPECT_THAT(piecewiseLinearIndex.lowerBound(101), testing::Eq(10));
+}
+
+TEST(PiecewiseLinearIndexTest, GivenEvenlySpacedKeys_WhenBuilt_ThenUsesSingleSegment) {
+	std::vector<int> sortedData(100000);
+	for (std::size_t index {0}; index < sortedData.size(); ++index) {
+		sortedData[index] = static_cast<int>(3 * index);
+	}
+	
+	const PiecewiseLinearIndex<std::vector<int>> piecewiseLinearIndex {sortedData, 4};
+	
+	EXPECT_THAT(piecewiseLinearIndex.getSegmentCount(), testing::Eq(1));
+	EXPECT_THAT(piecewiseLinearIndex.lowerBound(3 * 54321), testing::Eq(54321));
+	EXPECT_THAT(piecewiseLinearIndex.lowerBound(3 * 54321 + 1), testing::Eq(54322));
+}
+
+TEST(PiecewiseLinearIndexTest, GivenLongRunsOfDuplicates_WhenLowerBound_ThenReturnsIndexOfFirstDuplicate) {
+	std::vector<int> sortedData {};
+	for (auto key {0}; key < 20; ++key) {
+		sortedData.insert(sortedData.end(), static_cast<std::size_t>(key % 3 == 0 ? 50 : 1), key);
+	}
+	
+	const PiecewiseLinearIndex<std::vector<int>> piecewiseLinearIndex {sortedData, 4};
+	for (auto target {-1}; target <= 20; ++target) {
+		const auto expectedIndex {static_cast<std::size_t>(std::ranges::lower_bound(sortedData, target) - sortedData.begin())};
+		EXPECT_THAT(piecewiseLinearIndex.lowerBound(target), testing::Eq(expectedIndex));
+	}
+}
+
+TEST(PiecewiseLinearIndexTest, GivenRandomKeysAndEpsilons_WhenLowerBound_ThenMatchesStandardLowerBound) {
+	std::mt19937 generator {42};
+	std::uniform_real_distribution<double> distribution {0.0, 1.0};
+	
+	for (const std::size_t epsilon : {1, 8, 64}) {
+		for (const auto exponent : {1.0, 3.0}) {
+			std::vector<long long> sortedData(20000);
+			std::ranges::generate(sortedData, [&generator, &distribution, exponent]() {
+				return static_cast<long long>(std::pow(distribution(generator), exponent) * 1e9);
+			});
+			std::ranges::sort(sortedData);
+			const PiecewiseLinearIndex<std::vector<long long>> piecewiseLinearIndex {sortedData, epsilon};
+			
+			EXPECT_THAT(piecewiseLinearIndex.getSegmentCount(), testing::Lt(sortedData.size() / epsilon + 1));
+			for (std::size_t index {0}; index < sortedData.size(); index += 3) {
+				for (const auto target : {sortedData[index] - 1, sortedData[index], sortedData[index] + 1}) {
+					const auto expectedIndex {static_cast<std::size_t>(std::ranges::lower_bound(sortedData, target) - sortedData.begin())};
+					ASSERT_THAT(piecewiseLinearIndex.lowerBound(target), testing::Eq(expectedIndex));
+				}
+			}
+		}
+	}
+}
+
+TEST(PiecewiseLinearIndexTest, GivenFloatingPointKeys_WhenLowerBound_ThenMatchesStandardLowerBound) {
+	std::vector<double> sortedData(1000);
+	for (std::size_t index {0}; index < sortedData.size(); ++index) {
+		sortedData[index] = std::sqrt(static_cast<double>(index));
+	}
+	
+	const PiecewiseLinearIndex<std::vector<double>> piecewiseLinearIndex {sortedData, 2};
+	for (const auto target : {-1.0, 0.0, 0.5, 10.0, 10.01, 31.6, 100.0}) {
+		const auto expectedIndex {static_cast<std::size_t>(std::ranges::lower_bound(sortedData, target) - sortedData.begin())};
+		EXPECT_THAT(piecewiseLinearIndex.lowerBound(target), testing::Eq(expectedIndex));
+	}
+}
+}
\ No newline at end of file
@@ -0,0 +1,99 @@
+#include <gmock/gmock.h>
+
+#include <algorithm>
+#include <functional>
+#include <vector>
+
+#include "Algorithms/Searching/StaticBPlusTree.hpp"
+#include "SortedIntegerData.hpp"
+#include "SortedStringData.hpp"
+
+namespace Core::Algorithms::Searching::Test {
+TEST(StaticBPlusTreeTest, GivenEmptyVector_WhenQueried_ThenReturnsZero) {
+	const std::vector<int> sortedData {};
+	const StaticBPlusTree<int> staticBPlusTree {sortedData};
+	
+	EXPECT_THAT(staticBPlusTree.isEmpty(), testing::IsTrue());
+	EXPECT_THAT(staticBPlusTree.getHeight(), testing::Eq(0));
+	EXPECT_THAT(staticBPlusTree.lowerBound(1), testing::Eq(0));
+	EXPECT_THAT(staticBPlusTree.upperBound(1), testing::Eq(0));
+	EXPECT_THAT(staticBPlusTree.countInRange(0, 10), testing::Eq(0));
+}
+
+TEST(StaticBPlusTreeTest, GivenSortedIntegerArray_WhenLowerBound_ThenReturnsIndexOfFirstElementNotBeforeTarget) {
+	const std::array<int, 10> sortedData {sortedIntegers};
+	const StaticBPlusTree<int> staticBPlusTree {sortedData};
+	
+	EXPECT_THAT(staticBPlusTree.getSize(), testing::Eq(10));
+	EXPECT_THAT(staticBPlusTree.getHeight(), testing::Eq(1));
+	EXPECT_THAT(staticBPlusTree.lowerBound(0), testing::Eq(0));
+	EXPECT_THAT(staticBPlusTree.lowerBound(73), testing::Eq(6));
+	EXPECT_THAT(staticBPlusTree.lowerBound(74), testing::Eq(7));
+	EXPECT_THAT(staticBPlusTree.lowerBound(101), testing::Eq(10));
+}
+
+TEST(StaticBPlusTreeTest, GivenSortedIntegerArray_WhenUpperBound_ThenReturnsIndexOfFirstElementAfterTarget) {
+	const std::array<int, 10> sortedData {sortedIntegers};
+	const StaticBPlusTree<int> staticBPlusTree {sortedData};
+	
+	EXPECT_THAT(staticBPlusTree.upperBound(0), testing::Eq(0));
+	EXPECT_THAT(staticBPlusTree.upperBound(73), testing::Eq(7));
+	EXPECT_THAT(staticBPlusTree.upperBound(100), testing::Eq(10));
+}
+
+TEST(StaticBPlusTreeTest, GivenSortedIntegerArray_WhenCountInRange_ThenReturnsNumberOfElementsInClosedRange) {
+	const std::array<int, 10> sortedData {sortedIntegers};
+	const StaticBPlusTree<int> staticBPlusTree {sortedData};
+	
+	EXPECT_THAT(staticBPlusTree.countInRange(23, 73), testing::Eq(5));
+	EXPECT_THAT(staticBPlusTree.countInRange(24, 72), testing::Eq(3));
+	EXPECT_THAT(staticBPlusTree.countInRange(0, 1000), testing::Eq(10));
+	EXPECT_THAT(staticBPlusTree.countInRange(50, 60), testing::Eq(0));
+	EXPECT_THAT(staticBPlusTree.countInRange(73, 23), testing::Eq(0));
+}
+
+TEST(StaticBPlusTreeTest, GivenSortedStringArray_WhenLowerBoundAndUpperBound_ThenReturnsIndicesOfBounds) {
+	const std::array<std::string, 10> sortedData {sortedStrings};
+	const StaticBPlusTree<std::string> staticBPlusTree {sortedData};
+	
+	EXPECT_THAT(staticBPlusTree.lowerBound("Peach"), testing::Eq(7));
+	EXPECT_THAT(staticBPlusTree.upperBound("Peach"), testing::Eq(8));
+	EXPECT_THAT(staticBPlusTree.lowerBound("Pineapple"), testing::Eq(9));
+	EXPECT_THAT(staticBPlusTree.lowerBound("Zucchini"), testing::Eq(10));
+}
+
+TEST(StaticBPlusTreeTest, GivenDescendingVector_WhenLowerBoundWithGreater_ThenReturnsIndexOfFirstElementNotAfterTarget) {
+	std::vector<int> sortedData(1000);
+	for (std::size_t index {0}; index < sortedData.size(); ++index) {
+		sortedData[index] = static_cast<int>(2 * (sortedData.size() - index));
+	}
+	
+	const StaticBPlusTree<int, std::greater<int>> staticBPlusTree {sortedData};
+	for (auto target {-1}; target <= 2002; ++target) {
+		const auto expected {std::ranges::lower_bound(sortedData, target, std::greater<int> {}) - sortedData.begin()};
+		EXPECT_THAT(staticBPlusTree.lowerBound(target), testing::Eq(expected));
+	}
+}
+
+TEST(StaticBPlusTreeTest, GivenVectorsSpanningSeveralLayers_WhenQueriedWithAndWithoutSimd_ThenMatchesStandardBounds) {
+	for (const std::size_t size : {1, 15, 16, 17, 255, 256, 272, 273, 289, 4623, 5000}) {
+		std::vector<int> sortedData(size);
+		for (std::size_t index {0}; index < size; ++index) {
+			sortedData[index] = static_cast<int>(2 * (index / 3));
+		}
+		
+		const StaticBPlusTree<int> staticBPlusTree {sortedData};
+		const StaticBPlusTree<int, std::less<int>, false> scalarStaticBPlusTree {sortedData};
+		for (auto target {-1}; target <= sortedData.back() + 1; ++target) {
+			const auto lower {std::ranges::lower_bound(sortedData, target) - sortedData.begin()};
+			const auto upper {std::ranges::upper_bound(sortedData, target) - sortedData.begin()};
+			
+			EXPECT_THAT(staticBPlusTree.lowerBound(target), testing::Eq(lower));
+			EXPECT_THAT(staticBPlusTree.upperBound(target), testing::Eq(upper));
+			EXPECT_THAT(staticBPlusTree.countInRange(target, target), testing::Eq(upper - lower));
+			EXPECT_THAT(scalarStaticBPlusTree.lowerBound(target), testing::Eq(lower));
+			EXPECT_THAT(scalarStaticBPlusTree.upperBound(target), testing::Eq(upper));
+		}
+	}
+}
+}
\ No newline at end of file
@@ -0,0 +1,169 @@
+#include <gmock/gmock.h>
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <vector>
+
+#if defined(_WIN32)
+#include <process.h>
+#else
+#include <unistd.h>
+#endif
+
+#include "Algorithms/Sorting/ExternalMergeSorter.hpp"
+
+namespace Core::Algorithms::Sorting::Test {
+struct KeyedRecord {
+	int key;
+	int index;
+	
+	bool operator==(const KeyedRecord& other) const = default;
+};
+
+class ExternalMergeSorterTest : public testing::Test {
+protected:
+	void SetUp() override {
+		const auto* const testInfo {testing::UnitTest::GetInstance()->current_test_info()};
+		directory = std::filesystem::temp_directory_path() /
+		            ("ExternalMergeSorterTest-" + std::to_string(getProcessId()) + "-" + testInfo->name());
+		std::filesystem::remove_all(directory);
+		std::filesystem::create_directories(directory / "Runs");
+		inputPath = directory / "input.bin";
+		outputPath = directory / "output.bin";
+	}
+	
+	void TearDown() override {
+		std::error_code errorCode {};
+		std::filesystem::remove_all(directory, errorCode);
+	}
+	
+	static int getProcessId() noexcept {
+#if defined(_WIN32)
+		return _getpid();
+#else
+		return static_cast<int>(getpid());
+#endif
+	}
+	
+	template<typename RecordType>
+	void writeRecords(const std::vector<RecordType>& records) const {
+		std::ofstream stream {inputPath, std::ios::binary | std::ios::trunc};
+		stream.write(reinterpret_cast<const char*>(records.data()),
+		             static_cast<std::streamsize>(records.size() * sizeof(RecordType)));
+	}
+	
+	template<typename RecordType>
+	std::vector<RecordType> readRecords() const {
+		std::vector<RecordType> records(std::filesystem::file_size(outputPath) / sizeof(RecordType));
+		std::ifstream stream {outputPath, std::ios::binary};
+		stream.read(reinterpret_cast<char*>(records.data()),
+		            static_cast<std::streamsize>(records.size() * sizeof(RecordType)));
+		return records;
+	}
+	
+	static std::vector<int> makeRandomIntegers(const std::size_t size) {
+		std::mt19937 generator {42};
+		std::uniform_int_distribution<int> distribution {-1000000, 1000000};
+		std::vector<int> integers(size);
+		std::ranges::generate(integers, [&generator, &distribution]() {
+			return distribution(generator);
+		});
+		
+		return integers;
+	}
+
+protected:
+	std::filesystem::path directory;
+	std::filesystem::path inputPath;
+	std::filesystem::path outputPath;
+};
+
+TEST_F(ExternalMergeSorterTest, GivenMemoryLimitSmallerThanFiveRecords_WhenConstructed_ThenThrowsInvalidArgument) {
+	EXPECT_THROW(ExternalMergeSorter<int>(4 * sizeof(int), directory), std::invalid_argument);
+}
+
+TEST_F(ExternalMergeSorterTest, GivenMissingInputFile_WhenSort_ThenReturnsFalse) {
+	ExternalMergeSorter<int> sorter {1024, directory / "Runs"};
+	
+	EXPECT_THAT(sorter.sort(inputPath, outputPath, std::less<int> {}), testing::IsFalse());
+}
+
+TEST_F(ExternalMergeSorterTest, GivenInputFileWithPartialRecord_WhenSort_ThenReturnsFalse) {
+	writeRecords(std::vector<char> {1, 2, 3, 4, 5, 6, 7});
+	ExternalMergeSorter<int> sorter {1024, directory / "Runs"};
+	
+	EXPECT_THAT(sorter.sort(inputPath, outputPath, std::less<int> {}), testing::IsFalse());
+}
+
+TEST_F(ExternalMergeSorterTest, GivenEmptyInputFile_WhenSort_ThenOutputFileIsEmpty) {
+	writeRecords(std::vector<int> {});
+	ExternalMergeSorter<int> sorter {1024, directory / "Runs"};
+	
+	EXPECT_THAT(sorter.sort(inputPath, outputPath, std::less<int> {}), testing::IsTrue());
+	EXPECT_THAT(readRecords<int>(), testing::IsEmpty());
+}
+
+TEST_F(ExternalMergeSorterTest, GivenInputFileThatFitsInMemory_WhenSortDescendingOrder_ThenOutputIsSorted) {
+	writeRecords(std::vector<int> {34, 1, 88, 6, 100, 23, 73, 99, 29, 45});
+	ExternalMergeSorter<int> sorter {1024, directory / "Runs"};
+	
+	EXPECT_THAT(sorter.sort(inputPath, outputPath, std::greater<int> {}), testing::IsTrue());
+	EXPECT_THAT(readRecords<int>(), testing::ElementsAre(100, 99, 88, 73, 45, 34, 29, 23, 6, 1));
+}
+
+TEST_F(ExternalMergeSorterTest, GivenInputFileLargerThanMemoryLimit_WhenSortAscendingOrder_ThenOutputIsSorted) {
+	auto integers {makeRandomIntegers(100000)};
+	writeRecords(integers);
+	ExternalMergeSorter<int> sorter {4096, directory / "Runs"};
+	
+	EXPECT_THAT(sorter.sort(inputPath, outputPath, std::less<int> {}), testing::IsTrue());
+	
+	std::ranges::sort(integers);
+	EXPECT_THAT(readRecords<int>(), testing::ContainerEq(integers));
+}
+
+TEST_F(ExternalMergeSorterTest, GivenSameInputAndOutputFile_WhenSort_ThenFileIsSortedInPlace) {
+	auto integers {makeRandomIntegers(10000)};
+	writeRecords(integers);
+	ExternalMergeSorter<int> sorter {4096, directory / "Runs"};
+	
+	EXPECT_THAT(sorter.sort(inputPath, inputPath, std::less<int> {}), testing::IsTrue());
+	
+	std::ranges::sort(integers);
+	outputPath = inputPath;
+	EXPECT_THAT(readRecords<int>(), testing::ContainerEq(integers));
+}
+
+TEST_F(ExternalMergeSorterTest, GivenRecordsWithEqualKeys_WhenSort_ThenRelativeOrderOfEqualKeysIsPreserved) {
+	std::mt19937 generator {42};
+	std::uniform_int_distribution<int> distribution {0, 50};
+	std::vector<KeyedRecord> records(20000);
+	for (auto index {0}; index < static_cast<int>(records.size()); ++index) {
+		records[index] = {distribution(generator), index};
+	}
+	
+	writeRecords(records);
+	ExternalMergeSorter<KeyedRecord> sorter {2048, directory / "Runs"};
+	const auto compareKeys {[](const KeyedRecord& first, const KeyedRecord& second) {
+		return first.key < second.key;
+	}};
+	
+	EXPECT_THAT(sorter.sort(inputPath, outputPath, compareKeys), testing::IsTrue());
+	
+	std::ranges::stable_sort(records, compareKeys);
+	EXPECT_THAT(readRecords<KeyedRecord>(), testing::ContainerEq(records));
+}
+
+TEST_F(ExternalMergeSorterTest, GivenInputFileLargerThanMemoryLimit_WhenSort_ThenTemporaryFilesAreRemoved) {
+	writeRecords(makeRandomIntegers(10000));
+	ExternalMergeSorter<int> sorter {4096, directory / "Runs"};
+	
+	EXPECT_THAT(sorter.sort(inputPath, outputPath, std::less<int> {}), testing::IsTrue());
+	EXPECT_THAT(std::filesystem::is_empty(directory / "Runs"), testing::IsTrue());
+}
+}
\ No newline at end of file
@@ -0,0 +1,64 @@
+#include <gmock/gmock.h>
+
+#include <functional>
+#include <optional>
+#include <vector>
+
+#include "Algorithms/Sorting/LoserTree.hpp"
+
+namespace Core::Algorithms::Sorting::Test {
+TEST(LoserTreeTest, GivenNoSources_WhenIsEmpty_ThenReturnsTrue) {
+	const LoserTree<int> loserTree {{}, std::less<int> {}};
+	
+	EXPECT_THAT(loserTree.isEmpty(), testing::IsTrue());
+}
+
+TEST(LoserTreeTest, GivenOnlyEmptySources_WhenIsEmpty_ThenReturnsTrue) {
+	const LoserTree<int> loserTree {{std::nullopt, std::nullopt, std::nullopt}, std::less<int> {}};
+	
+	EXPECT_THAT(loserTree.isEmpty(), testing::IsTrue());
+}
+
+TEST(LoserTreeTest, GivenSources_WhenGetWinner_ThenReturnsSmallestElementAndItsSourceIndex) {
+	const LoserTree<int> loserTree {{7, std::nullopt, 3, 5, 9}, std::less<int> {}};
+	
+	EXPECT_THAT(loserTree.isEmpty(), testing::IsFalse());
+	EXPECT_THAT(loserTree.getWinner(), testing::Eq(3));
+	EXPECT_THAT(loserTree.getWinnerIndex(), testing::Eq(2));
+}
+
+TEST(LoserTreeTest, GivenSortedSources_WhenReplaceWinnerUntilEmpty_ThenElementsAreMergedInOrder) {
+	const std::vector<std::vector<int>> sources {{1, 4, 9}, {}, {2, 3, 10, 11}, {5}, {0, 6, 7, 8}};
+	std::vector<std::size_t> positions(sources.size(), 0);
+	std::vector<std::optional<int>> leaves {};
+	for (const auto& source : sources) {
+		leaves.push_back(source.empty() ? std::nullopt : std::optional<int> {source.front()});
+	}
+	
+	LoserTree<int> loserTree {std::move(leaves), std::less<int> {}};
+	std::vector<int> merged {};
+	while (!loserTree.isEmpty()) {
+		merged.push_back(loserTree.getWinner());
+		
+		const auto sourceIndex {loserTree.getWinnerIndex()};
+		const auto& source {sources[sourceIndex]};
+		auto& position {positions[sourceIndex]};
+		++position;
+		loserTree.replaceWinner(position < source.size() ? std::optional<int> {source[position]} : std::nullopt);
+	}
+	
+	EXPECT_THAT(merged, testing::ElementsAre(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11));
+}
+
+TEST(LoserTreeTest, GivenEqualElements_WhenGetWinnerIndex_ThenLowestSourceIndexWins) {
+	LoserTree<int> loserTree {{4, 2, 2, 2}, std::less<int> {}};
+	
+	EXPECT_THAT(loserTree.getWinnerIndex(), testing::Eq(1));
+	
+	loserTree.replaceWinner(std::nullopt);
+	EXPECT_THAT(loserTree.getWinnerIndex(), testing::Eq(2));
+	
+	loserTree.replaceWinner(std::nullopt);
+	EXPECT_THAT(loserTree.getWinnerIndex(), testing::Eq(3));
+}
+}
\ No newline at end of file
@@ -0,0 +1,90 @@
+#include <gmock/gmock.h>
+
+#include <algorithm>
+#include <numeric>
+#include <random>
+
+#include "Algorithms/Sorting/NthElementSelector.hpp"
+#include "UnsortedIntegerData.hpp"
+#include "UnsortedStringData.hpp"
+
+namespace Core::Algorithms::Sorting::Test {
+TEST(NthElementSelectorTest, GivenEmptyVector_WhenSelect_ThenReturnsNullopt) {
+	std::vector<int> data {};
+	auto selector {NthElementSelector<std::vector<int>>(data)};
+	
+	EXPECT_THAT(selector.select(0, std::less<int> {}), testing::Eq(std::nullopt));
+}
+
+TEST(NthElementSelectorTest, GivenPositionOutOfRange_WhenSelect_ThenReturnsNulloptAndContainerIsUnchanged) {
+	std::array<int, 10> data {unsortedIntegers};
+	auto selector {NthElementSelector<std::array<int, 10>>(data)};
+	
+	EXPECT_THAT(selector.select(10, std::less<int> {}), testing::Eq(std::nullopt));
+	EXPECT_THAT(data, testing::ContainerEq(unsortedIntegers));
+}
+
+TEST(NthElementSelectorTest, GivenUnsortedIntegerArray_WhenSelectEachPosition_ThenReturnsElementAtSortedPosition) {
+	const std::array<int, 10> sortedIntegers {1, 6, 23, 29, 34, 45, 73, 88, 99, 100};
+	
+	for (std::size_t position {0}; position < sortedIntegers.size(); ++position) {
+		std::array<int, 10> data {unsortedIntegers};
+		auto selector {NthElementSelector<std::array<int, 10>>(data)};
+		
+		EXPECT_THAT(selector.select(position, std::less<int> {}), testing::Optional(sortedIntegers[position]));
+		EXPECT_THAT(data[position], testing::Eq(sortedIntegers[position]));
+	}
+}
+
+TEST(NthElementSelectorTest, GivenUnsortedStringVector_WhenSelectDescendingOrder_ThenReturnsElementAtSortedPosition) {
+	std::vector<std::string> data {unsortedStrings.begin(), unsortedStrings.end()};
+	auto selector {NthElementSelector<std::vector<std::string>>(data)};
+	
+	EXPECT_THAT(selector.select(2, std::greater<std::string> {}), testing::Optional(std::string {"Peach"}));
+}
+
+TEST(NthElementSelectorTest, GivenLargeRandomVector_WhenSelect_ThenElementsArePartitionedAroundPosition) {
+	std::mt19937 generator {42};
+	std::uniform_int_distribution<int> distribution {0, 1000};
+	std::vector<int> data(100000);
+	std::ranges::generate(data, [&generator, &distribution]() {
+		return distribution(generator);
+	});
+	
+	auto sortedData {data};
+	std::ranges::sort(sortedData);
+	
+	for (const std::size_t position : {0UL, 1UL, 777UL, 50000UL, 99998UL, 99999UL}) {
+		auto selectedData {data};
+		auto selector {NthElementSelector<std::vector<int>>(selectedData)};
+		const auto nth {selector.select(position, std::less<int> {})};
+		
+		ASSERT_THAT(nth, testing::Optional(sortedData[position]));
+		EXPECT_THAT(std::all_of(selectedData.begin(), selectedData.begin() + position, [&nth](const int element) {
+			return element <= *nth;
+		}), testing::IsTrue());
+		EXPECT_THAT(std::all_of(selectedData.begin() + position, selectedData.end(), [&nth](const int element) {
+			return element >= *nth;
+		}), testing::IsTrue());
+	}
+}
+
+TEST(NthElementSelectorTest, GivenAllEqualElements_WhenSelect_ThenReturnsThatElement) {
+	std::vector<int> data(10000, 7);
+	auto selector {NthElementSelector<std::vector<int>>(data)};
+	
+	EXPECT_THAT(selector.select(5000, std::less<int> {}), testing::Optional(7));
+}
+
+TEST(NthElementSelectorTest, GivenSortedAndReverseSortedVectors_WhenSelectMedian_ThenReturnsMedian) {
+	std::vector<int> sortedData(10001);
+	std::iota(sortedData.begin(), sortedData.end(), 0);
+	std::vector<int> reverseSortedData {sortedData.rbegin(), sortedData.rend()};
+	
+	auto sortedSelector {NthElementSelector<std::vector<int>>(sortedData)};
+	auto reverseSortedSelector {NthElementSelector<std::vector<int>>(reverseSortedData)};
+	
+	EXPECT_THAT(sortedSelector.select(5000, std::less<int> {}), testing::Optional(5000));
+	EXPECT_THAT(reverseSortedSelector.select(5000, std::less<int> {}), testing::Optional(5000));
+}
+}
\ No newline at end of file
@@ -0,0 +1,70 @@
+#include <gmock/gmock.h>
+
+#include <algorithm>
+#include <random>
+
+#include "Algorithms/Sorting/PartialSorter.hpp"
+#include "UnsortedIntegerData.hpp"
+#include "UnsortedStringData.hpp"
+
+namespace Core::Algorithms::Sorting::Test {
+TEST(PartialSorterTest, GivenUnsortedIntegerArray_WhenSortFirstThreeAscendingOrder_ThenFirstThreeAreSmallestInOrder) {
+	std::array<int, 10> unsortedData {unsortedIntegers};
+	auto partialSorter {PartialSorter<std::array<int, 10>>(unsortedData, 3)};
+	partialSorter.sort(std::less<int> {});
+	
+	EXPECT_THAT(std::vector<int>(unsortedData.begin(), unsortedData.begin() + 3), testing::ElementsAre(1, 6, 23));
+	EXPECT_THAT(unsortedData, testing::UnorderedElementsAreArray(unsortedIntegers));
+}
+
+TEST(PartialSorterTest, GivenUnsortedIntegerVector_WhenSortFirstFourDescendingOrder_ThenFirstFourAreLargestInOrder) {
+	std::vector<int> unsortedData {unsortedIntegers.begin(), unsortedIntegers.end()};
+	auto partialSorter {PartialSorter<std::vector<int>>(unsortedData, 4)};
+	partialSorter.sort(std::greater<int> {});
+	
+	EXPECT_THAT(std::vector<int>(unsortedData.begin(), unsortedData.begin() + 4), testing::ElementsAre(100, 99, 88, 73));
+}
+
+TEST(PartialSorterTest, GivenUnsortedStringVector_WhenSortFirstTwoAscendingOrder_ThenFirstTwoAreSmallestInOrder) {
+	std::vector<std::string> unsortedData {unsortedStrings.begin(), unsortedStrings.end()};
+	auto partialSorter {PartialSorter<std::vector<std::string>>(unsortedData, 2)};
+	partialSorter.sort(std::less<std::string> {});
+	
+	EXPECT_THAT(std::vector<std::string>(unsortedData.begin(), unsortedData.begin() + 2),
+	            testing::ElementsAre("!", "Apple"));
+}
+
+TEST(PartialSorterTest, GivenCountGreaterThanSize_WhenSort_ThenWholeContainerIsSorted) {
+	std::vector<int> unsortedData {unsortedIntegers.begin(), unsortedIntegers.end()};
+	auto partialSorter {PartialSorter<std::vector<int>>(unsortedData, 100)};
+	partialSorter.sort(std::less<int> {});
+	
+	EXPECT_THAT(unsortedData, testing::ElementsAre(1, 6, 23, 29, 34, 45, 73, 88, 99, 100));
+}
+
+TEST(PartialSorterTest, GivenCountOfZero_WhenSort_ThenContainerIsUnchanged) {
+	std::vector<int> unsortedData {unsortedIntegers.begin(), unsortedIntegers.end()};
+	auto partialSorter {PartialSorter<std::vector<int>>(unsortedData, 0)};
+	partialSorter.sort(std::less<int> {});
+	
+	EXPECT_THAT(unsortedData, testing::ElementsAreArray(unsortedIntegers));
+}
+
+TEST(PartialSorterTest, GivenLargeRandomVector_WhenSortFirstThousand_ThenPrefixMatchesFullSort) {
+	std::mt19937 generator {42};
+	std::uniform_int_distribution<int> distribution {};
+	std::vector<int> unsortedData(100000);
+	std::ranges::generate(unsortedData, [&generator, &distribution]() {
+		return distribution(generator);
+	});
+	
+	auto sortedData {unsortedData};
+	std::ranges::sort(sortedData);
+	
+	auto partialSorter {PartialSorter<std::vector<int>>(unsortedData, 1000)};
+	partialSorter.sort(std::less<int> {});
+	
+	EXPECT_THAT(std::vector<int>(unsortedData.begin(), unsortedData.begin() + 1000),
+	            testing::ElementsAreArray(sortedData.begin(), sortedData.begin() + 1000));
+}
+}
\ No newline at end of file
@@ -0,0 +1,158 @@
+#include <gmock/gmock.h>
+
+#include <algorithm>
+#include <random>
+#include <utility>
+
+#include "Algorithms/Sorting/TimSorter.hpp"
+#include "UnsortedIntegerData.hpp"
+#include "UnsortedStringData.hpp"
+
+namespace Core::Algorithms::Sorting::Test {
+TEST(TimSorterTest, GivenUnsortedIntegerArray_WhenSortAscendingOrder_ThenArrayIsSortedInAscendingOrder) {
+	std::array<int, 10> unsortedData {unsortedIntegers};
+	auto timSorter {TimSorter<std::array<int, 10>>(unsortedData)};
+	timSorter.sort(std::less<int> {});
+	
+	EXPECT_THAT(unsortedData, testing::ElementsAre(1, 6, 23, 29, 34, 45, 73, 88, 99, 100));
+}
+
+TEST(TimSorterTest, GivenUnsortedIntegerVector_WhenSortDescendingOrder_ThenVectorIsSortedInDescendingOrder) {
+	std::vector<int> unsortedData {unsortedIntegers.begin(), unsortedIntegers.end()};
+	auto timSorter {TimSorter<std::vector<int>>(unsortedData)};
+	timSorter.sort(std::greater<int> {});
+	
+	EXPECT_THAT(unsortedData, testing::ElementsAre(100, 99, 88, 73, 45, 34, 29, 23, 6, 1));
+}
+
+TEST(TimSorterTest, GivenUnsortedStringArray_WhenSortAscendingOrder_ThenArrayIsSortedInAscendingOrder) {
+	std::array<std::string, 10> unsortedData {unsortedStrings};
+	auto timSorter {TimSorter<std::array<std::string, 10>>(unsortedData)};
+	timSorter.sort(std::less<std::string> {});
+	
+	EXPECT_THAT(unsortedData,
+	            testing::ElementsAre("!",
+	                                 "Apple",
+	                                 "Banana",
+	                                 "Cherry",
+	                                 "Grape",
+	                                 "Melon",
+	                                 "Orange",
+	                                 "Peach",
+	                                 "Pear",
+	                                 "Strawberry"));
+}
+
+TEST(TimSorterTest, GivenUnsortedStringVector_WhenSortDescendingOrder_ThenVectorIsSortedInDescendingOrder) {
+	std::vector<std::string> unsortedData {unsortedStrings.begin(), unsortedStrings.end()};
+	auto timSorter {TimSorter<std::vector<std::string>>(unsortedData)};
+	timSorter.sort(std::greater<std::string> {});
+	
+	EXPECT_THAT(unsortedData,
+	            testing::ElementsAre("Strawberry",
+	                                 "Pear",
+	                                 "Peach",
+	                                 "Orange",
+	                                 "Melon",
+	                                 "Grape",
+	                                 "Cherry",
+	                                 "Banana",
+	                                 "Apple",
+	                                 "!"));
+}
+
+TEST(TimSorterTest, GivenReverseSortedIntegerVector_WhenSortAscendingOrder_ThenVectorIsSortedInAscendingOrder) {
+	std::vector<int> data(10'000);
+	for (std::size_t index {0}; index < data.size(); ++index) {
+		data[index] = static_cast<int>(data.size() - index);
+	}
+	
+	auto timSorter {TimSorter<std::vector<int>>(data)};
+	timSorter.sort(std::less<int> {});
+	
+	EXPECT_THAT(std::is_sorted(data.begin(), data.end()), testing::IsTrue());
+}
+
+TEST(TimSorterTest, GivenNearlySortedIntegerVector_WhenSortAscendingOrder_ThenVectorIsSortedInAscendingOrder) {
+	std::vector<int> data(10'000);
+	for (std::size_t index {0}; index < data.size(); ++index) {
+		data[index] = static_cast<int>(index);
+	}
+	
+	std::mt19937 generator {42};
+	std::uniform_int_distribution<std::size_t> distribution {0, data.size() - 1};
+	for (auto swapCount {0}; swapCount < 20; ++swapCount) {
+		std::swap(data[distribution(generator)], data[distribution(generator)]);
+	}
+	
+	auto expectedData {data};
+	std::sort(expectedData.begin(), expectedData.end());
+	
+	auto timSorter {TimSorter<std::vector<int>>(data)};
+	timSorter.sort(std::less<int> {});
+	
+	EXPECT_THAT(data, testing::ContainerEq(expectedData));
+}
+
+TEST(TimSorterTest, GivenLongLeftRunGreaterThanShortRightRun_WhenSortAscendingOrder_ThenVectorIsSortedInAscendingOrder) {
+	constexpr std::size_t size {3'000};
+	constexpr std::size_t leftRunLength {size * 2 / 3};
+	
+	std::vector<int> data(size);
+	for (std::size_t index {0}; index < leftRunLength; ++index) {
+		data[index] = static_cast<int>(size + index);
+	}
+	
+	for (std::size_t index {leftRunLength}; index < size; ++index) {
+		data[index] = static_cast<int>(index - leftRunLength);
+	}
+	
+	auto expectedData {data};
+	std::sort(expectedData.begin(), expectedData.end());
+	
+	auto timSorter {TimSorter<std::vector<int>>(data)};
+	timSorter.sort(std::less<int> {});
+	
+	EXPECT_THAT(data, testing::ContainerEq(expectedData));
+}
+
+TEST(TimSorterTest, GivenRandomIntegerVector_WhenSortAscendingOrder_ThenVectorIsSortedInAscendingOrder) {
+	std::mt19937 generator {42};
+	std::uniform_int_distribution<int> distribution {-1'000'000, 1'000'000};
+	
+	std::vector<int> data(100'000);
+	std::generate(data.begin(), data.end(), [&generator, &distribution]() {
+		return distribution(generator);
+	});
+	
+	auto expectedData {data};
+	std::sort(expectedData.begin(), expectedData.end());
+	
+	auto timSorter {TimSorter<std::vector<int>>(data)};
+	timSorter.sort(std::less<int> {});
+	
+	EXPECT_THAT(data, testing::ContainerEq(expectedData));
+}
+
+TEST(TimSorterTest, GivenVectorWithEqualKeys_WhenSortAscendingOrder_ThenRelativeOrderOfEqualKeysIsPreserved) {
+	std::mt19937 generator {42};
+	std::uniform_int_distribution<int> distribution {0, 15};
+	
+	std::vector<std::pair<int, int>> data(50'000);
+	for (std::size_t index {0}; index < data.size(); ++index) {
+		data[index] = {distribution(generator), static_cast<int>(index)};
+	}
+	
+	const auto compareKeys {[](const std::pair<int, int>& left, const std::pair<int, int>& right) {
+		return left.first < right.first;
+	}};
+	
+	auto expectedData {data};
+	std::stable_sort(expectedData.begin(), expectedData.end(), compareKeys);
+	
+	auto timSorter {TimSorter<std::vector<std::pair<int, int>>>(data)};
+	timSorter.sort(compareKeys);
+	
+	EXPECT_THAT(data, testing::ContainerEq(expectedData));
+}
+}
\ No newline at end of file
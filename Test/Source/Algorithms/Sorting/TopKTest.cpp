@@ -0,0 +1,85 @@
+#include <gmock/gmock.h>
+
+#include <algorithm>
+#include <random>
+#include <stdexcept>
+
+#include "Algorithms/Sorting/TopK.hpp"
+#include "UnsortedIntegerData.hpp"
+#include "UnsortedStringData.hpp"
+
+namespace Core::Algorithms::Sorting::Test {
+TEST(TopKTest, GivenCapacityOfZero_WhenConstructed_ThenThrowsInvalidArgument) {
+	EXPECT_THROW(TopK<int>(0, std::less<int> {}), std::invalid_argument);
+}
+
+TEST(TopKTest, GivenNoElementsPushed_WhenQueried_ThenAccumulatorIsEmpty) {
+	const TopK<int> topK {3, std::less<int> {}};
+	
+	EXPECT_THAT(topK.isEmpty(), testing::IsTrue());
+	EXPECT_THAT(topK.getSize(), testing::Eq(0));
+	EXPECT_THAT(topK.getCapacity(), testing::Eq(3));
+	EXPECT_THAT(topK.peekThreshold(), testing::Eq(std::nullopt));
+	EXPECT_THAT(topK.getSortedElements(), testing::IsEmpty());
+}
+
+TEST(TopKTest, GivenFewerElementsThanCapacity_WhenPush_ThenAllElementsAreRetained) {
+	TopK<int> topK {5, std::less<int> {}};
+	
+	EXPECT_THAT(topK.push(8), testing::IsTrue());
+	EXPECT_THAT(topK.push(3), testing::IsTrue());
+	EXPECT_THAT(topK.push(5), testing::IsTrue());
+	EXPECT_THAT(topK.getSize(), testing::Eq(3));
+	EXPECT_THAT(topK.peekThreshold(), testing::Optional(8));
+	EXPECT_THAT(topK.getSortedElements(), testing::ElementsAre(3, 5, 8));
+}
+
+TEST(TopKTest, GivenUnsortedIntegers_WhenPushAscendingOrder_ThenSmallestElementsAreRetained) {
+	TopK<int> topK {3, std::less<int> {}};
+	for (const auto integer : unsortedIntegers) {
+		topK.push(integer);
+	}
+	
+	EXPECT_THAT(topK.getSize(), testing::Eq(3));
+	EXPECT_THAT(topK.peekThreshold(), testing::Optional(23));
+	EXPECT_THAT(topK.push(100), testing::IsFalse());
+	EXPECT_THAT(topK.getSortedElements(), testing::ElementsAre(1, 6, 23));
+}
+
+TEST(TopKTest, GivenUnsortedStrings_WhenPushDescendingOrder_ThenLargestElementsAreRetained) {
+	TopK<std::string> topK {2, std::greater<std::string> {}};
+	for (auto string : unsortedStrings) {
+		topK.push(std::move(string));
+	}
+	
+	EXPECT_THAT(topK.getSortedElements(), testing::ElementsAre("Strawberry", "Pear"));
+}
+
+TEST(TopKTest, GivenRetainedElements_WhenClear_ThenAccumulatorIsEmpty) {
+	TopK<int> topK {3, std::less<int> {}};
+	topK.push(1);
+	topK.push(2);
+	topK.clear();
+	
+	EXPECT_THAT(topK.isEmpty(), testing::IsTrue());
+	EXPECT_THAT(topK.push(9), testing::IsTrue());
+	EXPECT_THAT(topK.getSortedElements(), testing::ElementsAre(9));
+}
+
+TEST(TopKTest, GivenLongRandomStream_WhenPush_ThenRetainedElementsMatchPrefixOfFullSort) {
+	std::mt19937 generator {42};
+	std::uniform_int_distribution<int> distribution {};
+	std::vector<int> stream(100000);
+	std::ranges::generate(stream, [&generator, &distribution]() {
+		return distribution(generator);
+	});
+	
+	TopK<int> topK {1000, std::greater<int> {}};
+	for (const auto element : stream) {
+		topK.push(element);
+	}
+	
+	std::ranges::sort(stream, std::greater<int> {});
+	EXPECT_THAT(topK.getSortedElements(), testing::ElementsAreArray(stream.begin(), stream.begin() + 1000));
+}
+}
\ No newline at end of file
@@ -171,4 +171,33 @@ TEST_F(EmptyIntegerDoublyLinkedListTest, WhenIsEmpty_ThenReturnsTrue) {
 	
 	EXPECT_THAT(result, testing::IsTrue());
 }
+
+TEST_F(EmptyIntegerDoublyLinkedListTest, WhenSort_ThenListIsEmpty) {
+	doublyLinkedList.sort(std::less<int> {});
+	
+	EXPECT_THAT(doublyLinkedList.isEmpty(), testing::IsTrue());
+}
+
+TEST_F(EmptyIntegerDoublyLinkedListTest, GivenNonEmptyIntegerList_WhenSplice_ThenNodesAreMoved) {
+	DoublyLinkedList<int> otherDoublyLinkedList {};
+	otherDoublyLinkedList.insertAtTail(10);
+	otherDoublyLinkedList.insertAtTail(20);
+	doublyLinkedList.splice(otherDoublyLinkedList);
+	doublyLinkedList.insertAtTail(30);
+	
+	EXPECT_THAT(doublyLinkedList, testing::ElementsAre(10, 20, 30));
+	EXPECT_THAT(otherDoublyLinkedList.isEmpty(), testing::IsTrue());
+}
+
+TEST_F(EmptyIntegerDoublyLinkedListTest, GivenNonEmptyIntegerList_WhenMerge_ThenNodesAreMoved) {
+	DoublyLinkedList<int> otherDoublyLinkedList {};
+	otherDoublyLinkedList.insertAtTail(10);
+	otherDoublyLinkedList.insertAtTail(20);
+	doublyLinkedList.merge(otherDoublyLinkedList, std::less<int> {});
+	doublyLinkedList.insertAtTail(30);
+	
+	EXPECT_THAT(doublyLinkedList, testing::ElementsAre(10, 20, 30));
+	EXPECT_THAT(doublyLinkedList.getNodeCount(), testing::Eq(3));
+	EXPECT_THAT(otherDoublyLinkedList.isEmpty(), testing::IsTrue());
+}
 }
\ No newline at end of file
@@ -158,4 +158,33 @@ TEST_F(EmptyIntegerSinglyLinkedListTest, WhenIsEmpty_ThenReturnsTrue) {
 	
 	EXPECT_THAT(result, testing::IsTrue());
 }
+
+TEST_F(EmptyIntegerSinglyLinkedListTest, WhenSort_ThenListIsEmpty) {
+	singlyLinkedList.sort(std::less<int> {});
+	
+	EXPECT_THAT(singlyLinkedList.isEmpty(), testing::IsTrue());
+}
+
+TEST_F(EmptyIntegerSinglyLinkedListTest, GivenNonEmptyIntegerList_WhenSplice_ThenNodesAreMoved) {
+	SinglyLinkedList<int> otherSinglyLinkedList {};
+	otherSinglyLinkedList.insertAtTail(10);
+	otherSinglyLinkedList.insertAtTail(20);
+	singlyLinkedList.splice(otherSinglyLinkedList);
+	singlyLinkedList.insertAtTail(30);
+	
+	EXPECT_THAT(singlyLinkedList, testing::ElementsAre(10, 20, 30));
+	EXPECT_THAT(otherSinglyLinkedList.isEmpty(), testing::IsTrue());
+}
+
+TEST_F(EmptyIntegerSinglyLinkedListTest, GivenNonEmptyIntegerList_WhenMerge_ThenNodesAreMoved) {
+	SinglyLinkedList<int> otherSinglyLinkedList {};
+	otherSinglyLinkedList.insertAtTail(10);
+	otherSinglyLinkedList.insertAtTail(20);
+	singlyLinkedList.merge(otherSinglyLinkedList, std::less<int> {});
+	singlyLinkedList.insertAtTail(30);
+	
+	EXPECT_THAT(singlyLinkedList, testing::ElementsAre(10, 20, 30));
+	EXPECT_THAT(singlyLinkedList.getNodeCount(), testing::Eq(3));
+	EXPECT_THAT(otherSinglyLinkedList.isEmpty(), testing::IsTrue());
+}
 }
\ No newline at end of file
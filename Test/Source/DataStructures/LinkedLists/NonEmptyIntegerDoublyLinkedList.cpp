@@ -1,5 +1,10 @@
 #include <gmock/gmock.h>
 
+#include <algorithm>
+#include <random>
+#include <utility>
+#include <vector>
+
 #include "DataStructures/LinkedLists/DoublyLinkedList.hpp"
 #include "IntegerPredicates.hpp"
 
@@ -360,4 +365,105 @@ TEST_F(NonEmptyIntegerDoublyLinkedList, WhenIsEmpty_ThenReturnsFalse) {
 	
 	EXPECT_THAT(result, testing::IsFalse());
 }
+
+TEST_F(NonEmptyIntegerDoublyLinkedList, WhenSortDescendingOrder_ThenElementsAreInExpectedOrder) {
+	doublyLinkedList.sort(std::greater<int> {});
+	
+	EXPECT_THAT(doublyLinkedList, testing::ElementsAre(50, 40, 30, 20, 10));
+}
+
+TEST_F(NonEmptyIntegerDoublyLinkedList, GivenUnsortedElements_WhenSort_ThenTailIsUpdated) {
+	doublyLinkedList.insertAtHead(35);
+	doublyLinkedList.insertAtTail(5);
+	doublyLinkedList.sort(std::less<int> {});
+	doublyLinkedList.insertAtTail(60);
+	
+	EXPECT_THAT(doublyLinkedList, testing::ElementsAre(5, 10, 20, 30, 35, 40, 50, 60));
+	EXPECT_THAT(doublyLinkedList.getNodeCount(), testing::Eq(8));
+}
+
+TEST_F(NonEmptyIntegerDoublyLinkedList, GivenLargeUnsortedList_WhenSort_ThenElementsAreSortedStably) {
+	std::mt19937 generator {42};
+	std::uniform_int_distribution<int> distribution {0, 100};
+	std::vector<std::pair<int, int>> elements(10001);
+	DoublyLinkedList<std::pair<int, int>> list {};
+	for (auto index {0}; index < static_cast<int>(elements.size()); ++index) {
+		elements[index] = {distribution(generator), index};
+		list.insertAtTail(elements[index]);
+	}
+	
+	const auto compareKeys {[](const std::pair<int, int>& first, const std::pair<int, int>& second) {
+		return first.first < second.first;
+	}};
+	list.sort(compareKeys);
+	std::ranges::stable_sort(elements, compareKeys);
+	
+	EXPECT_THAT(list, testing::ElementsAreArray(elements));
+	EXPECT_THAT(list.getNodeCount(), testing::Eq(elements.size()));
+}
+
+TEST_F(NonEmptyIntegerDoublyLinkedList, GivenNonEmptyIntegerList_WhenSplice_ThenNodesAreMovedToTail) {
+	DoublyLinkedList<int> otherDoublyLinkedList {};
+	otherDoublyLinkedList.insertAtTail(60);
+	otherDoublyLinkedList.insertAtTail(70);
+	doublyLinkedList.splice(otherDoublyLinkedList);
+	doublyLinkedList.insertAtTail(80);
+	
+	EXPECT_THAT(doublyLinkedList, testing::ElementsAre(10, 20, 30, 40, 50, 60, 70, 80));
+	EXPECT_THAT(doublyLinkedList.getNodeCount(), testing::Eq(8));
+	EXPECT_THAT(otherDoublyLinkedList.isEmpty(), testing::IsTrue());
+}
+
+TEST_F(NonEmptyIntegerDoublyLinkedList, GivenEmptyIntegerList_WhenSplice_ThenElementsAreUnchanged) {
+	DoublyLinkedList<int> otherDoublyLinkedList {};
+	doublyLinkedList.splice(otherDoublyLinkedList);
+	
+	EXPECT_THAT(doublyLinkedList, testing::ElementsAre(10, 20, 30, 40, 50));
+	EXPECT_THAT(doublyLinkedList.getNodeCount(), testing::Eq(5));
+}
+
+TEST_F(NonEmptyIntegerDoublyLinkedList, GivenSortedIntegerList_WhenMerge_ThenElementsAreMergedInOrder) {
+	DoublyLinkedList<int> otherDoublyLinkedList {};
+	otherDoublyLinkedList.insertAtTail(5);
+	otherDoublyLinkedList.insertAtTail(30);
+	otherDoublyLinkedList.insertAtTail(45);
+	otherDoublyLinkedList.insertAtTail(60);
+	doublyLinkedList.merge(otherDoublyLinkedList, std::less<int> {});
+	doublyLinkedList.insertAtTail(70);
+	
+	EXPECT_THAT(doublyLinkedList, testing::ElementsAre(5, 10, 20, 30, 30, 40, 45, 50, 60, 70));
+	EXPECT_THAT(doublyLinkedList.getNodeCount(), testing::Eq(10));
+	EXPECT_THAT(otherDoublyLinkedList.isEmpty(), testing::IsTrue());
+}
+
+TEST_F(NonEmptyIntegerDoublyLinkedList, GivenUnsortedElements_WhenSort_ThenElementsAreInExpectedOrderWhenIteratedBackward) {
+	doublyLinkedList.insertAtHead(35);
+	doublyLinkedList.insertAtTail(5);
+	doublyLinkedList.sort(std::less<int> {});
+	const auto expectedElements {std::vector<int> {50, 40, 35, 30, 20, 10, 5}};
+	auto elementIndex {0};
+	
+	for (auto iterator {doublyLinkedList.rbegin()}; iterator != doublyLinkedList.rend(); ++iterator) {
+		EXPECT_THAT(*iterator, testing::Eq(expectedElements[elementIndex]));
+		++elementIndex;
+	}
+	
+	EXPECT_THAT(elementIndex, testing::Eq(7));
+}
+
+TEST_F(NonEmptyIntegerDoublyLinkedList, GivenSortedIntegerList_WhenMerge_ThenElementsAreInExpectedOrderWhenIteratedBackward) {
+	DoublyLinkedList<int> otherDoublyLinkedList {};
+	otherDoublyLinkedList.insertAtTail(25);
+	otherDoublyLinkedList.insertAtTail(60);
+	doublyLinkedList.merge(otherDoublyLinkedList, std::less<int> {});
+	const auto expectedElements {std::vector<int> {60, 50, 40, 30, 25, 20, 10}};
+	auto elementIndex {0};
+	
+	for (auto iterator {doublyLinkedList.rbegin()}; iterator != doublyLinkedList.rend(); ++iterator) {
+		EXPECT_THAT(*iterator, testing::Eq(expectedElements[elementIndex]));
+		++elementIndex;
+	}
+	
+	EXPECT_THAT(elementIndex, testing::Eq(7));
+}
 }
\ No newline at end of file
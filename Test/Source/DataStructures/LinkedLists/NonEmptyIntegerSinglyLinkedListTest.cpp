@@ -1,5 +1,10 @@
 #include <gmock/gmock.h>
 
+#include <algorithm>
+#include <random>
+#include <utility>
+#include <vector>
+
 #include "DataStructures/LinkedLists/SinglyLinkedList.hpp"
 #include "IntegerPredicates.hpp"
 
@@ -308,4 +313,74 @@ TEST_F(NonEmptyIntegerSinglyLinkedListTest, WhenIsEmpty_ThenReturnsFalse) {
 	
 	EXPECT_THAT(result, testing::IsFalse());
 }
+
+TEST_F(NonEmptyIntegerSinglyLinkedListTest, WhenSortDescendingOrder_ThenElementsAreInExpectedOrder) {
+	singlyLinkedList.sort(std::greater<int> {});
+	
+	EXPECT_THAT(singlyLinkedList, testing::ElementsAre(50, 40, 30, 20, 10));
+}
+
+TEST_F(NonEmptyIntegerSinglyLinkedListTest, GivenUnsortedElements_WhenSort_ThenTailIsUpdated) {
+	singlyLinkedList.insertAtHead(35);
+	singlyLinkedList.insertAtTail(5);
+	singlyLinkedList.sort(std::less<int> {});
+	singlyLinkedList.insertAtTail(60);
+	
+	EXPECT_THAT(singlyLinkedList, testing::ElementsAre(5, 10, 20, 30, 35, 40, 50, 60));
+	EXPECT_THAT(singlyLinkedList.getNodeCount(), testing::Eq(8));
+}
+
+TEST_F(NonEmptyIntegerSinglyLinkedListTest, GivenLargeUnsortedList_WhenSort_ThenElementsAreSortedStably) {
+	std::mt19937 generator {42};
+	std::uniform_int_distribution<int> distribution {0, 100};
+	std::vector<std::pair<int, int>> elements(10001);
+	SinglyLinkedList<std::pair<int, int>> list {};
+	for (auto index {0}; index < static_cast<int>(elements.size()); ++index) {
+		elements[index] = {distribution(generator), index};
+		list.insertAtTail(elements[index]);
+	}
+	
+	const auto compareKeys {[](const std::pair<int, int>& first, const std::pair<int, int>& second) {
+		return first.first < second.first;
+	}};
+	list.sort(compareKeys);
+	std::ranges::stable_sort(elements, compareKeys);
+	
+	EXPECT_THAT(list, testing::ElementsAreArray(elements));
+	EXPECT_THAT(list.getNodeCount(), testing::Eq(elements.size()));
+}
+
+TEST_F(NonEmptyIntegerSinglyLinkedListTest, GivenNonEmptyIntegerList_WhenSplice_ThenNodesAreMovedToTail) {
+	SinglyLinkedList<int> otherSinglyLinkedList {};
+	otherSinglyLinkedList.insertAtTail(60);
+	otherSinglyLinkedList.insertAtTail(70);
+	singlyLinkedList.splice(otherSinglyLinkedList);
+	singlyLinkedList.insertAtTail(80);
+	
+	EXPECT_THAT(singlyLinkedList, testing::ElementsAre(10, 20, 30, 40, 50, 60, 70, 80));
+	EXPECT_THAT(singlyLinkedList.getNodeCount(), testing::Eq(8));
+	EXPECT_THAT(otherSinglyLinkedList.isEmpty(), testing::IsTrue());
+}
+
+TEST_F(NonEmptyIntegerSinglyLinkedListTest, GivenEmptyIntegerList_WhenSplice_ThenElementsAreUnchanged) {
+	SinglyLinkedList<int> otherSinglyLinkedList {};
+	singlyLinkedList.splice(otherSinglyLinkedList);
+	
+	EXPECT_THAT(singlyLinkedList, testing::ElementsAre(10, 20, 30, 40, 50));
+	EXPECT_THAT(singlyLinkedList.getNodeCount(), testing::Eq(5));
+}
+
+TEST_F(NonEmptyIntegerSinglyLinkedListTest, GivenSortedIntegerList_WhenMerge_ThenElementsAreMergedInOrder) {
+	SinglyLinkedList<int> otherSinglyLinkedList {};
+	otherSinglyLinkedList.insertAtTail(5);
+	otherSinglyLinkedList.insertAtTail(30);
+	otherSinglyLinkedList.insertAtTail(45);
+	otherSinglyLinkedList.insertAtTail(60);
+	singlyLinkedList.merge(otherSinglyLinkedList, std::less<int> {});
+	singlyLinkedList.insertAtTail(70);
+	
+	EXPECT_THAT(singlyLinkedList, testing::ElementsAre(5, 10, 20, 30, 30, 40, 45, 50, 60, 70));
+	EXPECT_THAT(singlyLinkedList.getNodeCount(), testing::Eq(10));
+	EXPECT_THAT(otherSinglyLinkedList.isEmpty(), testing::IsTrue());
+}
 }
\ No newline at end of file
@@ -1,5 +1,9 @@
 #include <gmock/gmock.h>
 
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <stdexcept>
 #include <vector>
 
 #include "DataStructures/Trees/AVLTree.hpp"
@@ -169,4 +173,111 @@ TEST_F(EmptyIntegerAVLTreeTest, WhenGetHeight_ThenReturnsNegativeOne) {
 	
 	EXPECT_THAT(result, testing::Eq(-1));
 }
+
+TEST_F(EmptyIntegerAVLTreeTest, GivenIndex_WhenSelect_ThenReturnsNullOptional) {
+	const auto result {avlTree.select(0)};
+	
+	EXPECT_THAT(result, testing::Eq(std::nullopt));
+}
+
+TEST_F(EmptyIntegerAVLTreeTest, GivenInteger_WhenRank_ThenReturnsZero) {
+	const auto result {avlTree.rank(10)};
+	
+	EXPECT_THAT(result, testing::Eq(0));
+}
+
+TEST_F(EmptyIntegerAVLTreeTest, GivenBounds_WhenCountInRange_ThenReturnsZero) {
+	const auto result {avlTree.countInRange(-10, 10)};
+	
+	EXPECT_THAT(result, testing::Eq(0));
+}
+
+TEST_F(EmptyIntegerAVLTreeTest, GivenInteger_WhenEqualRange_ThenReturnsEmptyRange) {
+	const auto [first, last] {avlTree.equalRange(10)};
+	
+	EXPECT_THAT(first, testing::Eq(avlTree.cendInOrder()));
+	EXPECT_THAT(last, testing::Eq(avlTree.cendInOrder()));
+}
+
+TEST_F(EmptyIntegerAVLTreeTest, GivenSortedIntegers_WhenBuildFromSorted_ThenAVLTreeIsPerfectlyBalanced) {
+	std::vector<int> sortedElements(1000);
+	std::iota(sortedElements.begin(), sortedElements.end(), -500);
+	sortedElements[1] = sortedElements[0];
+	
+	const AVLTree<int> builtAVLTree {sortedElements};
+	
+	EXPECT_THAT(std::vector<int>(builtAVLTree.cbeginInOrder(), builtAVLTree.cendInOrder()),
+	            testing::ElementsAreArray(sortedElements));
+	EXPECT_THAT(builtAVLTree.getNodeCount(), testing::Eq(1000));
+	EXPECT_THAT(builtAVLTree.getHeight(), testing::Eq(9));
+	EXPECT_THAT(builtAVLTree.select(700), testing::Optional(200));
+}
+
+TEST_F(EmptyIntegerAVLTreeTest, GivenBuiltAVLTree_WhenInsertAndRemoveEveryElement_ThenAVLTreeIsEmpty) {
+	std::vector<int> sortedElements(500);
+	std::iota(sortedElements.begin(), sortedElements.end(), 0);
+	
+	AVLTree<int> builtAVLTree {sortedElements};
+	for (auto element {0}; element < 500; element += 2) {
+		builtAVLTree.insert(element);
+	}
+	
+	for (auto element {0}; element < 500; ++element) {
+		EXPECT_THAT(builtAVLTree.removeFirst(element), testing::Optional(element));
+	}
+	
+	for (auto element {0}; element < 500; element += 2) {
+		EXPECT_THAT(builtAVLTree.removeMinimum(), testing::Optional(element));
+	}
+	
+	EXPECT_THAT(builtAVLTree.isEmpty(), testing::IsTrue());
+}
+
+TEST_F(EmptyIntegerAVLTreeTest,
+       GivenIntegersInAscendingOrder_WhenInsertAndRemoveFromBothEnds_ThenAVLTreeStaysBalanced) {
+	constexpr auto elementCount {1 << 16};
+	for (auto element {0}; element < elementCount; ++element) {
+		avlTree.insert(element);
+	}
+	
+	EXPECT_THAT(avlTree.getHeight(), testing::Eq(16));
+	
+	for (auto element {0}; element < elementCount / 4; ++element) {
+		EXPECT_THAT(avlTree.removeMinimum(), testing::Optional(element));
+		EXPECT_THAT(avlTree.removeMaximum(), testing::Optional(elementCount - 1 - element));
+	}
+	
+	EXPECT_THAT(avlTree.getNodeCount(), testing::Eq(elementCount / 2));
+	EXPECT_THAT(avlTree.getHeight(), testing::Le(static_cast<int>(1.44 * std::log2(elementCount / 2))));
+	EXPECT_THAT(avlTree.select(0), testing::Optional(elementCount / 4));
+	EXPECT_THAT(avlTree.rank(elementCount / 2), testing::Eq(elementCount / 4));
+}
+
+TEST_F(EmptyIntegerAVLTreeTest,
+       GivenManySortedIntegersAndThreads_WhenBuildFromSorted_ThenEqualsSequentiallyBuiltAVLTree) {
+	std::vector<int> sortedElements(1 << 18);
+	std::iota(sortedElements.begin(), sortedElements.end(), 0);
+	
+	const AVLTree<int> sequentiallyBuiltAVLTree {sortedElements};
+	const AVLTree<int> concurrentlyBuiltAVLTree {sortedElements, 4};
+	
+	EXPECT_THAT(concurrentlyBuiltAVLTree, testing::Eq(sequentiallyBuiltAVLTree));
+	EXPECT_THAT(std::equal(concurrentlyBuiltAVLTree.cbeginLevelOrder(),
+	                       concurrentlyBuiltAVLTree.cendLevelOrder(),
+	                       sequentiallyBuiltAVLTree.cbeginLevelOrder()),
+	            testing::IsTrue());
+	EXPECT_THAT(concurrentlyBuiltAVLTree.getHeight(), testing::Eq(18));
+}
+
+TEST_F(EmptyIntegerAVLTreeTest, GivenNoElements_WhenBuildFromSorted_ThenAVLTreeIsEmpty) {
+	const AVLTree<int> builtAVLTree {std::vector<int> {}};
+	
+	EXPECT_THAT(builtAVLTree, testing::Eq(avlTree));
+}
+
+TEST_F(EmptyIntegerAVLTreeTest, GivenUnsortedIntegers_WhenBuildFromSorted_ThenThrowsInvalidArgument) {
+	const std::vector<int> unsortedElements {1, 3, 2};
+	
+	EXPECT_THROW((AVLTree<int> {unsortedElements}), std::invalid_argument);
+}
 }
\ No newline at end of file
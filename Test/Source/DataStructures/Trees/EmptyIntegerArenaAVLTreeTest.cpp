@@ -0,0 +1,84 @@
+#include <gmock/gmock.h>
+
+#include <cmath>
+#include <vector>
+
+#include "DataStructures/Trees/ArenaAVLTree.hpp"
+
+namespace Core::DataStructures::Trees::Test {
+class EmptyIntegerArenaAVLTreeTest : public testing::Test {
+public:
+	EmptyIntegerArenaAVLTreeTest() noexcept = default;
+	~EmptyIntegerArenaAVLTreeTest() noexcept override = default;
+
+protected:
+	ArenaAVLTree<int> arenaAVLTree {};
+};
+
+TEST_F(EmptyIntegerArenaAVLTreeTest, GivenTwoEmptyIntegerArenaAVLTrees_WhenCompare_ThenReturnsTrue) {
+	ArenaAVLTree<int> otherArenaAVLTree {};
+	
+	EXPECT_THAT(arenaAVLTree, testing::Eq(otherArenaAVLTree));
+}
+
+TEST_F(EmptyIntegerArenaAVLTreeTest, GivenInteger_WhenInsert_ThenSizeIsIncremented) {
+	arenaAVLTree.insert(10);
+	
+	EXPECT_THAT(arenaAVLTree.getNodeCount(), testing::Eq(1));
+	EXPECT_THAT(arenaAVLTree.findFirst(10), testing::Optional(10));
+}
+
+TEST_F(EmptyIntegerArenaAVLTreeTest, GivenIntegersInAscendingOrder_WhenInsert_ThenRotationsKeepArenaAVLTreeBalanced) {
+	for (auto element {0}; element < 1000; ++element) {
+		arenaAVLTree.insert(element);
+	}
+	
+	std::vector<int> expectedElements(1000);
+	for (auto element {0}; element < 1000; ++element) {
+		expectedElements[element] = element;
+	}
+	
+	EXPECT_THAT(std::vector<int>(arenaAVLTree.cbeginInOrder(), arenaAVLTree.cendInOrder()),
+	            testing::ElementsAreArray(expectedElements));
+	EXPECT_THAT(arenaAVLTree.getHeight(), testing::Le(static_cast<int>(1.44 * std::log2(1000))));
+}
+
+TEST_F(EmptyIntegerArenaAVLTreeTest, WhenRemove_ThenReturnsNullOptional) {
+	EXPECT_THAT(arenaAVLTree.removeFirst(10), testing::Eq(std::nullopt));
+	EXPECT_THAT(arenaAVLTree.removeMinimum(), testing::Eq(std::nullopt));
+	EXPECT_THAT(arenaAVLTree.removeMaximum(), testing::Eq(std::nullopt));
+	EXPECT_THAT(arenaAVLTree.removeAll(), testing::IsEmpty());
+}
+
+TEST_F(EmptyIntegerArenaAVLTreeTest, WhenFind_ThenReturnsNullOptional) {
+	EXPECT_THAT(arenaAVLTree.findFirst(10), testing::Eq(std::nullopt));
+	EXPECT_THAT(arenaAVLTree.findMinimum(), testing::Eq(std::nullopt));
+	EXPECT_THAT(arenaAVLTree.findMaximum(), testing::Eq(std::nullopt));
+	EXPECT_THAT(arenaAVLTree.contains(10), testing::IsFalse());
+}
+
+TEST_F(EmptyIntegerArenaAVLTreeTest, WhenGetHeight_ThenReturnsNegativeOne) {
+	const auto result {arenaAVLTree.getHeight()};
+	
+	EXPECT_THAT(result, testing::Eq(-1));
+}
+
+TEST_F(EmptyIntegerArenaAVLTreeTest, GivenReservedNodes_WhenInsert_ThenArenaIsNotReallocated) {
+	arenaAVLTree.reserve(100);
+	const auto memoryUsage {arenaAVLTree.getMemoryUsage()};
+	
+	arenaAVLTree.insert(0);
+	const auto* firstElement {&*arenaAVLTree.cbeginInOrder()};
+	for (auto element {1}; element < 100; ++element) {
+		arenaAVLTree.insert(element);
+	}
+	
+	EXPECT_THAT(arenaAVLTree.getMemoryUsage(), testing::Eq(memoryUsage));
+	EXPECT_THAT(&*arenaAVLTree.cbeginInOrder(), testing::Eq(firstElement));
+	EXPECT_THAT(memoryUsage, testing::Eq(100 * sizeof(ArenaAVLTreeNode<int>)));
+}
+
+TEST_F(EmptyIntegerArenaAVLTreeTest, GivenIntegerNode_WhenSizeOf_ThenNodeTakesSixteenBytes) {
+	EXPECT_THAT(sizeof(ArenaAVLTreeNode<int>), testing::Eq(16));
+}
+}
\ No newline at end of file
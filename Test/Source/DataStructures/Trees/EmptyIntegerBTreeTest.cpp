@@ -0,0 +1,159 @@
+#include <gmock/gmock.h>
+
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "DataStructures/Trees/BTree.hpp"
+
+namespace Core::DataStructures::Trees::Test {
+class EmptyIntegerBTreeTest : public testing::Test {
+public:
+	EmptyIntegerBTreeTest() noexcept = default;
+	~EmptyIntegerBTreeTest() noexcept override = default;
+
+protected:
+	BTree<int, int, 64> bTree {};
+};
+
+TEST_F(EmptyIntegerBTreeTest, GivenTwoEmptyIntegerBTrees_WhenCompare_ThenReturnsTrue) {
+	BTree<int, int, 64> otherBTree {};
+	
+	EXPECT_THAT(bTree == otherBTree, testing::IsTrue());
+}
+
+TEST_F(EmptyIntegerBTreeTest, GivenKeyAndValue_WhenInsert_ThenSizeIsIncremented) {
+	bTree.insert(10, 100);
+	const auto size {bTree.getNodeCount()};
+	
+	EXPECT_THAT(size, testing::Eq(1));
+}
+
+TEST_F(EmptyIntegerBTreeTest, GivenKeysInDescendingOrder_WhenInsert_ThenIteratesInAscendingOrder) {
+	for (auto key {99}; key >= 0; --key) {
+		bTree.insert(key, key * 10);
+	}
+	
+	std::vector<std::pair<int, int>> pairs {};
+	for (auto iterator {bTree.cbegin()}; iterator != bTree.cend(); ++iterator) {
+		pairs.emplace_back((*iterator).first, (*iterator).second);
+	}
+	
+	std::vector<std::pair<int, int>> expected {};
+	for (auto key {0}; key < 100; ++key) {
+		expected.emplace_back(key, key * 10);
+	}
+	
+	EXPECT_THAT(pairs, testing::ElementsAreArray(expected));
+}
+
+TEST_F(EmptyIntegerBTreeTest, GivenManyKeys_WhenInsert_ThenLevelCountIsLogarithmic) {
+	for (auto key {0}; key < 1000; ++key) {
+		bTree.insert(key, key);
+	}
+	
+	EXPECT_THAT(bTree.getLevelCount(), testing::AllOf(testing::Gt(1), testing::Le(8)));
+}
+
+TEST_F(EmptyIntegerBTreeTest, WhenRemoveFirst_ThenReturnsNullOptional) {
+	const auto removedValue {bTree.removeFirst(10)};
+	
+	EXPECT_THAT(removedValue, testing::Eq(std::nullopt));
+}
+
+TEST_F(EmptyIntegerBTreeTest, WhenRemoveMinimum_ThenReturnsNullOptional) {
+	const auto removedPair {bTree.removeMinimum()};
+	
+	EXPECT_THAT(removedPair, testing::Eq(std::nullopt));
+}
+
+TEST_F(EmptyIntegerBTreeTest, WhenRemoveMaximum_ThenReturnsNullOptional) {
+	const auto removedPair {bTree.removeMaximum()};
+	
+	EXPECT_THAT(removedPair, testing::Eq(std::nullopt));
+}
+
+TEST_F(EmptyIntegerBTreeTest, WhenFindFirst_ThenReturnsNullOptional) {
+	const auto value {bTree.findFirst(10)};
+	
+	EXPECT_THAT(value, testing::Eq(std::nullopt));
+}
+
+TEST_F(EmptyIntegerBTreeTest, WhenFindMinimum_ThenReturnsNullOptional) {
+	const auto pair {bTree.findMinimum()};
+	
+	EXPECT_THAT(pair, testing::Eq(std::nullopt));
+}
+
+TEST_F(EmptyIntegerBTreeTest, WhenForEachInRange_ThenFunctionIsNotApplied) {
+	std::size_t count {0};
+	
+	bTree.forEachInRange(0, 100, [&count](const int&, const int&) {
+		++count;
+	});
+	
+	EXPECT_THAT(count, testing::Eq(0));
+}
+
+TEST_F(EmptyIntegerBTreeTest, WhenIsEmpty_ThenReturnsTrue) {
+	const auto isEmpty {bTree.isEmpty()};
+	
+	EXPECT_THAT(isEmpty, testing::IsTrue());
+}
+
+TEST_F(EmptyIntegerBTreeTest, WhenGetLevelCount_ThenReturnsZero) {
+	const auto levelCount {bTree.getLevelCount()};
+	
+	EXPECT_THAT(levelCount, testing::Eq(0));
+}
+
+TEST_F(EmptyIntegerBTreeTest, GivenSortedPairs_WhenBulkLoad_ThenIteratesInAscendingOrder) {
+	std::vector<std::pair<int, int>> sortedPairs {};
+	for (auto key {0}; key < 1001; ++key) {
+		sortedPairs.emplace_back(key * 2, key);
+	}
+	
+	const BTree<int, int, 64> loadedBTree {sortedPairs};
+	
+	std::vector<std::pair<int, int>> pairs {};
+	for (auto iterator {loadedBTree.cbegin()}; iterator != loadedBTree.cend(); ++iterator) {
+		pairs.emplace_back((*iterator).first, (*iterator).second);
+	}
+	
+	EXPECT_THAT(pairs, testing::ElementsAreArray(sortedPairs));
+	EXPECT_THAT(loadedBTree.findFirst(1000), testing::Optional(500));
+	EXPECT_THAT(loadedBTree.findFirst(1001), testing::Eq(std::nullopt));
+}
+
+TEST_F(EmptyIntegerBTreeTest, GivenBulkLoadedBTree_WhenRemoveAllKeys_ThenBTreeIsEmpty) {
+	std::vector<std::pair<int, int>> sortedPairs {};
+	for (auto key {0}; key < 500; ++key) {
+		sortedPairs.emplace_back(key, key);
+	}
+	
+	BTree<int, int, 64> loadedBTree {sortedPairs};
+	for (auto key {0}; key < 500; key += 2) {
+		loadedBTree.removeFirst(key);
+	}
+	
+	for (auto key {1}; key < 500; key += 2) {
+		EXPECT_THAT(loadedBTree.removeFirst(key), testing::Optional(key));
+	}
+	
+	EXPECT_THAT(loadedBTree.isEmpty(), testing::IsTrue());
+	EXPECT_THAT(loadedBTree.getLevelCount(), testing::Eq(0));
+	EXPECT_THAT(loadedBTree.getMemoryUsage(), testing::Eq(0));
+}
+
+TEST_F(EmptyIntegerBTreeTest, GivenUnsortedPairs_WhenBulkLoad_ThenThrowsInvalidArgument) {
+	const std::vector<std::pair<int, int>> unsortedPairs {{1, 1}, {3, 3}, {2, 2}};
+	
+	EXPECT_THROW((BTree<int, int, 64> {unsortedPairs}), std::invalid_argument);
+}
+
+TEST_F(EmptyIntegerBTreeTest, GivenDuplicateKeys_WhenBulkLoad_ThenThrowsInvalidArgument) {
+	const std::vector<std::pair<int, int>> duplicatePairs {{1, 1}, {1, 2}};
+	
+	EXPECT_THROW((BTree<int, int, 64> {duplicatePairs}), std::invalid_argument);
+}
+}
\ No newline at end of file
@@ -1,5 +1,12 @@
 #include <gmock/gmock.h>
 
+#include <numeric>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <pthread.h>
+#endif
+
 #include "DataStructures/Trees/BinarySearchTree.hpp"
 
 namespace Core::DataStructures::Trees::Test {
@@ -9,9 +16,31 @@ public:
 	~EmptyIntegerBinarySearchTreeTest() noexcept override = default;
 
 protected:
+#if defined(__unix__) || defined(__APPLE__)
+	template<typename Function>
+	static void invokeOnSmallStack(Function& function);
+#endif
+	
 	BinarySearchTree<int> binarySearchTree {};
 };
 
+#if defined(__unix__) || defined(__APPLE__)
+template<typename Function>
+void EmptyIntegerBinarySearchTreeTest::invokeOnSmallStack(Function& function) {
+	pthread_attr_t threadAttributes {};
+	ASSERT_THAT(pthread_attr_init(&threadAttributes), testing::Eq(0));
+	ASSERT_THAT(pthread_attr_setstacksize(&threadAttributes, 1 << 17), testing::Eq(0));
+	
+	pthread_t thread {};
+	ASSERT_THAT(pthread_create(&thread, &threadAttributes, [](void* argument) -> void* {
+		(*static_cast<Function*>(argument))();
+		return nullptr;
+	}, &function), testing::Eq(0));
+	ASSERT_THAT(pthread_join(thread, nullptr), testing::Eq(0));
+	ASSERT_THAT(pthread_attr_destroy(&threadAttributes), testing::Eq(0));
+}
+#endif
+
 TEST_F(EmptyIntegerBinarySearchTreeTest, GivenTwoEmptyIntegerBinarySearchTrees_WhenCompare_ThenReturnsTrue) {
 	BinarySearchTree<int> otherBinarySearchTree {};
 	
@@ -99,4 +128,70 @@ TEST_F(EmptyIntegerBinarySearchTreeTest, WhenGetHeight_ThenReturnsNegativeOne) {
 	
 	EXPECT_THAT(result, testing::Eq(-1));
 }
+
+TEST_F(EmptyIntegerBinarySearchTreeTest, GivenIndex_WhenSelect_ThenReturnsNullOptional) {
+	const auto result {binarySearchTree.select(0)};
+	
+	EXPECT_THAT(result, testing::Eq(std::nullopt));
+}
+
+TEST_F(EmptyIntegerBinarySearchTreeTest, GivenInteger_WhenRank_ThenReturnsZero) {
+	const auto result {binarySearchTree.rank(10)};
+	
+	EXPECT_THAT(result, testing::Eq(0));
+}
+
+TEST_F(EmptyIntegerBinarySearchTreeTest, GivenBounds_WhenCountInRange_ThenReturnsZero) {
+	const auto result {binarySearchTree.countInRange(-10, 10)};
+	
+	EXPECT_THAT(result, testing::Eq(0));
+}
+
+TEST_F(EmptyIntegerBinarySearchTreeTest, GivenInteger_WhenLowerBound_ThenReturnsEndIterator) {
+	const auto result {binarySearchTree.lowerBound(10)};
+	
+	EXPECT_THAT(result, testing::Eq(binarySearchTree.cendInOrder()));
+}
+
+TEST_F(EmptyIntegerBinarySearchTreeTest, GivenBounds_WhenForEachInRange_ThenFunctionIsNotApplied) {
+	std::vector<int> elements {};
+	
+	binarySearchTree.forEachInRange(-10, 10, [&elements](const auto& element) {
+		elements.push_back(element);
+	});
+	
+	EXPECT_THAT(elements, testing::IsEmpty());
+}
+
+TEST_F(EmptyIntegerBinarySearchTreeTest,
+       GivenIntegersInAscendingOrder_WhenCopyAndRemoveAllOnSmallStack_ThenDegenerateTreeIsCopiedAndRemovedInPostOrder) {
+#if defined(__unix__) || defined(__APPLE__)
+	constexpr auto elementCount {1 << 14};
+	for (auto element {0}; element < elementCount; ++element) {
+		binarySearchTree.insert(element);
+	}
+	
+	std::vector<int> expectedElements(elementCount);
+	std::iota(expectedElements.rbegin(), expectedElements.rend(), 0);
+	
+	int copiedHeight {};
+	bool isCopyEqual {};
+	std::vector<int> removedElements {};
+	auto copyAndRemoveAll {[&]() {
+		const auto copiedBinarySearchTree {binarySearchTree};
+		copiedHeight = copiedBinarySearchTree.getHeight();
+		isCopyEqual = copiedBinarySearchTree == binarySearchTree;
+		removedElements = binarySearchTree.removeAll();
+	}};
+	
+	ASSERT_NO_FATAL_FAILURE(invokeOnSmallStack(copyAndRemoveAll));
+	
+	EXPECT_THAT(copiedHeight, testing::Eq(elementCount - 1));
+	EXPECT_THAT(isCopyEqual, testing::IsTrue());
+	EXPECT_THAT(removedElements, testing::ElementsAreArray(expectedElements));
+	EXPECT_THAT(binarySearchTree.isEmpty(), testing::IsTrue());
+#else
+	GTEST_SKIP() << "Setting the thread stack size requires POSIX threads.";
+#endif
+}
 }
\ No newline at end of file
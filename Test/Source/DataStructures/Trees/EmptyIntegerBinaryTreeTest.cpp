@@ -1,5 +1,9 @@
 #include <gmock/gmock.h>
 
+#include <cstdint>
+#include <numeric>
+#include <vector>
+
 #include "DataStructures/Trees/BinaryTree.hpp"
 #include "IntegerPredicates.hpp"
 
@@ -82,4 +86,77 @@ TEST_F(EmptyIntegerBinaryTreeTest, WhenGetHeight_ThenReturnsNegativeOne) {
 	
 	EXPECT_THAT(height, testing::Eq(-1));
 }
+
+TEST_F(EmptyIntegerBinaryTreeTest, GivenManyIntegers_WhenInsertAndRemoveFirst_ThenBinaryTreeStaysComplete) {
+	for (auto element {0}; element < 1023; ++element) {
+		binaryTree.insert(element);
+	}
+	
+	std::vector<int> expectedElements(1023);
+	std::iota(expectedElements.begin(), expectedElements.end(), 0);
+	
+	EXPECT_THAT(std::vector<int>(binaryTree.cbeginLevelOrder(), binaryTree.cendLevelOrder()),
+	            testing::ElementsAreArray(expectedElements));
+	EXPECT_THAT(*binaryTree.cbeginInOrder(), testing::Eq(511));
+	EXPECT_THAT(binaryTree.getHeight(), testing::Eq(9));
+	
+	EXPECT_THAT(binaryTree.removeFirst([](const auto& element) {
+		return element == 0;
+	}), testing::Optional(0));
+	
+	const auto copiedBinaryTree {binaryTree};
+	binaryTree.insert(1023);
+	binaryTree.insert(1024);
+	
+	expectedElements.front() = 1022;
+	expectedElements.pop_back();
+	
+	EXPECT_THAT(std::vector<int>(copiedBinaryTree.cbeginLevelOrder(), copiedBinaryTree.cendLevelOrder()),
+	            testing::ElementsAreArray(expectedElements));
+	EXPECT_THAT(std::vector<int>(binaryTree.cbeginPreOrder(), binaryTree.cendPreOrder()).size(), testing::Eq(1024));
+	EXPECT_THAT(binaryTree.getHeight(), testing::Eq(10));
+	EXPECT_THAT(binaryTree.removeAll().back(), testing::Eq(1022));
+}
+
+TEST_F(EmptyIntegerBinaryTreeTest, GivenFullStorage_WhenInsert_ThenStorageIsReallocatedAndAllTraversalsStayValid) {
+	binaryTree.insert(0);
+	const auto initialRootAddress {reinterpret_cast<std::uintptr_t>(&*binaryTree.cbeginLevelOrder())};
+	
+	auto size {1};
+	while (size < 1024 && reinterpret_cast<std::uintptr_t>(&*binaryTree.cbeginLevelOrder()) == initialRootAddress) {
+		binaryTree.insert(size++);
+	}
+	
+	ASSERT_THAT(reinterpret_cast<std::uintptr_t>(&*binaryTree.cbeginLevelOrder()), testing::Ne(initialRootAddress));
+	
+	binaryTree.insert(size++);
+	
+	std::vector<int> expectedLevelOrder(size);
+	std::iota(expectedLevelOrder.begin(), expectedLevelOrder.end(), 0);
+	std::vector<int> expectedPreOrder {};
+	std::vector<int> expectedInOrder {};
+	std::vector<int> expectedPostOrder {};
+	
+	const auto traverse {[&](const auto& self, const int index) -> void {
+		if (index >= size) {
+			return;
+		}
+		
+		expectedPreOrder.push_back(index);
+		self(self, 2 * index + 1);
+		expectedInOrder.push_back(index);
+		self(self, 2 * index + 2);
+		expectedPostOrder.push_back(index);
+	}};
+	traverse(traverse, 0);
+	
+	EXPECT_THAT(std::vector<int>(binaryTree.cbeginLevelOrder(), binaryTree.cendLevelOrder()),
+	            testing::ElementsAreArray(expectedLevelOrder));
+	EXPECT_THAT(std::vector<int>(binaryTree.cbeginPreOrder(), binaryTree.cendPreOrder()),
+	            testing::ElementsAreArray(expectedPreOrder));
+	EXPECT_THAT(std::vector<int>(binaryTree.cbeginInOrder(), binaryTree.cendInOrder()),
+	            testing::ElementsAreArray(expectedInOrder));
+	EXPECT_THAT(std::vector<int>(binaryTree.cbeginPostOrder(), binaryTree.cendPostOrder()),
+	            testing::ElementsAreArray(expectedPostOrder));
+}
 }
\ No newline at end of file
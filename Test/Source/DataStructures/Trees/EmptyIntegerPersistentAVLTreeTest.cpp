@@ -0,0 +1,79 @@
+#include <gmock/gmock.h>
+
+#include <vector>
+
+#include "DataStructures/Trees/PersistentAVLTree.hpp"
+
+namespace Core::DataStructures::Trees::Test {
+class EmptyIntegerPersistentAVLTreeTest : public testing::Test {
+public:
+	EmptyIntegerPersistentAVLTreeTest() noexcept = default;
+	~EmptyIntegerPersistentAVLTreeTest() noexcept override = default;
+
+protected:
+	PersistentAVLTree<int> persistentAVLTree {};
+};
+
+TEST_F(EmptyIntegerPersistentAVLTreeTest, GivenTwoEmptyIntegerPersistentAVLTrees_WhenCompare_ThenReturnsTrue) {
+	PersistentAVLTree<int> otherPersistentAVLTree {};
+	
+	EXPECT_THAT(persistentAVLTree, testing::Eq(otherPersistentAVLTree));
+}
+
+TEST_F(EmptyIntegerPersistentAVLTreeTest, GivenInteger_WhenInsert_ThenOnlyNewVersionContainsInteger) {
+	const auto newPersistentAVLTree {persistentAVLTree.insert(10)};
+	
+	EXPECT_THAT(newPersistentAVLTree.getNodeCount(), testing::Eq(1));
+	EXPECT_THAT(*newPersistentAVLTree.cbeginLevelOrder(), testing::Eq(10));
+	EXPECT_THAT(persistentAVLTree.isEmpty(), testing::IsTrue());
+}
+
+TEST_F(EmptyIntegerPersistentAVLTreeTest, GivenIntegersInAscendingOrder_WhenInsert_ThenRotationsKeepAVLTreeBalanced) {
+	for (auto element {0}; element < 1023; ++element) {
+		persistentAVLTree = persistentAVLTree.insert(element);
+	}
+	
+	std::vector<int> elements {};
+	persistentAVLTree.traverse(persistentAVLTree.cbeginInOrder(),
+	                           persistentAVLTree.cendInOrder(),
+	                           [&elements](const int& element) {
+		                           elements.push_back(element);
+	                           });
+	
+	EXPECT_THAT(elements.size(), testing::Eq(1023));
+	EXPECT_THAT(std::ranges::is_sorted(elements), testing::IsTrue());
+	EXPECT_THAT(persistentAVLTree.getHeight(), testing::Eq(9));
+}
+
+TEST_F(EmptyIntegerPersistentAVLTreeTest,
+       GivenIntegersLeftRightAndRightLeft_WhenInsert_ThenElementsAreInExpectedOrder) {
+	const auto leftRightPersistentAVLTree {persistentAVLTree.insert(30).insert(10).insert(20)};
+	const auto rightLeftPersistentAVLTree {persistentAVLTree.insert(10).insert(30).insert(20)};
+	
+	EXPECT_THAT(std::vector<int>(leftRightPersistentAVLTree.cbeginLevelOrder(),
+	                             leftRightPersistentAVLTree.cendLevelOrder()),
+	            testing::ElementsAre(20, 10, 30));
+	EXPECT_THAT(std::vector<int>(rightLeftPersistentAVLTree.cbeginLevelOrder(),
+	                             rightLeftPersistentAVLTree.cendLevelOrder()),
+	            testing::ElementsAre(20, 10, 30));
+}
+
+TEST_F(EmptyIntegerPersistentAVLTreeTest, WhenRemove_ThenReturnsEmptyVersion) {
+	EXPECT_THAT(persistentAVLTree.removeFirst(10).isEmpty(), testing::IsTrue());
+	EXPECT_THAT(persistentAVLTree.removeMinimum().isEmpty(), testing::IsTrue());
+	EXPECT_THAT(persistentAVLTree.removeMaximum().isEmpty(), testing::IsTrue());
+}
+
+TEST_F(EmptyIntegerPersistentAVLTreeTest, WhenFind_ThenReturnsNullOptional) {
+	EXPECT_THAT(persistentAVLTree.findFirst(10), testing::Eq(std::nullopt));
+	EXPECT_THAT(persistentAVLTree.findMinimum(), testing::Eq(std::nullopt));
+	EXPECT_THAT(persistentAVLTree.findMaximum(), testing::Eq(std::nullopt));
+	EXPECT_THAT(persistentAVLTree.select(0), testing::Eq(std::nullopt));
+}
+
+TEST_F(EmptyIntegerPersistentAVLTreeTest, WhenGetHeight_ThenReturnsNegativeOne) {
+	const auto result {persistentAVLTree.getHeight()};
+	
+	EXPECT_THAT(result, testing::Eq(-1));
+}
+}
\ No newline at end of file
@@ -0,0 +1,184 @@
+#include <gmock/gmock.h>
+
+#include <vector>
+
+#include "DataStructures/Trees/RedBlackTree.hpp"
+
+namespace Core::DataStructures::Trees::Test {
+class EmptyIntegerRedBlackTreeTest : public testing::Test {
+public:
+	EmptyIntegerRedBlackTreeTest() noexcept = default;
+	~EmptyIntegerRedBlackTreeTest() noexcept override = default;
+
+protected:
+	RedBlackTree<int> redBlackTree {};
+};
+
+TEST_F(EmptyIntegerRedBlackTreeTest, GivenTwoEmptyIntegerRedBlackTrees_WhenCompare_ThenReturnsTrue) {
+	RedBlackTree<int> otherRedBlackTree {};
+	
+	EXPECT_THAT(redBlackTree, testing::Eq(otherRedBlackTree));
+}
+
+TEST_F(EmptyIntegerRedBlackTreeTest, GivenInteger_WhenInsert_ThenElementsAreInExpectedOrder) {
+	redBlackTree.insert(10);
+	
+	auto iterator {redBlackTree.cbeginLevelOrder()};
+	
+	EXPECT_THAT(*iterator, testing::Eq(10));
+}
+
+TEST_F(EmptyIntegerRedBlackTreeTest, GivenInteger_WhenInsert_ThenSizeIsIncremented) {
+	redBlackTree.insert(10);
+	const auto size {redBlackTree.getNodeCount()};
+	
+	EXPECT_THAT(size, testing::Eq(1));
+}
+
+TEST_F(EmptyIntegerRedBlackTreeTest,
+       GivenInteger_WhenInsertAndLeftRotationIsPerformed_ThenElementsAreInExpectedOrder) {
+	redBlackTree.insert(10);
+	redBlackTree.insert(20);
+	redBlackTree.insert(30);
+	
+	std::vector<int> elements {};
+	for (auto iterator {redBlackTree.cbeginLevelOrder()}; iterator != redBlackTree.cendLevelOrder(); ++iterator) {
+		elements.push_back(*iterator);
+	}
+	
+	EXPECT_THAT(elements, testing::ElementsAre(20, 10, 30));
+}
+
+TEST_F(EmptyIntegerRedBlackTreeTest,
+       GivenInteger_WhenInsertAndRightRotationIsPerformed_ThenElementsAreInExpectedOrder) {
+	redBlackTree.insert(30);
+	redBlackTree.insert(20);
+	redBlackTree.insert(10);
+	
+	std::vector<int> elements {};
+	for (auto iterator {redBlackTree.cbeginLevelOrder()}; iterator != redBlackTree.cendLevelOrder(); ++iterator) {
+		elements.push_back(*iterator);
+	}
+	
+	EXPECT_THAT(elements, testing::ElementsAre(20, 10, 30));
+}
+
+TEST_F(EmptyIntegerRedBlackTreeTest,
+       GivenInteger_WhenInsertAndLeftAndRightRotationsArePerformed_ThenElementsAreInExpectedOrder) {
+	redBlackTree.insert(30);
+	redBlackTree.insert(10);
+	redBlackTree.insert(20);
+	
+	std::vector<int> elements {};
+	for (auto iterator {redBlackTree.cbeginLevelOrder()}; iterator != redBlackTree.cendLevelOrder(); ++iterator) {
+		elements.push_back(*iterator);
+	}
+	
+	EXPECT_THAT(elements, testing::ElementsAre(20, 10, 30));
+}
+
+TEST_F(EmptyIntegerRedBlackTreeTest,
+       GivenInteger_WhenInsertAndRightAndLeftRotationsArePerformed_ThenElementsAreInExpectedOrder) {
+	redBlackTree.insert(10);
+	redBlackTree.insert(30);
+	redBlackTree.insert(20);
+	
+	std::vector<int> elements {};
+	for (auto iterator {redBlackTree.cbeginLevelOrder()}; iterator != redBlackTree.cendLevelOrder(); ++iterator) {
+		elements.push_back(*iterator);
+	}
+	
+	EXPECT_THAT(elements, testing::ElementsAre(20, 10, 30));
+}
+
+TEST_F(EmptyIntegerRedBlackTreeTest, GivenAscendingIntegers_WhenInsert_ThenHeightIsLogarithmic) {
+	for (auto element {0}; element < 1023; ++element) {
+		redBlackTree.insert(element);
+	}
+	
+	const auto height {redBlackTree.getHeight()};
+	
+	EXPECT_THAT(height, testing::Le(2 * 10));
+}
+
+TEST_F(EmptyIntegerRedBlackTreeTest, GivenInteger_WhenRemoveFirst_ThenReturnsNullOptional) {
+	const auto result {redBlackTree.removeFirst(10)};
+	
+	EXPECT_THAT(result, testing::Eq(std::nullopt));
+}
+
+TEST_F(EmptyIntegerRedBlackTreeTest, GivenInteger_WhenRemoveFirst_ThenSizeIsNotDecremented) {
+	redBlackTree.removeFirst(10);
+	const auto size {redBlackTree.getNodeCount()};
+	
+	EXPECT_THAT(size, testing::Eq(0));
+}
+
+TEST_F(EmptyIntegerRedBlackTreeTest, WhenRemoveMinimum_ThenReturnsNullOptional) {
+	const auto result {redBlackTree.removeMinimum()};
+	
+	EXPECT_THAT(result, testing::Eq(std::nullopt));
+}
+
+TEST_F(EmptyIntegerRedBlackTreeTest, WhenRemoveMinimum_ThenSizeIsNotDecremented) {
+	redBlackTree.removeMinimum();
+	const auto size {redBlackTree.getNodeCount()};
+	
+	EXPECT_THAT(size, testing::Eq(0));
+}
+
+TEST_F(EmptyIntegerRedBlackTreeTest, WhenRemoveMaximum_ThenReturnsNullOptional) {
+	const auto result {redBlackTree.removeMaximum()};
+	
+	EXPECT_THAT(result, testing::Eq(std::nullopt));
+}
+
+TEST_F(EmptyIntegerRedBlackTreeTest, WhenRemoveMaximum_ThenSizeIsNotDecremented) {
+	redBlackTree.removeMaximum();
+	const auto size {redBlackTree.getNodeCount()};
+	
+	EXPECT_THAT(size, testing::Eq(0));
+}
+
+TEST_F(EmptyIntegerRedBlackTreeTest, GivenInteger_WhenRemoveAll_ThenReturnsEmptyVector) {
+	const auto result {redBlackTree.removeAll()};
+	
+	EXPECT_THAT(result, testing::IsEmpty());
+}
+
+TEST_F(EmptyIntegerRedBlackTreeTest, GivenInteger_WhenFindFirst_ThenReturnsNullOptional) {
+	const auto result {redBlackTree.findFirst(10)};
+	
+	EXPECT_THAT(result, testing::Eq(std::nullopt));
+}
+
+TEST_F(EmptyIntegerRedBlackTreeTest, WhenFindMinimum_ThenReturnsNullOptional) {
+	const auto result {redBlackTree.findMinimum()};
+	
+	EXPECT_THAT(result, testing::Eq(std::nullopt));
+}
+
+TEST_F(EmptyIntegerRedBlackTreeTest, WhenFindMaximum_ThenReturnsNullOptional) {
+	const auto result {redBlackTree.findMaximum()};
+	
+	EXPECT_THAT(result, testing::Eq(std::nullopt));
+}
+
+TEST_F(EmptyIntegerRedBlackTreeTest, GivenInteger_WhenContains_ThenReturnsFalse) {
+	const auto result {redBlackTree.contains(10)};
+	
+	EXPECT_THAT(result, testing::IsFalse());
+}
+
+TEST_F(EmptyIntegerRedBlackTreeTest, WhenIsEmpty_ThenReturnsTrue) {
+	const auto result {redBlackTree.isEmpty()};
+	
+	EXPECT_THAT(result, testing::IsTrue());
+}
+
+TEST_F(EmptyIntegerRedBlackTreeTest, WhenGetHeight_ThenReturnsNegativeOne) {
+	const auto result {redBlackTree.getHeight()};
+	
+	EXPECT_THAT(result, testing::Eq(-1));
+}
+}
\ No newline at end of file
@@ -1,6 +1,13 @@
 #include <gmock/gmock.h>
 
+#include <algorithm>
 #include <array>
+#include <bit>
+#include <iterator>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+#include <vector>
 
 #include "DataStructures/Trees/AVLTree.hpp"
 
@@ -318,4 +325,343 @@ TEST_F(NonEmptyIntegerAVLTreeTest, WhenGetHeight_ThenReturnsHeight) {
 	
 	EXPECT_THAT(height, testing::Eq(3));
 }
+
+TEST_F(NonEmptyIntegerAVLTreeTest,
+       GivenInOrderIterator_WhenInsertAndRotationsArePerformed_ThenIteratorContinuesFromSameElement) {
+	auto iterator {avlTree.cbeginInOrder()};
+	while (*iterator != 10) {
+		++iterator;
+	}
+	
+	for (auto element {60}; element <= 100; element += 10) {
+		avlTree.insert(element);
+	}
+	
+	std::vector<int> elements {};
+	for (; iterator != avlTree.cendInOrder(); ++iterator) {
+		elements.push_back(*iterator);
+	}
+	
+	EXPECT_THAT(elements, testing::ElementsAre(10, 30, 40, 50, 60, 70, 80, 90, 100));
+}
+
+TEST_F(NonEmptyIntegerAVLTreeTest, GivenNodeWithTwoChildrenAndDeepSuccessor_WhenRemoveFirst_ThenOtherElementsAreKept) {
+	avlTree.insert(35);
+	avlTree.insert(45);
+	
+	avlTree.removeFirst(10);
+	
+	std::vector<int> elements {};
+	for (auto iterator {avlTree.cbeginInOrder()}; iterator != avlTree.cendInOrder(); ++iterator) {
+		elements.push_back(*iterator);
+	}
+	
+	EXPECT_THAT(elements, testing::ElementsAre(-50, -20, -10, -5, 0, 30, 35, 40, 45, 50));
+}
+
+TEST_F(NonEmptyIntegerAVLTreeTest, GivenIndexOfEachElement_WhenSelect_ThenReturnsElementsInAscendingOrder) {
+	std::vector<int> elements {};
+	for (std::size_t index {0}; index < avlTree.getNodeCount(); ++index) {
+		elements.push_back(*avlTree.select(index));
+	}
+	
+	EXPECT_THAT(elements, testing::ElementsAre(-50, -20, -10, -5, 0, 10, 30, 40, 50));
+}
+
+TEST_F(NonEmptyIntegerAVLTreeTest, GivenIndexNotLessThanNodeCount_WhenSelect_ThenReturnsNullOptional) {
+	const auto result {avlTree.select(9)};
+	
+	EXPECT_THAT(result, testing::Eq(std::nullopt));
+}
+
+TEST_F(NonEmptyIntegerAVLTreeTest, GivenIntegerMatchingOneElement_WhenRank_ThenReturnsNumberOfSmallerElements) {
+	const auto result {avlTree.rank(0)};
+	
+	EXPECT_THAT(result, testing::Eq(4));
+}
+
+TEST_F(NonEmptyIntegerAVLTreeTest, GivenIntegerMatchingNoElements_WhenRank_ThenReturnsNumberOfSmallerElements) {
+	const auto result {avlTree.rank(35)};
+	
+	EXPECT_THAT(result, testing::Eq(7));
+}
+
+TEST_F(NonEmptyIntegerAVLTreeTest, GivenBounds_WhenCountInRange_ThenReturnsNumberOfElementsBetweenBounds) {
+	const auto result {avlTree.countInRange(-10, 30)};
+	
+	EXPECT_THAT(result, testing::Eq(5));
+}
+
+TEST_F(NonEmptyIntegerAVLTreeTest, GivenUpperBoundLessThanLowerBound_WhenCountInRange_ThenReturnsZero) {
+	const auto result {avlTree.countInRange(30, -10)};
+	
+	EXPECT_THAT(result, testing::Eq(0));
+}
+
+TEST_F(NonEmptyIntegerAVLTreeTest, GivenRemovedElements_WhenSelect_ThenSkipsRemovedElements) {
+	avlTree.removeFirst(0);
+	avlTree.removeMinimum();
+	
+	std::vector<int> elements {};
+	for (std::size_t index {0}; index < avlTree.getNodeCount(); ++index) {
+		elements.push_back(*avlTree.select(index));
+	}
+	
+	EXPECT_THAT(elements, testing::ElementsAre(-20, -10, -5, 10, 30, 40, 50));
+}
+
+TEST_F(NonEmptyIntegerAVLTreeTest, GivenRandomInsertsAndRemovals_WhenSelectAndRank_ThenMatchSortedElements) {
+	std::vector<int> sortedElements {avlTree.cbeginInOrder(), avlTree.cendInOrder()};
+	
+	std::mt19937 generator {42};
+	std::uniform_int_distribution<int> elementDistribution {-500, 500};
+	
+	for (auto operation {0}; operation < 5000; ++operation) {
+		const auto element {elementDistribution(generator)};
+		
+		if (generator() % 3 == 0) {
+			if (avlTree.removeFirst(element).has_value()) {
+				sortedElements.erase(std::ranges::lower_bound(sortedElements, element));
+			}
+		} else {
+			avlTree.insert(element);
+			sortedElements.insert(std::ranges::upper_bound(sortedElements, element), element);
+		}
+		
+		const auto index {static_cast<std::size_t>(generator()) % sortedElements.size()};
+		ASSERT_THAT(avlTree.select(index), testing::Optional(sortedElements[index]));
+		ASSERT_THAT(avlTree.rank(element),
+		            testing::Eq(static_cast<std::size_t>(std::ranges::lower_bound(sortedElements, element) -
+		                                                 sortedElements.begin())));
+	}
+	
+	EXPECT_THAT(avlTree.getHeight(), testing::Le(2 * static_cast<int>(std::bit_width(sortedElements.size()))));
+}
+
+TEST_F(NonEmptyIntegerAVLTreeTest, GivenIntegerMatchingNoElements_WhenLowerBound_ThenReturnsNextGreaterElement) {
+	const auto result {avlTree.lowerBound(15)};
+	
+	EXPECT_THAT(*result, testing::Eq(30));
+}
+
+TEST_F(NonEmptyIntegerAVLTreeTest, GivenIntegerGreaterThanMaximum_WhenUpperBound_ThenReturnsEndIterator) {
+	const auto result {avlTree.upperBound(50)};
+	
+	EXPECT_THAT(result, testing::Eq(avlTree.cendInOrder()));
+}
+
+TEST_F(NonEmptyIntegerAVLTreeTest, GivenIntegerMatchingOneElement_WhenEqualRange_ThenReturnsRangeOfMatchingElement) {
+	const auto [first, last] {avlTree.equalRange(-10)};
+	
+	EXPECT_THAT(std::vector<int>(first, last), testing::ElementsAre(-10));
+}
+
+TEST_F(NonEmptyIntegerAVLTreeTest, GivenBounds_WhenForEachInRange_ThenFunctionIsAppliedToElementsBetweenBounds) {
+	std::vector<int> elements {};
+	
+	avlTree.forEachInRange(-20, 35, [&elements](const auto& element) {
+		elements.push_back(element);
+	});
+	
+	EXPECT_THAT(elements, testing::ElementsAre(-20, -10, -5, 0, 10, 30));
+}
+
+TEST_F(NonEmptyIntegerAVLTreeTest, GivenRandomDuplicateElements_WhenRangeQueries_ThenMatchSortedElements) {
+	std::vector<int> sortedElements {avlTree.cbeginInOrder(), avlTree.cendInOrder()};
+	
+	std::mt19937 generator {7};
+	std::uniform_int_distribution<int> elementDistribution {-100, 100};
+	
+	for (auto operation {0}; operation < 2000; ++operation) {
+		const auto element {elementDistribution(generator)};
+		avlTree.insert(element);
+		sortedElements.insert(std::ranges::upper_bound(sortedElements, element), element);
+		
+		const auto first {elementDistribution(generator)};
+		const auto last {elementDistribution(generator)};
+		
+		std::vector<int> elements {};
+		avlTree.forEachInRange(first, last, [&elements](const auto& rangeElement) {
+			elements.push_back(rangeElement);
+		});
+		
+		const auto sortedFirst {std::ranges::lower_bound(sortedElements, first)};
+		const auto sortedLast {std::max(sortedFirst, std::ranges::upper_bound(sortedElements, last))};
+		ASSERT_THAT(elements, testing::ElementsAreArray(sortedFirst, sortedLast));
+		ASSERT_THAT(std::distance(avlTree.lowerBound(first), avlTree.upperBound(first)),
+		            testing::Eq(std::ranges::count(sortedElements, first)));
+	}
+}
+
+TEST_F(NonEmptyIntegerAVLTreeTest, WhenCopyConstruct_ThenNewAVLTreeHasSameShapeAsOriginal) {
+	const auto otherAVLTree {avlTree};
+	
+	EXPECT_THAT(std::vector<int>(otherAVLTree.cbeginLevelOrder(), otherAVLTree.cendLevelOrder()),
+	            testing::ElementsAreArray(avlTree.cbeginLevelOrder(), avlTree.cendLevelOrder()));
+	EXPECT_THAT(otherAVLTree.getHeight(), testing::Eq(avlTree.getHeight()));
+	EXPECT_THAT(otherAVLTree.select(4), testing::Optional(0));
+}
+
+TEST_F(NonEmptyIntegerAVLTreeTest, GivenCopiedAVLTree_WhenInsertAndRemoveOnCopy_ThenOriginalIsUnchanged) {
+	AVLTree<int> otherAVLTree {std::vector<int> {1, 2, 3}};
+	otherAVLTree = avlTree;
+	
+	for (auto element {60}; element < 100; ++element) {
+		otherAVLTree.insert(element);
+	}
+	
+	while (otherAVLTree.removeMinimum().has_value()) {
+		
+	}
+	
+	EXPECT_THAT(otherAVLTree.isEmpty(), testing::IsTrue());
+	EXPECT_THAT(std::vector<int>(avlTree.cbeginInOrder(), avlTree.cendInOrder()),
+	            testing::ElementsAre(-50, -20, -10, -5, 0, 10, 30, 40, 50));
+}
+
+TEST_F(NonEmptyIntegerAVLTreeTest, GivenInteger_WhenSplit_ThenElementsAreDividedAtInteger) {
+	const auto upperAVLTree {avlTree.split(0)};
+	
+	EXPECT_THAT(std::vector<int>(avlTree.cbeginInOrder(), avlTree.cendInOrder()),
+	            testing::ElementsAre(-50, -20, -10, -5));
+	EXPECT_THAT(std::vector<int>(upperAVLTree.cbeginInOrder(), upperAVLTree.cendInOrder()),
+	            testing::ElementsAre(0, 10, 30, 40, 50));
+	EXPECT_THAT(avlTree.getNodeCount(), testing::Eq(4));
+	EXPECT_THAT(upperAVLTree.getNodeCount(), testing::Eq(5));
+	EXPECT_THAT(upperAVLTree.rank(40), testing::Eq(3));
+}
+
+TEST_F(NonEmptyIntegerAVLTreeTest, GivenSplitAVLTree_WhenJoin_ThenAVLTreeIsRestored) {
+	auto upperAVLTree {avlTree.split(35)};
+	avlTree.join(std::move(upperAVLTree));
+	
+	EXPECT_THAT(std::vector<int>(avlTree.cbeginInOrder(), avlTree.cendInOrder()),
+	            testing::ElementsAre(-50, -20, -10, -5, 0, 10, 30, 40, 50));
+	EXPECT_THAT(avlTree.getNodeCount(), testing::Eq(9));
+	EXPECT_THAT(upperAVLTree.isEmpty(), testing::IsTrue());
+}
+
+TEST_F(NonEmptyIntegerAVLTreeTest, GivenOverlappingAVLTree_WhenJoin_ThenThrowsInvalidArgument) {
+	AVLTree<int> otherAVLTree {std::vector<int> {45, 60}};
+	
+	EXPECT_THROW(avlTree.join(std::move(otherAVLTree)), std::invalid_argument);
+	EXPECT_THAT(avlTree.getNodeCount(), testing::Eq(9));
+	EXPECT_THAT(otherAVLTree.getNodeCount(), testing::Eq(2));
+}
+
+TEST_F(NonEmptyIntegerAVLTreeTest, GivenOtherAVLTree_WhenSetOperations_ThenElementsMatchStandardAlgorithms) {
+	const AVLTree<int> otherAVLTree {std::vector<int> {-20, -15, 0, 5, 40, 45}};
+	
+	auto unitedAVLTree {avlTree};
+	unitedAVLTree.unionWith(AVLTree<int> {otherAVLTree});
+	auto intersectedAVLTree {avlTree};
+	intersectedAVLTree.intersectWith(AVLTree<int> {otherAVLTree});
+	avlTree.differenceWith(AVLTree<int> {otherAVLTree});
+	
+	EXPECT_THAT(std::vector<int>(unitedAVLTree.cbeginInOrder(), unitedAVLTree.cendInOrder()),
+	            testing::ElementsAre(-50, -20, -15, -10, -5, 0, 5, 10, 30, 40, 45, 50));
+	EXPECT_THAT(std::vector<int>(intersectedAVLTree.cbeginInOrder(), intersectedAVLTree.cendInOrder()),
+	            testing::ElementsAre(-20, 0, 40));
+	EXPECT_THAT(std::vector<int>(avlTree.cbeginInOrder(), avlTree.cendInOrder()),
+	            testing::ElementsAre(-50, -10, -5, 10, 30, 50));
+	EXPECT_THAT(unitedAVLTree.getNodeCount(), testing::Eq(12));
+	EXPECT_THAT(intersectedAVLTree.getNodeCount(), testing::Eq(3));
+	EXPECT_THAT(avlTree.getNodeCount(), testing::Eq(6));
+}
+
+TEST_F(NonEmptyIntegerAVLTreeTest, GivenSmallerAVLTree_WhenSetOperationsWithThisAVLTree_ThenElementsMatchExpected) {
+	AVLTree<int> unitedAVLTree {std::vector<int> {-20, 5, 5}};
+	unitedAVLTree.unionWith(AVLTree<int> {avlTree});
+	AVLTree<int> intersectedAVLTree {std::vector<int> {-20, 5, 40, 40}};
+	intersectedAVLTree.intersectWith(AVLTree<int> {avlTree});
+	AVLTree<int> subtractedAVLTree {std::vector<int> {-20, 5, 40, 40}};
+	subtractedAVLTree.differenceWith(std::move(avlTree));
+	
+	EXPECT_THAT(std::vector<int>(unitedAVLTree.cbeginInOrder(), unitedAVLTree.cendInOrder()),
+	            testing::ElementsAre(-50, -20, -10, -5, 0, 5, 5, 10, 30, 40, 50));
+	EXPECT_THAT(std::vector<int>(intersectedAVLTree.cbeginInOrder(), intersectedAVLTree.cendInOrder()),
+	            testing::ElementsAre(-20, 40, 40));
+	EXPECT_THAT(std::vector<int>(subtractedAVLTree.cbeginInOrder(), subtractedAVLTree.cendInOrder()),
+	            testing::ElementsAre(5));
+	EXPECT_THAT(avlTree.isEmpty(), testing::IsTrue());
+}
+
+TEST_F(NonEmptyIntegerAVLTreeTest,
+       GivenLargeRandomAVLTreesAndThreads_WhenSetOperations_ThenElementsMatchStandardAlgorithms) {
+	std::mt19937 randomEngine {46};
+	std::uniform_int_distribution<int> elementDistribution {0, 1 << 20};
+	
+	std::vector<int> firstElements(1 << 17);
+	std::vector<int> secondElements(1 << 16);
+	std::ranges::generate(firstElements, [&]() {
+		return elementDistribution(randomEngine);
+	});
+	std::ranges::generate(secondElements, [&]() {
+		return elementDistribution(randomEngine);
+	});
+	std::ranges::sort(firstElements);
+	std::ranges::sort(secondElements);
+	firstElements.erase(std::ranges::unique(firstElements).begin(), firstElements.end());
+	secondElements.erase(std::ranges::unique(secondElements).begin(), secondElements.end());
+	
+	std::vector<int> unitedElements {};
+	std::vector<int> intersectedElements {};
+	std::vector<int> subtractedElements {};
+	std::ranges::set_union(firstElements, secondElements, std::back_inserter(unitedElements));
+	std::ranges::set_intersection(firstElements, secondElements, std::back_inserter(intersectedElements));
+	std::ranges::set_difference(firstElements, secondElements, std::back_inserter(subtractedElements));
+	
+	AVLTree<int> unitedAVLTree {firstElements};
+	unitedAVLTree.unionWith(AVLTree<int> {secondElements}, 4);
+	AVLTree<int> intersectedAVLTree {firstElements};
+	intersectedAVLTree.intersectWith(AVLTree<int> {secondElements}, 4);
+	AVLTree<int> subtractedAVLTree {firstElements};
+	subtractedAVLTree.differenceWith(AVLTree<int> {secondElements}, 4);
+	
+	EXPECT_THAT(std::vector<int>(unitedAVLTree.cbeginInOrder(), unitedAVLTree.cendInOrder()),
+	            testing::ElementsAreArray(unitedElements));
+	EXPECT_THAT(std::vector<int>(intersectedAVLTree.cbeginInOrder(), intersectedAVLTree.cendInOrder()),
+	            testing::ElementsAreArray(intersectedElements));
+	EXPECT_THAT(std::vector<int>(subtractedAVLTree.cbeginInOrder(), subtractedAVLTree.cendInOrder()),
+	            testing::ElementsAreArray(subtractedElements));
+	EXPECT_THAT(unitedAVLTree.getNodeCount(), testing::Eq(unitedElements.size()));
+	EXPECT_THAT(unitedAVLTree.getHeight(),
+	            testing::Le(1.45 * std::bit_width(unitedElements.size() + 2)));
+	
+	for (auto element {0}; element < 1000; ++element) {
+		unitedAVLTree.removeFirst(unitedElements[element * 7]);
+		intersectedAVLTree.insert(element);
+	}
+	
+	EXPECT_THAT(unitedAVLTree.getNodeCount(), testing::Eq(unitedElements.size() - 1000));
+	EXPECT_THAT(intersectedAVLTree.getNodeCount(), testing::Eq(intersectedElements.size() + 1000));
+}
+
+TEST_F(NonEmptyIntegerAVLTreeTest, GivenManyJoinedBlocks_WhenRemoveEveryOtherElement_ThenRemainingElementsAreKept) {
+	AVLTree<int> joinedAVLTree {};
+	std::vector<int> expectedElements {};
+	
+	for (auto blockIndex {0}; blockIndex < 256; ++blockIndex) {
+		std::vector<int> blockElements(16);
+		std::iota(blockElements.begin(), blockElements.end(), blockIndex * 16);
+		
+		joinedAVLTree.join(AVLTree<int> {blockElements});
+	}
+	
+	auto splitAVLTree {joinedAVLTree.split(2048)};
+	joinedAVLTree.insert(-1);
+	
+	for (auto element {0}; element < 4096; element += 2) {
+		auto& ownerAVLTree {element < 2048 ? joinedAVLTree : splitAVLTree};
+		EXPECT_THAT(ownerAVLTree.removeFirst(element), testing::Optional(element));
+		expectedElements.push_back(element + 1);
+	}
+	
+	joinedAVLTree.join(std::move(splitAVLTree));
+	expectedElements.insert(expectedElements.begin(), -1);
+	
+	EXPECT_THAT(std::vector<int>(joinedAVLTree.cbeginInOrder(), joinedAVLTree.cendInOrder()),
+	            testing::ElementsAreArray(expectedElements));
+	EXPECT_THAT(joinedAVLTree.removeAll().size(), testing::Eq(expectedElements.size()));
+}
 }
\ No newline at end of file
@@ -0,0 +1,161 @@
+#include <gmock/gmock.h>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <random>
+#include <set>
+#include <utility>
+#include <vector>
+
+#include "DataStructures/Trees/ArenaAVLTree.hpp"
+
+namespace Core::DataStructures::Trees::Test {
+class NonEmptyIntegerArenaAVLTreeTest : public testing::Test {
+public:
+	NonEmptyIntegerArenaAVLTreeTest();
+	~NonEmptyIntegerArenaAVLTreeTest() noexcept override = default;
+
+protected:
+	ArenaAVLTree<int> arenaAVLTree {};
+};
+
+NonEmptyIntegerArenaAVLTreeTest::NonEmptyIntegerArenaAVLTreeTest() {
+	const auto elements {std::array<int, 9> {0, 10, -20, 40, 30, -10, -50, -5, 50}};
+	for (const auto& element : elements) {
+		arenaAVLTree.insert(element);
+	}
+}
+
+TEST_F(NonEmptyIntegerArenaAVLTreeTest, WhenIterateInOrder_ThenElementsAreInAscendingOrder) {
+	EXPECT_THAT(std::vector<int>(arenaAVLTree.cbeginInOrder(), arenaAVLTree.cendInOrder()),
+	            testing::ElementsAre(-50, -20, -10, -5, 0, 10, 30, 40, 50));
+	EXPECT_THAT(arenaAVLTree.getHeight(), testing::Eq(3));
+}
+
+TEST_F(NonEmptyIntegerArenaAVLTreeTest, WhenCopyConstruct_ThenNewArenaAVLTreeIsEqualToOriginal) {
+	auto otherArenaAVLTree {arenaAVLTree};
+	
+	EXPECT_THAT(otherArenaAVLTree, testing::Eq(arenaAVLTree));
+	
+	otherArenaAVLTree.removeFirst(0);
+	
+	EXPECT_THAT(otherArenaAVLTree, testing::Ne(arenaAVLTree));
+	EXPECT_THAT(arenaAVLTree.contains(0), testing::IsTrue());
+}
+
+TEST_F(NonEmptyIntegerArenaAVLTreeTest, WhenMoveConstruct_ThenOriginalArenaAVLTreeIsEmpty) {
+	const auto otherArenaAVLTree {std::move(arenaAVLTree)};
+	
+	EXPECT_THAT(otherArenaAVLTree.getNodeCount(), testing::Eq(9));
+	EXPECT_THAT(arenaAVLTree.isEmpty(), testing::IsTrue());
+	EXPECT_THAT(arenaAVLTree.getNodeCount(), testing::Eq(0));
+	EXPECT_THAT(arenaAVLTree.cbeginInOrder(), testing::Eq(arenaAVLTree.cendInOrder()));
+}
+
+TEST_F(NonEmptyIntegerArenaAVLTreeTest, GivenInteger_WhenRemoveFirst_ThenReturnsElementAndKeepsOrder) {
+	EXPECT_THAT(arenaAVLTree.removeFirst(0), testing::Optional(0));
+	EXPECT_THAT(arenaAVLTree.removeFirst(0), testing::Eq(std::nullopt));
+	EXPECT_THAT(std::vector<int>(arenaAVLTree.cbeginInOrder(), arenaAVLTree.cendInOrder()),
+	            testing::ElementsAre(-50, -20, -10, -5, 10, 30, 40, 50));
+	EXPECT_THAT(arenaAVLTree.getNodeCount(), testing::Eq(8));
+}
+
+TEST_F(NonEmptyIntegerArenaAVLTreeTest, WhenRemoveMinimumAndMaximum_ThenReturnsThem) {
+	EXPECT_THAT(arenaAVLTree.removeMinimum(), testing::Optional(-50));
+	EXPECT_THAT(arenaAVLTree.removeMaximum(), testing::Optional(50));
+	EXPECT_THAT(arenaAVLTree.findMinimum(), testing::Optional(-20));
+	EXPECT_THAT(arenaAVLTree.findMaximum(), testing::Optional(40));
+}
+
+TEST_F(NonEmptyIntegerArenaAVLTreeTest, WhenRemoveAll_ThenReturnsElementsInPostOrderAndReleasesArena) {
+	const auto result {arenaAVLTree.removeAll()};
+	
+	EXPECT_THAT(result, testing::ElementsAre(-50, -5, -10, -20, 10, 50, 40, 30, 0));
+	EXPECT_THAT(arenaAVLTree.isEmpty(), testing::IsTrue());
+	EXPECT_THAT(arenaAVLTree.getMemoryUsage(), testing::Eq(0));
+}
+
+TEST_F(NonEmptyIntegerArenaAVLTreeTest, GivenRemovedIntegers_WhenInsert_ThenFreedNodesAreReused) {
+	const auto memoryUsage {arenaAVLTree.getMemoryUsage()};
+	
+	for (auto round {0}; round < 100; ++round) {
+		arenaAVLTree.removeFirst(-10);
+		arenaAVLTree.removeMinimum();
+		arenaAVLTree.insert(-10);
+		arenaAVLTree.insert(-50);
+	}
+	
+	EXPECT_THAT(arenaAVLTree.getMemoryUsage(), testing::Eq(memoryUsage));
+	EXPECT_THAT(std::vector<int>(arenaAVLTree.cbeginInOrder(), arenaAVLTree.cendInOrder()),
+	            testing::ElementsAre(-50, -20, -10, -5, 0, 10, 30, 40, 50));
+}
+
+TEST_F(NonEmptyIntegerArenaAVLTreeTest, GivenRemovedIntegers_WhenCompact_ThenArenaHoldsOnlyLiveNodesContiguously) {
+	arenaAVLTree.removeFirst(0);
+	arenaAVLTree.removeMaximum();
+	
+	arenaAVLTree.compact();
+	
+	EXPECT_THAT(arenaAVLTree.getMemoryUsage(), testing::Eq(7 * sizeof(ArenaAVLTreeNode<int>)));
+	EXPECT_THAT(std::vector<int>(arenaAVLTree.cbeginInOrder(), arenaAVLTree.cendInOrder()),
+	            testing::ElementsAre(-50, -20, -10, -5, 10, 30, 40));
+	
+	std::vector<const std::byte*> elementAddresses {};
+	for (auto iterator {arenaAVLTree.cbeginInOrder()}; iterator != arenaAVLTree.cendInOrder(); ++iterator) {
+		elementAddresses.push_back(reinterpret_cast<const std::byte*>(&*iterator));
+	}
+	
+	const auto [lowestAddress, highestAddress] {std::ranges::minmax(elementAddresses)};
+	
+	EXPECT_THAT(highestAddress - lowestAddress, testing::Eq(6 * sizeof(ArenaAVLTreeNode<int>)));
+	
+	arenaAVLTree.insert(0);
+	
+	EXPECT_THAT(arenaAVLTree.removeFirst(-10), testing::Optional(-10));
+	EXPECT_THAT(std::vector<int>(arenaAVLTree.cbeginInOrder(), arenaAVLTree.cendInOrder()),
+	            testing::ElementsAre(-50, -20, -5, 0, 10, 30, 40));
+}
+
+TEST_F(NonEmptyIntegerArenaAVLTreeTest, GivenRandomOperations_WhenApply_ThenMatchesMultiset) {
+	std::mt19937 generator {42};
+	std::uniform_int_distribution<int> elementDistribution {-500, 500};
+	std::uniform_int_distribution<int> operationDistribution {0, 3};
+	std::multiset<int> expectedElements {0, 10, -20, 40, 30, -10, -50, -5, 50};
+	
+	for (auto operation {0}; operation < 20000; ++operation) {
+		const auto element {elementDistribution(generator)};
+		
+		switch (operationDistribution(generator)) {
+			case 0:
+			case 1:
+				arenaAVLTree.insert(element);
+				expectedElements.insert(element);
+				break;
+			case 2: {
+				const auto isExpected {expectedElements.contains(element)};
+				if (isExpected) {
+					expectedElements.erase(expectedElements.find(element));
+				}
+				
+				EXPECT_THAT(arenaAVLTree.removeFirst(element).has_value(), testing::Eq(isExpected));
+				break;
+			}
+			default:
+				if (!expectedElements.empty()) {
+					expectedElements.erase(expectedElements.begin());
+				}
+				
+				arenaAVLTree.removeMinimum();
+				break;
+		}
+	}
+	
+	EXPECT_THAT(std::vector<int>(arenaAVLTree.cbeginInOrder(), arenaAVLTree.cendInOrder()),
+	            testing::ElementsAreArray(expectedElements));
+	EXPECT_THAT(arenaAVLTree.getNodeCount(), testing::Eq(expectedElements.size()));
+	EXPECT_THAT(arenaAVLTree.getHeight(),
+	            testing::Le(1.45 * std::log2(static_cast<double>(expectedElements.size()) + 2)));
+}
+}
\ No newline at end of file
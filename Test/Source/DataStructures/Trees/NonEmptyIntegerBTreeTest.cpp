@@ -0,0 +1,175 @@
+#include <gmock/gmock.h>
+
+#include <array>
+#include <map>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "DataStructures/Trees/BTree.hpp"
+
+namespace Core::DataStructures::Trees::Test {
+class NonEmptyIntegerBTreeTest : public testing::Test {
+public:
+	NonEmptyIntegerBTreeTest();
+	~NonEmptyIntegerBTreeTest() noexcept override = default;
+
+protected:
+	BTree<int, int, 64> bTree {};
+};
+
+NonEmptyIntegerBTreeTest::NonEmptyIntegerBTreeTest() {
+	const auto keys {std::array<int, 9> {0, 10, -20, 40, 30, -10, -50, -5, 50}};
+	for (const auto& key : keys) {
+		bTree.insert(key, key * 2);
+	}
+}
+
+TEST_F(NonEmptyIntegerBTreeTest, WhenCopyConstruct_ThenNewBTreeIsEqualToOriginalBTree) {
+	const auto copiedBTree {bTree};
+	
+	EXPECT_THAT(copiedBTree == bTree, testing::IsTrue());
+}
+
+TEST_F(NonEmptyIntegerBTreeTest, WhenMoveConstruct_ThenNewBTreeIsEqualToOriginalBTree) {
+	auto copiedBTree {bTree};
+	const auto movedBTree {std::move(copiedBTree)};
+	
+	EXPECT_THAT(movedBTree == bTree, testing::IsTrue());
+	EXPECT_THAT(copiedBTree.isEmpty(), testing::IsTrue());
+}
+
+TEST_F(NonEmptyIntegerBTreeTest, WhenCopyAssign_ThenNewBTreeIsEqualToOriginalBTree) {
+	BTree<int, int, 64> copiedBTree {};
+	copiedBTree.insert(1, 1);
+	
+	copiedBTree = bTree;
+	
+	EXPECT_THAT(copiedBTree == bTree, testing::IsTrue());
+}
+
+TEST_F(NonEmptyIntegerBTreeTest, GivenTwoNonEqualNonEmptyIntegerBTrees_WhenCompare_ThenReturnsFalse) {
+	auto otherBTree {bTree};
+	otherBTree.insert(10, 0);
+	
+	EXPECT_THAT(otherBTree == bTree, testing::IsFalse());
+}
+
+TEST_F(NonEmptyIntegerBTreeTest, GivenExistingKey_WhenInsert_ThenValueIsReplacedAndSizeIsUnchanged) {
+	bTree.insert(30, 1);
+	
+	EXPECT_THAT(bTree.findFirst(30), testing::Optional(1));
+	EXPECT_THAT(bTree.getNodeCount(), testing::Eq(9));
+}
+
+TEST_F(NonEmptyIntegerBTreeTest, GivenExistingKey_WhenRemoveFirst_ThenReturnsValueAndSizeIsDecremented) {
+	const auto removedValue {bTree.removeFirst(-10)};
+	
+	EXPECT_THAT(removedValue, testing::Optional(-20));
+	EXPECT_THAT(bTree.getNodeCount(), testing::Eq(8));
+	EXPECT_THAT(bTree.contains(-10), testing::IsFalse());
+}
+
+TEST_F(NonEmptyIntegerBTreeTest, GivenMissingKey_WhenRemoveFirst_ThenReturnsNullOptional) {
+	const auto removedValue {bTree.removeFirst(15)};
+	
+	EXPECT_THAT(removedValue, testing::Eq(std::nullopt));
+	EXPECT_THAT(bTree.getNodeCount(), testing::Eq(9));
+}
+
+TEST_F(NonEmptyIntegerBTreeTest, WhenRemoveMinimum_ThenReturnsPairWithSmallestKey) {
+	const auto removedPair {bTree.removeMinimum()};
+	
+	EXPECT_THAT(removedPair, testing::Optional(std::make_pair(-50, -100)));
+	EXPECT_THAT(bTree.findMinimum(), testing::Optional(std::make_pair(-20, -40)));
+}
+
+TEST_F(NonEmptyIntegerBTreeTest, WhenRemoveMaximum_ThenReturnsPairWithLargestKey) {
+	const auto removedPair {bTree.removeMaximum()};
+	
+	EXPECT_THAT(removedPair, testing::Optional(std::make_pair(50, 100)));
+	EXPECT_THAT(bTree.findMaximum(), testing::Optional(std::make_pair(40, 80)));
+}
+
+TEST_F(NonEmptyIntegerBTreeTest, WhenRemoveAll_ThenReturnsPairsInAscendingKeyOrder) {
+	const auto pairs {bTree.removeAll()};
+	
+	EXPECT_THAT(pairs,
+	            testing::ElementsAre(std::make_pair(-50, -100),
+	                                 std::make_pair(-20, -40),
+	                                 std::make_pair(-10, -20),
+	                                 std::make_pair(-5, -10),
+	                                 std::make_pair(0, 0),
+	                                 std::make_pair(10, 20),
+	                                 std::make_pair(30, 60),
+	                                 std::make_pair(40, 80),
+	                                 std::make_pair(50, 100)));
+	EXPECT_THAT(bTree.isEmpty(), testing::IsTrue());
+}
+
+TEST_F(NonEmptyIntegerBTreeTest, GivenExistingKey_WhenFindFirst_ThenReturnsValue) {
+	const auto value {bTree.findFirst(40)};
+	
+	EXPECT_THAT(value, testing::Optional(80));
+}
+
+TEST_F(NonEmptyIntegerBTreeTest, GivenMissingKey_WhenContains_ThenReturnsFalse) {
+	const auto contains {bTree.contains(-15)};
+	
+	EXPECT_THAT(contains, testing::IsFalse());
+}
+
+TEST_F(NonEmptyIntegerBTreeTest, GivenRange_WhenForEachInRange_ThenFunctionIsAppliedToKeysInRange) {
+	std::vector<int> keys {};
+	
+	bTree.forEachInRange(-10, 30, [&keys](const int& key, const int&) {
+		keys.push_back(key);
+	});
+	
+	EXPECT_THAT(keys, testing::ElementsAre(-10, -5, 0, 10, 30));
+}
+
+TEST_F(NonEmptyIntegerBTreeTest, WhenIsEmpty_ThenReturnsFalse) {
+	const auto isEmpty {bTree.isEmpty()};
+	
+	EXPECT_THAT(isEmpty, testing::IsFalse());
+}
+
+TEST_F(NonEmptyIntegerBTreeTest, GivenRandomInsertsAndRemovals_WhenCompareWithMap_ThenContentsAreEqual) {
+	std::map<int, int> map {};
+	for (auto iterator {bTree.cbegin()}; iterator != bTree.cend(); ++iterator) {
+		map.emplace((*iterator).first, (*iterator).second);
+	}
+	
+	std::mt19937 generator {42};
+	std::uniform_int_distribution<int> keyDistribution {-500, 500};
+	
+	for (auto operation {0}; operation < 20000; ++operation) {
+		const auto key {keyDistribution(generator)};
+		
+		if (generator() % 3 == 0) {
+			const auto iterator {map.find(key)};
+			const auto removedValue {bTree.removeFirst(key)};
+			
+			ASSERT_THAT(removedValue.has_value(), testing::Eq(iterator != map.end()));
+			if (iterator != map.end()) {
+				ASSERT_THAT(*removedValue, testing::Eq(iterator->second));
+				map.erase(iterator);
+			}
+		} else {
+			bTree.insert(key, operation);
+			map.insert_or_assign(key, operation);
+		}
+	}
+	
+	std::vector<std::pair<int, int>> pairs {};
+	for (auto iterator {bTree.cbegin()}; iterator != bTree.cend(); ++iterator) {
+		pairs.emplace_back((*iterator).first, (*iterator).second);
+	}
+	
+	EXPECT_THAT(pairs, testing::ElementsAreArray(map));
+	EXPECT_THAT(bTree.getNodeCount(), testing::Eq(map.size()));
+	EXPECT_THAT(bTree.findMinimum(), testing::Optional(*map.begin()));
+	EXPECT_THAT(bTree.findMaximum(), testing::Optional(*map.rbegin()));
+}
+}
\ No newline at end of file
@@ -1,6 +1,9 @@
 #include <gmock/gmock.h>
 
 #include <array>
+#include <numeric>
+#include <utility>
+#include <vector>
 
 #include "DataStructures/Trees/BinarySearchTree.hpp"
 
@@ -151,6 +154,152 @@ TEST_F(NonEmptyIntegerBinarySearchTreeTest, WhenIteratePreOrder_ThenElementsAreI
 	EXPECT_THAT(elements, testing::ElementsAre(0, -10, -15, -20, -5, 10, 5, 15, 20));
 }
 
+TEST_F(NonEmptyIntegerBinarySearchTreeTest, GivenCopiedIterator_WhenIncrementOriginal_ThenIteratorsAreNotEqual) {
+	auto iterator {binarySearchTree.cbeginInOrder()};
+	const auto copiedIterator {iterator};
+	++iterator;
+	
+	EXPECT_THAT(copiedIterator == binarySearchTree.cbeginInOrder(), testing::IsTrue());
+	EXPECT_THAT(iterator == copiedIterator, testing::IsFalse());
+	EXPECT_THAT(*iterator, testing::Eq(-15));
+}
+
+TEST_F(NonEmptyIntegerBinarySearchTreeTest, GivenDegenerateTree_WhenIterateInOrder_ThenElementsAreInExpectedOrder) {
+	BinarySearchTree<int> degenerateTree {};
+	for (auto element {0}; element < 100; ++element) {
+		degenerateTree.insert(element);
+	}
+	
+	std::vector<int> elements {};
+	for (auto iterator {degenerateTree.cbeginInOrder()}; iterator != degenerateTree.cendInOrder(); ++iterator) {
+		elements.push_back(*iterator);
+	}
+	
+	std::vector<int> expectedElements(100);
+	std::iota(expectedElements.begin(), expectedElements.end(), 0);
+	EXPECT_THAT(elements, testing::ElementsAreArray(expectedElements));
+}
+
+TEST_F(NonEmptyIntegerBinarySearchTreeTest, GivenDegenerateTree_WhenIteratePostOrder_ThenElementsAreInExpectedOrder) {
+	BinarySearchTree<int> degenerateTree {};
+	for (auto element {100}; element > 0; --element) {
+		degenerateTree.insert(element);
+	}
+	
+	std::vector<int> elements {};
+	for (auto iterator {degenerateTree.beginPostOrder()}; iterator != degenerateTree.endPostOrder(); ++iterator) {
+		elements.push_back(*iterator);
+	}
+	
+	std::vector<int> expectedElements(100);
+	std::iota(expectedElements.begin(), expectedElements.end(), 1);
+	EXPECT_THAT(elements, testing::ElementsAreArray(expectedElements));
+}
+
+TEST_F(NonEmptyIntegerBinarySearchTreeTest,
+       GivenLeftDegenerateTree_WhenCopyInOrderIteratorMidWalk_ThenBothIteratorsVisitRemainingElements) {
+	BinarySearchTree<int> degenerateTree {};
+	for (auto element {99}; element >= 0; --element) {
+		degenerateTree.insert(element);
+	}
+	
+	std::vector<int> elements {};
+	for (auto iterator {degenerateTree.cbeginInOrder()}; iterator != degenerateTree.cendInOrder(); ++iterator) {
+		elements.push_back(*iterator);
+	}
+	
+	std::vector<int> expectedElements(100);
+	std::iota(expectedElements.begin(), expectedElements.end(), 0);
+	EXPECT_THAT(elements, testing::ElementsAreArray(expectedElements));
+	
+	auto iterator {degenerateTree.cbeginInOrder()};
+	for (auto element {0}; element < 25; ++element) {
+		++iterator;
+	}
+	
+	auto copiedIterator {iterator};
+	std::vector<int> remainingElements {};
+	for (; iterator != degenerateTree.cendInOrder(); ++iterator) {
+		remainingElements.push_back(*iterator);
+	}
+	
+	std::vector<int> copiedRemainingElements {};
+	for (; copiedIterator != degenerateTree.cendInOrder(); ++copiedIterator) {
+		copiedRemainingElements.push_back(*copiedIterator);
+	}
+	
+	expectedElements.erase(expectedElements.begin(), expectedElements.begin() + 25);
+	EXPECT_THAT(remainingElements, testing::ElementsAreArray(expectedElements));
+	EXPECT_THAT(copiedRemainingElements, testing::ElementsAreArray(expectedElements));
+}
+
+TEST_F(NonEmptyIntegerBinarySearchTreeTest,
+       GivenDegenerateTree_WhenMovePostOrderIterator_ThenMovedFromIteratorIsEmptyAndMovedToIteratorVisitsAllElements) {
+	BinarySearchTree<int> degenerateTree {};
+	for (auto element {0}; element < 100; ++element) {
+		degenerateTree.insert(element);
+	}
+	
+	std::vector<int> expectedElements(100);
+	std::iota(expectedElements.rbegin(), expectedElements.rend(), 0);
+	
+	auto iterator {degenerateTree.cbeginPostOrder()};
+	auto movedIterator {std::move(iterator)};
+	EXPECT_THAT(iterator == degenerateTree.cendPostOrder(), testing::IsTrue());
+	
+	iterator = std::move(movedIterator);
+	EXPECT_THAT(movedIterator == degenerateTree.cendPostOrder(), testing::IsTrue());
+	
+	std::vector<int> elements {};
+	for (; iterator != degenerateTree.cendPostOrder(); ++iterator) {
+		elements.push_back(*iterator);
+	}
+	
+	EXPECT_THAT(elements, testing::ElementsAreArray(expectedElements));
+}
+
+TEST_F(NonEmptyIntegerBinarySearchTreeTest,
+       GivenCompleteTree_WhenCopyLevelOrderIteratorMidWalk_ThenBothIteratorsVisitRemainingElements) {
+	std::vector<int> expectedElements {};
+	for (auto level {0}; level < 8; ++level) {
+		for (auto index {0}; index < (1 << level); ++index) {
+			expectedElements.push_back((2 * index + 1) << (7 - level));
+		}
+	}
+	
+	BinarySearchTree<int> completeTree {};
+	for (const auto element : expectedElements) {
+		completeTree.insert(element);
+	}
+	
+	std::vector<int> elements {};
+	for (auto iterator {completeTree.cbeginLevelOrder()}; iterator != completeTree.cendLevelOrder(); ++iterator) {
+		elements.push_back(*iterator);
+	}
+	
+	EXPECT_THAT(elements, testing::ElementsAreArray(expectedElements));
+	
+	auto iterator {completeTree.cbeginLevelOrder()};
+	for (auto element {0}; element < 100; ++element) {
+		++iterator;
+	}
+	
+	auto copiedIterator {iterator};
+	std::vector<int> remainingElements {};
+	for (; iterator != completeTree.cendLevelOrder(); ++iterator) {
+		remainingElements.push_back(*iterator);
+	}
+	
+	std::vector<int> copiedRemainingElements {};
+	for (; copiedIterator != completeTree.cendLevelOrder(); ++copiedIterator) {
+		copiedRemainingElements.push_back(*copiedIterator);
+	}
+	
+	expectedElements.erase(expectedElements.begin(), expectedElements.begin() + 100);
+	EXPECT_THAT(remainingElements, testing::ElementsAreArray(expectedElements));
+	EXPECT_THAT(copiedRemainingElements, testing::ElementsAreArray(expectedElements));
+}
+
 TEST_F(NonEmptyIntegerBinarySearchTreeTest, GivenInteger_WhenInsert_ThenElementsAreInExpectedOrder) {
 	binarySearchTree.insert(8);
 	
@@ -406,4 +555,187 @@ TEST_F(NonEmptyIntegerBinarySearchTreeTest, WhenGetHeight_ThenReturnsHeight) {
 	
 	EXPECT_THAT(height, testing::Eq(3));
 }
+
+TEST_F(NonEmptyIntegerBinarySearchTreeTest, GivenInOrderIterator_WhenInsert_ThenIteratorContinuesFromSameElement) {
+	auto iterator {binarySearchTree.cbeginInOrder()};
+	++iterator;
+	++iterator;
+	
+	binarySearchTree.insert(-12);
+	binarySearchTree.insert(12);
+	binarySearchTree.insert(25);
+	
+	std::vector<int> elements {};
+	for (; iterator != binarySearchTree.cendInOrder(); ++iterator) {
+		elements.push_back(*iterator);
+	}
+	
+	EXPECT_THAT(elements, testing::ElementsAre(-10, -5, 0, 5, 10, 12, 15, 20, 25));
+}
+
+TEST_F(NonEmptyIntegerBinarySearchTreeTest,
+       GivenNodeWithTwoChildren_WhenRemoveFirst_ThenIteratorToOtherElementRemainsValid) {
+	auto iterator {binarySearchTree.cbeginInOrder()};
+	while (*iterator != 15) {
+		++iterator;
+	}
+	
+	binarySearchTree.removeFirst(0);
+	binarySearchTree.removeFirst(10);
+	
+	std::vector<int> elements {};
+	for (; iterator != binarySearchTree.cendInOrder(); ++iterator) {
+		elements.push_back(*iterator);
+	}
+	
+	EXPECT_THAT(elements, testing::ElementsAre(15, 20));
+}
+
+TEST_F(NonEmptyIntegerBinarySearchTreeTest, WhenGetSizeOfInOrderIterator_ThenIsSizeOfPointer) {
+	EXPECT_THAT(sizeof(BinarySearchTree<int>::ConstInOrderIterator), testing::Eq(sizeof(void*)));
+}
+
+TEST_F(NonEmptyIntegerBinarySearchTreeTest, GivenIndexOfEachElement_WhenSelect_ThenReturnsElementsInAscendingOrder) {
+	std::vector<int> elements {};
+	for (std::size_t index {0}; index < binarySearchTree.getNodeCount(); ++index) {
+		elements.push_back(*binarySearchTree.select(index));
+	}
+	
+	EXPECT_THAT(elements, testing::ElementsAre(-20, -15, -10, -5, 0, 5, 10, 15, 20));
+}
+
+TEST_F(NonEmptyIntegerBinarySearchTreeTest, GivenIndexNotLessThanNodeCount_WhenSelect_ThenReturnsNullOptional) {
+	const auto result {binarySearchTree.select(9)};
+	
+	EXPECT_THAT(result, testing::Eq(std::nullopt));
+}
+
+TEST_F(NonEmptyIntegerBinarySearchTreeTest,
+       GivenIntegerMatchingOneElement_WhenRank_ThenReturnsNumberOfSmallerElements) {
+	const auto result {binarySearchTree.rank(0)};
+	
+	EXPECT_THAT(result, testing::Eq(4));
+}
+
+TEST_F(NonEmptyIntegerBinarySearchTreeTest,
+       GivenIntegerMatchingNoElements_WhenRank_ThenReturnsNumberOfSmallerElements) {
+	const auto result {binarySearchTree.rank(7)};
+	
+	EXPECT_THAT(result, testing::Eq(6));
+}
+
+TEST_F(NonEmptyIntegerBinarySearchTreeTest, GivenBounds_WhenCountInRange_ThenReturnsNumberOfElementsBetweenBounds) {
+	const auto result {binarySearchTree.countInRange(-10, 10)};
+	
+	EXPECT_THAT(result, testing::Eq(5));
+}
+
+TEST_F(NonEmptyIntegerBinarySearchTreeTest, GivenUpperBoundLessThanLowerBound_WhenCountInRange_ThenReturnsZero) {
+	const auto result {binarySearchTree.countInRange(10, -10)};
+	
+	EXPECT_THAT(result, testing::Eq(0));
+}
+
+TEST_F(NonEmptyIntegerBinarySearchTreeTest, GivenRemovedElements_WhenSelect_ThenSkipsRemovedElements) {
+	binarySearchTree.removeFirst(0);
+	binarySearchTree.removeMinimum();
+	
+	std::vector<int> elements {};
+	for (std::size_t index {0}; index < binarySearchTree.getNodeCount(); ++index) {
+		elements.push_back(*binarySearchTree.select(index));
+	}
+	
+	EXPECT_THAT(elements, testing::ElementsAre(-15, -10, -5, 5, 10, 15, 20));
+}
+
+TEST_F(NonEmptyIntegerBinarySearchTreeTest,
+       GivenIntegerMatchingNoElements_WhenLowerBound_ThenReturnsNextGreaterElement) {
+	const auto result {binarySearchTree.lowerBound(-7)};
+	
+	EXPECT_THAT(*result, testing::Eq(-5));
+}
+
+TEST_F(NonEmptyIntegerBinarySearchTreeTest, GivenIntegerMatchingOneElement_WhenLowerBound_ThenReturnsMatchingElement) {
+	const auto result {binarySearchTree.lowerBound(-5)};
+	
+	EXPECT_THAT(*result, testing::Eq(-5));
+}
+
+TEST_F(NonEmptyIntegerBinarySearchTreeTest, GivenIntegerGreaterThanMaximum_WhenLowerBound_ThenReturnsEndIterator) {
+	const auto result {binarySearchTree.lowerBound(25)};
+	
+	EXPECT_THAT(result, testing::Eq(binarySearchTree.cendInOrder()));
+}
+
+TEST_F(NonEmptyIntegerBinarySearchTreeTest,
+       GivenIntegerMatchingOneElement_WhenUpperBound_ThenReturnsNextGreaterElement) {
+	const auto result {binarySearchTree.upperBound(-5)};
+	
+	EXPECT_THAT(*result, testing::Eq(0));
+}
+
+TEST_F(NonEmptyIntegerBinarySearchTreeTest,
+       GivenIntegerMatchingSeveralElements_WhenEqualRange_ThenReturnsRangeOfMatchingElements) {
+	binarySearchTree.insert(5);
+	binarySearchTree.insert(5);
+	
+	const auto [first, last] {binarySearchTree.equalRange(5)};
+	
+	EXPECT_THAT(std::vector<int>(first, last), testing::ElementsAre(5, 5, 5));
+	EXPECT_THAT(*last, testing::Eq(10));
+}
+
+TEST_F(NonEmptyIntegerBinarySearchTreeTest, GivenIntegerMatchingNoElements_WhenEqualRange_ThenReturnsEmptyRange) {
+	const auto [first, last] {binarySearchTree.equalRange(7)};
+	
+	EXPECT_THAT(first, testing::Eq(last));
+	EXPECT_THAT(*first, testing::Eq(10));
+}
+
+TEST_F(NonEmptyIntegerBinarySearchTreeTest, GivenLowerBounds_WhenIterateBetweenLowerBounds_ThenVisitsHalfOpenRange) {
+	const std::vector<int> elements(binarySearchTree.lowerBound(-10), binarySearchTree.lowerBound(10));
+	
+	EXPECT_THAT(elements, testing::ElementsAre(-10, -5, 0, 5));
+}
+
+TEST_F(NonEmptyIntegerBinarySearchTreeTest,
+       GivenBounds_WhenForEachInRange_ThenFunctionIsAppliedToElementsBetweenBounds) {
+	std::vector<int> elements {};
+	
+	binarySearchTree.forEachInRange(-12, 10, [&elements](const auto& element) {
+		elements.push_back(element);
+	});
+	
+	EXPECT_THAT(elements, testing::ElementsAre(-10, -5, 0, 5, 10));
+}
+
+TEST_F(NonEmptyIntegerBinarySearchTreeTest,
+       GivenUpperBoundLessThanLowerBound_WhenForEachInRange_ThenFunctionIsNotApplied) {
+	std::vector<int> elements {};
+	
+	binarySearchTree.forEachInRange(10, -10, [&elements](const auto& element) {
+		elements.push_back(element);
+	});
+	
+	EXPECT_THAT(elements, testing::IsEmpty());
+}
+
+TEST_F(NonEmptyIntegerBinarySearchTreeTest, WhenCopyConstruct_ThenNewBinarySearchTreeHasSameShapeAsOriginal) {
+	const auto otherBinarySearchTree {binarySearchTree};
+	
+	EXPECT_THAT(std::vector<int>(otherBinarySearchTree.cbeginPreOrder(), otherBinarySearchTree.cendPreOrder()),
+	            testing::ElementsAre(0, -10, -15, -20, -5, 10, 5, 15, 20));
+	EXPECT_THAT(otherBinarySearchTree.getHeight(), testing::Eq(3));
+	EXPECT_THAT(otherBinarySearchTree.select(6), testing::Optional(10));
+}
+
+TEST_F(NonEmptyIntegerBinarySearchTreeTest, GivenCopiedBinarySearchTree_WhenRemoveFromCopy_ThenOriginalIsUnchanged) {
+	BinarySearchTree<int> otherBinarySearchTree {};
+	otherBinarySearchTree = binarySearchTree;
+	otherBinarySearchTree.removeFirst(0);
+	
+	EXPECT_THAT(binarySearchTree.getNodeCount(), testing::Eq(9));
+	EXPECT_THAT(binarySearchTree.contains(0), testing::IsTrue());
+	EXPECT_THAT(otherBinarySearchTree.rank(10), testing::Eq(5));
+}
 }
\ No newline at end of file
@@ -1,5 +1,7 @@
 #include <gmock/gmock.h>
 
+#include <vector>
+
 #include "DataStructures/Trees/BinaryTree.hpp"
 #include "IntegerPredicates.hpp"
 
@@ -324,4 +326,26 @@ TEST_F(NonEmptyIntegerBinaryTreeTest, WhenGetHeight_ThenReturnsHeight) {
 	
 	EXPECT_THAT(height, testing::Eq(2));
 }
+
+TEST_F(NonEmptyIntegerBinaryTreeTest, WhenCopyAssign_ThenNewBinaryTreeHasSameShapeAsOriginal) {
+	binaryTree.removeFirst([](const auto& element) {
+		return element == 20;
+	});
+	
+	BinaryTree<int> otherBinaryTree {};
+	otherBinaryTree.insert(60);
+	otherBinaryTree = binaryTree;
+	
+	EXPECT_THAT(std::vector<int>(otherBinaryTree.cbeginPreOrder(), otherBinaryTree.cendPreOrder()),
+	            testing::ElementsAreArray(binaryTree.cbeginPreOrder(), binaryTree.cendPreOrder()));
+	EXPECT_THAT(otherBinaryTree.getNodeCount(), testing::Eq(4));
+}
+
+TEST_F(NonEmptyIntegerBinaryTreeTest, GivenCopiedBinaryTree_WhenInsertIntoCopy_ThenOriginalIsUnchanged) {
+	auto otherBinaryTree {binaryTree};
+	otherBinaryTree.insert(60);
+	
+	EXPECT_THAT(std::vector<int>(binaryTree.cbeginLevelOrder(), binaryTree.cendLevelOrder()),
+	            testing::ElementsAre(10, 20, 30, 40, 50));
+}
 }
\ No newline at end of file
@@ -0,0 +1,174 @@
+#include <gmock/gmock.h>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cmath>
+#include <memory>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include "DataStructures/Trees/PersistentAVLTree.hpp"
+
+namespace Core::DataStructures::Trees::Test {
+class NonEmptyIntegerPersistentAVLTreeTest : public testing::Test {
+public:
+	NonEmptyIntegerPersistentAVLTreeTest();
+	~NonEmptyIntegerPersistentAVLTreeTest() noexcept override = default;
+
+protected:
+	PersistentAVLTree<int> persistentAVLTree {};
+};
+
+NonEmptyIntegerPersistentAVLTreeTest::NonEmptyIntegerPersistentAVLTreeTest() {
+	const auto elements {std::array<int, 9> {0, 10, -20, 40, 30, -10, -50, -5, 50}};
+	for (const auto& element : elements) {
+		persistentAVLTree = persistentAVLTree.insert(element);
+	}
+}
+
+TEST_F(NonEmptyIntegerPersistentAVLTreeTest, WhenCopyConstruct_ThenNewPersistentAVLTreeIsEqualToOriginal) {
+	const auto otherPersistentAVLTree {persistentAVLTree};
+	
+	EXPECT_THAT(otherPersistentAVLTree, testing::Eq(persistentAVLTree));
+	EXPECT_THAT(&*otherPersistentAVLTree.cbeginLevelOrder(), testing::Eq(&*persistentAVLTree.cbeginLevelOrder()));
+}
+
+TEST_F(NonEmptyIntegerPersistentAVLTreeTest, GivenInteger_WhenInsert_ThenPreviousVersionIsUnchanged) {
+	const auto newPersistentAVLTree {persistentAVLTree.insert(20)};
+	
+	EXPECT_THAT(std::vector<int>(newPersistentAVLTree.cbeginInOrder(), newPersistentAVLTree.cendInOrder()),
+	            testing::ElementsAre(-50, -20, -10, -5, 0, 10, 20, 30, 40, 50));
+	EXPECT_THAT(std::vector<int>(persistentAVLTree.cbeginInOrder(), persistentAVLTree.cendInOrder()),
+	            testing::ElementsAre(-50, -20, -10, -5, 0, 10, 30, 40, 50));
+	EXPECT_THAT(persistentAVLTree.contains(20), testing::IsFalse());
+}
+
+TEST_F(NonEmptyIntegerPersistentAVLTreeTest, GivenInteger_WhenInsert_ThenNodesOffTheSearchPathAreShared) {
+	const auto newPersistentAVLTree {persistentAVLTree.insert(60)};
+	
+	std::vector<const int*> previousElements {};
+	persistentAVLTree.traverse(persistentAVLTree.cbeginPreOrder(),
+	                           persistentAVLTree.cendPreOrder(),
+	                           [&previousElements](const int& element) {
+		                           previousElements.push_back(&element);
+	                           });
+	
+	std::vector<const int*> newElements {};
+	newPersistentAVLTree.traverse(newPersistentAVLTree.cbeginPostOrder(),
+	                              newPersistentAVLTree.cendPostOrder(),
+	                              [&newElements](const int& element) {
+		                              newElements.push_back(&element);
+	                              });
+	
+	const auto sharedElementCount {std::ranges::count_if(previousElements, [&newElements](const int* element) {
+		return std::ranges::find(newElements, element) != newElements.end();
+	})};
+	
+	EXPECT_THAT(sharedElementCount, testing::Ge(persistentAVLTree.getNodeCount() - persistentAVLTree.getHeight() - 1));
+}
+
+TEST_F(NonEmptyIntegerPersistentAVLTreeTest, GivenInteger_WhenRemoveFirst_ThenPreviousVersionIsUnchanged) {
+	const auto newPersistentAVLTree {persistentAVLTree.removeFirst(0)};
+	
+	EXPECT_THAT(std::vector<int>(newPersistentAVLTree.cbeginInOrder(), newPersistentAVLTree.cendInOrder()),
+	            testing::ElementsAre(-50, -20, -10, -5, 10, 30, 40, 50));
+	EXPECT_THAT(persistentAVLTree.getNodeCount(), testing::Eq(9));
+	EXPECT_THAT(persistentAVLTree.findFirst(0), testing::Optional(0));
+}
+
+TEST_F(NonEmptyIntegerPersistentAVLTreeTest, GivenMissingInteger_WhenRemoveFirst_ThenNewVersionSharesRoot) {
+	const auto newPersistentAVLTree {persistentAVLTree.removeFirst(15)};
+	
+	EXPECT_THAT(newPersistentAVLTree, testing::Eq(persistentAVLTree));
+	EXPECT_THAT(&*newPersistentAVLTree.cbeginLevelOrder(), testing::Eq(&*persistentAVLTree.cbeginLevelOrder()));
+}
+
+TEST_F(NonEmptyIntegerPersistentAVLTreeTest, WhenRemoveMinimumAndMaximum_ThenNewVersionsLackThem) {
+	const auto withoutMinimum {persistentAVLTree.removeMinimum()};
+	const auto withoutMaximum {persistentAVLTree.removeMaximum()};
+	
+	EXPECT_THAT(withoutMinimum.findMinimum(), testing::Optional(-20));
+	EXPECT_THAT(withoutMaximum.findMaximum(), testing::Optional(40));
+	EXPECT_THAT(persistentAVLTree.findMinimum(), testing::Optional(-50));
+	EXPECT_THAT(persistentAVLTree.findMaximum(), testing::Optional(50));
+}
+
+TEST_F(NonEmptyIntegerPersistentAVLTreeTest, GivenIndexAndInteger_WhenSelectAndRank_ThenReturnPositions) {
+	EXPECT_THAT(persistentAVLTree.select(4), testing::Optional(0));
+	EXPECT_THAT(persistentAVLTree.select(9), testing::Eq(std::nullopt));
+	EXPECT_THAT(persistentAVLTree.rank(30), testing::Eq(6));
+	EXPECT_THAT(persistentAVLTree.rank(35), testing::Eq(7));
+}
+
+TEST_F(NonEmptyIntegerPersistentAVLTreeTest, GivenRandomOperations_WhenKeepEveryVersion_ThenEveryVersionIsIntact) {
+	std::mt19937 randomEngine {47};
+	std::uniform_int_distribution<int> elementDistribution {0, 200};
+	
+	std::vector<PersistentAVLTree<int>> versions {persistentAVLTree};
+	std::vector<std::vector<int>> expectedElements {{-50, -20, -10, -5, 0, 10, 30, 40, 50}};
+	
+	for (auto operation {0}; operation < 2000; ++operation) {
+		const auto element {elementDistribution(randomEngine)};
+		auto elements {expectedElements.back()};
+		
+		if (operation % 3 == 2) {
+			versions.push_back(versions.back().removeFirst(element));
+			if (const auto iterator {std::ranges::find(elements, element)}; iterator != elements.end()) {
+				elements.erase(iterator);
+			}
+		} else {
+			versions.push_back(versions.back().insert(element));
+			elements.insert(std::ranges::upper_bound(elements, element), element);
+		}
+		
+		expectedElements.push_back(std::move(elements));
+	}
+	
+	for (std::size_t version {0}; version < versions.size(); version += 97) {
+		EXPECT_THAT(std::vector<int>(versions[version].cbeginInOrder(), versions[version].cendInOrder()),
+		            testing::ElementsAreArray(expectedElements[version]));
+		EXPECT_THAT(versions[version].getHeight(),
+		            testing::Le(1.45 * std::log2(static_cast<double>(versions[version].getNodeCount() + 2))));
+	}
+}
+
+TEST_F(NonEmptyIntegerPersistentAVLTreeTest,
+       GivenConcurrentWriter_WhenReadersLoadSnapshots_ThenSnapshotsAreConsistent) {
+	std::atomic<std::shared_ptr<const PersistentAVLTree<int>>> publishedVersion {
+			std::make_shared<const PersistentAVLTree<int>>(persistentAVLTree)};
+	std::atomic<bool> isWriting {true};
+	
+	std::thread writer {[&publishedVersion, &isWriting]() {
+		auto version {*publishedVersion.load()};
+		for (auto element {100}; element < 2100; ++element) {
+			version = version.insert(element);
+			if (element % 2 == 0) {
+				version = version.removeMaximum();
+			}
+			
+			publishedVersion.store(std::make_shared<const PersistentAVLTree<int>>(version));
+		}
+		
+		isWriting.store(false);
+	}};
+	
+	std::size_t inconsistentSnapshotCount {0};
+	while (isWriting.load()) {
+		const auto snapshot {publishedVersion.load()};
+		const std::vector<int> elements(snapshot->cbeginInOrder(), snapshot->cendInOrder());
+		
+		if (elements.size() != snapshot->getNodeCount() || !std::ranges::is_sorted(elements) ||
+		    !snapshot->contains(-50)) {
+			++inconsistentSnapshotCount;
+		}
+	}
+	
+	writer.join();
+	
+	EXPECT_THAT(inconsistentSnapshotCount, testing::Eq(0));
+	EXPECT_THAT(publishedVersion.load()->getNodeCount(), testing::Eq(1009));
+	EXPECT_THAT(persistentAVLTree.getNodeCount(), testing::Eq(9));
+}
+}
\ No newline at end of file
@@ -0,0 +1,398 @@
+#include <gmock/gmock.h>
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <iterator>
+#include <random>
+#include <set>
+#include <vector>
+
+#include "DataStructures/Trees/ParentLinkedBinaryTreeNode.hpp"
+#include "DataStructures/Trees/RedBlackTree.hpp"
+
+namespace Core::DataStructures::Trees::Test {
+class NonEmptyIntegerRedBlackTreeTest : public testing::Test {
+public:
+	NonEmptyIntegerRedBlackTreeTest();
+	~NonEmptyIntegerRedBlackTreeTest() noexcept override = default;
+
+protected:
+	static std::vector<int> getLevelOrderElements(const RedBlackTree<int>& traversedRedBlackTree);
+	
+	RedBlackTree<int> redBlackTree {};
+};
+
+NonEmptyIntegerRedBlackTreeTest::NonEmptyIntegerRedBlackTreeTest() {
+	const auto elements {std::array<int, 9> {0, 10, -20, 40, 30, -10, -50, -5, 50}};
+	for (const auto& element : elements) {
+		redBlackTree.insert(element);
+	}
+}
+
+std::vector<int> NonEmptyIntegerRedBlackTreeTest::getLevelOrderElements(const RedBlackTree<int>& traversedRedBlackTree) {
+	std::vector<int> elements {};
+	for (auto iterator {traversedRedBlackTree.cbeginLevelOrder()};
+	     iterator != traversedRedBlackTree.cendLevelOrder();
+	     ++iterator) {
+		elements.push_back(*iterator);
+	}
+	
+	return elements;
+}
+
+TEST_F(NonEmptyIntegerRedBlackTreeTest, WhenCopyConstruct_ThenNewRedBlackTreeIsEqualToOriginalRedBlackTree) {
+	const auto otherRedBlackTree {redBlackTree};
+	
+	EXPECT_THAT(otherRedBlackTree, testing::Eq(redBlackTree));
+}
+
+TEST_F(NonEmptyIntegerRedBlackTreeTest, WhenCopyConstructAndRemove_ThenCopyIsRestructuredLikeOriginalRedBlackTree) {
+	auto otherRedBlackTree {redBlackTree};
+	
+	EXPECT_THAT(getLevelOrderElements(otherRedBlackTree), testing::ElementsAre(0, -20, 30, -50, -10, 10, 40, -5, 50));
+	
+	for (const auto element : {10, -50, 0, 40, -5}) {
+		redBlackTree.removeFirst(element);
+		otherRedBlackTree.removeFirst(element);
+		
+		EXPECT_THAT(getLevelOrderElements(otherRedBlackTree),
+		            testing::ElementsAreArray(getLevelOrderElements(redBlackTree)));
+	}
+}
+
+TEST_F(NonEmptyIntegerRedBlackTreeTest, WhenMoveConstruct_ThenNewRedBlackTreeIsEqualToOriginalRedBlackTree) {
+	const auto otherRedBlackTree {std::move(redBlackTree)};
+	
+	std::vector<int> elements {};
+	for (auto iterator {otherRedBlackTree.cbeginLevelOrder()};
+	     iterator != otherRedBlackTree.cendLevelOrder();
+	     ++iterator) {
+		elements.push_back(*iterator);
+	}
+	
+	EXPECT_THAT(elements, testing::ElementsAre(0, -20, 30, -50, -10, 10, 40, -5, 50));
+}
+
+TEST_F(NonEmptyIntegerRedBlackTreeTest, WhenCopyAssign_ThenNewRedBlackTreeIsEqualToOriginalRedBlackTree) {
+	const auto otherRedBlackTree = redBlackTree;
+	
+	EXPECT_THAT(otherRedBlackTree, testing::Eq(redBlackTree));
+}
+
+TEST_F(NonEmptyIntegerRedBlackTreeTest, WhenCopyAssignAndRemove_ThenCopyIsRestructuredLikeOriginalRedBlackTree) {
+	RedBlackTree<int> otherRedBlackTree {};
+	otherRedBlackTree.insert(100);
+	otherRedBlackTree = redBlackTree;
+	
+	EXPECT_THAT(getLevelOrderElements(otherRedBlackTree), testing::ElementsAre(0, -20, 30, -50, -10, 10, 40, -5, 50));
+	
+	for (const auto element : {10, -50, 0, 40, -5}) {
+		redBlackTree.removeFirst(element);
+		otherRedBlackTree.removeFirst(element);
+		
+		EXPECT_THAT(getLevelOrderElements(otherRedBlackTree),
+		            testing::ElementsAreArray(getLevelOrderElements(redBlackTree)));
+	}
+}
+
+TEST_F(NonEmptyIntegerRedBlackTreeTest, WhenMoveAssign_ThenNewRedBlackTreeIsEqualToOriginalRedBlackTree) {
+	const auto otherRedBlackTree = std::move(redBlackTree);
+	
+	std::vector<int> elements {};
+	for (auto iterator {otherRedBlackTree.cbeginLevelOrder()};
+	     iterator != otherRedBlackTree.cendLevelOrder();
+	     ++iterator) {
+		elements.push_back(*iterator);
+	}
+	
+	EXPECT_THAT(elements, testing::ElementsAre(0, -20, 30, -50, -10, 10, 40, -5, 50));
+}
+
+TEST_F(NonEmptyIntegerRedBlackTreeTest, GivenTwoNonEqualNonEmptyIntegerRedBlackTrees_WhenCompare_ThenReturnsFalse) {
+	RedBlackTree<int> otherRedBlackTree {};
+	const auto elements {std::array<int, 9> {50, 40, 30, 20, 10, 0, -10, -20, -50}};
+	for (const auto& element : elements) {
+		otherRedBlackTree.insert(element);
+	}
+	
+	EXPECT_THAT(redBlackTree, testing::Ne(otherRedBlackTree));
+}
+
+TEST_F(NonEmptyIntegerRedBlackTreeTest, GivenTwoEqualNonEmptyIntegerRedBlackTrees_WhenCompare_ThenReturnsTrue) {
+	RedBlackTree<int> otherRedBlackTree {};
+	const auto elements {std::array<int, 9> {50, 40, 30, -5, 10, 0, -10, -20, -50}};
+	for (const auto& element : elements) {
+		otherRedBlackTree.insert(element);
+	}
+	
+	EXPECT_THAT(redBlackTree, testing::Eq(otherRedBlackTree));
+}
+
+TEST_F(NonEmptyIntegerRedBlackTreeTest, GivenInteger_WhenInsert_ThenSizeIsIncremented) {
+	redBlackTree.insert(5);
+	const auto size {redBlackTree.getNodeCount()};
+	
+	EXPECT_THAT(size, testing::Eq(10));
+}
+
+TEST_F(NonEmptyIntegerRedBlackTreeTest,
+       GivenInteger_WhenInsertAndLeftRotationIsPerformed_ThenElementsAreInExpectedOrder) {
+	redBlackTree.insert(60);
+	
+	std::vector<int> elements {};
+	for (auto iterator {redBlackTree.cbeginLevelOrder()}; iterator != redBlackTree.cendLevelOrder(); ++iterator) {
+		elements.push_back(*iterator);
+	}
+	
+	EXPECT_THAT(elements, testing::ElementsAre(0, -20, 30, -50, -10, 10, 50, -5, 40, 60));
+}
+
+TEST_F(NonEmptyIntegerRedBlackTreeTest,
+       GivenInteger_WhenInsertAndRightAndLeftRotationsArePerformed_ThenElementsAreInExpectedOrder) {
+	redBlackTree.insert(45);
+	
+	std::vector<int> elements {};
+	for (auto iterator {redBlackTree.cbeginLevelOrder()}; iterator != redBlackTree.cendLevelOrder(); ++iterator) {
+		elements.push_back(*iterator);
+	}
+	
+	EXPECT_THAT(elements, testing::ElementsAre(0, -20, 30, -50, -10, 10, 45, -5, 40, 50));
+}
+
+TEST_F(NonEmptyIntegerRedBlackTreeTest, GivenInteger_WhenRemoveFirst_ThenReturnsElement) {
+	const auto result {redBlackTree.removeFirst(-5)};
+	
+	EXPECT_THAT(result, testing::Optional(-5));
+}
+
+TEST_F(NonEmptyIntegerRedBlackTreeTest, GivenInteger_WhenRemoveFirst_ThenSizeIsDecremented) {
+	redBlackTree.removeFirst(-5);
+	const auto size {redBlackTree.getNodeCount()};
+	
+	EXPECT_THAT(size, testing::Eq(8));
+}
+
+TEST_F(NonEmptyIntegerRedBlackTreeTest, GivenIntegerMatchingNoElements_WhenRemoveFirst_ThenReturnsNullOptional) {
+	const auto result {redBlackTree.removeFirst(100)};
+	
+	EXPECT_THAT(result, testing::Eq(std::nullopt));
+}
+
+TEST_F(NonEmptyIntegerRedBlackTreeTest, GivenBlackLeaf_WhenRemoveFirst_ThenElementsAreInExpectedOrder) {
+	const auto result {redBlackTree.removeFirst(10)};
+	
+	ASSERT_THAT(result, testing::Optional(10));
+	
+	std::vector<int> elements {};
+	for (auto iterator {redBlackTree.cbeginLevelOrder()}; iterator != redBlackTree.cendLevelOrder(); ++iterator) {
+		elements.push_back(*iterator);
+	}
+	
+	EXPECT_THAT(elements, testing::ElementsAre(0, -20, 40, -50, -10, 30, 50, -5));
+}
+
+TEST_F(NonEmptyIntegerRedBlackTreeTest, GivenRootWithTwoChildren_WhenRemoveFirst_ThenElementsAreInExpectedOrder) {
+	const auto result {redBlackTree.removeFirst(0)};
+	
+	ASSERT_THAT(result, testing::Optional(0));
+	
+	std::vector<int> elements {};
+	for (auto iterator {redBlackTree.cbeginLevelOrder()}; iterator != redBlackTree.cendLevelOrder(); ++iterator) {
+		elements.push_back(*iterator);
+	}
+	
+	EXPECT_THAT(elements, testing::ElementsAre(10, -20, 40, -50, -10, 30, 50, -5));
+}
+
+TEST_F(NonEmptyIntegerRedBlackTreeTest, WhenRemoveMinimum_ThenReturnsElement) {
+	const auto result {redBlackTree.removeMinimum()};
+	
+	EXPECT_THAT(result, testing::Optional(-50));
+}
+
+TEST_F(NonEmptyIntegerRedBlackTreeTest, WhenRemoveMinimum_ThenSizeIsDecremented) {
+	redBlackTree.removeMinimum();
+	const auto size {redBlackTree.getNodeCount()};
+	
+	EXPECT_THAT(size, testing::Eq(8));
+}
+
+TEST_F(NonEmptyIntegerRedBlackTreeTest, WhenRemoveMaximum_ThenReturnsElement) {
+	const auto result {redBlackTree.removeMaximum()};
+	
+	EXPECT_THAT(result, testing::Optional(50));
+}
+
+TEST_F(NonEmptyIntegerRedBlackTreeTest, WhenRemoveMaximum_ThenSizeIsDecremented) {
+	redBlackTree.removeMaximum();
+	const auto size {redBlackTree.getNodeCount()};
+	
+	EXPECT_THAT(size, testing::Eq(8));
+}
+
+TEST_F(NonEmptyIntegerRedBlackTreeTest, WhenRemoveMinimumUntilEmpty_ThenElementsAreReturnedInAscendingOrder) {
+	std::vector<int> elements {};
+	while (const auto element {redBlackTree.removeMinimum()}) {
+		elements.push_back(*element);
+	}
+	
+	EXPECT_THAT(elements, testing::ElementsAre(-50, -20, -10, -5, 0, 10, 30, 40, 50));
+	EXPECT_THAT(redBlackTree.isEmpty(), testing::IsTrue());
+}
+
+TEST_F(NonEmptyIntegerRedBlackTreeTest, WhenRemoveAll_ThenReturnsElementsInPostOrder) {
+	const auto result {redBlackTree.removeAll()};
+	
+	EXPECT_THAT(result, testing::ElementsAre(-50, -5, -10, -20, 10, 50, 40, 30, 0));
+}
+
+TEST_F(NonEmptyIntegerRedBlackTreeTest, WhenRemoveAll_ThenSizeIsZero) {
+	redBlackTree.removeAll();
+	const auto size {redBlackTree.getNodeCount()};
+	
+	EXPECT_THAT(size, testing::Eq(0));
+}
+
+TEST_F(NonEmptyIntegerRedBlackTreeTest, GivenIntegerMatchingAtLeastOneElement_WhenFindFirst_ThenReturnsElement) {
+	const auto result {redBlackTree.findFirst(50)};
+	
+	EXPECT_THAT(result, testing::Optional(50));
+}
+
+TEST_F(NonEmptyIntegerRedBlackTreeTest, GivenIntegerMatchingNoElements_WhenFindFirst_ThenReturnsNullOptional) {
+	const auto result {redBlackTree.findFirst(100)};
+	
+	EXPECT_THAT(result, testing::Eq(std::nullopt));
+}
+
+TEST_F(NonEmptyIntegerRedBlackTreeTest, WhenFindMinimum_ThenReturnsElement) {
+	const auto result {redBlackTree.findMinimum()};
+	
+	EXPECT_THAT(result, testing::Optional(-50));
+}
+
+TEST_F(NonEmptyIntegerRedBlackTreeTest, WhenFindMaximum_ThenReturnsElement) {
+	const auto result {redBlackTree.findMaximum()};
+	
+	EXPECT_THAT(result, testing::Optional(50));
+}
+
+TEST_F(NonEmptyIntegerRedBlackTreeTest,
+       GivenConstFunctionToApplyToEachElement_WhenConstTraverse_ThenFunctionIsAppliedToEachElement) {
+	std::vector<int> elements {};
+	const auto pushBack {[&elements](const int& element) {
+		elements.push_back(element);
+	}};
+	
+	const auto& constRedBlackTree {redBlackTree};
+	constRedBlackTree.traverse(constRedBlackTree.cbeginInOrder(), constRedBlackTree.cendInOrder(), pushBack);
+	
+	EXPECT_THAT(elements, testing::ElementsAre(-50, -20, -10, -5, 0, 10, 30, 40, 50));
+}
+
+TEST_F(NonEmptyIntegerRedBlackTreeTest,
+       GivenFunctionToApplyToEachElement_WhenTraverse_ThenFunctionIsAppliedToEachElement) {
+	const auto doubleElement {[](int& element) {
+		element = element * 2;
+	}};
+	
+	redBlackTree.traverse(redBlackTree.beginInOrder(), redBlackTree.endInOrder(), doubleElement);
+	
+	std::vector<int> elements {};
+	for (auto iterator {redBlackTree.cbeginInOrder()}; iterator != redBlackTree.cendInOrder(); ++iterator) {
+		elements.push_back(*iterator);
+	}
+	
+	EXPECT_THAT(elements, testing::ElementsAre(-100, -40, -20, -10, 0, 20, 60, 80, 100));
+}
+
+TEST_F(NonEmptyIntegerRedBlackTreeTest, GivenIntegerMatchingAtLeastOneElement_WhenContains_ThenReturnsTrue) {
+	const auto contains {redBlackTree.contains(50)};
+	
+	EXPECT_THAT(contains, testing::IsTrue());
+}
+
+TEST_F(NonEmptyIntegerRedBlackTreeTest, WhenIsEmpty_ThenReturnsFalse) {
+	const auto isEmpty {redBlackTree.isEmpty()};
+	
+	EXPECT_THAT(isEmpty, testing::IsFalse());
+}
+
+TEST_F(NonEmptyIntegerRedBlackTreeTest, WhenGetHeight_ThenReturnsHeight) {
+	const auto height {redBlackTree.getHeight()};
+	
+	EXPECT_THAT(height, testing::Eq(3));
+}
+
+TEST_F(NonEmptyIntegerRedBlackTreeTest,
+       GivenInOrderIterator_WhenInsertAndRotationsArePerformed_ThenIteratorContinuesFromSameElement) {
+	auto iterator {redBlackTree.cbeginInOrder()};
+	while (*iterator != 10) {
+		++iterator;
+	}
+	
+	for (auto element {60}; element <= 100; element += 10) {
+		redBlackTree.insert(element);
+	}
+	
+	std::vector<int> elements {};
+	for (; iterator != redBlackTree.cendInOrder(); ++iterator) {
+		elements.push_back(*iterator);
+	}
+	
+	EXPECT_THAT(elements, testing::ElementsAre(10, 30, 40, 50, 60, 70, 80, 90, 100));
+}
+
+TEST_F(NonEmptyIntegerRedBlackTreeTest, WhenGetNodeSize_ThenNodeIsNotLargerThanParentLinkedBinaryTreeNode) {
+	EXPECT_THAT(sizeof(RedBlackTreeNode<int>), testing::Le(sizeof(ParentLinkedBinaryTreeNode<int>)));
+}
+
+TEST_F(NonEmptyIntegerRedBlackTreeTest, GivenRandomInsertsAndRemovals_WhenCompareWithMultiset_ThenContentsAreEqual) {
+	std::multiset<int> multiset {redBlackTree.cbeginInOrder(), redBlackTree.cendInOrder()};
+	
+	std::mt19937 generator {42};
+	std::uniform_int_distribution<int> elementDistribution {-500, 500};
+	
+	for (auto operation {0}; operation < 20000; ++operation) {
+		const auto element {elementDistribution(generator)};
+		
+		switch (generator() % 4) {
+			case 0: {
+				const auto iterator {multiset.find(element)};
+				const auto removedElement {redBlackTree.removeFirst(element)};
+				
+				ASSERT_THAT(removedElement.has_value(), testing::Eq(iterator != multiset.end()));
+				if (iterator != multiset.end()) {
+					multiset.erase(iterator);
+				}
+				
+				break;
+			}
+			case 1: {
+				const auto isMinimum {operation % 2 == 0};
+				const auto removedElement {isMinimum ? redBlackTree.removeMinimum() : redBlackTree.removeMaximum()};
+				
+				ASSERT_THAT(removedElement.has_value(), testing::Eq(!multiset.empty()));
+				if (removedElement.has_value()) {
+					const auto iterator {isMinimum ? multiset.begin() : std::prev(multiset.end())};
+					ASSERT_THAT(*removedElement, testing::Eq(*iterator));
+					multiset.erase(iterator);
+				}
+				
+				break;
+			}
+			default: {
+				redBlackTree.insert(element);
+				multiset.insert(element);
+				break;
+			}
+		}
+	}
+	
+	ASSERT_THAT(redBlackTree.getNodeCount(), testing::Eq(multiset.size()));
+	EXPECT_THAT(std::equal(redBlackTree.cbeginInOrder(), redBlackTree.cendInOrder(), multiset.begin(), multiset.end()),
+	            testing::IsTrue());
+	EXPECT_THAT(redBlackTree.getHeight(), testing::Le(2 * static_cast<int>(std::bit_width(multiset.size() + 1))));
+}
+}
\ No newline at end of file